@@ -44,6 +44,9 @@ using namespace Data;
 // Include typemaps support
 %include <typemaps.i>
 
+// Include the array typemaps
+%include "PyFrensie_Array.i"
+
 // AtomProperties handling
 %import(module="PyFrensie.Data") Data_AtomProperties.i
 
@@ -156,11 +159,28 @@ tutorial for this class is shown below:
   }
 }
 
+// The data container getters return read-only numpy arrays that alias the
+// data container arrays (no copy). The arrays keep the data container alive
+// but they will be invalidated if the data container array is reset (e.g. by
+// a set method). Call the copy method of a returned array if an independent
+// array is needed.
+%enable_array_view_output
+
 %shared_ptr( Data::ENDLDataContainer )
 
 // Include the ENDLDataContainer
 %include "Data_ENDLDataContainer.hpp"
 
+// Restore the default (deep-copy) array output typemaps
+%disable_array_view_output
+
+// Tie the lifetime of the arrays returned by the data container getters to
+// the data container that returned them
+%pythoncode
+%{
+_manageArrayViewLifetimes(ENDLDataContainer)
+%}
+
 //---------------------------------------------------------------------------//
 // Turn off the exception handling
 //---------------------------------------------------------------------------//
@@ -31,6 +31,7 @@ FRENSIE formate data file.
 
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_MomentPreservingElectronDataContainer.hpp"
 #include "Utility_ArchivableObject.hpp"
 
 #include "Utility_SerializationHelpers.hpp"
@@ -51,6 +52,9 @@ using namespace Data;
 // Include typemaps support
 %include <typemaps.i>
 
+// Include the array typemaps
+%include "PyFrensie_Array.i"
+
 // AtomProperties handling
 %import(module="PyFrensie.Data") Data_AtomProperties.i
 
@@ -207,6 +211,13 @@ tutorial for this class is shown below:
 
 %standard_native_data_container_setup( ElectronPhotonRelaxationDataContainer, EPR )
 
+// The data container getters return read-only numpy arrays that alias the
+// data container arrays (no copy). The arrays keep the data container alive
+// (see the _manageArrayViewLifetimes calls below) but they will be invalidated
+// if the data container array is reset (e.g. by a set method). Call the copy
+// method of a returned array if an independent array is needed.
+%enable_array_view_output
+
 %shared_ptr(Data::ElectronPhotonRelaxationDataContainer);
 
 // Include the ElectronPhotonRelaxationDataContainer
@@ -239,6 +250,44 @@ tutorial for this class is shown below:
 // Include the ElectronPhotonRelaxationDataContainer
 %include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 
+//---------------------------------------------------------------------------//
+// Add support for the MomentPreservingElectronDataContainer
+//---------------------------------------------------------------------------//
+// Add a more detailed docstring for the MomentPreservingElectronDataContainer
+%feature("docstring")
+Data::MomentPreservingElectronDataContainer
+"
+The MomentPreservingElectronDataContainer can be used to read in a Native
+format moment preserving electron data file and extract the data contained in
+it. A brief usage tutorial for this class is shown below:
+
+  import PyFrensie.Data.Native, numpy, matplotlib.pyplot
+
+  h_mp_native_data = PyFrensie.Data.Native.MomentPreservingElectronDataContainer( 'h_mp_native_file_name' )
+
+  matplotlib.pyplot.plot( h_mp_native_data.getMomentPreservingDiscreteAngles( 0 ), h_mp_native_data.getMomentPreservingWeights( 0 ) )
+  matplotlib.pyplot.show()
+"
+
+%standard_native_data_container_setup( MomentPreservingElectronDataContainer, MP )
+
+%shared_ptr(Data::MomentPreservingElectronDataContainer);
+
+// Include the MomentPreservingElectronDataContainer
+%include "Data_MomentPreservingElectronDataContainer.hpp"
+
+// Restore the default (deep-copy) array output typemaps
+%disable_array_view_output
+
+// Tie the lifetime of the arrays returned by the data container getters to
+// the data container that returned them
+%pythoncode
+%{
+_manageArrayViewLifetimes(ElectronPhotonRelaxationDataContainer)
+_manageArrayViewLifetimes(AdjointElectronPhotonRelaxationDataContainer)
+_manageArrayViewLifetimes(MomentPreservingElectronDataContainer)
+%}
+
 //---------------------------------------------------------------------------//
 // Turn off the exception handling
 //---------------------------------------------------------------------------//
@@ -320,6 +320,13 @@ typedef long unsigned int uint64_t;
   %append_output(PyFrensie::convertToPython( *$1 ));
 }
 
+// The estimator moment getters return read-only numpy arrays that alias the
+// estimator moment data (no copy). The arrays keep the estimator alive (see
+// the _manageArrayViewLifetimes calls below) but they will be invalidated if
+// the estimator moments are reset or resized. Call the copy method of a
+// returned array if an independent array is needed.
+%enable_array_view_output
+
 %shared_ptr( MonteCarlo::Estimator )
 %include "MonteCarlo_Estimator.hpp"
 
@@ -473,6 +480,22 @@ typedef long unsigned int uint64_t;
 // The multiplied cell collision flux estimators
 %post_estimator_setup_helper( MeshTrackLengthFluxEstimator )
 
+// Restore the default (deep-copy) array output typemaps
+%disable_array_view_output
+
+// Tie the lifetime of the arrays returned by the estimator getters to the
+// estimator that returned them
+%pythoncode
+%{
+def _manageEstimatorArrayViewLifetimes(cls):
+    _manageArrayViewLifetimes(cls)
+
+    for subclass in cls.__subclasses__():
+        _manageEstimatorArrayViewLifetimes(subclass)
+
+_manageEstimatorArrayViewLifetimes(Estimator)
+%}
+
 //---------------------------------------------------------------------------//
 // end MonteCarlo_Estimator.i
 //---------------------------------------------------------------------------//
@@ -126,6 +126,8 @@ using namespace MonteCarlo;
 %ignore MonteCarlo::EventHandler::enableThreadSupport;
 %ignore MonteCarlo::EventHandler::updateObserversFromParticleSimulationStartedEvent;
 %ignore MonteCarlo::EventHandler::updateObserversFromParticleSimulationStoppedEvent;
+%ignore MonteCarlo::EventHandler::updateObserversFromParticleSimulationBatchStartedEvent;
+%ignore MonteCarlo::EventHandler::updateObserversFromParticleSimulationBatchStoppedEvent;
 %ignore MonteCarlo::EventHandler::commitObserverHistoryContributions;
 %ignore MonteCarlo::EventHandler::resetObserverData;
 %ignore MonteCarlo::EventHandler::reduceObserverData;
@@ -45,6 +45,27 @@ using namespace MonteCarlo;
 
 %ignore *::getHistoryData;
 
+// The track record file reader is only available in C++
+%ignore *::readTrackRecords;
+
+// Add typemaps for converting file_path to and from Python string
+%typemap(in) const boost::filesystem::path& ( boost::filesystem::path temp ){
+  temp = PyFrensie::convertFromPython<std::string>( $input );
+  $1 = &temp;
+}
+
+%typemap(out) boost::filesystem::path {
+  %append_output(PyFrensie::convertToPython( $1.string() ) );
+}
+
+%typemap(out) const boost::filesystem::path& {
+  %append_output(PyFrensie::convertToPython( $1->string() ) );
+}
+
+%typemap(typecheck, precedence=1140) (const boost::filesystem::path&) {
+  $1 = (PyString_Check($input)) ? 1 : 0;
+}
+
 %shared_ptr(MonteCarlo::ParticleTracker)
 %include "MonteCarlo_ParticleTracker.hpp"
 
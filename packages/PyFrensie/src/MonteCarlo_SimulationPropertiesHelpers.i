@@ -52,6 +52,16 @@ MonteCarlo::PROPERTIES::setImplicitCaptureModeOn;
 %feature("autodoc", "isImplicitCaptureModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isImplicitCaptureModeOn;
 
+// Set interleaved estimator moments mode on/off
+%feature("autodoc", "setInterleavedEstimatorMomentsModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setInterleavedEstimatorMomentsModeOff;
+
+%feature("autodoc", "setInterleavedEstimatorMomentsModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setInterleavedEstimatorMomentsModeOn;
+
+%feature("autodoc", "isInterleavedEstimatorMomentsModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isInterleavedEstimatorMomentsModeOn;
+
 // Set/get max energy
 %feature("autodoc", "setNumberOfBatchesPerProcessor(PROPERTIES self, const unsigned batches_per_processor) -> void")
 MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
@@ -21,6 +21,67 @@
 // Include the std::vector class
 %include <std_vector.i>
 
+// This macro takes a C++ data type (TYPE) and defines the output typemaps
+// that deep-copy Utility::ArrayView<const TYPE> and std::vector<TYPE> data
+// into a new (owning) numpy array
+%define %array_copy_output_typemaps(TYPE)
+
+// The array view data cannot be modified and will therefore be deep-copied
+%typemap(out) Utility::ArrayView< const TYPE >
+{
+  $result = PyFrensie::Details::convertArrayToPython( $1 );
+  
+  if( !$result )
+    SWIG_fail;
+}
+
+// The supplied std_vector.i interface file does not provide support for
+// NumPy arrays - these output typemaps do.
+%typemap(out) std::vector<TYPE>
+{
+  $result = PyFrensie::convertToPython( $1 );
+
+  if( !$result )
+    SWIG_fail;
+}
+
+%typemap(out) const std::vector<TYPE>&
+{
+  $result = PyFrensie::convertToPython( *$1 );
+
+  if( !$result )
+    SWIG_fail;
+}
+
+%enddef
+
+// This macro takes a C++ data type (TYPE) and defines the output typemaps
+// that return a read-only numpy array that aliases the
+// Utility::ArrayView<const TYPE> or const std::vector<TYPE>& data (no copy).
+// The numpy array does not own the data - the python proxy object that
+// returned the array must be kept alive while the array is in use (see
+// _manageArrayViewLifetimes).
+%define %array_view_output_typemaps(TYPE)
+
+%typemap(out) Utility::ArrayView< const TYPE >
+{
+  $result = PyFrensie::Details::convertArrayViewOfConstToPython( $1 );
+
+  if( !$result )
+    SWIG_fail;
+}
+
+%typemap(out) const std::vector<TYPE>&
+{
+  $result = PyFrensie::Details::convertArrayViewOfConstToPython(
+                                              Utility::arrayViewOfConst( *$1 ) );
+
+  if( !$result )
+    SWIG_fail;
+}
+
+%enddef
+
 // This macro takes a C++ data type (TYPE) and a corresponding NumPy typecode
 // (TYPECODE) and define all of the output typemaps needed to handle
 // std::vector<TYPE> -> numpy.array( ..., dtype=TYPECODE )
@@ -95,32 +156,8 @@
     SWIG_fail;
 }
 
-// The array view data cannot be modified and will therefore be deep-copied
-%typemap(out) Utility::ArrayView< const TYPE >
-{
-  $result = PyFrensie::Details::convertArrayToPython( $1 );
-  
-  if( !$result )
-    SWIG_fail;
-}
-
-// The supplied std_vector.i interface file does not provide support for
-// NumPy arrays - these output typemaps do.
-%typemap(out) std::vector<TYPE>
-{
-  $result = PyFrensie::convertToPython( $1 );
-
-  if( !$result )
-    SWIG_fail;
-}
-
-%typemap(out) const std::vector<TYPE>&
-{
-  $result = PyFrensie::convertToPython( *$1 );
-
-  if( !$result )
-    SWIG_fail;
-}
+// The array view and std::vector output typemaps (deep-copy by default)
+%array_copy_output_typemaps(TYPE)
 
 %enddef
 
@@ -138,6 +175,84 @@
 %array_typemaps(float             , NPY_FLOAT    )
 %array_typemaps(double            , NPY_DOUBLE   )
 
+
+// Enable the zero-copy output typemaps for all types of interest. Any wrapped
+// method declared after this directive that returns a
+// Utility::ArrayView<const TYPE> or a const std::vector<TYPE>& will return a
+// read-only numpy array that aliases the C++ data. Call the copy method of the
+// returned array if an independent (writable) array is needed.
+%define %enable_array_view_output
+%array_view_output_typemaps(signed char)
+%array_view_output_typemaps(unsigned char)
+%array_view_output_typemaps(short)
+%array_view_output_typemaps(unsigned short)
+%array_view_output_typemaps(int)
+%array_view_output_typemaps(unsigned int)
+%array_view_output_typemaps(long)
+%array_view_output_typemaps(unsigned long)
+%array_view_output_typemaps(long long)
+%array_view_output_typemaps(unsigned long long)
+%array_view_output_typemaps(float)
+%array_view_output_typemaps(double)
+%enddef
+
+// Restore the default (deep-copy) output typemaps for all types of interest
+%define %disable_array_view_output
+%array_copy_output_typemaps(signed char)
+%array_copy_output_typemaps(unsigned char)
+%array_copy_output_typemaps(short)
+%array_copy_output_typemaps(unsigned short)
+%array_copy_output_typemaps(int)
+%array_copy_output_typemaps(unsigned int)
+%array_copy_output_typemaps(long)
+%array_copy_output_typemaps(unsigned long)
+%array_copy_output_typemaps(long long)
+%array_copy_output_typemaps(unsigned long long)
+%array_copy_output_typemaps(float)
+%array_copy_output_typemaps(double)
+%enddef
+
+// The numpy arrays returned by the zero-copy output typemaps do not own their
+// data. These helpers tie the lifetime of the python proxy object that
+// returned an array (and therefore the C++ object that owns the data) to the
+// lifetime of the array.
+%pythoncode
+%{
+import functools as _functools
+import numpy as _numpy
+
+class _ArrayViewOwner(object):
+    """Exposes a numpy array view through the array interface while holding a
+    reference to the object that owns the viewed data."""
+    def __init__(self, view, owner):
+        self.__array_interface__ = view.__array_interface__
+        self._view = view
+        self._owner = owner
+
+def _attachArrayViewOwner(value, owner):
+    """Attach the owner to a numpy array that aliases the owner's data."""
+    if isinstance(value, _numpy.ndarray) and value.base is None and not value.flags.owndata:
+        return _numpy.asarray(_ArrayViewOwner(value, owner))
+    else:
+        return value
+
+def _manageArrayViewLifetimes(cls):
+    """Wrap each get method of the class so that the arrays that it returns
+    keep the proxy object that returned them alive. The arrays will still be
+    invalidated if the C++ data that they alias is resized or reset (e.g. by
+    calling a set method)."""
+    def _wrapMethod(method):
+        @_functools.wraps(method)
+        def _wrapper(self, *args, **kwargs):
+            return _attachArrayViewOwner(method(self, *args, **kwargs), self)
+        return _wrapper
+
+    for name, method in list(cls.__dict__.items()):
+        if name.startswith("get") and callable(method):
+            setattr(cls, name, _wrapMethod(method))
+    return cls
+%}
+
 //---------------------------------------------------------------------------//
 // end PyFrensie_Array.i
 //---------------------------------------------------------------------------//
@@ -72,6 +72,10 @@ STLCompliantArray convertPythonToArray( PyObject* py_obj );
 template<typename T>
 PyObject* convertArrayViewToPython( const Utility::ArrayView<T>& obj );
 
+// Create a read-only Python (NumPy) view of an ArrayView of const object
+template<typename T>
+PyObject* convertArrayViewOfConstToPython( const Utility::ArrayView<const T>& obj );
+
 // Create an ArrayView object from a Python object
 template<typename T>
 Utility::ArrayView<T> convertPythonToArrayView( PyObject* py_obj );
@@ -401,6 +401,41 @@ PyObject* convertArrayViewToPython( const Utility::ArrayView<T>& obj )
   return PyArray_SimpleNewFromData( 1, dims, typecode, (void*)obj.data() );
 }
 
+// Create a read-only Python (NumPy) view of an ArrayView of const object
+/*! \details The array view data will not be deep-copied. The returned NumPy
+ * array aliases the array view data and is flagged as read-only. The NumPy
+ * array does not own the data - the owner of the data must be kept alive
+ * for as long as the NumPy array is in use (call the NumPy array copy
+ * method if an independent array is needed).
+ */
+template<typename T>
+PyObject* convertArrayViewOfConstToPython(
+                                      const Utility::ArrayView<const T>& obj )
+{
+  TEST_FOR_EXCEPTION( obj.size() > std::numeric_limits<npy_intp>::max(),
+                      std::runtime_error,
+                      "The object is too big to convert to a numpy array ("
+                      << obj.size() << " > "
+                      << std::numeric_limits<npy_intp>::max() << ")!" );
+
+  npy_intp dims[1] = { static_cast<npy_intp>(obj.size()) };
+  int typecode = numpyTypecode( T() );
+
+  // An empty view may not have any data - NumPy will allocate an empty array
+  if( obj.size() == 0 )
+    return PyArray_SimpleNew( 1, dims, typecode );
+
+  return PyArray_New( &PyArray_Type,
+                      1,
+                      dims,
+                      typecode,
+                      NULL,
+                      (void*)obj.data(),
+                      0,
+                      NPY_ARRAY_CARRAY_RO,
+                      NULL );
+}
+
 // Create a Python (NumPy) object from a fixed size array object
 template<typename FixedSizeArray>
 PyObject* convertFixedSizeArrayToPython( const FixedSizeArray& obj )
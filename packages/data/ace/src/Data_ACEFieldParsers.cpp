@@ -0,0 +1,312 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACEFieldParsers.cpp
+//! \author Alex Robinson
+//! \brief  The ACE fixed width field parser definitions.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Data_ACEFieldParsers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Data{
+
+namespace{
+
+//! The exactly representable powers of ten
+const double s_exact_powers_of_ten[] =
+  {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+//! The max mantissa that can be exactly represented by a double
+const uint64_t s_max_exact_mantissa = (uint64_t(1) << 53);
+
+//! The max number of significant digits that can be stored in the mantissa
+const int s_max_significant_digits = 19;
+
+//! Check if a character is a fortran blank
+inline bool isBlank( const char character )
+{
+  return character == ' ' || character == '\t' || character == '\r';
+}
+
+//! Check if a character is a digit
+inline bool isDigit( const char character )
+{
+  return character >= '0' && character <= '9';
+}
+
+//! Remove the leading and trailing blanks from a field
+inline void trimField( const char*& field_start, const char*& field_end )
+{
+  while( field_start != field_end && isBlank( *field_start ) )
+    ++field_start;
+
+  while( field_end != field_start && isBlank( *(field_end-1) ) )
+    --field_end;
+}
+
+//! Parse a real field using std::strtod (slow path)
+double parseRealFieldUsingStrtod( const char* field_start,
+                                  const char* field_end,
+                                  const char* exponent_start,
+                                  const bool exponent_has_letter )
+{
+  std::string normalized_field( field_start, exponent_start );
+
+  if( exponent_start != field_end )
+  {
+    normalized_field.push_back( 'E' );
+
+    if( exponent_has_letter )
+      ++exponent_start;
+
+    normalized_field.append( exponent_start, field_end );
+  }
+
+  return std::strtod( normalized_field.c_str(), NULL );
+}
+
+} // end anonymous namespace
+
+// Parse a fortran real field (e.g. G20.0, F11.0)
+double parseFortranRealField( const char* field_start,
+                              const char* field_end )
+{
+  const char* const original_field_start = field_start;
+  const char* const original_field_end = field_end;
+
+  trimField( field_start, field_end );
+
+  // A blank field is zero
+  if( field_start == field_end )
+    return 0.0;
+
+  const char* it = field_start;
+
+  bool negative = false;
+
+  if( *it == '+' || *it == '-' )
+  {
+    negative = (*it == '-');
+    ++it;
+  }
+
+  uint64_t mantissa = 0;
+  int significant_digits = 0;
+  int decimal_exponent = 0;
+  bool digits_found = false;
+  bool mantissa_truncated = false;
+
+  // Parse the integer part
+  while( it != field_end && isDigit( *it ) )
+  {
+    const unsigned digit = *it - '0';
+    digits_found = true;
+
+    if( mantissa != 0 || digit != 0 )
+    {
+      if( significant_digits < s_max_significant_digits )
+      {
+        mantissa = 10*mantissa + digit;
+        ++significant_digits;
+      }
+      else
+      {
+        ++decimal_exponent;
+
+        if( digit != 0 )
+          mantissa_truncated = true;
+      }
+    }
+
+    ++it;
+  }
+
+  // Parse the fractional part
+  if( it != field_end && *it == '.' )
+  {
+    ++it;
+
+    while( it != field_end && isDigit( *it ) )
+    {
+      const unsigned digit = *it - '0';
+      digits_found = true;
+
+      if( mantissa == 0 && digit == 0 )
+        --decimal_exponent;
+      else if( significant_digits < s_max_significant_digits )
+      {
+        mantissa = 10*mantissa + digit;
+        ++significant_digits;
+        --decimal_exponent;
+      }
+      else if( digit != 0 )
+        mantissa_truncated = true;
+
+      ++it;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !digits_found,
+                      std::runtime_error,
+                      "ACE real field '"
+                      << std::string( original_field_start,
+                                      original_field_end )
+                      << "' is not valid!" );
+
+  // Parse the exponent
+  const char* exponent_start = it;
+  bool exponent_has_letter = false;
+  int exponent = 0;
+
+  if( it != field_end )
+  {
+    if( *it == 'E' || *it == 'e' || *it == 'D' || *it == 'd' )
+    {
+      exponent_has_letter = true;
+      ++it;
+    }
+
+    bool negative_exponent = false;
+
+    if( it != field_end && (*it == '+' || *it == '-') )
+    {
+      negative_exponent = (*it == '-');
+      ++it;
+    }
+
+    TEST_FOR_EXCEPTION( it == field_end || !isDigit( *it ),
+                        std::runtime_error,
+                        "ACE real field '"
+                        << std::string( original_field_start,
+                                        original_field_end )
+                        << "' has an invalid exponent!" );
+
+    while( it != field_end && isDigit( *it ) )
+    {
+      // Cap the exponent - anything this large will over/underflow anyway
+      if( exponent < 10000 )
+        exponent = 10*exponent + (*it - '0');
+
+      ++it;
+    }
+
+    if( negative_exponent )
+      exponent = -exponent;
+  }
+
+  TEST_FOR_EXCEPTION( it != field_end,
+                      std::runtime_error,
+                      "ACE real field '"
+                      << std::string( original_field_start,
+                                      original_field_end )
+                      << "' is not valid!" );
+
+  if( mantissa == 0 )
+    return negative ? -0.0 : 0.0;
+
+  decimal_exponent += exponent;
+
+  // Fast path: both the mantissa and the power of ten are exact so the
+  // result will be correctly rounded
+  if( !mantissa_truncated &&
+      mantissa <= s_max_exact_mantissa &&
+      decimal_exponent >= -22 &&
+      decimal_exponent <= 22 )
+  {
+    double value = static_cast<double>( mantissa );
+
+    if( decimal_exponent < 0 )
+      value /= s_exact_powers_of_ten[-decimal_exponent];
+    else
+      value *= s_exact_powers_of_ten[decimal_exponent];
+
+    return negative ? -value : value;
+  }
+  else
+  {
+    return parseRealFieldUsingStrtod( field_start,
+                                      field_end,
+                                      exponent_start,
+                                      exponent_has_letter );
+  }
+}
+
+// Parse a fortran integer field (e.g. I7, I9)
+int parseFortranIntegerField( const char* field_start,
+                              const char* field_end )
+{
+  const char* const original_field_start = field_start;
+  const char* const original_field_end = field_end;
+
+  trimField( field_start, field_end );
+
+  // A blank field is zero
+  if( field_start == field_end )
+    return 0;
+
+  const char* it = field_start;
+
+  bool negative = false;
+
+  if( *it == '+' || *it == '-' )
+  {
+    negative = (*it == '-');
+    ++it;
+  }
+
+  TEST_FOR_EXCEPTION( it == field_end,
+                      std::runtime_error,
+                      "ACE integer field '"
+                      << std::string( original_field_start,
+                                      original_field_end )
+                      << "' is not valid!" );
+
+  long long value = 0;
+
+  while( it != field_end )
+  {
+    TEST_FOR_EXCEPTION( !isDigit( *it ),
+                        std::runtime_error,
+                        "ACE integer field '"
+                        << std::string( original_field_start,
+                                        original_field_end )
+                        << "' is not valid!" );
+
+    value = 10*value + (*it - '0');
+
+    TEST_FOR_EXCEPTION( value > std::numeric_limits<int>::max(),
+                        std::runtime_error,
+                        "ACE integer field '"
+                        << std::string( original_field_start,
+                                        original_field_end )
+                        << "' is out of range!" );
+
+    ++it;
+  }
+
+  return negative ? -static_cast<int>( value ) : static_cast<int>( value );
+}
+
+// Extract a fortran character field (trailing and leading blanks removed)
+std::string extractFortranCharacterField( const char* field_start,
+                                          const char* field_end )
+{
+  trimField( field_start, field_end );
+
+  return std::string( field_start, field_end );
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_ACEFieldParsers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,53 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACEFieldParsers.hpp
+//! \author Alex Robinson
+//! \brief  The ACE fixed width field parser declarations.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_ACE_FIELD_PARSERS_HPP
+#define DATA_ACE_FIELD_PARSERS_HPP
+
+// Std Lib Includes
+#include <string>
+
+namespace Data{
+
+/*! Parse a fortran real field (e.g. G20.0, F11.0)
+ *
+ * \details Leading and trailing blanks are ignored and a blank field is
+ * treated as zero (the fortran default). The exponent can be introduced with
+ * 'E', 'e', 'D' or 'd' or with only its sign (e.g. 1.0-11). When the
+ * decimal digits of the field form an integer mantissa that is no larger than
+ * 2^53 (i.e. it is exactly representable by a double) and the net decimal
+ * exponent magnitude is at most 22, the field is converted exactly with a
+ * single floating point multiplication or division. This covers every value
+ * written by NJOY (which never writes more than 15 significant digits). All
+ * other fields (including fields with more than 19 significant digits) fall
+ * back to std::strtod. A std::runtime_error will be thrown if the field is
+ * not a valid real number.
+ */
+double parseFortranRealField( const char* field_start,
+                              const char* field_end );
+
+/*! Parse a fortran integer field (e.g. I7, I9)
+ *
+ * \details Leading and trailing blanks are ignored and a blank field is
+ * treated as zero (the fortran default). A std::runtime_error will be thrown
+ * if the field is not a valid integer.
+ */
+int parseFortranIntegerField( const char* field_start,
+                              const char* field_end );
+
+//! Extract a fortran character field (trailing and leading blanks removed)
+std::string extractFortranCharacterField( const char* field_start,
+                                          const char* field_end );
+
+} // end Data namespace
+
+#endif // end DATA_ACE_FIELD_PARSERS_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_ACEFieldParsers.hpp
+//---------------------------------------------------------------------------//
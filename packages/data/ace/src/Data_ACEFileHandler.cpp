@@ -8,30 +8,146 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
-#include <boost/algorithm/string.hpp>
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
-#include "Data_ACEHelperWrappers.hpp"
+#include "Data_ACEFieldParsers.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
 
 namespace Data{
 
+namespace{
+
+//! The size of the binary (type 2) table header (bytes)
+const size_t s_binary_header_size = 10 + 2*sizeof(double) + 10 + 70 + 10 +
+  16*(sizeof(int32_t) + sizeof(double)) + 16*sizeof(int32_t) +
+  32*sizeof(int32_t);
+
+//! Get a fixed width field (fortran pads short lines with blanks)
+inline void getField( const char* line_start,
+                      const char* line_end,
+                      const size_t field_offset,
+                      const size_t field_width,
+                      const char*& field_start,
+                      const char*& field_end )
+{
+  const size_t line_length = line_end - line_start;
+
+  field_start = line_start + std::min( field_offset, line_length );
+  field_end = line_start + std::min( field_offset + field_width, line_length );
+}
+
+//! Move to the next line of the library
+inline void moveToNextLine( const ACELibraryFile& library,
+                            const char*& line_start,
+                            const char*& line_end )
+{
+  TEST_FOR_EXCEPTION( line_end == library.end(),
+                      std::runtime_error,
+                      "ACE file " << library.getPath().string() <<
+                      " ended unexpectedly!" );
+
+  line_start = line_end + 1;
+  line_end = library.getLineEnd( line_start );
+}
+
+//! Parse an array that is stored in fixed width fields
+template<typename T, typename FieldParser>
+void parseFixedWidthArray( const ACELibraryFile& library,
+                           const size_t fields_per_line,
+                           const size_t field_width,
+                           FieldParser field_parser,
+                           const char*& line_start,
+                           const char*& line_end,
+                           T* values,
+                           const size_t number_of_values )
+{
+  const char* field_start;
+  const char* field_end;
+
+  size_t i = 0;
+
+  while( true )
+  {
+    for( size_t j = 0; j < fields_per_line && i < number_of_values; ++j, ++i )
+    {
+      getField( line_start, line_end, j*field_width, field_width,
+                field_start, field_end );
+
+      values[i] = field_parser( field_start, field_end );
+    }
+
+    if( i == number_of_values )
+      break;
+
+    moveToNextLine( library, line_start, line_end );
+  }
+}
+
+//! Copy a value from a binary record
+template<typename T>
+inline void copyFromRecord( const char*& record_position, T& value )
+{
+  std::memcpy( &value, record_position, sizeof(T) );
+
+  record_position += sizeof(T);
+}
+
+//! Copy a character field from a binary record
+inline void copyFromRecord( const char*& record_position,
+                            const size_t field_width,
+                            std::string& value )
+{
+  value = extractFortranCharacterField( record_position,
+                                        record_position + field_width );
+
+  record_position += field_width;
+}
+
+} // end anonymous namespace
+
+// Initialize static member data
+const size_t ACEFileHandler::s_default_binary_record_length = 4096;
+const size_t ACEFileHandler::s_default_binary_entries_per_record = 512;
+
 // Constructor
 ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 				const std::string& table_name,
 				const size_t table_start_line,
-				const bool is_ascii )
-  : d_ace_file_id( 1 ),
-    d_ace_library_name( file_name_with_path ),
-    d_ace_table_name( 10, ' ' ),
-    d_ace_table_processing_date( 10, ' ' ),
-    d_ace_table_comment( 70, ' ' ),
-    d_ace_table_material_id( 10, ' ' ),
+				const bool is_ascii,
+                                const size_t binary_record_length,
+                                const size_t binary_entries_per_record )
+  : ACEFileHandler( file_name_with_path,
+                    table_name,
+                    table_start_line,
+                    is_ascii,
+                    std::shared_ptr<ACETableCache>(),
+                    binary_record_length,
+                    binary_entries_per_record )
+{ /* ... */ }
+
+// Constructor (with an ACE table cache)
+ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+				const std::string& table_name,
+				const size_t table_start_line,
+				const bool is_ascii,
+                                const std::shared_ptr<ACETableCache>& cache,
+                                const size_t binary_record_length,
+                                const size_t binary_entries_per_record )
+  : d_ace_library_name( file_name_with_path ),
+    d_ace_table_name(),
+    d_ace_table_processing_date(),
+    d_ace_table_comment(),
+    d_ace_table_material_id(),
     d_atomic_weight_ratio( 0.0 ),
     d_temperature( 0.0*Utility::Units::MeV ),
     d_zaids(),
@@ -40,78 +156,84 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
     d_jxs(),
     d_xss( new std::vector<double> )
 {
+  // Make sure the table start is valid
+  testPrecondition( table_start_line > 0 );
+
   // Convert to the preferred path format
   d_ace_library_name.make_preferred();
-  
+
   TEST_FOR_EXCEPTION( !boost::filesystem::exists( d_ace_library_name ),
                       std::runtime_error,
                       "ACE file " << d_ace_library_name.string() <<
                       " does not exist!" );
-  
-  this->openACEFile( d_ace_library_name.string(), is_ascii );
-  this->readACETable( table_name, table_start_line );
+
+  // Restore the table from the cache if possible
+  if( cache )
+  {
+    if( cache->restoreTable( d_ace_library_name,
+                             table_name,
+                             table_start_line,
+                             is_ascii,
+                             *this ) )
+      return;
+  }
+
+  // The mapped library (and its line index) is shared with all other
+  // handlers that read tables from it
+  std::shared_ptr<const ACELibraryFile> library =
+    ACELibraryFile::getLibrary( d_ace_library_name, is_ascii );
+
+  if( is_ascii )
+    this->readAsciiACETable( *library, table_name, table_start_line );
+  else
+  {
+    this->readBinaryACETable( *library,
+                              table_name,
+                              table_start_line,
+                              binary_record_length,
+                              binary_entries_per_record );
+  }
+
+  if( cache )
+    cache->storeTable( table_start_line, is_ascii, *this );
 }
 
 // Destructor
 ACEFileHandler::~ACEFileHandler()
 {}
 
-// Open an ACE library file
-void ACEFileHandler::openACEFile( const std::string& file_name,
-				  const bool is_ascii )
-{
-  // Make sure no other ace library is open and assigned the desired id
-  testPrecondition( !fileIsOpenUsingFortran( d_ace_file_id ) );
-
-  // Binary files cannot currently be handled
-  TEST_FOR_EXCEPTION( !is_ascii,
-		      std::runtime_error,
-		      "Binary ACE files cannot currently be read ("
-                      << file_name << ")." );
-
-  // Check that the file exists
-  bool ace_file_exists = (bool)fileExistsUsingFortran( file_name.c_str(),
-						       file_name.size() );
-  TEST_FOR_EXCEPTION( !ace_file_exists,
-		      std::runtime_error,
-		      "ACE file " << file_name << " does not exists." );
-
-  // Check that the file can be opened
-  bool ace_file_is_readable =
-    (bool)fileIsReadableUsingFortran( file_name.c_str(),
-                                      file_name.size() );
-  
-  TEST_FOR_EXCEPTION( !ace_file_is_readable,
-		      std::runtime_error,
-		      "ACE file " + file_name +
-                      " exists but is not readable." );
-
-  // Open the file
-  openFileUsingFortran( file_name.c_str(), file_name.size(), d_ace_file_id );
-
-  // Make sure the ace library is open and assigned the desired id
-  testPostcondition( fileIsOpenUsingFortran( d_ace_file_id ) );
-}
-
-// Read a table in the ACE file
-void ACEFileHandler::readACETable( const std::string& table_name,
-				   const size_t table_start_line )
-{
-  testPrecondition( table_start_line <= (size_t)std::numeric_limits<int>::max() );
-  
-  // Move to the start of the ACE table in the ACE file
-  moveToLineUsingFortran( d_ace_file_id, static_cast<int>( table_start_line ) );
-
-  // Read the first line of the ACE table header
-  readAceTableHeaderLine1( d_ace_file_id,
-			   &d_ace_table_name[0],
-			   &d_atomic_weight_ratio,
-			   Utility::reinterpretAsRaw(&d_temperature),
-			   &d_ace_table_processing_date[0] );
-
-  // Clear white space from the ace table name and processing date
-  boost::algorithm::trim( d_ace_table_name );
-  boost::algorithm::trim( d_ace_table_processing_date );
+// Read the ascii (type 1) ACE table
+void ACEFileHandler::readAsciiACETable( const ACELibraryFile& library,
+                                        const std::string& table_name,
+                                        const size_t table_start_line )
+{
+  const char* line_start = library.getLineStart( table_start_line );
+  const char* line_end = library.getLineEnd( line_start );
+
+  const char* field_start;
+  const char* field_end;
+
+  try{
+    // Read the first line of the ACE table header: (A10,2G12.0,1X,A10)
+    getField( line_start, line_end, 0, 10, field_start, field_end );
+    d_ace_table_name = extractFortranCharacterField( field_start, field_end );
+
+    getField( line_start, line_end, 10, 12, field_start, field_end );
+    d_atomic_weight_ratio = parseFortranRealField( field_start, field_end );
+
+    getField( line_start, line_end, 22, 12, field_start, field_end );
+    d_temperature =
+      parseFortranRealField( field_start, field_end )*Utility::Units::MeV;
+
+    getField( line_start, line_end, 35, 10, field_start, field_end );
+    d_ace_table_processing_date =
+      extractFortranCharacterField( field_start, field_end );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "The header of the table at line "
+                           << table_start_line << " of ACE library "
+                           << d_ace_library_name.string() <<
+                           " could not be read!" );
 
   // Test that the table name is the same as the desired table name
   TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
@@ -121,45 +243,193 @@ void ACEFileHandler::readACETable( const std::string& table_name,
                       << d_ace_library_name << " but found table "
                       << d_ace_table_name << "!" );
 
-  // Read the second line of the ACE table header
-  readAceTableHeaderLine2( d_ace_file_id,
-			   &d_ace_table_comment[0],
-			   &d_ace_table_material_id[0] );
+  try{
+    // Read the second line of the ACE table header: (A70,A10)
+    moveToNextLine( library, line_start, line_end );
 
-  boost::algorithm::trim( d_ace_table_comment );
-  boost::algorithm::trim( d_ace_table_material_id );
+    getField( line_start, line_end, 0, 70, field_start, field_end );
+    d_ace_table_comment =
+      extractFortranCharacterField( field_start, field_end );
 
-  // Read the zaids and awrs
-  std::array<int,16> raw_zaids;
-  std::array<double,16> raw_atomic_weight_ratios;
-  
-  readAceTableZaidsAndAwrs( d_ace_file_id,
-			    raw_zaids.data(),
-			    raw_atomic_weight_ratios.data() );
+    getField( line_start, line_end, 70, 10, field_start, field_end );
+    d_ace_table_material_id =
+      extractFortranCharacterField( field_start, field_end );
 
+    // Read the zaids and awrs: (4(I7,F11.0)/4(I7,F11.0)/...)
+    for( size_t i = 0; i < 4; ++i )
+    {
+      moveToNextLine( library, line_start, line_end );
+
+      for( size_t j = 0; j < 4; ++j )
+      {
+        getField( line_start, line_end, j*18, 7, field_start, field_end );
+
+        const int raw_zaid = parseFortranIntegerField( field_start, field_end );
+
+        getField( line_start, line_end, j*18+7, 11, field_start, field_end );
+
+        const double raw_atomic_weight_ratio =
+          parseFortranRealField( field_start, field_end );
+
+        if( raw_zaid != 0 )
+        {
+          d_zaids.push_back( raw_zaid );
+          d_atomic_weight_ratios.push_back( raw_atomic_weight_ratio );
+        }
+      }
+    }
+
+    // Read the nxs array: (8I9/8I9)
+    moveToNextLine( library, line_start, line_end );
+
+    parseFixedWidthArray( library, 8, 9, &parseFortranIntegerField,
+                          line_start, line_end,
+                          d_nxs.data(), d_nxs.size() );
+
+    // Read the jxs array: (8I9/8I9/8I9/8I9)
+    moveToNextLine( library, line_start, line_end );
+
+    parseFixedWidthArray( library, 8, 9, &parseFortranIntegerField,
+                          line_start, line_end,
+                          d_jxs.data(), d_jxs.size() );
+
+    TEST_FOR_EXCEPTION( d_nxs[0] < 0,
+                        std::runtime_error,
+                        "The XSS array size (" << d_nxs[0] << ") is not "
+                        "valid!" );
+
+    // Read the xss array: (4G20.0)
+    d_xss->resize( d_nxs[0] );
+
+    moveToNextLine( library, line_start, line_end );
+
+    parseFixedWidthArray( library, 4, 20, &parseFortranRealField,
+                          line_start, line_end,
+                          d_xss->data(), d_xss->size() );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Table " << table_name << " in ACE library "
+                           << d_ace_library_name.string() <<
+                           " could not be read!" );
+}
+
+// Read the binary (type 2) ACE table
+void ACEFileHandler::readBinaryACETable( const ACELibraryFile& library,
+                                         const std::string& table_name,
+                                         const size_t table_start_record,
+                                         const size_t record_length,
+                                         const size_t entries_per_record )
+{
+  TEST_FOR_EXCEPTION( record_length < s_binary_header_size,
+                      std::runtime_error,
+                      "The binary ACE record length (" << record_length <<
+                      ") is too small to store the table header!" );
+
+  TEST_FOR_EXCEPTION( entries_per_record == 0 ||
+                      entries_per_record*sizeof(double) > record_length,
+                      std::runtime_error,
+                      "The number of binary ACE entries per record ("
+                      << entries_per_record << ") is not compatible with "
+                      "the record length (" << record_length << ")!" );
+
+  const char* record_position =
+    library.getRecordStart( table_start_record, record_length );
+
+  TEST_FOR_EXCEPTION( (size_t)(library.end() - record_position) < s_binary_header_size,
+                      std::runtime_error,
+                      "The header of the table at record "
+                      << table_start_record << " of ACE library "
+                      << d_ace_library_name.string() << " is truncated!" );
+
+  // Read the table name, awr, temperature and processing date
+  copyFromRecord( record_position, 10, d_ace_table_name );
+
+  TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
+                      std::runtime_error,
+                      "Expected table " << table_name << " at record "
+                      << table_start_record << " of ACE library "
+                      << d_ace_library_name << " but found table "
+                      << d_ace_table_name << "!" );
+
+  copyFromRecord( record_position, d_atomic_weight_ratio );
+
+  double raw_temperature;
+  copyFromRecord( record_position, raw_temperature );
+
+  d_temperature = raw_temperature*Utility::Units::MeV;
+
+  copyFromRecord( record_position, 10, d_ace_table_processing_date );
+
+  // Read the comment and material id
+  copyFromRecord( record_position, 70, d_ace_table_comment );
+  copyFromRecord( record_position, 10, d_ace_table_material_id );
+
+  // Read the zaids and awrs
   for( size_t i = 0; i < 16; ++i )
   {
-    if( raw_zaids[i] != 0 )
+    int32_t raw_zaid;
+    double raw_atomic_weight_ratio;
+
+    copyFromRecord( record_position, raw_zaid );
+    copyFromRecord( record_position, raw_atomic_weight_ratio );
+
+    if( raw_zaid != 0 )
     {
-      d_zaids.push_back( raw_zaids[i] );
-      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratios[i] );
+      d_zaids.push_back( raw_zaid );
+      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratio );
     }
   }
 
-  // Read the nxs array
-  readAceTableNXSArray( d_ace_file_id, d_nxs.data() );
+  // Read the nxs and jxs arrays
+  for( size_t i = 0; i < d_nxs.size(); ++i )
+  {
+    int32_t raw_value;
+    copyFromRecord( record_position, raw_value );
 
-  // Read the jxs array
-  readAceTableJXSArray( d_ace_file_id, d_jxs.data() );
+    d_nxs[i] = raw_value;
+  }
+
+  for( size_t i = 0; i < d_jxs.size(); ++i )
+  {
+    int32_t raw_value;
+    copyFromRecord( record_position, raw_value );
+
+    d_jxs[i] = raw_value;
+  }
+
+  TEST_FOR_EXCEPTION( d_nxs[0] < 0,
+                      std::runtime_error,
+                      "The XSS array size (" << d_nxs[0] << ") of table "
+                      << table_name << " in ACE library "
+                      << d_ace_library_name.string() << " is not valid!" );
 
-  // Resize the xss array
+  // Read the xss array (it starts in the record after the header record)
   d_xss->resize( d_nxs[0] );
 
-  // Read the xss array
-  readAceTableXSSArray( d_ace_file_id, d_xss->data(), d_xss->size() );
+  size_t entries_read = 0;
+  size_t record_number = table_start_record + 1;
 
-  // Close the ACE File
-  closeFileUsingFortran( d_ace_file_id );
+  while( entries_read < d_xss->size() )
+  {
+    const size_t entries_to_read =
+      std::min( entries_per_record, d_xss->size() - entries_read );
+
+    record_position = library.getRecordStart( record_number, record_length );
+
+    TEST_FOR_EXCEPTION( (size_t)(library.end() - record_position) <
+                        entries_to_read*sizeof(double),
+                        std::runtime_error,
+                        "The XSS array of table " << table_name <<
+                        " in ACE library " << d_ace_library_name.string() <<
+                        " is truncated!" );
+
+    std::memcpy( d_xss->data() + entries_read,
+                 record_position,
+                 entries_to_read*sizeof(double) );
+
+    entries_read += entries_to_read;
+    ++record_number;
+  }
 }
 
 // Get the library name
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Data_ZAID.hpp"
+#include "Data_ACELibraryFile.hpp"
 #include "Utility_ElectronVoltUnit.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Array.hpp"
@@ -25,6 +26,8 @@
 
 namespace Data{
 
+class ACETableCache;
+
 /*! \defgroup ace_table A Compact ENDF (ACE) Table
  *
  * The first line of every ACE table contains the table name, the atomic
@@ -38,8 +41,10 @@ namespace Data{
  * through twelfth lines contain the JXS array. All remaining lines in the
  * table contain the XSS array. The contents of each of these arrays depends
  * on the type of table (i.e. continuous energy neutron, continuous energy
- * photon, etc.). The task of reading in this data is handled by the
- * Data::ACEFileHandler.
+ * photon, etc.). Binary (type 2) tables store the same data in fixed length
+ * direct access records: the first record of the table contains the header
+ * data and the subsequent records contain the XSS array. The task of reading
+ * in this data is handled by the Data::ACEFileHandler.
  */
 
 //! The ACE (A Compact ENDF) file handler class
@@ -54,11 +59,43 @@ public:
   //! The energy quantity
   typedef boost::units::quantity<EnergyUnit> Energy;
 
-  //! Constructor
+  //! The default binary (type 2) library record length (bytes)
+  static const size_t s_default_binary_record_length;
+
+  //! The default number of binary (type 2) library entries per record
+  static const size_t s_default_binary_entries_per_record;
+
+  /*! Constructor
+   *
+   * \details For ascii (type 1) libraries the table start is the line
+   * where the table starts. For binary (type 2) libraries the table start is
+   * the record where the table starts (the xsdir address). Multiple handlers
+   * can be constructed concurrently (see Data::ACELibraryFile).
+   */
+  ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+		  const std::string& table_name,
+		  const size_t table_start_line,
+		  const bool is_ascii = true,
+                  const size_t binary_record_length =
+                  s_default_binary_record_length,
+                  const size_t binary_entries_per_record =
+                  s_default_binary_entries_per_record );
+
+  /*! Constructor (with an ACE table cache)
+   *
+   * \details The table will be restored from the cache if possible. If the
+   * table has to be read from the library it will be stored in the cache
+   * (see Data::ACETableCache). A null cache is allowed.
+   */
   ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 		  const std::string& table_name,
 		  const size_t table_start_line,
-		  const bool is_ascii = true );
+		  const bool is_ascii,
+                  const std::shared_ptr<ACETableCache>& cache,
+                  const size_t binary_record_length =
+                  s_default_binary_record_length,
+                  const size_t binary_entries_per_record =
+                  s_default_binary_entries_per_record );
 
   //! Destructor
   ~ACEFileHandler();
@@ -101,18 +138,22 @@ public:
 
 private:
 
-  // Open the ACE file
-  void openACEFile( const std::string& file_name,
-		    const bool is_ascii );
+  // Declare the ACE table cache as a friend (tables are restored directly)
+  friend class ACETableCache;
 
-  // Read the ACE table
-  void readACETable( const std::string& table_name,
-		     const size_t table_start_line );
+  // Read the ascii (type 1) ACE table
+  void readAsciiACETable( const ACELibraryFile& library,
+                          const std::string& table_name,
+                          const size_t table_start_line );
 
-  // The ace file id used by the ace_helpers fortran module (always set to 1)
-  int d_ace_file_id;
+  // Read the binary (type 2) ACE table
+  void readBinaryACETable( const ACELibraryFile& library,
+                           const std::string& table_name,
+                           const size_t table_start_record,
+                           const size_t record_length,
+                           const size_t entries_per_record );
 
-  // The name of the ace library that is currently open
+  // The name of the ace library that the table was read from
   boost::filesystem::path d_ace_library_name;
 
   // The name of the ace table read from the ace library
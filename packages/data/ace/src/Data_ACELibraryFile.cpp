@@ -0,0 +1,305 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACELibraryFile.cpp
+//! \author Alex Robinson
+//! \brief  The memory mapped ACE library file class definition.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Data_ACELibraryFile.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Tuple.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+namespace Data{
+
+namespace{
+
+//! The library registry key (path, size, last write time)
+typedef std::tuple<std::string,uintmax_t,std::time_t> LibraryRegistryKey;
+
+//! The library registry
+typedef std::map<LibraryRegistryKey,std::shared_ptr<const ACELibraryFile> >
+LibraryRegistry;
+
+//! Get the library registry mutex
+std::mutex& getLibraryRegistryMutex()
+{
+  static std::mutex registry_mutex;
+
+  return registry_mutex;
+}
+
+//! Get the library registry
+LibraryRegistry& getLibraryRegistry()
+{
+  static LibraryRegistry registry;
+
+  return registry;
+}
+
+} // end anonymous namespace
+
+// Initialize static member data
+const size_t ACELibraryFile::s_index_stride = 1024;
+
+// Constructor
+ACELibraryFile::ACELibraryFile( const boost::filesystem::path& file_path,
+                                const bool is_ascii )
+  : d_path( file_path ),
+    d_is_ascii( is_ascii ),
+    d_file_mapping(),
+    d_mapped_region(),
+    d_begin( NULL ),
+    d_end( NULL ),
+    d_line_index_mutex(),
+    d_line_index(),
+    d_line_index_complete( true )
+{
+  // Zero length files cannot be mapped
+  if( boost::filesystem::file_size( d_path ) > 0 )
+  {
+    try{
+      d_file_mapping.reset( new boost::interprocess::file_mapping(
+                                         d_path.string().c_str(),
+                                         boost::interprocess::read_only ) );
+
+      d_mapped_region.reset( new boost::interprocess::mapped_region(
+                                         *d_file_mapping,
+                                         boost::interprocess::read_only ) );
+    }
+    EXCEPTION_CATCH_RETHROW_AS( boost::interprocess::interprocess_exception,
+                                std::runtime_error,
+                                "ACE file " << d_path.string() <<
+                                " could not be memory mapped!" );
+
+    // The library will be read sequentially from the table start
+    d_mapped_region->advise( boost::interprocess::mapped_region::advice_sequential );
+
+    d_begin = static_cast<const char*>( d_mapped_region->get_address() );
+    d_end = d_begin + d_mapped_region->get_size();
+
+    // The first line always starts at the beginning of the file
+    d_line_index.push_back( 0 );
+    d_line_index_complete = false;
+  }
+}
+
+// Destructor
+ACELibraryFile::~ACELibraryFile()
+{ /* ... */ }
+
+// Get the shared library file associated with the file path
+/*! \details If the library has already been mapped (and it has not been
+ * modified since) the registered library will be returned. Otherwise the
+ * library will be mapped and registered.
+ */
+std::shared_ptr<const ACELibraryFile> ACELibraryFile::getLibrary(
+                                     const boost::filesystem::path& file_path,
+                                     const bool is_ascii )
+{
+  boost::filesystem::path preferred_file_path( file_path );
+  preferred_file_path.make_preferred();
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( preferred_file_path ),
+                      std::runtime_error,
+                      "ACE file " << preferred_file_path.string() <<
+                      " does not exist!" );
+
+  LibraryRegistryKey key(
+              preferred_file_path.string(),
+              boost::filesystem::file_size( preferred_file_path ),
+              boost::filesystem::last_write_time( preferred_file_path ) );
+
+  std::lock_guard<std::mutex> registry_lock( getLibraryRegistryMutex() );
+
+  LibraryRegistry& registry = getLibraryRegistry();
+
+  LibraryRegistry::iterator library_it = registry.find( key );
+
+  if( library_it == registry.end() )
+  {
+    std::shared_ptr<const ACELibraryFile> library(
+                         new ACELibraryFile( preferred_file_path, is_ascii ) );
+
+    library_it = registry.emplace( key, library ).first;
+  }
+  else
+  {
+    TEST_FOR_EXCEPTION( library_it->second->isAscii() != is_ascii,
+                        std::runtime_error,
+                        "ACE file " << preferred_file_path.string() <<
+                        " has already been mapped as a "
+                        << (library_it->second->isAscii() ?
+                            "ascii" : "binary") << " library!" );
+  }
+
+  return library_it->second;
+}
+
+// Release all libraries that are held by the registry
+/*! \details Any handlers that still use a library will keep it mapped
+ * until they are done with it.
+ */
+void ACELibraryFile::clearLibraryRegistry()
+{
+  std::lock_guard<std::mutex> registry_lock( getLibraryRegistryMutex() );
+
+  getLibraryRegistry().clear();
+}
+
+// Get the library file path
+const boost::filesystem::path& ACELibraryFile::getPath() const
+{
+  return d_path;
+}
+
+// Check if the library is an ascii (type 1) library
+bool ACELibraryFile::isAscii() const
+{
+  return d_is_ascii;
+}
+
+// Get the library size (bytes)
+size_t ACELibraryFile::getSize() const
+{
+  return d_end - d_begin;
+}
+
+// Get the start of the library data
+const char* ACELibraryFile::begin() const
+{
+  return d_begin;
+}
+
+// Get the end of the library data
+const char* ACELibraryFile::end() const
+{
+  return d_end;
+}
+
+// Get the start of the desired line (1-based)
+/*! \details The line index will only be extended up to the desired line.
+ */
+const char* ACELibraryFile::getLineStart( const size_t line_number ) const
+{
+  // Make sure the line number is valid
+  testPrecondition( line_number > 0 );
+  // Make sure that the library is an ascii library
+  testPrecondition( d_is_ascii );
+
+  const size_t line_offset = line_number - 1;
+  const size_t index_entry = line_offset/s_index_stride;
+
+  const char* line_start;
+
+  {
+    std::lock_guard<std::mutex> line_index_lock( d_line_index_mutex );
+
+    while( d_line_index.size() <= index_entry && !d_line_index_complete )
+    {
+      line_start = d_begin + d_line_index.back();
+
+      for( size_t i = 0; i < s_index_stride; ++i )
+      {
+        line_start = this->getLineEnd( line_start );
+
+        if( line_start == d_end )
+          break;
+        else
+          ++line_start;
+      }
+
+      if( line_start == d_end )
+        d_line_index_complete = true;
+      else
+        d_line_index.push_back( line_start - d_begin );
+    }
+
+    TEST_FOR_EXCEPTION( d_line_index.size() <= index_entry,
+                        std::runtime_error,
+                        "ACE file " << d_path.string() << " does not have "
+                        "line " << line_number << "!" );
+
+    line_start = d_begin + d_line_index[index_entry];
+  }
+
+  // Scan the remaining lines (the mapped data is read only so no lock needed)
+  for( size_t i = index_entry*s_index_stride; i < line_offset; ++i )
+  {
+    line_start = this->getLineEnd( line_start );
+
+    TEST_FOR_EXCEPTION( line_start == d_end,
+                        std::runtime_error,
+                        "ACE file " << d_path.string() << " does not have "
+                        "line " << line_number << "!" );
+
+    ++line_start;
+  }
+
+  TEST_FOR_EXCEPTION( line_start == d_end,
+                      std::runtime_error,
+                      "ACE file " << d_path.string() << " does not have "
+                      "line " << line_number << "!" );
+
+  return line_start;
+}
+
+// Get the end of the line that starts at the desired location
+/*! \details The returned pointer will point to the line feed character (or
+ * the end of the library if there is no line feed).
+ */
+const char* ACELibraryFile::getLineEnd( const char* line_start ) const
+{
+  // Make sure the line start is valid
+  testPrecondition( line_start >= d_begin );
+  testPrecondition( line_start <= d_end );
+
+  const char* line_end = static_cast<const char*>(
+                          std::memchr( line_start, '\n', d_end - line_start ) );
+
+  if( line_end )
+    return line_end;
+  else
+    return d_end;
+}
+
+// Get the start of the desired direct access record (1-based)
+const char* ACELibraryFile::getRecordStart( const size_t record_number,
+                                            const size_t record_length ) const
+{
+  // Make sure the record number is valid
+  testPrecondition( record_number > 0 );
+  // Make sure the record length is valid
+  testPrecondition( record_length > 0 );
+  // Make sure that the library is a binary library
+  testPrecondition( !d_is_ascii );
+
+  const size_t record_offset = (record_number - 1)*record_length;
+
+  TEST_FOR_EXCEPTION( record_offset >= this->getSize(),
+                      std::runtime_error,
+                      "ACE file " << d_path.string() << " does not have "
+                      "record " << record_number << " (record length = "
+                      << record_length << ")!" );
+
+  return d_begin + record_offset;
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_ACELibraryFile.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,126 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACELibraryFile.hpp
+//! \author Alex Robinson
+//! \brief  The memory mapped ACE library file class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_ACE_LIBRARY_FILE_HPP
+#define DATA_ACE_LIBRARY_FILE_HPP
+
+// Std Lib Includes
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <mutex>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace Data{
+
+/*! The memory mapped ACE library file
+ *
+ * \details An ACE library can contain hundreds of tables and be several GB in
+ * size. Instead of streaming through every line that precedes a table, the
+ * library is memory mapped and a sparse index of line offsets is built up
+ * lazily (the records of binary libraries are fixed length so they can be
+ * located directly). The index is memoized with the library so that every
+ * subsequent table load from the same library only has to scan at most
+ * Data::ACELibraryFile::s_index_stride lines past the nearest indexed line.
+ * All libraries are shared through a process wide registry (see
+ * Data::ACELibraryFile::getLibrary), which keeps them mapped until
+ * Data::ACELibraryFile::clearLibraryRegistry is called. All of the public
+ * member functions are thread safe.
+ */
+class ACELibraryFile
+{
+
+public:
+
+  //! Get the shared library file associated with the file path
+  static std::shared_ptr<const ACELibraryFile> getLibrary(
+                                     const boost::filesystem::path& file_path,
+                                     const bool is_ascii = true );
+
+  //! Release all libraries that are held by the registry
+  static void clearLibraryRegistry();
+
+  //! Destructor
+  ~ACELibraryFile();
+
+  //! Get the library file path
+  const boost::filesystem::path& getPath() const;
+
+  //! Check if the library is an ascii (type 1) library
+  bool isAscii() const;
+
+  //! Get the library size (bytes)
+  size_t getSize() const;
+
+  //! Get the start of the library data
+  const char* begin() const;
+
+  //! Get the end of the library data
+  const char* end() const;
+
+  //! Get the start of the desired line (1-based)
+  const char* getLineStart( const size_t line_number ) const;
+
+  //! Get the end of the line that starts at the desired location
+  const char* getLineEnd( const char* line_start ) const;
+
+  //! Get the start of the desired direct access record (1-based)
+  const char* getRecordStart( const size_t record_number,
+                              const size_t record_length ) const;
+
+  //! The number of lines between indexed line offsets
+  static const size_t s_index_stride;
+
+private:
+
+  // Constructor
+  ACELibraryFile( const boost::filesystem::path& file_path,
+                  const bool is_ascii );
+
+  // The library file path
+  boost::filesystem::path d_path;
+
+  // The library type
+  bool d_is_ascii;
+
+  // The file mapping
+  std::unique_ptr<boost::interprocess::file_mapping> d_file_mapping;
+
+  // The mapped region
+  std::unique_ptr<boost::interprocess::mapped_region> d_mapped_region;
+
+  // The start of the library data
+  const char* d_begin;
+
+  // The end of the library data
+  const char* d_end;
+
+  // The line index mutex
+  mutable std::mutex d_line_index_mutex;
+
+  // The offsets of every s_index_stride line (line 1 is stored at index 0)
+  mutable std::vector<size_t> d_line_index;
+
+  // Set when the entire library has been indexed
+  mutable bool d_line_index_complete;
+};
+
+} // end Data namespace
+
+#endif // end DATA_ACE_LIBRARY_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_ACELibraryFile.hpp
+//---------------------------------------------------------------------------//
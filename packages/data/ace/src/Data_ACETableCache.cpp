@@ -0,0 +1,652 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACETableCache.cpp
+//! \author Alex Robinson
+//! \brief  The preprocessed ACE table cache class definition.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Data_ACETableCache.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+namespace Data{
+
+namespace{
+
+//! The cache file magic string (including the null terminator)
+const char s_cache_file_magic[16] = "FRENSIE_ACE_TBL";
+
+//! The byte order mark (used to detect caches written on other platforms)
+const uint32_t s_byte_order_mark = 0x01020304;
+
+//! Compute the checksum of a block of data
+uint64_t computeChecksum( const char* data_start, const char* data_end )
+{
+  // 64-bit FNV-1a applied to 8 byte words (with extra mixing)
+  const uint64_t prime = 1099511628211ULL;
+
+  uint64_t checksum = 14695981039346656037ULL;
+
+  const char* it = data_start;
+
+  for( ; (size_t)(data_end - it) >= sizeof(uint64_t); it += sizeof(uint64_t) )
+  {
+    uint64_t word;
+    std::memcpy( &word, it, sizeof(uint64_t) );
+
+    checksum = (checksum ^ word)*prime;
+    checksum ^= (checksum >> 32);
+  }
+
+  for( ; it != data_end; ++it )
+    checksum = (checksum ^ static_cast<unsigned char>( *it ))*prime;
+
+  return checksum;
+}
+
+//! Append a value to a cache buffer
+template<typename T>
+inline void appendToBuffer( std::vector<char>& buffer, const T& value )
+{
+  const char* value_start = reinterpret_cast<const char*>( &value );
+
+  buffer.insert( buffer.end(), value_start, value_start + sizeof(T) );
+}
+
+//! Append an array to a cache buffer
+template<typename T>
+inline void appendToBuffer( std::vector<char>& buffer,
+                            const T* values,
+                            const uint64_t number_of_values )
+{
+  appendToBuffer( buffer, number_of_values );
+
+  const char* values_start = reinterpret_cast<const char*>( values );
+
+  buffer.insert( buffer.end(),
+                 values_start,
+                 values_start + number_of_values*sizeof(T) );
+}
+
+//! Append a string to a cache buffer
+inline void appendToBuffer( std::vector<char>& buffer,
+                            const std::string& value )
+{
+  appendToBuffer( buffer, value.data(), value.size() );
+}
+
+//! The cache buffer reader
+class CacheBufferReader
+{
+
+public:
+
+  //! Constructor
+  CacheBufferReader( const char* buffer_start, const char* buffer_end )
+    : d_position( buffer_start ),
+      d_end( buffer_end )
+  { /* ... */ }
+
+  //! Read a value
+  template<typename T>
+  void read( T& value )
+  {
+    this->checkRemainingBytes( sizeof(T) );
+
+    std::memcpy( &value, d_position, sizeof(T) );
+
+    d_position += sizeof(T);
+  }
+
+  //! Read an array (the array values are copied)
+  template<typename T>
+  void read( std::vector<T>& values )
+  {
+    uint64_t number_of_values;
+    const char* values_start;
+
+    this->skipArray<T>( number_of_values, values_start );
+
+    values.resize( number_of_values );
+
+    if( number_of_values > 0 )
+      std::memcpy( values.data(), values_start, number_of_values*sizeof(T) );
+  }
+
+  //! Read a string
+  void read( std::string& value )
+  {
+    uint64_t number_of_characters;
+    const char* characters_start;
+
+    this->skipArray<char>( number_of_characters, characters_start );
+
+    value.assign( characters_start, number_of_characters );
+  }
+
+  //! Skip over an array (the start of the array is returned)
+  template<typename T>
+  void skipArray( uint64_t& number_of_values, const char*& values_start )
+  {
+    this->read( number_of_values );
+
+    TEST_FOR_EXCEPTION( number_of_values > (d_end - d_position)/sizeof(T),
+                        std::runtime_error,
+                        "The cache file is truncated!" );
+
+    values_start = d_position;
+
+    d_position += number_of_values*sizeof(T);
+  }
+
+  //! Check if the end of the buffer has been reached
+  bool atEnd() const
+  { return d_position == d_end; }
+
+private:
+
+  // Check that there are enough bytes remaining
+  void checkRemainingBytes( const size_t number_of_bytes ) const
+  {
+    TEST_FOR_EXCEPTION( (size_t)(d_end - d_position) < number_of_bytes,
+                        std::runtime_error,
+                        "The cache file is truncated!" );
+  }
+
+  // The current position
+  const char* d_position;
+
+  // The end of the buffer
+  const char* d_end;
+};
+
+} // end anonymous namespace
+
+// Initialize static member data
+const uint32_t ACETableCache::s_format_version = 1;
+
+// Create a cache key from the data that identifies the cached tables
+/*! \details The key is the 16 character hex representation of the 64-bit
+ * checksum of the key data.
+ */
+std::string ACETableCache::createKey( const std::string& key_data )
+{
+  const uint64_t checksum =
+    computeChecksum( key_data.data(), key_data.data() + key_data.size() );
+
+  char key[17];
+
+  std::snprintf( key, sizeof(key), "%016llx",
+                 static_cast<unsigned long long>( checksum ) );
+
+  return std::string( key );
+}
+
+// Get the name of the cache file associated with a key
+std::string ACETableCache::getCacheFileName( const std::string& key )
+{
+  return std::string( "ace_table_cache_" ) + key + ".bin";
+}
+
+// Load a cache file (a null pointer will be returned if it does not exist)
+/*! \details The cache file will be memory mapped and the checksum, format
+ * version and key will be verified before any table is indexed. A
+ * std::runtime_error will be thrown if the cache file can't be used.
+ */
+std::shared_ptr<ACETableCache> ACETableCache::load(
+                                     const boost::filesystem::path& cache_file,
+                                     const std::string& key )
+{
+  if( !boost::filesystem::exists( cache_file ) )
+    return std::shared_ptr<ACETableCache>();
+
+  std::shared_ptr<ACETableCache> cache( new ACETableCache( key ) );
+
+  try{
+    const size_t minimum_cache_file_size = sizeof(s_cache_file_magic) +
+      2*sizeof(uint32_t) + sizeof(uint64_t);
+
+    TEST_FOR_EXCEPTION( boost::filesystem::file_size( cache_file ) <
+                        minimum_cache_file_size,
+                        std::runtime_error,
+                        "The cache file is truncated!" );
+
+    cache->d_file_mapping.reset( new boost::interprocess::file_mapping(
+                                         cache_file.string().c_str(),
+                                         boost::interprocess::read_only ) );
+
+    cache->d_mapped_region.reset( new boost::interprocess::mapped_region(
+                                         *cache->d_file_mapping,
+                                         boost::interprocess::read_only ) );
+
+    const char* cache_start =
+      static_cast<const char*>( cache->d_mapped_region->get_address() );
+
+    const char* cache_end = cache_start + cache->d_mapped_region->get_size();
+
+    // Verify the checksum (stored in the last 8 bytes)
+    const char* checksum_start = cache_end - sizeof(uint64_t);
+
+    uint64_t stored_checksum;
+    std::memcpy( &stored_checksum, checksum_start, sizeof(uint64_t) );
+
+    TEST_FOR_EXCEPTION( computeChecksum( cache_start, checksum_start ) !=
+                        stored_checksum,
+                        std::runtime_error,
+                        "The cache file checksum is not valid!" );
+
+    CacheBufferReader reader( cache_start, checksum_start );
+
+    // Verify the header
+    char magic[sizeof(s_cache_file_magic)];
+    reader.read( magic );
+
+    TEST_FOR_EXCEPTION( std::memcmp( magic, s_cache_file_magic,
+                                     sizeof(magic) ) != 0,
+                        std::runtime_error,
+                        "The file is not an ACE table cache file!" );
+
+    uint32_t format_version;
+    reader.read( format_version );
+
+    TEST_FOR_EXCEPTION( format_version != s_format_version,
+                        std::runtime_error,
+                        "The cache file format version (" << format_version <<
+                        ") is not supported (expected version "
+                        << s_format_version << ")!" );
+
+    uint32_t byte_order_mark;
+    reader.read( byte_order_mark );
+
+    TEST_FOR_EXCEPTION( byte_order_mark != s_byte_order_mark,
+                        std::runtime_error,
+                        "The cache file was written on a platform with a "
+                        "different byte order!" );
+
+    std::string stored_key;
+    reader.read( stored_key );
+
+    TEST_FOR_EXCEPTION( stored_key != key,
+                        std::runtime_error,
+                        "The cache file key (" << stored_key << ") does not "
+                        "match the expected key (" << key << ")!" );
+
+    // Index the tables
+    uint64_t number_of_tables;
+    reader.read( number_of_tables );
+
+    for( uint64_t i = 0; i < number_of_tables; ++i )
+    {
+      std::string library_path, table_name;
+      uint64_t table_start;
+      uint8_t is_ascii;
+
+      reader.read( library_path );
+      reader.read( table_name );
+      reader.read( table_start );
+      reader.read( is_ascii );
+
+      CachedTable& table =
+        cache->d_tables[std::make_tuple( library_path, table_name,
+                                         table_start, is_ascii != 0 )];
+
+      reader.read( table.library_size );
+      reader.read( table.library_write_time );
+      reader.read( table.processing_date );
+      reader.read( table.comment );
+      reader.read( table.material_id );
+      reader.read( table.atomic_weight_ratio );
+      reader.read( table.temperature );
+      reader.read( table.zaids );
+      reader.read( table.atomic_weight_ratios );
+
+      TEST_FOR_EXCEPTION( table.zaids.size() !=
+                          table.atomic_weight_ratios.size(),
+                          std::runtime_error,
+                          "The cached table " << table_name << " is not "
+                          "valid!" );
+
+      reader.read( table.nxs );
+      reader.read( table.jxs );
+
+      // The xss array is only copied when the table is restored
+      reader.skipArray<double>( table.xss_size, table.xss_start );
+
+      table.used = false;
+    }
+
+    TEST_FOR_EXCEPTION( !reader.atEnd(),
+                        std::runtime_error,
+                        "The cache file contains unexpected data!" );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "ACE table cache file " << cache_file.string() <<
+                           " could not be loaded!" );
+
+  return cache;
+}
+
+// Constructor (empty cache)
+ACETableCache::ACETableCache( const std::string& key )
+  : d_key( key ),
+    d_file_mapping(),
+    d_mapped_region(),
+    d_mutex(),
+    d_tables(),
+    d_number_of_restored_tables( 0 ),
+    d_number_of_stored_tables( 0 )
+{ /* ... */ }
+
+// Destructor
+ACETableCache::~ACETableCache()
+{ /* ... */ }
+
+// Get the cache key
+const std::string& ACETableCache::getKey() const
+{
+  return d_key;
+}
+
+// Get the number of tables in the cache
+size_t ACETableCache::getNumberOfTables() const
+{
+  std::lock_guard<std::mutex> lock( d_mutex );
+
+  return d_tables.size();
+}
+
+// Get the number of tables that have been restored from the cache
+size_t ACETableCache::getNumberOfRestoredTables() const
+{
+  std::lock_guard<std::mutex> lock( d_mutex );
+
+  return d_number_of_restored_tables;
+}
+
+// Get the number of tables that have been stored in the cache
+size_t ACETableCache::getNumberOfStoredTables() const
+{
+  std::lock_guard<std::mutex> lock( d_mutex );
+
+  return d_number_of_stored_tables;
+}
+
+// Get the library stamp (size and last write time)
+void ACETableCache::getLibraryStamp(
+                                  const boost::filesystem::path& library_path,
+                                  uint64_t& library_size,
+                                  int64_t& library_write_time )
+{
+  library_size = boost::filesystem::file_size( library_path );
+  library_write_time = boost::filesystem::last_write_time( library_path );
+}
+
+// Restore a table (returns false if the table is not cached)
+/*! \details A table will not be restored if the library that it was read
+ * from has been modified since the table was cached.
+ */
+bool ACETableCache::restoreTable( const boost::filesystem::path& library_path,
+                                  const std::string& table_name,
+                                  const size_t table_start,
+                                  const bool is_ascii,
+                                  ACEFileHandler& ace_file_handler )
+{
+  uint64_t library_size;
+  int64_t library_write_time;
+
+  ACETableCache::getLibraryStamp( library_path,
+                                  library_size,
+                                  library_write_time );
+
+  const CachedTable* table;
+
+  {
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    std::map<CachedTableKey,CachedTable>::iterator table_it =
+      d_tables.find( std::make_tuple( library_path.string(),
+                                      table_name,
+                                      table_start,
+                                      is_ascii ) );
+
+    if( table_it == d_tables.end() )
+      return false;
+
+    if( table_it->second.library_size != library_size ||
+        table_it->second.library_write_time != library_write_time )
+      return false;
+
+    table_it->second.used = true;
+    ++d_number_of_restored_tables;
+
+    // Cached tables are never modified or removed once they have been
+    // inserted so the table can be safely accessed without the lock
+    table = &table_it->second;
+  }
+
+  ace_file_handler.d_ace_table_name = table_name;
+  ace_file_handler.d_ace_table_processing_date = table->processing_date;
+  ace_file_handler.d_ace_table_comment = table->comment;
+  ace_file_handler.d_ace_table_material_id = table->material_id;
+  ace_file_handler.d_atomic_weight_ratio = table->atomic_weight_ratio;
+  ace_file_handler.d_temperature =
+    table->temperature*Utility::Units::MeV;
+
+  ace_file_handler.d_zaids.assign( table->zaids.begin(), table->zaids.end() );
+  ace_file_handler.d_atomic_weight_ratios = table->atomic_weight_ratios;
+
+  std::copy( table->nxs.begin(), table->nxs.end(),
+             ace_file_handler.d_nxs.begin() );
+  std::copy( table->jxs.begin(), table->jxs.end(),
+             ace_file_handler.d_jxs.begin() );
+
+  ace_file_handler.d_xss->resize( table->xss_size );
+
+  if( table->xss_size > 0 )
+  {
+    std::memcpy( ace_file_handler.d_xss->data(),
+                 table->xss_start,
+                 table->xss_size*sizeof(double) );
+  }
+
+  return true;
+}
+
+// Store a table
+/*! \details The XSS array is shared with the handler (it is not copied).
+ * A stored table replaces any stale cached table with the same key.
+ */
+void ACETableCache::storeTable( const size_t table_start,
+                                const bool is_ascii,
+                                const ACEFileHandler& ace_file_handler )
+{
+  CachedTable table;
+
+  ACETableCache::getLibraryStamp( ace_file_handler.getLibraryName(),
+                                  table.library_size,
+                                  table.library_write_time );
+
+  table.processing_date = ace_file_handler.getTableProcessingDate();
+  table.comment = ace_file_handler.getTableComment();
+  table.material_id = ace_file_handler.getTableMatId();
+  table.atomic_weight_ratio = ace_file_handler.getTableAtomicWeightRatio();
+  table.temperature = ace_file_handler.getTableTemperature().value();
+
+  Utility::ArrayView<const ZAID> zaids = ace_file_handler.getTableZAIDs();
+
+  for( size_t i = 0; i < zaids.size(); ++i )
+    table.zaids.push_back( zaids[i].toRaw() );
+
+  Utility::ArrayView<const double> atomic_weight_ratios =
+    ace_file_handler.getTableAtomicWeightRatios();
+
+  table.atomic_weight_ratios.assign( atomic_weight_ratios.begin(),
+                                     atomic_weight_ratios.end() );
+
+  std::copy( ace_file_handler.getTableNXSArray().begin(),
+             ace_file_handler.getTableNXSArray().end(),
+             table.nxs.begin() );
+  std::copy( ace_file_handler.getTableJXSArray().begin(),
+             ace_file_handler.getTableJXSArray().end(),
+             table.jxs.begin() );
+
+  table.xss = ace_file_handler.getTableXSSArray();
+  table.xss_start = reinterpret_cast<const char*>( table.xss->data() );
+  table.xss_size = table.xss->size();
+  table.used = true;
+
+  std::lock_guard<std::mutex> lock( d_mutex );
+
+  const CachedTableKey table_key =
+    std::make_tuple( ace_file_handler.getLibraryName().string(),
+                     ace_file_handler.getTableName(),
+                     table_start,
+                     is_ascii );
+
+  // A restored table can't be replaced (it may still be in use)
+  std::map<CachedTableKey,CachedTable>::iterator table_it =
+    d_tables.find( table_key );
+
+  if( table_it == d_tables.end() )
+  {
+    d_tables.insert( std::make_pair( table_key, table ) );
+
+    ++d_number_of_stored_tables;
+  }
+  else if( !table_it->second.used )
+  {
+    d_tables.erase( table_it );
+    d_tables.insert( std::make_pair( table_key, table ) );
+
+    ++d_number_of_stored_tables;
+  }
+}
+
+// Save the tables that have been used to a cache file
+/*! \details The cache file is written to a temporary file first, which then
+ * replaces the cache file. A partially written cache file will therefore
+ * never be observed by another run.
+ */
+void ACETableCache::save( const boost::filesystem::path& cache_file ) const
+{
+  std::vector<char> buffer;
+
+  {
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    // Write the header
+    buffer.insert( buffer.end(),
+                   s_cache_file_magic,
+                   s_cache_file_magic + sizeof(s_cache_file_magic) );
+
+    appendToBuffer( buffer, s_format_version );
+    appendToBuffer( buffer, s_byte_order_mark );
+    appendToBuffer( buffer, d_key );
+
+    uint64_t number_of_used_tables = 0;
+
+    std::map<CachedTableKey,CachedTable>::const_iterator table_it =
+      d_tables.begin();
+
+    while( table_it != d_tables.end() )
+    {
+      if( table_it->second.used )
+        ++number_of_used_tables;
+
+      ++table_it;
+    }
+
+    appendToBuffer( buffer, number_of_used_tables );
+
+    // Write the tables
+    table_it = d_tables.begin();
+
+    while( table_it != d_tables.end() )
+    {
+      const CachedTable& table = table_it->second;
+
+      if( table.used )
+      {
+        appendToBuffer( buffer, Utility::get<0>( table_it->first ) );
+        appendToBuffer( buffer, Utility::get<1>( table_it->first ) );
+        appendToBuffer( buffer, Utility::get<2>( table_it->first ) );
+        appendToBuffer( buffer,
+                        static_cast<uint8_t>( Utility::get<3>( table_it->first ) ) );
+
+        appendToBuffer( buffer, table.library_size );
+        appendToBuffer( buffer, table.library_write_time );
+        appendToBuffer( buffer, table.processing_date );
+        appendToBuffer( buffer, table.comment );
+        appendToBuffer( buffer, table.material_id );
+        appendToBuffer( buffer, table.atomic_weight_ratio );
+        appendToBuffer( buffer, table.temperature );
+        appendToBuffer( buffer, table.zaids.data(), table.zaids.size() );
+        appendToBuffer( buffer,
+                        table.atomic_weight_ratios.data(),
+                        table.atomic_weight_ratios.size() );
+        appendToBuffer( buffer, table.nxs );
+        appendToBuffer( buffer, table.jxs );
+        appendToBuffer( buffer,
+                        reinterpret_cast<const double*>( table.xss_start ),
+                        table.xss_size );
+      }
+
+      ++table_it;
+    }
+  }
+
+  appendToBuffer( buffer,
+                  computeChecksum( buffer.data(),
+                                   buffer.data() + buffer.size() ) );
+
+  // Write the buffer to a temporary file
+  if( cache_file.has_parent_path() )
+    boost::filesystem::create_directories( cache_file.parent_path() );
+
+  boost::filesystem::path temp_cache_file = cache_file;
+  temp_cache_file += boost::filesystem::unique_path( ".%%%%-%%%%-%%%%.tmp" );
+
+  {
+    std::ofstream temp_cache_file_stream( temp_cache_file.string().c_str(),
+                                          std::ios::binary );
+
+    TEST_FOR_EXCEPTION( !temp_cache_file_stream.good(),
+                        std::runtime_error,
+                        "Could not open temporary ACE table cache file "
+                        << temp_cache_file.string() << "!" );
+
+    temp_cache_file_stream.write( buffer.data(), buffer.size() );
+    temp_cache_file_stream.close();
+
+    if( !temp_cache_file_stream.good() )
+    {
+      boost::filesystem::remove( temp_cache_file );
+
+      THROW_EXCEPTION( std::runtime_error,
+                       "Could not write temporary ACE table cache file "
+                       << temp_cache_file.string() << "!" );
+    }
+  }
+
+  // Replace the cache file
+  boost::filesystem::rename( temp_cache_file, cache_file );
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_ACETableCache.cpp
+//---------------------------------------------------------------------------//
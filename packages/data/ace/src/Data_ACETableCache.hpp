@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_ACETableCache.hpp
+//! \author Alex Robinson
+//! \brief  The preprocessed ACE table cache class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_ACE_TABLE_CACHE_HPP
+#define DATA_ACE_TABLE_CACHE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <mutex>
+#include <ctime>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// FRENSIE Includes
+#include "Utility_Map.hpp"
+#include "Utility_Tuple.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Array.hpp"
+
+namespace Data{
+
+class ACEFileHandler;
+
+/*! The preprocessed ACE table cache
+ *
+ * \details Parsing the ascii ACE tables that are needed by a simulation can
+ * take minutes. The ACE table cache stores the parsed tables (header data and
+ * NXS, JXS and XSS arrays) in a versioned, checksummed binary file that can
+ * be memory mapped by later runs. A Data::ACEFileHandler that is constructed
+ * with a cache will first try to restore its table from the cache and will
+ * store the table in the cache if it had to read it from the library. Only
+ * the reading and parsing of the tables is saved - the objects that are
+ * constructed from the tables are not cached and native data files are not
+ * handled by the cache. A cached table is only used if the size and last
+ * write time of the library that it was read from have not changed. All of
+ * the public member functions are thread safe.
+ */
+class ACETableCache
+{
+
+public:
+
+  //! The cache format version
+  static const uint32_t s_format_version;
+
+  //! Create a cache key from the data that identifies the cached tables
+  static std::string createKey( const std::string& key_data );
+
+  //! Get the name of the cache file associated with a key
+  static std::string getCacheFileName( const std::string& key );
+
+  //! Load a cache file (a null pointer will be returned if it does not exist)
+  static std::shared_ptr<ACETableCache> load(
+                                  const boost::filesystem::path& cache_file,
+                                  const std::string& key );
+
+  //! Constructor (empty cache)
+  ACETableCache( const std::string& key );
+
+  //! Destructor
+  ~ACETableCache();
+
+  //! Get the cache key
+  const std::string& getKey() const;
+
+  //! Get the number of tables in the cache
+  size_t getNumberOfTables() const;
+
+  //! Get the number of tables that have been restored from the cache
+  size_t getNumberOfRestoredTables() const;
+
+  //! Get the number of tables that have been stored in the cache
+  size_t getNumberOfStoredTables() const;
+
+  //! Restore a table (returns false if the table is not cached)
+  bool restoreTable( const boost::filesystem::path& library_path,
+                     const std::string& table_name,
+                     const size_t table_start,
+                     const bool is_ascii,
+                     ACEFileHandler& ace_file_handler );
+
+  //! Store a table
+  void storeTable( const size_t table_start,
+                   const bool is_ascii,
+                   const ACEFileHandler& ace_file_handler );
+
+  //! Save the tables that have been used to a cache file
+  void save( const boost::filesystem::path& cache_file ) const;
+
+private:
+
+  // The cached table data
+  struct CachedTable
+  {
+    // The library size (bytes)
+    uint64_t library_size;
+
+    // The library last write time
+    int64_t library_write_time;
+
+    // The table processing date
+    std::string processing_date;
+
+    // The table comment
+    std::string comment;
+
+    // The table material id
+    std::string material_id;
+
+    // The table atomic weight ratio
+    double atomic_weight_ratio;
+
+    // The table temperature (MeV)
+    double temperature;
+
+    // The raw table zaids
+    std::vector<uint32_t> zaids;
+
+    // The table atomic weight ratios
+    std::vector<double> atomic_weight_ratios;
+
+    // The table NXS array
+    std::array<int32_t,16> nxs;
+
+    // The table JXS array
+    std::array<int32_t,32> jxs;
+
+    // The XSS array start (may point into the mapped cache file)
+    const char* xss_start;
+
+    // The XSS array size
+    uint64_t xss_size;
+
+    // The XSS array (only set if the table was stored during this run)
+    std::shared_ptr<const std::vector<double> > xss;
+
+    // Records if the table has been used during this run
+    bool used;
+  };
+
+  // The cached table key (library path, table name, table start, is ascii)
+  typedef std::tuple<std::string,std::string,uint64_t,bool> CachedTableKey;
+
+  // Get the library stamp (size and last write time)
+  static void getLibraryStamp( const boost::filesystem::path& library_path,
+                               uint64_t& library_size,
+                               int64_t& library_write_time );
+
+  // The cache key
+  std::string d_key;
+
+  // The cache file mapping (only set if the cache was loaded)
+  std::unique_ptr<boost::interprocess::file_mapping> d_file_mapping;
+
+  // The mapped cache file region (only set if the cache was loaded)
+  std::unique_ptr<boost::interprocess::mapped_region> d_mapped_region;
+
+  // The cached table mutex
+  mutable std::mutex d_mutex;
+
+  // The cached tables
+  std::map<CachedTableKey,CachedTable> d_tables;
+
+  // The number of restored tables
+  size_t d_number_of_restored_tables;
+
+  // The number of stored tables
+  size_t d_number_of_stored_tables;
+};
+
+} // end Data namespace
+
+#endif // end DATA_ACE_TABLE_CACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_ACETableCache.hpp
+//---------------------------------------------------------------------------//
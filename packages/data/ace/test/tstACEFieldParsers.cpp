@@ -0,0 +1,119 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstACEFieldParsers.cpp
+//! \author Alex Robinson
+//! \brief  ACE fixed width field parser unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+// FRENSIE Includes
+#include "Data_ACEFieldParsers.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Parse a real field stored in a string
+double parseReal( const std::string& field )
+{
+  return Data::parseFortranRealField( field.data(),
+                                      field.data() + field.size() );
+}
+
+// Parse an integer field stored in a string
+int parseInteger( const std::string& field )
+{
+  return Data::parseFortranIntegerField( field.data(),
+                                         field.data() + field.size() );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that real fields can be parsed
+FRENSIE_UNIT_TEST( ACEFieldParsers, parseFortranRealField )
+{
+  FRENSIE_CHECK_EQUAL( parseReal( "   1.00000000000E-11" ), 1e-11 );
+  FRENSIE_CHECK_EQUAL( parseReal( "  -2.53010000000E-08" ), -2.53010e-08 );
+  FRENSIE_CHECK_EQUAL( parseReal( "   1.02000000000E+02" ), 102.0 );
+  FRENSIE_CHECK_EQUAL( parseReal( "    0.999167" ), 0.999167 );
+  FRENSIE_CHECK_EQUAL( parseReal( "        206." ), 206.0 );
+  FRENSIE_CHECK_EQUAL( parseReal( "   .5" ), 0.5 );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.5D+03" ), 1.5e3 );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.5d-03" ), 1.5e-3 );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.5e3" ), 1.5e3 );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.0-11" ), 1e-11 );
+  FRENSIE_CHECK_EQUAL( parseReal( "3.0+05" ), 3e5 );
+  FRENSIE_CHECK_EQUAL( parseReal( "0.00000000000E+00" ), 0.0 );
+  FRENSIE_CHECK_EQUAL( parseReal( "                    " ), 0.0 );
+  FRENSIE_CHECK_EQUAL( parseReal( "" ), 0.0 );
+  FRENSIE_CHECK_EQUAL( parseReal( "  4.2\r" ), 4.2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that real fields outside of the fast path range are parsed correctly
+FRENSIE_UNIT_TEST( ACEFieldParsers, parseFortranRealField_slow_path )
+{
+  FRENSIE_CHECK_EQUAL( parseReal( "   1.23456789012E-35" ),
+                       std::strtod( "1.23456789012E-35", NULL ) );
+  FRENSIE_CHECK_EQUAL( parseReal( "  -9.87654321098E+30" ),
+                       std::strtod( "-9.87654321098E+30", NULL ) );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.2345678901234567890123" ),
+                       std::strtod( "1.2345678901234567890123", NULL ) );
+  FRENSIE_CHECK_EQUAL( parseReal( "1.0-300" ),
+                       std::strtod( "1.0E-300", NULL ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid real fields are detected
+FRENSIE_UNIT_TEST( ACEFieldParsers, parseFortranRealField_invalid )
+{
+  FRENSIE_CHECK_THROW( parseReal( "   abc" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseReal( "   1.0E" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseReal( "   1.0E+" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseReal( "   -" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseReal( "   1.0 2.0" ), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that integer fields can be parsed
+FRENSIE_UNIT_TEST( ACEFieldParsers, parseFortranIntegerField )
+{
+  FRENSIE_CHECK_EQUAL( parseInteger( "     8177" ), 8177 );
+  FRENSIE_CHECK_EQUAL( parseInteger( "    -1001" ), -1001 );
+  FRENSIE_CHECK_EQUAL( parseInteger( "       +3" ), 3 );
+  FRENSIE_CHECK_EQUAL( parseInteger( "         " ), 0 );
+  FRENSIE_CHECK_EQUAL( parseInteger( "" ), 0 );
+
+  FRENSIE_CHECK_THROW( parseInteger( "     1.0" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseInteger( "       -" ), std::runtime_error );
+  FRENSIE_CHECK_THROW( parseInteger( "99999999999" ), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that character fields can be extracted
+FRENSIE_UNIT_TEST( ACEFieldParsers, extractFortranCharacterField )
+{
+  std::string field( "  1001.70c" );
+
+  FRENSIE_CHECK_EQUAL( Data::extractFortranCharacterField(
+                                      field.data(),
+                                      field.data() + field.size() ),
+                       "1001.70c" );
+
+  field = "mat 125   ";
+
+  FRENSIE_CHECK_EQUAL( Data::extractFortranCharacterField(
+                                      field.data(),
+                                      field.data() + field.size() ),
+                       "mat 125" );
+}
+
+//---------------------------------------------------------------------------//
+// end tstACEFieldParsers.cpp
+//---------------------------------------------------------------------------//
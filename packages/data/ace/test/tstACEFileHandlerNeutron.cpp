@@ -10,9 +10,13 @@
 #include <string>
 #include <memory>
 #include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -91,6 +95,152 @@ FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron )
   FRENSIE_CHECK_EQUAL( xss->back(), 102 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can read a binary (type 2) neutron ace file
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_binary_neutron )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ascii_file_handler( test_neutron_ace_file_name,
+                                           table_name,
+                                           test_neutron_ace_file_start_line );
+
+  // Write a binary library with a dummy table in front of the table
+  const size_t record_length =
+    Data::ACEFileHandler::s_default_binary_record_length;
+  const size_t entries_per_record =
+    Data::ACEFileHandler::s_default_binary_entries_per_record;
+
+  std::string binary_file_name( "test_h1_binary_ace_file.bin" );
+
+  {
+    std::vector<char> header_record( record_length, '\0' );
+    char* record_position = header_record.data();
+
+    std::string padded_name( 10, ' ' );
+    padded_name.replace( 2, table_name.size(), table_name );
+
+    std::memcpy( record_position, padded_name.data(), 10 );
+    record_position += 10;
+
+    double raw_value = ascii_file_handler.getTableAtomicWeightRatio();
+    std::memcpy( record_position, &raw_value, sizeof(double) );
+    record_position += sizeof(double);
+
+    raw_value = ascii_file_handler.getTableTemperature().value();
+    std::memcpy( record_position, &raw_value, sizeof(double) );
+    record_position += sizeof(double);
+
+    std::string padded_field = ascii_file_handler.getTableProcessingDate();
+    padded_field.resize( 10, ' ' );
+    std::memcpy( record_position, padded_field.data(), 10 );
+    record_position += 10;
+
+    padded_field = ascii_file_handler.getTableComment();
+    padded_field.resize( 70, ' ' );
+    std::memcpy( record_position, padded_field.data(), 70 );
+    record_position += 70;
+
+    padded_field = ascii_file_handler.getTableMatId();
+    padded_field.resize( 10, ' ' );
+    std::memcpy( record_position, padded_field.data(), 10 );
+    record_position += 10;
+
+    // No zaids or awrs are stored in neutron tables
+    record_position += 16*(sizeof(int32_t) + sizeof(double));
+
+    for( size_t i = 0; i < 16; ++i )
+    {
+      int32_t raw_int = ascii_file_handler.getTableNXSArray()[i];
+      std::memcpy( record_position, &raw_int, sizeof(int32_t) );
+      record_position += sizeof(int32_t);
+    }
+
+    for( size_t i = 0; i < 32; ++i )
+    {
+      int32_t raw_int = ascii_file_handler.getTableJXSArray()[i];
+      std::memcpy( record_position, &raw_int, sizeof(int32_t) );
+      record_position += sizeof(int32_t);
+    }
+
+    std::ofstream binary_file( binary_file_name, std::ios::binary );
+
+    std::vector<char> dummy_record( record_length, '\0' );
+    binary_file.write( dummy_record.data(), record_length );
+    binary_file.write( header_record.data(), record_length );
+
+    const std::vector<double>& xss = *ascii_file_handler.getTableXSSArray();
+
+    for( size_t i = 0; i < xss.size(); i += entries_per_record )
+    {
+      std::vector<double> xss_record( entries_per_record, 0.0 );
+
+      std::copy( xss.begin() + i,
+                 xss.begin() + std::min( i + entries_per_record, xss.size() ),
+                 xss_record.begin() );
+
+      binary_file.write( reinterpret_cast<const char*>( xss_record.data() ),
+                         record_length );
+    }
+  }
+
+  FRENSIE_CHECK_THROW( Data::ACEFileHandler( binary_file_name, table_name, 1u, false ),
+                       std::runtime_error );
+
+  Data::ACEFileHandler binary_file_handler( binary_file_name,
+                                            table_name,
+                                            2u,
+                                            false );
+
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableName(), table_name );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableAtomicWeightRatio(),
+                       ascii_file_handler.getTableAtomicWeightRatio() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableTemperature(),
+                       ascii_file_handler.getTableTemperature() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableProcessingDate(),
+                       ascii_file_handler.getTableProcessingDate() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableComment(),
+                       ascii_file_handler.getTableComment() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableMatId(),
+                       ascii_file_handler.getTableMatId() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableZAIDs().size(), 0 );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableNXSArray(),
+                       ascii_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( binary_file_handler.getTableJXSArray(),
+                       ascii_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( *binary_file_handler.getTableXSSArray(),
+                       *ascii_file_handler.getTableXSSArray() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that tables can be read concurrently
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_concurrent )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ref_file_handler( test_neutron_ace_file_name,
+                                         table_name,
+                                         test_neutron_ace_file_start_line );
+
+  std::vector<std::shared_ptr<const std::vector<double> > > xss_arrays( 8 );
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < xss_arrays.size(); ++i )
+  {
+    Data::ACEFileHandler file_handler( test_neutron_ace_file_name,
+                                       table_name,
+                                       test_neutron_ace_file_start_line );
+
+    xss_arrays[i] = file_handler.getTableXSSArray();
+  }
+
+  for( size_t i = 0; i < xss_arrays.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( *xss_arrays[i],
+                         *ref_file_handler.getTableXSSArray() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -106,6 +256,13 @@ FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
                                         "Test neutron ACE file start line" );
 }
 
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( 4 );
+}
+
 FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
 
 //---------------------------------------------------------------------------//
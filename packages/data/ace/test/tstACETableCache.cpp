@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstACETableCache.cpp
+//! \author Alex Robinson
+//! \brief  ACE table cache unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <fstream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Data_ACETableCache.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+std::string test_neutron_ace_file_name;
+unsigned test_neutron_ace_file_start_line;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a cache key can be created
+FRENSIE_UNIT_TEST( ACETableCache, createKey )
+{
+  std::string key = Data::ACETableCache::createKey( "H-1 definitions" );
+
+  FRENSIE_CHECK_EQUAL( key.size(), 16 );
+  FRENSIE_CHECK_EQUAL( key, Data::ACETableCache::createKey( "H-1 definitions" ) );
+  FRENSIE_CHECK( key != Data::ACETableCache::createKey( "H-2 definitions" ) );
+
+  FRENSIE_CHECK_EQUAL( Data::ACETableCache::getCacheFileName( key ),
+                       "ace_table_cache_" + key + ".bin" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that tables read by a handler with a cache are stored in the cache
+FRENSIE_UNIT_TEST( ACETableCache, storeTable )
+{
+  std::shared_ptr<Data::ACETableCache>
+    cache( new Data::ACETableCache( "test_key" ) );
+
+  FRENSIE_CHECK_EQUAL( cache->getKey(), "test_key" );
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfTables(), 0 );
+
+  Data::ACEFileHandler ace_file_handler( test_neutron_ace_file_name,
+                                         "1001.70c",
+                                         test_neutron_ace_file_start_line,
+                                         true,
+                                         cache );
+
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfTables(), 1 );
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfStoredTables(), 1 );
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfRestoredTables(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a cache can be saved and loaded
+FRENSIE_UNIT_TEST( ACETableCache, save_load )
+{
+  const std::string cache_file_name( "test_ace_table_cache.bin" );
+
+  Data::ACEFileHandler ref_file_handler( test_neutron_ace_file_name,
+                                         "1001.70c",
+                                         test_neutron_ace_file_start_line );
+
+  {
+    std::shared_ptr<Data::ACETableCache>
+      cache( new Data::ACETableCache( "test_key" ) );
+
+    Data::ACEFileHandler ace_file_handler( test_neutron_ace_file_name,
+                                           "1001.70c",
+                                           test_neutron_ace_file_start_line,
+                                           true,
+                                           cache );
+
+    cache->save( cache_file_name );
+  }
+
+  std::shared_ptr<Data::ACETableCache> cache =
+    Data::ACETableCache::load( cache_file_name, "test_key" );
+
+  FRENSIE_REQUIRE( cache.get() != NULL );
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfTables(), 1 );
+
+  Data::ACEFileHandler ace_file_handler( test_neutron_ace_file_name,
+                                         "1001.70c",
+                                         test_neutron_ace_file_start_line,
+                                         true,
+                                         cache );
+
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfRestoredTables(), 1 );
+  FRENSIE_CHECK_EQUAL( cache->getNumberOfStoredTables(), 0 );
+
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableName(),
+                       ref_file_handler.getTableName() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableAtomicWeightRatio(),
+                       ref_file_handler.getTableAtomicWeightRatio() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableTemperature(),
+                       ref_file_handler.getTableTemperature() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableProcessingDate(),
+                       ref_file_handler.getTableProcessingDate() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableComment(),
+                       ref_file_handler.getTableComment() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableMatId(),
+                       ref_file_handler.getTableMatId() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableZAIDs(),
+                       ref_file_handler.getTableZAIDs() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableAtomicWeightRatios(),
+                       ref_file_handler.getTableAtomicWeightRatios() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableNXSArray(),
+                       ref_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler.getTableJXSArray(),
+                       ref_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( *ace_file_handler.getTableXSSArray(),
+                       *ref_file_handler.getTableXSSArray() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that cache files that can't be used are detected
+FRENSIE_UNIT_TEST( ACETableCache, load_invalid )
+{
+  const std::string cache_file_name( "test_invalid_ace_table_cache.bin" );
+
+  // Missing cache file
+  boost::filesystem::remove( cache_file_name );
+
+  FRENSIE_CHECK( Data::ACETableCache::load( cache_file_name, "test_key" ).get() == NULL );
+
+  // Key mismatch
+  {
+    Data::ACETableCache cache( "test_key" );
+
+    cache.save( cache_file_name );
+  }
+
+  FRENSIE_CHECK( Data::ACETableCache::load( cache_file_name, "test_key" ).get() != NULL );
+  FRENSIE_CHECK_THROW( Data::ACETableCache::load( cache_file_name, "other_key" ),
+                       std::runtime_error );
+
+  // Corrupt cache file
+  {
+    std::fstream cache_file( cache_file_name.c_str(),
+                             std::ios::in | std::ios::out | std::ios::binary );
+
+    cache_file.seekp( 20 );
+    cache_file.put( 'X' );
+  }
+
+  FRENSIE_CHECK_THROW( Data::ACETableCache::load( cache_file_name, "test_key" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_neutron_ace_file",
+                                        test_neutron_ace_file_name, "",
+                                        "Test neutron ACE file name" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_neutron_ace_file_start_line",
+                                        test_neutron_ace_file_start_line, 1,
+                                        "Test neutron ACE file start line" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// tstACETableCache.cpp
+//---------------------------------------------------------------------------//
@@ -11,16 +11,25 @@
 
 // Std Lib Includes
 #include <string>
+#include <type_traits>
 
 // Boost Includes
 #include <boost/serialization/nvp.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
 
 // FRENSIE Includes
+#include "FRENSIE_config.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
 
+#ifdef HAVE_FRENSIE_HDF5
+#include "Utility_HDF5OArchive.hpp"
+#include "Utility_HDF5IArchive.hpp"
+#endif // end HAVE_FRENSIE_HDF5
+
 //! Macro for use with the boost serialization library
 #define DATA_MAKE_NVP( archive, data_field_prefix, data_field_base_name ) \
   archive & boost::serialization::make_nvp( #data_field_base_name, data_field_prefix ## data_field_base_name )
@@ -31,6 +40,22 @@
 
 namespace Data{
 
+namespace Details{
+
+//! Check if data container data blocks are stored as binary records
+template<typename Archive>
+struct UsesDataBlockRecords : public std::integral_constant<bool,
+  std::is_same<Archive,boost::archive::binary_oarchive>::value ||
+  std::is_same<Archive,boost::archive::binary_iarchive>::value
+#ifdef HAVE_FRENSIE_HDF5
+  || std::is_same<Archive,Utility::HDF5OArchive>::value
+  || std::is_same<Archive,Utility::HDF5IArchive>::value
+#endif // end HAVE_FRENSIE_HDF5
+  >
+{ /* ... */ };
+
+} // end Details namespace
+
   // Test preconditions for energy grids
   template<typename Array>
   bool energyGridValid( const Array& energy_grid );
@@ -12,12 +12,17 @@
 #include <sstream>
 #include <typeinfo>
 
+// Boost Includes
+#include <boost/interprocess/streams/bufferstream.hpp>
+
 // FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_DataContainerHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_InterpolationPolicy.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Data{
@@ -31,6 +36,31 @@ AdjointElectronPhotonRelaxationDataContainer::AdjointElectronPhotonRelaxationDat
 {
   // Import the data in the archive
   this->loadFromFile( file_name_with_path );
+
+  // Decode all of the data block records
+  this->loadAllDataBlocks();
+}
+
+// Constructor (from saved archive - the other data blocks are lazy)
+/*! \details Only the requested data blocks will be decoded. The remaining
+ * data blocks will be decoded when they are first accessed. Archives that
+ * do not store data block records (e.g. xml archives) are always loaded
+ * completely.
+ */
+AdjointElectronPhotonRelaxationDataContainer::AdjointElectronPhotonRelaxationDataContainer(
+                           const boost::filesystem::path& file_name_with_path,
+                           const std::set<DataBlock>& data_blocks )
+{
+  // Import the data in the archive
+  this->loadFromFile( file_name_with_path );
+
+  // Decode the requested data block records
+  for( std::set<DataBlock>::const_iterator data_block_it = data_blocks.begin();
+       data_block_it != data_blocks.end();
+       ++data_block_it )
+  {
+    this->loadDataBlock( *data_block_it );
+  }
 }
 
 // Load the archived object (implementation)
@@ -80,6 +110,138 @@ const char* AdjointElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Return the name of a data block
+std::string AdjointElectronPhotonRelaxationDataContainer::getDataBlockName(
+                                                  const DataBlock data_block )
+{
+  switch( data_block )
+  {
+    case COMPTON_PROFILE_DATA_BLOCK:
+      return "compton_profile_data_block";
+    case FORM_FACTOR_DATA_BLOCK:
+      return "form_factor_data_block";
+    case PHOTON_CROSS_SECTION_DATA_BLOCK:
+      return "photon_cross_section_data_block";
+    case PAIR_PRODUCTION_DATA_BLOCK:
+      return "pair_production_data_block";
+    case PHOTON_BREMSSTRAHLUNG_DATA_BLOCK:
+      return "photon_bremsstrahlung_data_block";
+    case ELASTIC_DATA_BLOCK:
+      return "elastic_data_block";
+    case ELECTROIONIZATION_DATA_BLOCK:
+      return "electroionization_data_block";
+    case ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK:
+      return "electron_bremsstrahlung_data_block";
+    case ATOMIC_EXCITATION_DATA_BLOCK:
+      return "atomic_excitation_data_block";
+    case ELECTRON_CROSS_SECTION_DATA_BLOCK:
+      return "electron_cross_section_data_block";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Data block " << (int)data_block << " is unknown!" );
+    }
+  }
+}
+
+// Check if a data block has been loaded
+/*! \details A data block that is not stored in the archive that the
+ * container was loaded from (or a data block of a container that was not
+ * loaded from an archive) is considered to be loaded.
+ */
+bool AdjointElectronPhotonRelaxationDataContainer::isDataBlockLoaded(
+                                            const DataBlock data_block ) const
+{
+  if( (size_t)data_block < d_data_block_records.size() )
+    return d_data_block_records[data_block].empty();
+  else
+    return true;
+}
+
+// Load a data block (if it has not been loaded yet)
+/*! \details The data block record will be released once it has been decoded.
+ * Data blocks of different containers can be loaded concurrently. The first
+ * access to a data block of a single container must not be concurrent with
+ * other accesses to the same container.
+ */
+void AdjointElectronPhotonRelaxationDataContainer::loadDataBlock(
+                                            const DataBlock data_block ) const
+{
+  if( this->isDataBlockLoaded( data_block ) )
+    return;
+
+  // The data block fields are logically part of the (const) container state -
+  // they simply have not been decoded yet
+  AdjointElectronPhotonRelaxationDataContainer& mutable_container =
+    const_cast<AdjointElectronPhotonRelaxationDataContainer&>( *this );
+
+  std::vector<char>& data_block_record = d_data_block_records[data_block];
+
+  // The bpis pointer must be NULL (see loadFromFileImpl)
+  const boost::archive::detail::basic_pointer_iserializer* bpis =
+    this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+  std::string error_message;
+
+  try{
+    boost::interprocess::ibufferstream
+      iss( data_block_record.data(), data_block_record.size() );
+
+    boost::archive::binary_iarchive ar( static_cast<std::istream&>( iss ),
+                                        boost::archive::no_header );
+
+    AdjointElectronPhotonRelaxationDataContainer::serializeDataBlock(
+                                                ar, mutable_container, data_block );
+  }
+  catch( const std::exception& exception )
+  {
+    error_message = exception.what();
+  }
+
+  this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      "Could not load the "
+                      << AdjointElectronPhotonRelaxationDataContainer::getDataBlockName( data_block )
+                      << ": " << error_message );
+
+  // Release the data block record
+  std::vector<char>().swap( data_block_record );
+}
+
+// Load all of the data blocks
+void AdjointElectronPhotonRelaxationDataContainer::loadAllDataBlocks() const
+{
+  for( int i = COMPTON_PROFILE_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+    this->loadDataBlock( (DataBlock)i );
+}
+
+// Create a data block record
+void AdjointElectronPhotonRelaxationDataContainer::createDataBlockRecord(
+                               const DataBlock data_block,
+                               std::vector<char>& data_block_record ) const
+{
+  // The bpos pointer must be NULL (see saveToFileImpl)
+  const boost::archive::detail::basic_pointer_oserializer* bpos =
+    this->resetBposPointer<std::vector<double> >( ".bin" );
+
+  std::ostringstream oss;
+
+  {
+    boost::archive::binary_oarchive ar( oss, boost::archive::no_header );
+
+    AdjointElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
+  }
+
+  this->restoreBposPointer<std::vector<double> >( ".bin", bpos );
+
+  const std::string raw_data_block_record = oss.str();
+
+  data_block_record.assign( raw_data_block_record.begin(),
+                            raw_data_block_record.end() );
+}
+
 //---------------------------------------------------------------------------//
 // Get Notes
 //---------------------------------------------------------------------------//
@@ -386,6 +548,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getComptonProfileMomentumGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -398,6 +562,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getComptonProfile(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                    d_subshells.end() );
@@ -410,6 +576,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getOccupationNumberMomentumGrid(
 					        const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -422,6 +590,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getOccupationNumber(
 					        const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -433,6 +603,8 @@ AdjointElectronPhotonRelaxationDataContainer::getOccupationNumber(
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function_momentum_grid;
 }
 
@@ -440,6 +612,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function;
 }
 
@@ -447,6 +621,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor_momentum_grid;
 }
 
@@ -454,6 +630,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMo
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor;
 }
 
@@ -461,6 +639,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor()
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
 }
 
@@ -468,6 +648,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormF
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor;
 }
 
@@ -475,6 +657,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormF
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_photon_energy_grid;
 }
 
@@ -482,6 +666,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonEnergyGrid() const
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeIncoherentMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_waller_hartree_incoherent_max_energy_grid;
 }
 
@@ -489,6 +675,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeIncoherentM
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_waller_hartree_incoherent_cross_section;
 }
 
@@ -496,6 +684,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeIncoherentC
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxIncoherentMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_impulse_approx_incoherent_max_energy_grid;
 }
 
@@ -503,12 +693,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxIncoherentM
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_impulse_approx_incoherent_cross_section;
 }
 
 // Return the adjoint impulse approx. (IA) incoherent photon cross section threshold energy bin index
 unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_impulse_approx_incoherent_cross_section_threshold_index;
 }
 
@@ -516,6 +710,8 @@ unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxIn
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxIncoherentMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid;
 }
 
@@ -523,12 +719,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseA
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_doppler_broadened_impulse_approx_incoherent_cross_section;
 }
 
 // Return the adjoint Doppler broadened impulse approx. (IA) incoherent photon cross section threshold energy bin index
 unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_doppler_broadened_impulse_approx_incoherent_cross_section_threshold_index;
 }
 
@@ -537,6 +737,8 @@ const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -549,6 +751,8 @@ const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxSubshellIncoherentCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -560,6 +764,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxSubshellInc
 unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -572,6 +778,8 @@ const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -584,6 +792,8 @@ const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -595,6 +805,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseA
 unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -606,6 +818,8 @@ unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadene
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeCoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_coherent_cross_section;
 }
 
@@ -613,6 +827,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeCoherentCro
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeTotalMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_waller_hatree_total_max_energy_grid;
 }
 
@@ -620,6 +836,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeTotalMaxEne
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_waller_hatree_total_cross_section;
 }
 
@@ -627,6 +845,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeTotalCrossS
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxTotalMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_impulse_approx_total_max_energy_grid;
 }
 
@@ -634,6 +854,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxTotalMaxEne
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_impulse_approx_total_cross_section;
 }
 
@@ -641,6 +863,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointImpulseApproxTotalCrossS
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxTotalMaxEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_doppler_broadened_impulse_approx_total_max_energy_grid;
 }
 
@@ -648,6 +872,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseA
 const std::vector<std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseApproxTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_doppler_broadened_impulse_approx_total_cross_section;
 }
 
@@ -655,6 +881,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseA
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_total_cross_section;
 }
 
@@ -662,6 +890,8 @@ AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection(
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_total_cross_section;
 }
 
@@ -669,6 +899,8 @@ AdjointElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection(
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionGrid() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_pair_production_energy_distribution_grid;
 }
 
@@ -676,6 +908,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDist
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistribution() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_pair_production_energy_distribution;
 }
 
@@ -683,6 +917,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDist
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionNormConstantGrid() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_pair_production_norm_constant_grid;
 }
 
@@ -690,6 +926,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDist
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionNormConstant() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_pair_production_norm_constant;
 }
 
@@ -697,6 +935,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDist
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionGrid() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_triplet_production_energy_distribution_grid;
 }
 
@@ -704,6 +944,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyD
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistribution() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_triplet_production_energy_distribution;
 }
 
@@ -711,6 +953,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyD
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionNormConstantGrid() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_triplet_production_norm_constant_grid;
 }
 
@@ -718,6 +962,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyD
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionNormConstant() const
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   return d_adjoint_triplet_production_norm_constant;
 }
 
@@ -725,6 +971,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyD
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_adjoint_photon_bremsstrahlung_energy_grid;
 }
 
@@ -733,6 +981,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungEnergy(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_photon_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_photon_bremsstrahlung_energy_grid.back() );
@@ -745,6 +995,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungPDF(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_photon_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_photon_bremsstrahlung_energy_grid.back() );
@@ -756,6 +1008,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungPDF(
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungPhotonCrossSection() const
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_adjoint_bremsstrahlung_photon_cross_section;
 }
 
@@ -763,6 +1017,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungPhotonCros
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungPhotonCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_adjoint_bremsstrahlung_photon_cross_section_threshold_index;
 }
 
@@ -794,6 +1050,8 @@ AdjointElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElasticAngularEnergyGrid() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_angular_energy_grid;
 }
 
@@ -801,6 +1059,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElasticAngularEnergyGrid
 const std::map<double,std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticAngles() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_cutoff_elastic_angles;
 }
 
@@ -808,6 +1068,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticAngles() co
 const std::map<double,std::vector<double> >&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticPDF() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_cutoff_elastic_pdf;
 }
 
@@ -816,6 +1078,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticAngles(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -828,6 +1092,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticPDF(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -838,6 +1104,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticPDF(
 // Return if there is moment preserving data
 bool AdjointElectronPhotonRelaxationDataContainer::hasAdjointMomentPreservingData() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_moment_preserving_elastic_discrete_angles.size() > 0;
 }
 
@@ -847,6 +1115,8 @@ bool AdjointElectronPhotonRelaxationDataContainer::hasAdjointMomentPreservingDat
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingCrossSectionReduction() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_moment_preserving_cross_section_reductions;
 }
 
@@ -854,6 +1124,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingCrossSec
 const std::map<double,std::vector<double> >
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticDiscreteAngles() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_moment_preserving_elastic_discrete_angles;
 }
 
@@ -861,6 +1133,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticD
 const std::map<double,std::vector<double> >
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticWeights() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_adjoint_moment_preserving_elastic_weights;
 }
 
@@ -869,6 +1143,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticDiscreteAngles(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -881,6 +1157,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticWeights(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -892,6 +1170,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingElasticW
 const std::string&
 AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationSamplingMode() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   return d_forward_electroionization_sampling_mode;
 }
 
@@ -900,6 +1180,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationEnergyGrid(
                             const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -915,6 +1197,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationEnergyG
  */
 bool AdjointElectronPhotonRelaxationDataContainer::separateAdjointElectroionizationEnergyGrid() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   return !d_adjoint_electroionization_energy_grid.empty();
 }
 
@@ -924,6 +1208,9 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationRecoilE
                            const unsigned subshell,
 					       const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming_adjoint_energy is valid
@@ -947,6 +1234,9 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationRecoilP
                            const unsigned subshell,
 					       const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming_adjoint_energy is valid
@@ -968,6 +1258,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationRecoilP
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungEnergyGrid() const
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
     if ( this->separateAdjointBremsstrahlungEnergyGrid() )
       return d_adjoint_electron_bremsstrahlung_energy_grid;
     else
@@ -980,6 +1272,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungEn
  */
 bool AdjointElectronPhotonRelaxationDataContainer::separateAdjointBremsstrahlungEnergyGrid() const
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_adjoint_electron_bremsstrahlung_energy_grid.size() > 0;
 }
 
@@ -988,6 +1282,9 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungEnergy(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   if( this->separateAdjointBremsstrahlungEnergyGrid() )
   {
@@ -1008,6 +1305,9 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungPDF(
 					        const double incoming_adjoint_energy ) const
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   if( this->separateAdjointBremsstrahlungEnergyGrid() )
   {
@@ -1027,6 +1327,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungPD
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGrid() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   return d_adjoint_atomic_excitation_energy_grid;
 }
 
@@ -1034,6 +1336,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGr
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGain() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   return d_adjoint_atomic_excitation_energy_gain;
 }
 
@@ -1041,12 +1345,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGa
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronEnergyGrid() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_electron_energy_grid;
 }
 // Return the cutoff elastic electron cross section
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_cutoff_elastic_cross_section;
 }
 
@@ -1054,12 +1362,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticCrossSectio
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_cutoff_elastic_cross_section_threshold_index;
 }
 // Return the screened Rutherford elastic electron cross section
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointScreenedRutherfordElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_screened_rutherford_elastic_cross_section;
 }
 
@@ -1067,12 +1379,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointScreenedRutherfordElasti
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_screened_rutherford_elastic_cross_section_threshold_index;
 }
 // Return the total elastic electron cross section
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTotalElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_total_elastic_cross_section;
 }
 
@@ -1080,6 +1396,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointTotalElasticCrossSection
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTotalElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_total_elastic_cross_section_threshold_index;
 }
 
@@ -1088,6 +1406,8 @@ const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationCrossSection(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_electroionization_subshell_cross_section.find( subshell )->second;
 }
 
@@ -1096,6 +1416,8 @@ unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationCrossSectionThresholdEnergyIndex(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_electroionization_subshell_cross_section_threshold_index.find( subshell )->second;
 }
 
@@ -1103,6 +1425,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationCrossSe
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_bremsstrahlung_electron_cross_section;
 }
 
@@ -1110,6 +1434,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCr
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_bremsstrahlung_electron_cross_section_threshold_index;
 }
 
@@ -1117,6 +1443,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCr
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_atomic_excitation_cross_section;
 }
 
@@ -1124,6 +1452,8 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSec
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_adjoint_atomic_excitation_cross_section_threshold_index;
 }
 
@@ -1131,12 +1461,16 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSec
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getForwardBremsstrahlungElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_bremsstrahlung_electron_cross_section;
 }
 // Return the forward bremsstrahlung electron cross section threshold energy bin index
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getForwardBremsstrahlungElectronCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_bremsstrahlung_electron_cross_section_threshold_index;
 }
 
@@ -1144,6 +1478,8 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardBremsstrahlungElectronCr
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_electroionization_electron_cross_section;
 }
 
@@ -1151,6 +1487,8 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectro
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectronCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_electroionization_electron_cross_section_threshold_index;
 }
 
@@ -1158,6 +1496,8 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectro
 const std::vector<double>&
 AdjointElectronPhotonRelaxationDataContainer::getForwardAtomicExcitationElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_atomic_excitation_electron_cross_section;
 }
 
@@ -1165,6 +1505,8 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardAtomicExcitationElectron
 unsigned
 AdjointElectronPhotonRelaxationDataContainer::getForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_forward_atomic_excitation_electron_cross_section_threshold_index;
 }
 
@@ -1650,6 +1992,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setComptonProfileMomentumGrid
                      const unsigned subshell,
                      const std::vector<double>& compton_profile_momentum_grid )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the momentum grid is valid
@@ -1667,6 +2011,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setComptonProfile(
                                    const unsigned subshell,
                                    const std::vector<double>& compton_profile )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the compton_profile is valid
@@ -1682,6 +2028,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setOccupationNumberMomentumGr
                    const unsigned subshell,
                    const std::vector<double>& occupation_number_momentum_grid )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number momentum grid is valid
@@ -1699,6 +2047,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setOccupationNumber(
                                  const unsigned subshell,
                                  const std::vector<double>& occupation_number )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number is valid
@@ -1714,6 +2064,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setOccupationNumber(
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunctionMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1727,6 +2079,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFun
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunction(
                                const std::vector<double>& scattering_function )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the scattering function is valid
   testPrecondition( scattering_function.size() ==
 		    d_waller_hartree_scattering_function_momentum_grid.size());
@@ -1740,6 +2094,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFun
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactorMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1753,6 +2109,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFac
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactor(
                                 const std::vector<double>& atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition( atomic_form_factor.size() ==
 		    d_waller_hartree_atomic_form_factor_momentum_grid.size() );
@@ -1769,6 +2127,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFac
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid(
                              const std::vector<double>& squared_momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( squared_momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending(
@@ -1784,6 +2144,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomic
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactor(
                         const std::vector<double>& squared_atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition(
      squared_atomic_form_factor.size() ==
@@ -1802,6 +2164,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomic
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonEnergyGrid(
                                        const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -1813,6 +2177,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointWallerHartreeIncohe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_incoherent_max_energy_grid.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -1826,6 +2192,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointWallerHartreeIncohe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_incoherent_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -1839,6 +2207,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxIncohe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_incoherent_max_energy_grid.size() <=
                     d_adjoint_photon_energy_grid.size() );
@@ -1852,6 +2222,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxIncohe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_incoherent_cross_section.size() <=
                     d_adjoint_photon_energy_grid.size() );
@@ -1864,6 +2236,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxIncohe
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure that the threshold index is valid
   testPrecondition( d_adjoint_impulse_approx_incoherent_cross_section.size() +
                     index == d_adjoint_photon_energy_grid.size() );
@@ -1876,6 +2250,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_incoherent_max_energy_grid.size() <=
                     d_adjoint_photon_energy_grid.size() );
@@ -1889,6 +2265,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_incoherent_cross_section.size() <=
                     d_adjoint_photon_energy_grid.size() );
@@ -1901,6 +2279,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure that the threshold index is valid
   testPrecondition( d_adjoint_doppler_broadened_impulse_approx_incoherent_cross_section.size() +
                     index == d_adjoint_photon_energy_grid.size() );
@@ -1914,6 +2294,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxSubshe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the max energy grid is valid
@@ -1930,6 +2312,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxSubshe
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the cross section is valid
@@ -1945,6 +2329,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxSubshe
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   testPrecondition( d_adjoint_impulse_approx_subshell_incoherent_cross_sections.find( subshell ) !=
@@ -1962,6 +2348,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the max energy grid is valid
@@ -1978,6 +2366,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the cross section is valid
@@ -1993,6 +2383,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   testPrecondition( d_adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections.find( subshell ) !=
@@ -2008,6 +2400,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointWallerHartreeCoherentCrossSection(
                             const std::vector<double>& coherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the coherent cross section is valid
   testPrecondition( coherent_cross_section.size() ==
 		    d_adjoint_photon_energy_grid.size() );
@@ -2021,6 +2415,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointWallerHartreeTotalM
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_total_max_energy_grid.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2034,6 +2430,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointWallerHartreeTotalC
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_total_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2047,6 +2445,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxTotalM
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_total_max_energy_grid.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2060,6 +2460,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointImpulseApproxTotalC
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_total_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2073,6 +2475,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_max_energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the max energy grid is valid
   testPrecondition( adjoint_total_max_energy_grid.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2086,6 +2490,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
                                        const std::vector<std::vector<double> >&
                                        adjoint_total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cross section is valid
   testPrecondition( adjoint_total_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2098,6 +2504,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointDopplerBroadenedImp
 void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2110,6 +2518,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSec
 void AdjointElectronPhotonRelaxationDataContainer::setImpulseApproxTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() ==
                     d_adjoint_photon_energy_grid.size() );
@@ -2122,6 +2532,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setImpulseApproxTotalCrossSec
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnergyDistributionGrid(
           const std::vector<double>& adjoint_pair_production_energy_dist_grid )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition( Data::energyGridValid( adjoint_pair_production_energy_dist_grid ) );
 
@@ -2133,6 +2545,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnerg
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnergyDistribution(
                const std::vector<double>& adjoint_pair_production_energy_dist )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition( adjoint_pair_production_energy_dist.size() ==
                     d_adjoint_pair_production_energy_distribution_grid.size());
@@ -2146,6 +2560,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnerg
                           const std::vector<double>&
                           adjoint_pair_production_energy_dist_norm_const_grid )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition( Data::energyGridValid(
                          adjoint_pair_production_energy_dist_norm_const_grid ) );
@@ -2159,6 +2575,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnerg
                                const std::vector<double>&
                                adjoint_pair_production_energy_dist_norm_const )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy dist. norm constant is valid
   testPrecondition( adjoint_pair_production_energy_dist_norm_const.size() ==
                     d_adjoint_pair_production_norm_constant_grid.size() );
@@ -2174,6 +2592,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPairProductionEnerg
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEnergyDistributionGrid(
        const std::vector<double>& adjoint_triplet_production_energy_dist_grid )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition( Data::energyGridValid( adjoint_triplet_production_energy_dist_grid ) );
 
@@ -2185,6 +2605,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEn
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEnergyDistribution(
             const std::vector<double>& adjoint_triplet_production_energy_dist )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition(
                  adjoint_triplet_production_energy_dist.size() ==
@@ -2199,6 +2621,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEn
                        const std::vector<double>&
                        adjoint_triplet_production_energy_dist_norm_const_grid )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy distribution grid is valid
   testPrecondition( Data::energyGridValid(
                       adjoint_triplet_production_energy_dist_norm_const_grid ) );
@@ -2212,6 +2636,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEn
                             const std::vector<double>&
                             adjoint_triplet_production_energy_dist_norm_const )
 {
+  this->loadDataBlock( PAIR_PRODUCTION_DATA_BLOCK );
+
   // Make sure the energy dist. norm constant is valid
   testPrecondition( adjoint_triplet_production_energy_dist_norm_const.size() ==
                     d_adjoint_triplet_production_norm_constant_grid.size() );
@@ -2227,6 +2653,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointTripletProductionEn
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlungEnergyGrid(
 				       const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -2238,6 +2666,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlun
 		     const double incoming_adjoint_energy,
 		     const std::vector<double>&  adjoint_photon_bremsstrahlung_energy )
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_photon_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_photon_bremsstrahlung_energy_grid.back() );
@@ -2253,6 +2683,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlun
 	 const double incoming_adjoint_energy,
 	 const std::vector<double>& adjoint_photon_bremsstrahlung_pdf )
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_photon_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_photon_bremsstrahlung_energy_grid.back() );
@@ -2267,6 +2699,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlun
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlungEnergy(
     const std::map<double,std::vector<double> >&  adjoint_photon_bremsstrahlung_energy )
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_adjoint_photon_bremsstrahlung_energy = adjoint_photon_bremsstrahlung_energy;
 }
 
@@ -2274,6 +2708,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlun
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlungPDF(
     const std::map<double,std::vector<double> >& adjoint_photon_bremsstrahlung_pdf )
 {
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_adjoint_photon_bremsstrahlung_pdf = adjoint_photon_bremsstrahlung_pdf;
 }
 
@@ -2281,6 +2717,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointPhotonBremsstrahlun
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungPhotonCrossSection(
 			 const std::vector<double>& cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the bremsstrahlung cross section is valid
   testPrecondition( cross_section.size() <=
                     d_adjoint_photon_energy_grid.size() );
@@ -2293,6 +2732,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungPhoto
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungPhotonCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+  this->loadDataBlock( PHOTON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_bremsstrahlung_photon_cross_section.size() + index ==
@@ -2335,6 +2777,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setElectronTwoDGridPolicy(
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointElasticAngularEnergyGrid(
 				       const std::vector<double>& adjoint_angular_energy_grid )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the angular energy grid is valid
   testPrecondition( adjoint_angular_energy_grid.back() > 0 );
   testPrecondition(
@@ -2351,6 +2795,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticAngles
     const double incoming_adjoint_energy,
     const std::vector<double>& adjoint_cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -2372,6 +2818,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticPDFAtE
     const double incoming_adjoint_energy,
     const std::vector<double>& adjoint_cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -2384,6 +2832,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticPDFAtE
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticAngles(
     const std::map<double,std::vector<double> >& adjoint_cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_adjoint_cutoff_elastic_angles = adjoint_cutoff_elastic_angles;
 }
 
@@ -2391,6 +2841,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticAngles
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticPDF(
     const std::map<double,std::vector<double> >& adjoint_cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_adjoint_cutoff_elastic_pdf = adjoint_cutoff_elastic_pdf;
 }
 
@@ -2401,6 +2853,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticPDF(
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingCrossSectionReduction(
     const std::vector<double>& adjoint_cross_section_reduction )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the cross_section_reduction is valid
   testPrecondition( adjoint_cross_section_reduction.size() ==
                     d_adjoint_angular_energy_grid.size() );
@@ -2414,6 +2868,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingEla
 		     const double incoming_adjoint_energy,
 		     const std::vector<double>& adjoint_moment_preserving_elastic_discrete_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -2438,6 +2894,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingEla
 			 const double incoming_adjoint_energy,
 			 const std::vector<double>& adjoint_moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   testPrecondition( incoming_adjoint_energy >= d_adjoint_angular_energy_grid.front() );
   testPrecondition( incoming_adjoint_energy <= d_adjoint_angular_energy_grid.back() );
@@ -2455,6 +2913,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingEla
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingElasticDiscreteAngles(
     const std::map<double,std::vector<double> >& adjoint_moment_preserving_elastic_discrete_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_adjoint_moment_preserving_elastic_discrete_angles =
         adjoint_moment_preserving_elastic_discrete_angles;
 }
@@ -2463,6 +2923,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingEla
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingElasticWeights(
     const std::map<double,std::vector<double> >& adjoint_moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_adjoint_moment_preserving_elastic_weights =
     adjoint_moment_preserving_elastic_weights;
 }
@@ -2470,6 +2932,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointMomentPreservingEla
 // Set the forward electroionization sampling mode
 void AdjointElectronPhotonRelaxationDataContainer::setForwardElectroionizationSamplingMode( const std::string sampling_mode )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( this->isElectroionizationSamplingModeValid( sampling_mode ) );
 
@@ -2481,6 +2945,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationEn
             const unsigned subshell,
             const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   testPrecondition( Data::energyGridValid( energy_grid ) );
@@ -2495,6 +2961,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationRe
             const double incoming_adjoint_energy,
             const std::vector<double>& recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming_adjoint_energy is valid
@@ -2521,6 +2990,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationRe
             const double incoming_adjoint_energy,
             const std::vector<double>& recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming_adjoint_energy is valid
@@ -2546,6 +3018,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationRe
     const unsigned subshell,
     const std::map<double,std::vector<double> >& recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2558,6 +3032,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationRe
     const unsigned subshell,
     const std::map<double,std::vector<double> >& recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2569,6 +3045,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationRe
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahlungEnergyGrid(
 				       const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -2580,6 +3058,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahl
 		     const double incoming_adjoint_energy,
 		     const std::vector<double>&  adjoint_electron_bremsstrahlung_energy )
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   if( this->separateAdjointBremsstrahlungEnergyGrid() )
   {
@@ -2603,6 +3084,9 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahl
 	 const double incoming_adjoint_energy,
 	 const std::vector<double>& adjoint_electron_bremsstrahlung_pdf )
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoming_adjoint_energy is valid
   if( this->separateAdjointBremsstrahlungEnergyGrid() )
   {
@@ -2625,6 +3109,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahl
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahlungEnergy(
     const std::map<double,std::vector<double> >&  adjoint_electron_bremsstrahlung_energy )
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_adjoint_electron_bremsstrahlung_energy = adjoint_electron_bremsstrahlung_energy;
 }
 
@@ -2632,6 +3118,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahl
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahlungPDF(
     const std::map<double,std::vector<double> >& adjoint_electron_bremsstrahlung_pdf )
 {
+  this->loadDataBlock( ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_adjoint_electron_bremsstrahlung_pdf = adjoint_electron_bremsstrahlung_pdf;
 }
 
@@ -2639,6 +3127,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronBremsstrahl
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationEnergyGrid(
     const std::vector<double>& adjoint_atomic_excitation_energy_grid )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( adjoint_atomic_excitation_energy_grid ) );
 
@@ -2649,6 +3139,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationEne
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationEnergyGain(
     const std::vector<double>&  adjoint_atomic_excitation_energy_gain )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   // Make sure the atomic excitation energy gain are valid
   testPrecondition( Data::valuesGreaterThanZero( adjoint_atomic_excitation_energy_gain ) );
 
@@ -2660,6 +3152,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationEne
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronEnergyGrid(
     const std::vector<double>& adjoint_energy_grid )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( adjoint_energy_grid ) );
 
@@ -2670,6 +3164,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectronEnergyGrid(
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticCrossSection(
 			 const std::vector<double>& adjoint_cutoff_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cutoff elastic cross section is valid
   testPrecondition( adjoint_cutoff_elastic_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2682,6 +3178,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticCrossS
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_cutoff_elastic_cross_section.size() + index ==
@@ -2694,6 +3192,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointCutoffElasticCrossS
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointScreenedRutherfordElasticCrossSection(
 			 const std::vector<double>& adjoint_screened_rutherford_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the screened rutherford elastic cross section is valid
   testPrecondition( adjoint_screened_rutherford_elastic_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2710,6 +3210,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointScreenedRutherfordE
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointScreenedRutherfordElasticCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_screened_rutherford_elastic_cross_section.size() + index ==
@@ -2722,6 +3224,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointScreenedRutherfordE
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointTotalElasticCrossSection(
 			 const std::vector<double>& adjoint_total_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total elastic cross section is valid
   testPrecondition( adjoint_total_elastic_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2734,6 +3238,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointTotalElasticCrossSe
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointTotalElasticCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_total_elastic_cross_section.size() + index ==
@@ -2747,6 +3253,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationCr
             const unsigned subshell,
             const std::vector<double>& cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the electroionization cross section is valid
@@ -2764,6 +3272,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationCr
             const unsigned subshell,
 	        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the threshold index is valid
@@ -2779,6 +3289,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointElectroionizationCr
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungElectronCrossSection(
 			 const std::vector<double>& cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the bremsstrahlung cross section is valid
   testPrecondition( cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2791,6 +3303,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungElect
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungElectronCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_bremsstrahlung_electron_cross_section.size() + index ==
@@ -2803,6 +3317,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointBremsstrahlungElect
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationCrossSection(
 			 const std::vector<double>& adjoint_atomic_excitation_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the atomic excitation cross section is valid
   testPrecondition( adjoint_atomic_excitation_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2817,6 +3333,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationCro
 void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationCrossSectionThresholdEnergyIndex(
 						        const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_adjoint_atomic_excitation_cross_section.size() + index ==
@@ -2829,6 +3347,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setAdjointAtomicExcitationCro
 void AdjointElectronPhotonRelaxationDataContainer::setForwardBremsstrahlungElectronCrossSection(
           const std::vector<double>& forward_bremsstrahlung_electron_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the forward bremsstrahlung electron cross section is valid
   testPrecondition( forward_bremsstrahlung_electron_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2843,6 +3363,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setForwardBremsstrahlungElect
 void AdjointElectronPhotonRelaxationDataContainer::setForwardBremsstrahlungElectronCrossSectionThresholdEnergyIndex(
                               const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_forward_bremsstrahlung_electron_cross_section.size() + index ==
                     d_adjoint_electron_energy_grid.size() );
@@ -2854,6 +3376,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setForwardBremsstrahlungElect
 void AdjointElectronPhotonRelaxationDataContainer::setForwardElectroionizationElectronCrossSection(
           const std::vector<double>& forward_electroionization_electron_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the forward electroionization electron cross section is valid
   testPrecondition( forward_electroionization_electron_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2868,6 +3392,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setForwardElectroionizationEl
 void AdjointElectronPhotonRelaxationDataContainer::setForwardElectroionizationElectronCrossSectionThresholdEnergyIndex(
                               const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_forward_electroionization_electron_cross_section.size() + index ==
                     d_adjoint_electron_energy_grid.size() );
@@ -2879,6 +3405,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setForwardElectroionizationEl
 void AdjointElectronPhotonRelaxationDataContainer::setForwardAtomicExcitationElectronCrossSection(
           const std::vector<double>& forward_atomic_excitation_electron_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the forward atomic excitationelectron cross section is valid
   testPrecondition( forward_atomic_excitation_electron_cross_section.size() <=
                     d_adjoint_electron_energy_grid.size() );
@@ -2893,6 +3421,8 @@ void AdjointElectronPhotonRelaxationDataContainer::setForwardAtomicExcitationEle
 void AdjointElectronPhotonRelaxationDataContainer::setForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex(
                               const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_forward_atomic_excitation_electron_cross_section.size() + index ==
                     d_adjoint_electron_energy_grid.size() );
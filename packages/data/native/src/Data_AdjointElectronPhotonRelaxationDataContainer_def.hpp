@@ -22,295 +22,305 @@
 namespace Data{
 
 // Save the data to an archive
+/*! \details Binary and HDF5 archives store every data block as a single
+ * binary record. All other archives store the data fields directly (in the
+ * same order that version 0 archives use).
+ */
 template<typename Archive>
 void AdjointElectronPhotonRelaxationDataContainer::save( Archive& ar,
                                                    const unsigned version) const
 {
-  // Notes
-  DATA_MAKE_NVP_DEFAULT( ar, notes );
-
-  // Basic Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_number );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_weight );
-  DATA_MAKE_NVP_DEFAULT( ar, min_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, min_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_electron_energy );
-
-  // Photon Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_threshold_energy_nudge_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_dist_norm_constant_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_dist_norm_constant_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_dist_norm_constant_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_dist_norm_constant_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_energy_to_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_distance_tol );
+  const bool use_data_block_records =
+    Details::UsesDataBlockRecords<Archive>::value;
 
-  // Electron Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_angle_cosine );
-  DATA_MAKE_NVP_DEFAULT( ar, number_of_adjoint_moment_preserving_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_min_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_convergence_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_min_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_distance_tol );
-
-  // Relaxation Data
-  DATA_MAKE_NVP_DEFAULT( ar, subshells );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_occupancies );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_binding_energies );
+  // Table Data
+  AdjointElectronPhotonRelaxationDataContainer::serializeTableData( ar, *this );
 
   // Photon Data
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profile_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profiles );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hartree_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hartree_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_max_energy_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_max_energy_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hatree_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hatree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_distribution_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_distribution );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_norm_constant_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_norm_constant );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_distribution_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_distribution );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_norm_constant_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_norm_constant );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_photon_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_photon_cross_section_threshold_index );
+  for( int i = COMPTON_PROFILE_DATA_BLOCK; i <= PHOTON_BREMSSTRAHLUNG_DATA_BLOCK; ++i )
+  {
+    this->saveDataBlockToArchive( ar, (DataBlock)i, use_data_block_records );
+  }
 
   // Electron Data
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_angular_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_cross_section_reductions );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_elastic_discrete_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_elastic_weights );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_sampling_mode );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_recoil_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_recoil_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_energy_gain );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_screened_rutherford_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_screened_rutherford_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_total_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_total_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_subshell_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_subshell_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_bremsstrahlung_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_bremsstrahlung_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_atomic_excitation_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_atomic_excitation_electron_cross_section_threshold_index );
+  AdjointElectronPhotonRelaxationDataContainer::serializeElectronTwoDData( ar, *this );
+
+  for( int i = ELASTIC_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->saveDataBlockToArchive( ar, (DataBlock)i, use_data_block_records );
+  }
 }
 
 // Load the data from an archive
+/*! \details The data block records will not be decoded here. Version 0
+ * archives never contain data block records.
+ */
 template<typename Archive>
 void AdjointElectronPhotonRelaxationDataContainer::load( Archive& ar,
                                                         const unsigned version )
+{
+  const bool use_data_block_records = version > 0 &&
+    Details::UsesDataBlockRecords<Archive>::value;
+
+  d_data_block_records.clear();
+  d_data_block_records.resize( ELECTRON_CROSS_SECTION_DATA_BLOCK+1 );
+
+  // Table Data
+  AdjointElectronPhotonRelaxationDataContainer::serializeTableData( ar, *this );
+
+  // Photon Data
+  for( int i = COMPTON_PROFILE_DATA_BLOCK; i <= PHOTON_BREMSSTRAHLUNG_DATA_BLOCK; ++i )
+  {
+    this->loadDataBlockFromArchive( ar, (DataBlock)i, use_data_block_records );
+  }
+
+  // Electron Data
+  AdjointElectronPhotonRelaxationDataContainer::serializeElectronTwoDData( ar, *this );
+
+  for( int i = ELASTIC_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->loadDataBlockFromArchive( ar, (DataBlock)i, use_data_block_records );
+  }
+}
+
+// Serialize the table data (always loaded)
+template<typename Archive, typename ContainerType>
+void AdjointElectronPhotonRelaxationDataContainer::serializeTableData(
+                                                  Archive& ar,
+                                                  ContainerType& container )
 {
   // Notes
-  DATA_MAKE_NVP_DEFAULT( ar, notes );
+  DATA_MAKE_NVP( ar, container.d_, notes );
 
   // Basic Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_number );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_weight );
-  DATA_MAKE_NVP_DEFAULT( ar, min_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, min_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_electron_energy );
+  DATA_MAKE_NVP( ar, container.d_, atomic_number );
+  DATA_MAKE_NVP( ar, container.d_, atomic_weight );
+  DATA_MAKE_NVP( ar, container.d_, min_photon_energy );
+  DATA_MAKE_NVP( ar, container.d_, max_photon_energy );
+  DATA_MAKE_NVP( ar, container.d_, min_electron_energy );
+  DATA_MAKE_NVP( ar, container.d_, max_electron_energy );
 
   // Photon Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_threshold_energy_nudge_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_dist_norm_constant_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_dist_norm_constant_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_dist_norm_constant_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_dist_norm_constant_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_energy_to_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_incoherent_grid_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_photon_grid_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_photon_grid_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_photon_grid_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_photon_threshold_energy_nudge_factor );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_photon_tabular_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_energy_dist_norm_constant_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_energy_dist_norm_constant_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_energy_dist_norm_constant_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_energy_dist_norm_constant_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_max_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_energy_to_max_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_grid_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_grid_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_incoherent_grid_distance_tol );
 
   // Electron Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_angle_cosine );
-  DATA_MAKE_NVP_DEFAULT( ar, number_of_adjoint_moment_preserving_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_min_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_convergence_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_min_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_max_energy_nudge_value );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, cutoff_angle_cosine );
+  DATA_MAKE_NVP( ar, container.d_, number_of_adjoint_moment_preserving_angles );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electron_grid_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electron_grid_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electron_grid_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, electron_tabular_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_min_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_max_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_evaluation_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_convergence_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_min_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_max_energy_nudge_value );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_distance_tol );
 
   // Relaxation Data
-  DATA_MAKE_NVP_DEFAULT( ar, subshells );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_occupancies );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_binding_energies );
+  DATA_MAKE_NVP( ar, container.d_, subshells );
+  DATA_MAKE_NVP( ar, container.d_, subshell_occupancies );
+  DATA_MAKE_NVP( ar, container.d_, subshell_binding_energies );
+}
 
-  // Photon Data
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profile_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profiles );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hartree_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hartree_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_max_energy_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_max_energy_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hatree_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_waller_hatree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_total_max_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_doppler_broadened_impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_distribution_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_energy_distribution );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_norm_constant_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_pair_production_norm_constant );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_distribution_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_energy_distribution );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_norm_constant_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_triplet_production_norm_constant );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_photon_bremsstrahlung_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_photon_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_photon_cross_section_threshold_index );
-  
-  // Electron Data
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_angular_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_cross_section_reductions );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_elastic_discrete_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_moment_preserving_elastic_weights );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_sampling_mode );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_recoil_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_recoil_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_bremsstrahlung_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_energy_gain );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electron_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_cutoff_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_screened_rutherford_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_screened_rutherford_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_total_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_total_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_subshell_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_electroionization_subshell_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_bremsstrahlung_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, adjoint_atomic_excitation_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_bremsstrahlung_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_bremsstrahlung_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_electroionization_electron_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_atomic_excitation_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, forward_atomic_excitation_electron_cross_section_threshold_index );
+// Serialize the electron 2D distribution data (always loaded)
+template<typename Archive, typename ContainerType>
+void AdjointElectronPhotonRelaxationDataContainer::serializeElectronTwoDData(
+                                                  Archive& ar,
+                                                  ContainerType& container )
+{
+  DATA_MAKE_NVP( ar, container.d_, electron_two_d_interp );
+  DATA_MAKE_NVP( ar, container.d_, electron_two_d_grid );
+}
+
+// Serialize a data block
+template<typename Archive, typename ContainerType>
+void AdjointElectronPhotonRelaxationDataContainer::serializeDataBlock(
+                                                  Archive& ar,
+                                                  ContainerType& container,
+                                                  const DataBlock data_block )
+{
+  switch( data_block )
+  {
+    case COMPTON_PROFILE_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, compton_profile_momentum_grids );
+      DATA_MAKE_NVP( ar, container.d_, compton_profiles );
+      DATA_MAKE_NVP( ar, container.d_, occupation_number_momentum_grids );
+      DATA_MAKE_NVP( ar, container.d_, occupation_numbers );
+      break;
+    case FORM_FACTOR_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_scattering_function_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_scattering_function );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_atomic_form_factor_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_atomic_form_factor );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_squared_atomic_form_factor );
+      break;
+    case PHOTON_CROSS_SECTION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_photon_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_waller_hartree_incoherent_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_waller_hartree_incoherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_incoherent_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_incoherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_incoherent_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_incoherent_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_incoherent_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_subshell_incoherent_max_energy_grids );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_subshell_incoherent_cross_sections );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_max_energy_grids );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_sections );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_coherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_waller_hatree_total_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_waller_hatree_total_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_total_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_impulse_approx_total_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_total_max_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_doppler_broadened_impulse_approx_total_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_total_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_total_cross_section );
+      break;
+    case PAIR_PRODUCTION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_energy_distribution_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_energy_distribution );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_norm_constant_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_pair_production_norm_constant );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_energy_distribution_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_energy_distribution );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_norm_constant_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_triplet_production_norm_constant );
+      break;
+    case PHOTON_BREMSSTRAHLUNG_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_photon_bremsstrahlung_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_photon_bremsstrahlung_energy );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_photon_bremsstrahlung_pdf );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_photon_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_photon_cross_section_threshold_index );
+      break;
+    case ELASTIC_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_angular_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_cutoff_elastic_angles );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_cutoff_elastic_pdf );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_moment_preserving_cross_section_reductions );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_moment_preserving_elastic_discrete_angles );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_moment_preserving_elastic_weights );
+      break;
+    case ELECTROIONIZATION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, forward_electroionization_sampling_mode );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_recoil_energy );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_recoil_pdf );
+      break;
+    case ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electron_bremsstrahlung_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electron_bremsstrahlung_energy );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electron_bremsstrahlung_pdf );
+      break;
+    case ATOMIC_EXCITATION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_atomic_excitation_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_atomic_excitation_energy_gain );
+      break;
+    case ELECTRON_CROSS_SECTION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electron_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_cutoff_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_cutoff_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_screened_rutherford_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_screened_rutherford_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_total_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_total_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_subshell_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_electroionization_subshell_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_electron_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_bremsstrahlung_electron_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_atomic_excitation_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, adjoint_atomic_excitation_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, forward_bremsstrahlung_electron_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, forward_bremsstrahlung_electron_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, forward_electroionization_electron_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, forward_electroionization_electron_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, forward_atomic_excitation_electron_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, forward_atomic_excitation_electron_cross_section_threshold_index );
+      break;
+  }
+}
+
+// Save a data block to an archive
+/*! \details A data block that has not been loaded will be saved using its
+ * original record.
+ */
+template<typename Archive>
+void AdjointElectronPhotonRelaxationDataContainer::saveDataBlockToArchive(
+                                     Archive& ar,
+                                     const DataBlock data_block,
+                                     const bool use_data_block_record ) const
+{
+  if( use_data_block_record )
+  {
+    const std::string record_name =
+      AdjointElectronPhotonRelaxationDataContainer::getDataBlockName( data_block );
+
+    if( this->isDataBlockLoaded( data_block ) )
+    {
+      std::vector<char> data_block_record;
+
+      this->createDataBlockRecord( data_block, data_block_record );
+
+      ar & boost::serialization::make_nvp( record_name.c_str(),
+                                           data_block_record );
+    }
+    else
+    {
+      ar & boost::serialization::make_nvp( record_name.c_str(),
+                                           d_data_block_records[data_block] );
+    }
+  }
+  else
+  {
+    this->loadDataBlock( data_block );
+
+    AdjointElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
+  }
+}
+
+// Load a data block from an archive
+template<typename Archive>
+void AdjointElectronPhotonRelaxationDataContainer::loadDataBlockFromArchive(
+                                           Archive& ar,
+                                           const DataBlock data_block,
+                                           const bool use_data_block_record )
+{
+  if( use_data_block_record )
+  {
+    const std::string record_name =
+      AdjointElectronPhotonRelaxationDataContainer::getDataBlockName( data_block );
+
+    ar & boost::serialization::make_nvp( record_name.c_str(),
+                                         d_data_block_records[data_block] );
+  }
+  else
+    AdjointElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
 }
 
 } // end Data namespace
@@ -12,11 +12,15 @@
 #include <sstream>
 #include <typeinfo>
 
+// Boost Includes
+#include <boost/interprocess/streams/bufferstream.hpp>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_DataContainerHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Data{
@@ -30,6 +34,31 @@ ElectronPhotonRelaxationDataContainer::ElectronPhotonRelaxationDataContainer(
 {
   // Import the data in the archive
   this->loadFromFile( file_name_with_path );
+
+  // Decode all of the data block records
+  this->loadAllDataBlocks();
+}
+
+// Constructor (from saved archive - the other data blocks are lazy)
+/*! \details Only the requested data blocks will be decoded. The remaining
+ * data blocks will be decoded when they are first accessed. Archives that
+ * do not store data block records (e.g. xml archives) are always loaded
+ * completely.
+ */
+ElectronPhotonRelaxationDataContainer::ElectronPhotonRelaxationDataContainer(
+                           const boost::filesystem::path& file_name_with_path,
+                           const std::set<DataBlock>& data_blocks )
+{
+  // Import the data in the archive
+  this->loadFromFile( file_name_with_path );
+
+  // Decode the requested data block records
+  for( std::set<DataBlock>::const_iterator data_block_it = data_blocks.begin();
+       data_block_it != data_blocks.end();
+       ++data_block_it )
+  {
+    this->loadDataBlock( *data_block_it );
+  }
 }
 
 // Load the archived object (implementation)
@@ -79,6 +108,136 @@ const char* ElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Return the name of a data block
+std::string ElectronPhotonRelaxationDataContainer::getDataBlockName(
+                                                  const DataBlock data_block )
+{
+  switch( data_block )
+  {
+    case RELAXATION_DATA_BLOCK:
+      return "relaxation_data_block";
+    case COMPTON_PROFILE_DATA_BLOCK:
+      return "compton_profile_data_block";
+    case FORM_FACTOR_DATA_BLOCK:
+      return "form_factor_data_block";
+    case PHOTON_CROSS_SECTION_DATA_BLOCK:
+      return "photon_cross_section_data_block";
+    case ELASTIC_DATA_BLOCK:
+      return "elastic_data_block";
+    case ELECTROIONIZATION_DATA_BLOCK:
+      return "electroionization_data_block";
+    case BREMSSTRAHLUNG_DATA_BLOCK:
+      return "bremsstrahlung_data_block";
+    case ATOMIC_EXCITATION_DATA_BLOCK:
+      return "atomic_excitation_data_block";
+    case ELECTRON_CROSS_SECTION_DATA_BLOCK:
+      return "electron_cross_section_data_block";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Data block " << (int)data_block << " is unknown!" );
+    }
+  }
+}
+
+// Check if a data block has been loaded
+/*! \details A data block that is not stored in the archive that the
+ * container was loaded from (or a data block of a container that was not
+ * loaded from an archive) is considered to be loaded.
+ */
+bool ElectronPhotonRelaxationDataContainer::isDataBlockLoaded(
+                                            const DataBlock data_block ) const
+{
+  if( (size_t)data_block < d_data_block_records.size() )
+    return d_data_block_records[data_block].empty();
+  else
+    return true;
+}
+
+// Load a data block (if it has not been loaded yet)
+/*! \details The data block record will be released once it has been decoded.
+ * Data blocks of different containers can be loaded concurrently. The first
+ * access to a data block of a single container must not be concurrent with
+ * other accesses to the same container.
+ */
+void ElectronPhotonRelaxationDataContainer::loadDataBlock(
+                                            const DataBlock data_block ) const
+{
+  if( this->isDataBlockLoaded( data_block ) )
+    return;
+
+  // The data block fields are logically part of the (const) container state -
+  // they simply have not been decoded yet
+  ElectronPhotonRelaxationDataContainer& mutable_container =
+    const_cast<ElectronPhotonRelaxationDataContainer&>( *this );
+
+  std::vector<char>& data_block_record = d_data_block_records[data_block];
+
+  // The bpis pointer must be NULL (see loadFromFileImpl)
+  const boost::archive::detail::basic_pointer_iserializer* bpis =
+    this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+  std::string error_message;
+
+  try{
+    boost::interprocess::ibufferstream
+      iss( data_block_record.data(), data_block_record.size() );
+
+    boost::archive::binary_iarchive ar( static_cast<std::istream&>( iss ),
+                                        boost::archive::no_header );
+
+    ElectronPhotonRelaxationDataContainer::serializeDataBlock(
+                                                ar, mutable_container, data_block );
+  }
+  catch( const std::exception& exception )
+  {
+    error_message = exception.what();
+  }
+
+  this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      "Could not load the "
+                      << ElectronPhotonRelaxationDataContainer::getDataBlockName( data_block )
+                      << ": " << error_message );
+
+  // Release the data block record
+  std::vector<char>().swap( data_block_record );
+}
+
+// Load all of the data blocks
+void ElectronPhotonRelaxationDataContainer::loadAllDataBlocks() const
+{
+  for( int i = RELAXATION_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+    this->loadDataBlock( (DataBlock)i );
+}
+
+// Create a data block record
+void ElectronPhotonRelaxationDataContainer::createDataBlockRecord(
+                               const DataBlock data_block,
+                               std::vector<char>& data_block_record ) const
+{
+  // The bpos pointer must be NULL (see saveToFileImpl)
+  const boost::archive::detail::basic_pointer_oserializer* bpos =
+    this->resetBposPointer<std::vector<double> >( ".bin" );
+
+  std::ostringstream oss;
+
+  {
+    boost::archive::binary_oarchive ar( oss, boost::archive::no_header );
+
+    ElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
+  }
+
+  this->restoreBposPointer<std::vector<double> >( ".bin", bpos );
+
+  const std::string raw_data_block_record = oss.str();
+
+  data_block_record.assign( raw_data_block_record.begin(),
+                            raw_data_block_record.end() );
+}
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -286,6 +445,8 @@ double ElectronPhotonRelaxationDataContainer::getSubshellBindingEnergy(
 // Return if there is relaxation data
 bool ElectronPhotonRelaxationDataContainer::hasRelaxationData() const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   return d_relaxation_transitions.size() > 0;
 }
 
@@ -293,6 +454,8 @@ bool ElectronPhotonRelaxationDataContainer::hasRelaxationData() const
 bool ElectronPhotonRelaxationDataContainer::hasSubshellRelaxationData(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -305,6 +468,8 @@ bool ElectronPhotonRelaxationDataContainer::hasSubshellRelaxationData(
 unsigned ElectronPhotonRelaxationDataContainer::getSubshellRelaxationTransitions(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -317,6 +482,8 @@ const std::vector<std::pair<unsigned,unsigned> >&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationVacancies(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -329,6 +496,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationParticleEnergies(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -341,6 +510,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationProbabilities(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -357,6 +528,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getComptonProfileMomentumGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -369,6 +542,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getComptonProfile(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -381,6 +556,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getOccupationNumberMomentumGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -393,6 +570,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getOccupationNumber(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -404,6 +583,8 @@ ElectronPhotonRelaxationDataContainer::getOccupationNumber(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function_momentum_grid;
 }
 
@@ -411,6 +592,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentu
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function;
 }
 
@@ -418,12 +601,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() cons
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor_momentum_grid;
 }
 
 // Return the Waller-Hartree atomic form factor
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor;
 }
 
@@ -431,6 +618,8 @@ const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
 }
 
@@ -438,6 +627,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSq
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor;
 }
 
@@ -445,12 +636,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor()
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getPhotonEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photon_energy_grid;
 }
 
 // Check if there are average heating numbers
 bool ElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_has_average_photon_heating_numbers;
 }
 
@@ -458,6 +653,8 @@ bool ElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() con
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_average_photon_heating_numbers;
 }
 
@@ -465,6 +662,8 @@ ElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_incoherent_cross_section;
 }
 
@@ -472,6 +671,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection()
 unsigned
 ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_incoherent_cross_section_threshold_index;
 }
 
@@ -479,6 +680,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_incoherent_cross_section;
 }
 
@@ -486,6 +689,8 @@ ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection()
 unsigned
 ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_incoherent_cross_section_threshold_index;
 }
 
@@ -494,6 +699,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -506,6 +713,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -517,6 +726,8 @@ ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSe
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_coherent_cross_section;
 }
 
@@ -524,6 +735,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() co
 unsigned
 ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_coherent_cross_section_threshold_index;
 }
 
@@ -531,12 +744,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThres
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getPairProductionCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_pair_production_cross_section;
 }
 
 // Return the pair production cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_pair_production_cross_section_threshold_index;
 }
 
@@ -544,24 +761,32 @@ unsigned ElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_triplet_production_cross_section;
 }
 
 // Return the triplet production cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_triplet_production_cross_section_threshold_index;
 }
 
 // Return the Photoelectric effect cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photoelectric_cross_section;
 }
 
 // Return the Photoelectric effect cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photoelectric_cross_section_threshold_index;
 }
 
@@ -570,6 +795,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -582,6 +809,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -592,12 +821,16 @@ ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThres
 // Return the Waller-Hartree total cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_total_cross_section;
 }
 
 // Return the impulse approx. total cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_total_cross_section;
 }
 
@@ -624,6 +857,8 @@ ElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_angular_energy_grid;
 }
 
@@ -631,6 +866,8 @@ ElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticInterpPolicy() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_cutoff_elastic_interp;
 }
 
@@ -638,6 +875,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticInterpPolicy() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_cutoff_elastic_angles;
 }
 
@@ -645,6 +884,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_cutoff_elastic_pdf;
 }
 
@@ -653,6 +894,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -665,6 +908,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -695,6 +940,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF(
 // Return if there is moment preserving data
 bool ElectronPhotonRelaxationDataContainer::hasMomentPreservingData() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_moment_preserving_elastic_discrete_angles.size() > 0;
 }
 
@@ -702,6 +949,8 @@ bool ElectronPhotonRelaxationDataContainer::hasMomentPreservingData() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_moment_preserving_elastic_discrete_angles;
 }
 
@@ -709,6 +958,8 @@ ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles(
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_moment_preserving_elastic_weights;
 }
 
@@ -717,6 +968,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -729,6 +982,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -742,6 +997,8 @@ ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingCrossSectionReduction() const
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   return d_moment_preserving_cross_section_reductions;
 }
 
@@ -750,6 +1007,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectroionizationEnergyGrid(
                             const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -760,6 +1019,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationEnergyGrid(
 const std::string&
 ElectronPhotonRelaxationDataContainer::getElectroionizationInterpPolicy() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   return d_electroionization_interp;
 }
 
@@ -768,6 +1029,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilEnergy(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -780,6 +1043,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilEnergy(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -798,6 +1063,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -810,6 +1077,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -826,6 +1095,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
 // Return if there is electroionization outgoing energy data
 bool ElectronPhotonRelaxationDataContainer::hasElectroionizationOutgoingEnergyData() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   return d_electroionization_outgoing_energy.size() > 0;
 }
 
@@ -834,6 +1105,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingEnergy(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -846,6 +1119,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingEnergy(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -866,6 +1141,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -880,6 +1157,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -899,6 +1178,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_bremsstrahlung_energy_grid;
 }
 
@@ -906,6 +1187,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonInterpPolicy() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_interp;
 }
 
@@ -913,6 +1196,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonInterpPolicy() con
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_energy;
 }
 
@@ -921,6 +1206,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -932,6 +1219,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy(
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_pdf;
 }
 
@@ -940,6 +1229,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -951,6 +1242,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_grid;
 }
 
@@ -958,6 +1251,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_loss_interp;
 }
 
@@ -965,6 +1260,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_loss;
 }
 
@@ -972,6 +1269,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electron_energy_grid;
 }
 
@@ -979,6 +1278,8 @@ ElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electron_cross_section_interp;
 }
 
@@ -986,6 +1287,8 @@ ElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() con
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_electron_cross_section;
 }
 
@@ -993,6 +1296,8 @@ ElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_cutoff_elastic_cross_section;
 }
 
@@ -1000,12 +1305,16 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_cutoff_elastic_cross_section_threshold_index;
 }
 // Return the screened Rutherford elastic electron cross section
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_screened_rutherford_elastic_cross_section;
 }
 
@@ -1013,6 +1322,8 @@ ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection(
 unsigned
 ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_screened_rutherford_elastic_cross_section_threshold_index;
 }
 
@@ -1020,6 +1331,8 @@ ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionT
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_elastic_cross_section;
 }
 
@@ -1027,6 +1340,8 @@ ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_elastic_cross_section_threshold_index;
 }
 
@@ -1035,6 +1350,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSection(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electroionization_subshell_cross_section.find( subshell )->second;
 }
 
@@ -1043,6 +1360,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThresholdEnergyIndex(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electroionization_subshell_cross_section_threshold_index.find( subshell )->second;
 }
 
@@ -1050,6 +1369,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThreshold
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_bremsstrahlung_cross_section;
 }
 
@@ -1057,6 +1378,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_bremsstrahlung_cross_section_threshold_index;
 }
 
@@ -1064,6 +1387,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEne
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_atomic_excitation_cross_section;
 }
 
@@ -1071,6 +1396,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_atomic_excitation_cross_section_threshold_index;
 }
 
@@ -1400,6 +1727,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationTransitions(
                            const unsigned subshell,
                            const unsigned transitions )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -1411,6 +1740,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationVacancies(
        const unsigned subshell,
        const std::vector<std::pair<unsigned,unsigned> >& relaxation_vacancies )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation vacancies are valid
@@ -1425,6 +1756,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationParticleEnergie
               const unsigned subshell,
               const std::vector<double>& relaxation_particle_energies )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation particle energies are valid
@@ -1439,6 +1772,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationProbabilities(
                           const unsigned subshell,
                           const std::vector<double>& relaxation_probabilities )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation cdf is valid
@@ -1458,6 +1793,8 @@ void ElectronPhotonRelaxationDataContainer::setComptonProfileMomentumGrid(
                      const unsigned subshell,
                      const std::vector<double>& compton_profile_momentum_grid )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the momentum grid is valid
@@ -1475,6 +1812,8 @@ void ElectronPhotonRelaxationDataContainer::setComptonProfile(
                                    const unsigned subshell,
                                    const std::vector<double>& compton_profile )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the compton_profile is valid
@@ -1490,6 +1829,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumberMomentumGrid(
                     const unsigned subshell,
                     const std::vector<double>& occupation_number_momentum_grid )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number momentum grid is valid
@@ -1507,6 +1848,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumber(
                                   const unsigned subshell,
                                   const std::vector<double>& occupation_number )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number is valid
@@ -1522,6 +1865,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumber(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunctionMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1535,6 +1880,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunctionMo
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunction(
                                const std::vector<double>& scattering_function )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the scattering function is valid
   testPrecondition( scattering_function.size() ==
                     d_waller_hartree_scattering_function_momentum_grid.size());
@@ -1548,6 +1895,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunction(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactorMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1561,6 +1910,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactorMome
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactor(
                                 const std::vector<double>& atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition( atomic_form_factor.size() ==
                     d_waller_hartree_atomic_form_factor_momentum_grid.size() );
@@ -1577,6 +1928,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactor(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid(
                              const std::vector<double>& squared_momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( squared_momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending(
@@ -1592,6 +1945,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFac
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactor(
                         const std::vector<double>& squared_atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition(
      squared_atomic_form_factor.size() ==
@@ -1610,6 +1965,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFac
 void ElectronPhotonRelaxationDataContainer::setPhotonEnergyGrid(
                                        const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -1620,6 +1977,8 @@ void ElectronPhotonRelaxationDataContainer::setPhotonEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setHasAveragePhotonHeatingNumbers(
                                                const bool has_heating_numbers )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   d_has_average_photon_heating_numbers = has_heating_numbers;
 }
 
@@ -1627,6 +1986,8 @@ void ElectronPhotonRelaxationDataContainer::setHasAveragePhotonHeatingNumbers(
 void ElectronPhotonRelaxationDataContainer::setAveragePhotonHeatingNumbers(
                                    const std::vector<double>& heating_numbers )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the heating numbers are valid
   testPrecondition( heating_numbers.size() == d_photon_energy_grid.size() );
 
@@ -1637,6 +1998,8 @@ void ElectronPhotonRelaxationDataContainer::setAveragePhotonHeatingNumbers(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSection(
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoherent cross section is valid
   testPrecondition( incoherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1649,6 +2012,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_waller_hartree_incoherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1660,6 +2025,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSection(
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoherent cross section is valid
   testPrecondition( incoherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1672,6 +2039,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_impulse_approx_incoherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1684,6 +2053,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
                           const unsigned subshell,
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoherent cross section is valid
@@ -1700,6 +2071,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the threshold index is valid
@@ -1718,6 +2091,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection(
                             const std::vector<double>& coherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the coherent cross section is valid
   testPrecondition( coherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1730,6 +2105,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_waller_hartree_coherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1741,6 +2118,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection
 void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSection(
                      const std::vector<double>& pair_production_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the pair production cross section is valid
   testPrecondition( pair_production_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1753,6 +2132,8 @@ void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSection(
 void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_pair_production_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1764,6 +2145,8 @@ void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSectionThresho
 void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSection(
                   const std::vector<double>& triplet_production_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the triplet production cross section is valid
   testPrecondition( triplet_production_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1776,6 +2159,8 @@ void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSection(
 void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_triplet_production_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1787,6 +2172,8 @@ void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSectionThre
 void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSection(
                        const std::vector<double>& photoelectric_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the photoelectric cross section is valid
   testPrecondition( photoelectric_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1798,6 +2185,8 @@ void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSection(
 void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_photoelectric_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1810,6 +2199,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
                        const unsigned subshell,
                        const std::vector<double>& photoelectric_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the photoelectric cross section is valid
@@ -1826,6 +2217,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the index is valid
@@ -1843,6 +2236,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() == d_photon_energy_grid.size());
   testPrecondition( Data::valuesGreaterThanZero( total_cross_section ) );
@@ -1854,6 +2249,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSection(
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() == d_photon_energy_grid.size());
   testPrecondition( Data::valuesGreaterThanZero( total_cross_section ) );
@@ -1890,6 +2287,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronTwoDGridPolicy(
 void ElectronPhotonRelaxationDataContainer::setElasticAngularEnergyGrid(
                        const std::vector<double>& angular_energy_grid )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the angular energy grid is valid
   testPrecondition( angular_energy_grid.back() > 0 );
   testPrecondition(
@@ -1905,6 +2304,8 @@ void ElectronPhotonRelaxationDataContainer::setElasticAngularEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticInterpPolicy(
     const std::string& cutoff_elastic_interp )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( cutoff_elastic_interp ) );
 
@@ -1916,6 +2317,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticAnglesAtEnergy(
     const double incoming_energy,
     const std::vector<double>& cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -1937,6 +2340,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDFAtEnergy(
     const double incoming_energy,
     const std::vector<double>& cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -1949,6 +2354,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDFAtEnergy(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticAngles(
     const std::map<double,std::vector<double> >& cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_cutoff_elastic_angles = cutoff_elastic_angles;
 }
 
@@ -1956,12 +2363,16 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticAngles(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDF(
     const std::map<double,std::vector<double> >& cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_cutoff_elastic_pdf = cutoff_elastic_pdf;
 }
 
 // Clear all the moment preserving data
 void ElectronPhotonRelaxationDataContainer::clearMomentPreservingData()
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   d_moment_preserving_elastic_discrete_angles.clear();
   d_moment_preserving_elastic_weights.clear();
   d_moment_preserving_cross_section_reductions.clear();
@@ -1971,6 +2382,8 @@ void ElectronPhotonRelaxationDataContainer::clearMomentPreservingData()
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAngles(
   const std::map<double,std::vector<double> >& moment_preserving_elastic_discrete_angles)
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the moment preserving elastic discrete angles are valid
   testPrecondition( moment_preserving_elastic_discrete_angles.size() ==
                     this->getElasticAngularEnergyGrid().size() );
@@ -1982,6 +2395,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAn
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
   const std::map<double,std::vector<double> >& moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the moment preserving elastic weights are valid
   testPrecondition( moment_preserving_elastic_weights.size() ==
                     this->getElasticAngularEnergyGrid().size() );
@@ -1994,6 +2409,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAn
             const double incoming_energy,
             const std::vector<double>& moment_preserving_elastic_discrete_angles )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -2018,6 +2435,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
             const double incoming_energy,
             const std::vector<double>& moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -2040,6 +2459,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingCrossSectionReduction(
     const std::vector<double>& cross_section_reduction )
 {
+  this->loadDataBlock( ELASTIC_DATA_BLOCK );
+
   // Make sure the cross_section_reduction is valid
   testPrecondition( cross_section_reduction.size() ==
                     d_angular_energy_grid.size() );
@@ -2052,6 +2473,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationEnergyGrid(
             const unsigned subshell,
             const std::vector<double>& electroionization_energy_grid )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   testPrecondition( Data::energyGridValid( electroionization_energy_grid ) );
@@ -2063,6 +2486,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setElectroionizationInterpPolicy(
     const std::string& electroionization_interp )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( electroionization_interp ) );
 
@@ -2075,6 +2500,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilEnergyAtIn
             const double incoming_energy,
             const std::vector<double>& electroionization_recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2093,6 +2520,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilPDFAtIncom
             const double incoming_energy,
             const std::vector<double>& electroionization_recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2110,6 +2539,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilEnergy(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2122,6 +2553,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilPDF(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2135,6 +2568,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingEnergyAt
             const double incoming_energy,
             const std::vector<double>& electroionization_outgoing_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2158,6 +2593,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDFAtInc
             const double incoming_energy,
             const std::vector<double>& electroionization_outgoing_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2179,6 +2616,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingEnergy(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_outgoing_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2191,6 +2630,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDF(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_outgoing_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2202,6 +2643,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDF(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungEnergyGrid(
                        const std::vector<double>& bremsstrahlung_energy_grid )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( bremsstrahlung_energy_grid ) );
 
@@ -2212,6 +2655,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonInterpPolicy(
     const std::string& bremsstrahlung_photon_interp )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( bremsstrahlung_photon_interp ) );
 
@@ -2223,6 +2668,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergyAtIncom
              const double incoming_energy,
              const std::vector<double>&  bremsstrahlung_photon_energy )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -2238,6 +2685,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDFAtIncoming
              const double incoming_energy,
              const std::vector<double>& bremsstrahlung_photon_pdf )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -2251,6 +2700,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDFAtIncoming
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergy(
     const std::map<double,std::vector<double> >&  bremsstrahlung_photon_energy )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_bremsstrahlung_photon_energy = bremsstrahlung_photon_energy;
 }
 
@@ -2258,6 +2709,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergy(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDF(
     const std::map<double,std::vector<double> >& bremsstrahlung_photon_pdf )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DATA_BLOCK );
+
   d_bremsstrahlung_photon_pdf = bremsstrahlung_photon_pdf;
 }
 
@@ -2265,6 +2718,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDF(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyGrid(
                        const std::vector<double>& atomic_excitation_energy_grid )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( atomic_excitation_energy_grid ) );
 
@@ -2275,6 +2730,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLossInterpPolicy(
     const std::string& atomic_excitation_energy_loss_interp )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( atomic_excitation_energy_loss_interp ) );
 
@@ -2285,6 +2742,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLossInterpP
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLoss(
              const std::vector<double>&  atomic_excitation_energy_loss )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DATA_BLOCK );
+
   // Make sure the atomic excitation energy loss are valid
   testPrecondition( Data::valuesGreaterThanZero( atomic_excitation_energy_loss ) );
 
@@ -2295,6 +2754,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLoss(
 void ElectronPhotonRelaxationDataContainer::setElectronEnergyGrid(
                        const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -2305,6 +2766,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setElectronCrossSectionInterpPolicy(
     const std::string& electron_cross_section_interp )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the atomic excitation energy loss are valid
   testPrecondition( isInterpPolicyValid( electron_cross_section_interp ) );
 
@@ -2315,6 +2778,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronCrossSectionInterpPolicy(
 void ElectronPhotonRelaxationDataContainer::setTotalElectronCrossSection(
              const std::vector<double>& total_electron_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total electron cross section is valid
   testPrecondition( total_electron_cross_section.size() ==
                     d_electron_energy_grid.size() );
@@ -2327,6 +2792,8 @@ void ElectronPhotonRelaxationDataContainer::setTotalElectronCrossSection(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSection(
              const std::vector<double>& cutoff_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cutoff elastic cross section is valid
   testPrecondition( cutoff_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2339,6 +2806,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSection(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_cutoff_elastic_cross_section.size() + index ==
@@ -2351,6 +2820,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSectionThreshol
 void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSection(
              const std::vector<double>& screened_rutherford_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the screened rutherford elastic cross section is valid
   testPrecondition( screened_rutherford_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2366,6 +2837,8 @@ void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSec
 void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_screened_rutherford_elastic_cross_section.size() + index ==
@@ -2378,6 +2851,8 @@ void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSec
 void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSection(
              const std::vector<double>& total_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total elastic cross section is valid
   testPrecondition( total_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2390,6 +2865,8 @@ void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSection(
 void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_total_elastic_cross_section.size() + index ==
@@ -2403,6 +2880,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSection(
             const unsigned subshell,
             const std::vector<double>& electroionization_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the electroionization cross section is valid
@@ -2419,6 +2898,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSectionThre
             const unsigned subshell,
             const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the threshold index is valid
@@ -2433,6 +2914,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSectionThre
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSection(
              const std::vector<double>& bremsstrahlung_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the bremsstrahlung cross section is valid
   testPrecondition( bremsstrahlung_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2445,6 +2928,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSection(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_bremsstrahlung_cross_section.size() + index ==
@@ -2457,6 +2942,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSectionThresho
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSection(
              const std::vector<double>& atomic_excitation_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the atomic excitation cross section is valid
   testPrecondition( atomic_excitation_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2469,6 +2956,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSection(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_atomic_excitation_cross_section.size() + index ==
@@ -29,6 +29,17 @@ namespace Data{
 
 /*! The electron-photon-relaxation data container
  * \details Linear-linear interpolation should be used for all data.
+ *
+ * When the container is saved to a binary (.bin) or HDF5 (.h5fa) archive
+ * every data block (see
+ * Data::ElectronPhotonRelaxationDataContainer::DataBlock) is stored as a
+ * single binary record. Only the table data, the subshell data and the
+ * electron 2D distribution settings are always loaded. When a container is
+ * constructed with a set of data blocks the remaining data block records are
+ * kept and will only be decoded when one of the member functions that needs
+ * them is called. Lazy data blocks are not decoded in a thread safe way - a
+ * lazily loaded container must not be shared by multiple threads until all of
+ * the data blocks that they use have been loaded.
  */
 class ElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<ElectronPhotonRelaxationDataContainer>
 {
@@ -37,10 +48,28 @@ class ElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<E
 
 public:
 
+  //! The data blocks that can be loaded independently
+  enum DataBlock{
+    RELAXATION_DATA_BLOCK = 0,
+    COMPTON_PROFILE_DATA_BLOCK,
+    FORM_FACTOR_DATA_BLOCK,
+    PHOTON_CROSS_SECTION_DATA_BLOCK,
+    ELASTIC_DATA_BLOCK,
+    ELECTROIONIZATION_DATA_BLOCK,
+    BREMSSTRAHLUNG_DATA_BLOCK,
+    ATOMIC_EXCITATION_DATA_BLOCK,
+    ELECTRON_CROSS_SECTION_DATA_BLOCK
+  };
+
   //! Constructor (from saved archive)
   ElectronPhotonRelaxationDataContainer(
                           const boost::filesystem::path& file_name_with_path );
 
+  //! Constructor (from saved archive - the other data blocks are lazy)
+  ElectronPhotonRelaxationDataContainer(
+                           const boost::filesystem::path& file_name_with_path,
+                           const std::set<DataBlock>& data_blocks );
+
   //! Destructor
   virtual ~ElectronPhotonRelaxationDataContainer()
   { /* ... */ }
@@ -48,6 +77,18 @@ public:
   //! The database name used in an archive
   const char* getArchiveName() const override;
 
+  //! Return the name of a data block
+  static std::string getDataBlockName( const DataBlock data_block );
+
+  //! Check if a data block has been loaded
+  bool isDataBlockLoaded( const DataBlock data_block ) const;
+
+  //! Load a data block (if it has not been loaded yet)
+  void loadDataBlock( const DataBlock data_block ) const;
+
+  //! Load all of the data blocks
+  void loadAllDataBlocks() const;
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -969,12 +1010,53 @@ private:
 
   BOOST_SERIALIZATION_SPLIT_MEMBER();
 
+  // Serialize the table data (always loaded)
+  template<typename Archive, typename ContainerType>
+  static void serializeTableData( Archive& ar, ContainerType& container );
+
+  // Serialize the electron 2D distribution data (always loaded)
+  template<typename Archive, typename ContainerType>
+  static void serializeElectronTwoDData( Archive& ar,
+                                         ContainerType& container );
+
+  // Serialize a data block
+  template<typename Archive, typename ContainerType>
+  static void serializeDataBlock( Archive& ar,
+                                  ContainerType& container,
+                                  const DataBlock data_block );
+
+  // Save a data block to an archive
+  template<typename Archive>
+  void saveDataBlockToArchive( Archive& ar,
+                               const DataBlock data_block,
+                               const bool use_data_block_record ) const;
+
+  // Load a data block from an archive
+  template<typename Archive>
+  void loadDataBlockFromArchive( Archive& ar,
+                                 const DataBlock data_block,
+                                 const bool use_data_block_record );
+
+  // Create a data block record
+  void createDataBlockRecord( const DataBlock data_block,
+                              std::vector<char>& data_block_record ) const;
+
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
   // The name used in archive name-value pairs
   static const std::string s_archive_name;
 
+//---------------------------------------------------------------------------//
+// DATA BLOCK RECORDS
+//---------------------------------------------------------------------------//
+
+  // The data block records that have not been decoded yet (indexed by data
+  // block). A record is released as soon as it has been decoded so an empty
+  // record indicates that the data block is loaded. The records are mutable
+  // because the (const) getters decode the data blocks on first access.
+  mutable std::vector<std::vector<char> > d_data_block_records;
+
 //---------------------------------------------------------------------------//
 // NOTES
 //---------------------------------------------------------------------------//
@@ -1317,7 +1399,7 @@ private:
 
 } // end Data namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ElectronPhotonRelaxationDataContainer, Data, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ElectronPhotonRelaxationDataContainer, Data, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ElectronPhotonRelaxationDataContainer, Data );
 
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, ElectronPhotonRelaxationDataContainer );
@@ -22,237 +22,275 @@
 namespace Data{
 
 // Save the data to an archive
+/*! \details Binary and HDF5 archives store every data block as a single
+ * binary record. All other archives store the data fields directly (in the
+ * same order that version 0 archives use).
+ */
 template<typename Archive>
 void ElectronPhotonRelaxationDataContainer::save( Archive& ar,
                                                   const unsigned version) const
 {
-  // Notes
-  DATA_MAKE_NVP_DEFAULT( ar, notes );
+  const bool use_data_block_records =
+    Details::UsesDataBlockRecords<Archive>::value;
 
   // Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_number );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_weight );
-  DATA_MAKE_NVP_DEFAULT( ar, min_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, min_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_incoherent_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_threshold_energy_nudge_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_angle_cosine );
-  DATA_MAKE_NVP_DEFAULT( ar, number_of_moment_preserving_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_convergence_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_distance_tol );
+  ElectronPhotonRelaxationDataContainer::serializeTableData( ar, *this );
 
-  // Relaxation Data
-  DATA_MAKE_NVP_DEFAULT( ar, subshells );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_occupancies );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_binding_energies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_transitions );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_vacancies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_particle_energies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_probabilities );
+  // Relaxation and Photon Data
+  for( int i = RELAXATION_DATA_BLOCK; i <= PHOTON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->saveDataBlockToArchive( ar, (DataBlock)i, use_data_block_records );
+  }
 
-  // Photon Data
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profile_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profiles );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, has_average_photon_heating_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, average_photon_heating_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, pair_production_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, pair_production_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, triplet_production_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, triplet_production_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, photoelectric_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, photoelectric_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_photoelectric_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_photoelectric_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_total_cross_section );
   // Electron Data
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, angular_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_elastic_discrete_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_elastic_weights );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_cross_section_reductions );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_recoil_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_recoil_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_outgoing_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_outgoing_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_loss_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_loss );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_cross_section_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, total_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, screened_rutherford_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, screened_rutherford_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, total_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, total_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_subshell_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_subshell_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_cross_section_threshold_index );
+  ElectronPhotonRelaxationDataContainer::serializeElectronTwoDData( ar, *this );
+
+  for( int i = ELASTIC_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->saveDataBlockToArchive( ar, (DataBlock)i, use_data_block_records );
+  }
 }
 
 // Load the data from an archive
+/*! \details The data block records will not be decoded here. Version 0
+ * archives never contain data block records.
+ */
 template<typename Archive>
 void ElectronPhotonRelaxationDataContainer::load( Archive& ar,
                                                   const unsigned version )
 {
-  // Notes
-  DATA_MAKE_NVP_DEFAULT( ar, notes );
+  const bool use_data_block_records = version > 0 &&
+    Details::UsesDataBlockRecords<Archive>::value;
+
+  d_data_block_records.clear();
+  d_data_block_records.resize( ELECTRON_CROSS_SECTION_DATA_BLOCK+1 );
 
   // Table Data
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_number );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_weight );
-  DATA_MAKE_NVP_DEFAULT( ar, min_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, min_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, max_electron_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_incoherent_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_threshold_energy_nudge_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_angle_cosine );
-  DATA_MAKE_NVP_DEFAULT( ar, number_of_moment_preserving_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_tabular_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_grid_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_evaluation_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_convergence_tolerance );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_distance_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_evaluation_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_convergence_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_absolute_diff_tol );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_distance_tol );
+  ElectronPhotonRelaxationDataContainer::serializeTableData( ar, *this );
 
-  // Relaxation Data
-  DATA_MAKE_NVP_DEFAULT( ar, subshells );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_occupancies );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_binding_energies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_transitions );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_vacancies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_particle_energies );
-  DATA_MAKE_NVP_DEFAULT( ar, relaxation_probabilities );
+  // Relaxation and Photon Data
+  for( int i = RELAXATION_DATA_BLOCK; i <= PHOTON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->loadDataBlockFromArchive( ar, (DataBlock)i, use_data_block_records );
+  }
 
-  // Photon Data
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profile_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, compton_profiles );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_number_momentum_grids );
-  DATA_MAKE_NVP_DEFAULT( ar, occupation_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_scattering_function );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_squared_atomic_form_factor );
-  DATA_MAKE_NVP_DEFAULT( ar, photon_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, has_average_photon_heating_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, average_photon_heating_numbers );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_incoherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_incoherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_subshell_incoherent_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_subshell_incoherent_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_coherent_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, pair_production_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, pair_production_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, triplet_production_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, triplet_production_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, photoelectric_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, photoelectric_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_photoelectric_cross_sections );
-  DATA_MAKE_NVP_DEFAULT( ar, subshell_photoelectric_cross_section_threshold_indices );
-  DATA_MAKE_NVP_DEFAULT( ar, waller_hartree_total_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, impulse_approx_total_cross_section );
   // Electron Data
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_two_d_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, angular_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_elastic_discrete_angles );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_elastic_weights );
-  DATA_MAKE_NVP_DEFAULT( ar, moment_preserving_cross_section_reductions );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_recoil_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_recoil_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_outgoing_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_outgoing_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_energy );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_photon_pdf );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_loss_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_energy_loss );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_energy_grid );
-  DATA_MAKE_NVP_DEFAULT( ar, electron_cross_section_interp );
-  DATA_MAKE_NVP_DEFAULT( ar, total_electron_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, cutoff_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, screened_rutherford_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, screened_rutherford_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, total_elastic_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, total_elastic_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_subshell_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, electroionization_subshell_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, bremsstrahlung_cross_section_threshold_index );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_cross_section );
-  DATA_MAKE_NVP_DEFAULT( ar, atomic_excitation_cross_section_threshold_index );
+  ElectronPhotonRelaxationDataContainer::serializeElectronTwoDData( ar, *this );
+
+  for( int i = ELASTIC_DATA_BLOCK; i <= ELECTRON_CROSS_SECTION_DATA_BLOCK; ++i )
+  {
+    this->loadDataBlockFromArchive( ar, (DataBlock)i, use_data_block_records );
+  }
+}
+
+// Serialize the table data (always loaded)
+template<typename Archive, typename ContainerType>
+void ElectronPhotonRelaxationDataContainer::serializeTableData(
+                                                  Archive& ar,
+                                                  ContainerType& container )
+{
+  // Notes
+  DATA_MAKE_NVP( ar, container.d_, notes );
+
+  // Table Data
+  DATA_MAKE_NVP( ar, container.d_, atomic_number );
+  DATA_MAKE_NVP( ar, container.d_, atomic_weight );
+  DATA_MAKE_NVP( ar, container.d_, min_photon_energy );
+  DATA_MAKE_NVP( ar, container.d_, max_photon_energy );
+  DATA_MAKE_NVP( ar, container.d_, min_electron_energy );
+  DATA_MAKE_NVP( ar, container.d_, max_electron_energy );
+  DATA_MAKE_NVP( ar, container.d_, occupation_number_evaluation_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, subshell_incoherent_evaluation_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, photon_threshold_energy_nudge_factor );
+  DATA_MAKE_NVP( ar, container.d_, cutoff_angle_cosine );
+  DATA_MAKE_NVP( ar, container.d_, number_of_moment_preserving_angles );
+  DATA_MAKE_NVP( ar, container.d_, electron_tabular_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, photon_grid_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, photon_grid_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, photon_grid_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, electron_grid_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, electron_grid_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, electron_grid_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_evaluation_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_convergence_tolerance );
+  DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_distance_tol );
+  DATA_MAKE_NVP( ar, container.d_, electroionization_evaluation_tol );
+  DATA_MAKE_NVP( ar, container.d_, electroionization_convergence_tol );
+  DATA_MAKE_NVP( ar, container.d_, electroionization_absolute_diff_tol );
+  DATA_MAKE_NVP( ar, container.d_, electroionization_distance_tol );
+
+  // Subshell Data
+  DATA_MAKE_NVP( ar, container.d_, subshells );
+  DATA_MAKE_NVP( ar, container.d_, subshell_occupancies );
+  DATA_MAKE_NVP( ar, container.d_, subshell_binding_energies );
+}
+
+// Serialize the electron 2D distribution data (always loaded)
+template<typename Archive, typename ContainerType>
+void ElectronPhotonRelaxationDataContainer::serializeElectronTwoDData(
+                                                  Archive& ar,
+                                                  ContainerType& container )
+{
+  DATA_MAKE_NVP( ar, container.d_, electron_two_d_interp );
+  DATA_MAKE_NVP( ar, container.d_, electron_two_d_grid );
+}
+
+// Serialize a data block
+template<typename Archive, typename ContainerType>
+void ElectronPhotonRelaxationDataContainer::serializeDataBlock(
+                                                  Archive& ar,
+                                                  ContainerType& container,
+                                                  const DataBlock data_block )
+{
+  switch( data_block )
+  {
+    case RELAXATION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, relaxation_transitions );
+      DATA_MAKE_NVP( ar, container.d_, relaxation_vacancies );
+      DATA_MAKE_NVP( ar, container.d_, relaxation_particle_energies );
+      DATA_MAKE_NVP( ar, container.d_, relaxation_probabilities );
+      break;
+    case COMPTON_PROFILE_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, compton_profile_momentum_grids );
+      DATA_MAKE_NVP( ar, container.d_, compton_profiles );
+      DATA_MAKE_NVP( ar, container.d_, occupation_number_momentum_grids );
+      DATA_MAKE_NVP( ar, container.d_, occupation_numbers );
+      break;
+    case FORM_FACTOR_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_scattering_function_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_scattering_function );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_atomic_form_factor_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_atomic_form_factor );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_squared_atomic_form_factor );
+      break;
+    case PHOTON_CROSS_SECTION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, photon_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, has_average_photon_heating_numbers );
+      DATA_MAKE_NVP( ar, container.d_, average_photon_heating_numbers );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_incoherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_incoherent_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_incoherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_incoherent_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_subshell_incoherent_cross_sections );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_coherent_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_coherent_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, pair_production_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, pair_production_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, triplet_production_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, triplet_production_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, photoelectric_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, photoelectric_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, subshell_photoelectric_cross_sections );
+      DATA_MAKE_NVP( ar, container.d_, subshell_photoelectric_cross_section_threshold_indices );
+      DATA_MAKE_NVP( ar, container.d_, waller_hartree_total_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, impulse_approx_total_cross_section );
+      break;
+    case ELASTIC_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, angular_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, cutoff_elastic_interp );
+      DATA_MAKE_NVP( ar, container.d_, cutoff_elastic_angles );
+      DATA_MAKE_NVP( ar, container.d_, cutoff_elastic_pdf );
+      DATA_MAKE_NVP( ar, container.d_, moment_preserving_elastic_discrete_angles );
+      DATA_MAKE_NVP( ar, container.d_, moment_preserving_elastic_weights );
+      DATA_MAKE_NVP( ar, container.d_, moment_preserving_cross_section_reductions );
+      break;
+    case ELECTROIONIZATION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, electroionization_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_interp );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_recoil_energy );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_recoil_pdf );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_outgoing_energy );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_outgoing_pdf );
+      break;
+    case BREMSSTRAHLUNG_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_photon_interp );
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_photon_energy );
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_photon_pdf );
+      break;
+    case ATOMIC_EXCITATION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, atomic_excitation_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, atomic_excitation_energy_loss_interp );
+      DATA_MAKE_NVP( ar, container.d_, atomic_excitation_energy_loss );
+      break;
+    case ELECTRON_CROSS_SECTION_DATA_BLOCK:
+      DATA_MAKE_NVP( ar, container.d_, electron_energy_grid );
+      DATA_MAKE_NVP( ar, container.d_, electron_cross_section_interp );
+      DATA_MAKE_NVP( ar, container.d_, total_electron_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, cutoff_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, cutoff_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, screened_rutherford_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, screened_rutherford_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, total_elastic_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, total_elastic_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_subshell_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, electroionization_subshell_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, bremsstrahlung_cross_section_threshold_index );
+      DATA_MAKE_NVP( ar, container.d_, atomic_excitation_cross_section );
+      DATA_MAKE_NVP( ar, container.d_, atomic_excitation_cross_section_threshold_index );
+      break;
+  }
+}
+
+// Save a data block to an archive
+/*! \details A data block that has not been loaded will be saved using its
+ * original record.
+ */
+template<typename Archive>
+void ElectronPhotonRelaxationDataContainer::saveDataBlockToArchive(
+                                     Archive& ar,
+                                     const DataBlock data_block,
+                                     const bool use_data_block_record ) const
+{
+  if( use_data_block_record )
+  {
+    const std::string record_name =
+      ElectronPhotonRelaxationDataContainer::getDataBlockName( data_block );
+
+    if( this->isDataBlockLoaded( data_block ) )
+    {
+      std::vector<char> data_block_record;
+
+      this->createDataBlockRecord( data_block, data_block_record );
+
+      ar & boost::serialization::make_nvp( record_name.c_str(),
+                                           data_block_record );
+    }
+    else
+    {
+      ar & boost::serialization::make_nvp( record_name.c_str(),
+                                           d_data_block_records[data_block] );
+    }
+  }
+  else
+  {
+    this->loadDataBlock( data_block );
+
+    ElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
+  }
+}
+
+// Load a data block from an archive
+template<typename Archive>
+void ElectronPhotonRelaxationDataContainer::loadDataBlockFromArchive(
+                                           Archive& ar,
+                                           const DataBlock data_block,
+                                           const bool use_data_block_record )
+{
+  if( use_data_block_record )
+  {
+    const std::string record_name =
+      ElectronPhotonRelaxationDataContainer::getDataBlockName( data_block );
+
+    ar & boost::serialization::make_nvp( record_name.c_str(),
+                                         d_data_block_records[data_block] );
+  }
+  else
+    ElectronPhotonRelaxationDataContainer::serializeDataBlock( ar, *this, data_block );
 }
 
 } // end Data namespace
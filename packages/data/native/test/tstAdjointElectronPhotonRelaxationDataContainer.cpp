@@ -2565,6 +2565,65 @@ FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
   FRENSIE_CHECK_EQUAL( epr_data_container_copy.getForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data blocks in a binary archive can be loaded lazily
+FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
+                   export_importData_binary_lazy )
+{
+  typedef Data::AdjointElectronPhotonRelaxationDataContainer Container;
+
+  const std::string test_binary_file_name( "test_aepr_data_container.bin" );
+
+  epr_data_container.saveToFile( test_binary_file_name, true );
+
+  std::set<Container::DataBlock> data_blocks;
+  data_blocks.insert( Container::PHOTON_CROSS_SECTION_DATA_BLOCK );
+
+  const Container epr_data_container_copy( test_binary_file_name,
+                                           data_blocks );
+
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::PHOTON_CROSS_SECTION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::COMPTON_PROFILE_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::ELECTRON_CROSS_SECTION_DATA_BLOCK ) );
+
+  // The table data is always loaded
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(),
+                       epr_data_container.getNotes() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK( epr_data_container_copy.getSubshells().count( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronTwoDGridPolicy(),
+                       epr_data_container.getElectronTwoDGridPolicy() );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointPhotonEnergyGrid().size(), 3 );
+
+  // Lazy data blocks are loaded when they are first accessed
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfile( 1 ).size(), 3 );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::COMPTON_PROFILE_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK ) );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectronBremsstrahlungEnergy(1.0).size(), 3 );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK ) );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::ELECTRON_CROSS_SECTION_DATA_BLOCK ) );
+
+  // A partially loaded container can be archived
+  const std::string test_resaved_binary_file_name( "test_aepr_data_container_copy.bin" );
+
+  epr_data_container_copy.saveToFile( test_resaved_binary_file_name, true );
+
+  const Container epr_data_container_copy_2( test_resaved_binary_file_name );
+
+  FRENSIE_CHECK( epr_data_container_copy_2.isDataBlockLoaded( Container::ELASTIC_DATA_BLOCK ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getAdjointPhotonEnergyGrid(),
+                       epr_data_container.getAdjointPhotonEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getAdjointElectronEnergyGrid(),
+                       epr_data_container.getAdjointElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getAdjointPairProductionEnergyDistribution(),
+                       epr_data_container.getAdjointPairProductionEnergyDistribution() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getForwardElectroionizationSamplingMode(),
+                       epr_data_container.getForwardElectroionizationSamplingMode() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstAdjointElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
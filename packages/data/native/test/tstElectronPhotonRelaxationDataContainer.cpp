@@ -9,10 +9,12 @@
 // Std Lib Includes
 #include <string>
 #include <iostream>
+#include <memory>
 
 // FRENSIE Includes
 #include "Data_ElectronPhotonRelaxationVolatileDataContainer.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -2171,6 +2173,137 @@ FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
                        0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data blocks in a binary archive can be loaded lazily
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   export_importData_binary_lazy )
+{
+  typedef Data::ElectronPhotonRelaxationDataContainer Container;
+
+  const std::string test_binary_file_name( "test_epr_data_container.bin" );
+
+  epr_data_container.saveToFile( test_binary_file_name, true );
+
+  std::set<Container::DataBlock> data_blocks;
+  data_blocks.insert( Container::PHOTON_CROSS_SECTION_DATA_BLOCK );
+
+  const Container epr_data_container_copy( test_binary_file_name,
+                                           data_blocks );
+
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::PHOTON_CROSS_SECTION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::RELAXATION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::BREMSSTRAHLUNG_DATA_BLOCK ) );
+
+  // The table data is always loaded
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(), notes );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK( epr_data_container_copy.getSubshells().count( 1 ) );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSection().size(),
+                       2 );
+
+  // Lazy data blocks are loaded when they are first accessed
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationTransitions(1),
+                       1 );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::RELAXATION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Container::BREMSSTRAHLUNG_DATA_BLOCK ) );
+
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Container::BREMSSTRAHLUNG_DATA_BLOCK ) );
+
+  // A partially loaded container can be archived
+  const std::string test_resaved_binary_file_name( "test_epr_data_container_copy.bin" );
+
+  epr_data_container_copy.saveToFile( test_resaved_binary_file_name, true );
+
+  const Container epr_data_container_copy_2( test_resaved_binary_file_name );
+
+  FRENSIE_CHECK( epr_data_container_copy_2.isDataBlockLoaded( Container::ELASTIC_DATA_BLOCK ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getElectronEnergyGrid(),
+                       epr_data_container.getElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getCutoffElasticAngles().size(),
+                       epr_data_container.getCutoffElasticAngles().size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that containers can be loaded concurrently
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   importData_multiple_threads )
+{
+  typedef Data::ElectronPhotonRelaxationDataContainer Container;
+
+  const std::string test_binary_file_name( "test_epr_data_container_mt.bin" );
+  const std::string test_xml_file_name( "test_epr_data_container_mt.xml" );
+
+  epr_data_container.saveToFile( test_binary_file_name, true );
+  epr_data_container.saveToFile( test_xml_file_name, true );
+
+  const int number_of_containers =
+    4*Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  std::vector<std::shared_ptr<const Container> >
+    containers( number_of_containers );
+
+  std::set<Container::DataBlock> data_blocks;
+  data_blocks.insert( Container::PHOTON_CROSS_SECTION_DATA_BLOCK );
+
+  // Archive loading and the lazy data block decoding both reset the global
+  // boost::serialization pointer serializers
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ) schedule( dynamic )
+  for( int i = 0; i < number_of_containers; ++i )
+  {
+    if( i % 2 == 0 )
+    {
+      containers[i].reset( new Container( test_binary_file_name,
+                                          data_blocks ) );
+
+      containers[i]->loadAllDataBlocks();
+    }
+    else
+      containers[i].reset( new Container( test_xml_file_name ) );
+  }
+
+  for( int i = 0; i < number_of_containers; ++i )
+  {
+    FRENSIE_REQUIRE( containers[i].get() != NULL );
+    FRENSIE_CHECK_EQUAL( containers[i]->getNotes(), notes );
+    FRENSIE_CHECK_EQUAL( containers[i]->getPhotonEnergyGrid(),
+                         epr_data_container.getPhotonEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( containers[i]->getSubshellRelaxationTransitions(1),
+                         1 );
+    FRENSIE_CHECK_EQUAL( containers[i]->getBremsstrahlungCrossSection().size(),
+                         3u );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
 //---------------------------------------------------------------------------//
 // end tstElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
@@ -16,6 +16,8 @@
 #include "Utility_GaussKronrodIntegrator.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace DataGen{
@@ -412,7 +414,9 @@ void AdjointElectronGridGenerator<TwoDInterpPolicy>::generateAndEvaluateDistribu
 // Generate and evaluate the distribution grid in place
 /*! \details If the nudged min energy of a primary energy is greater than or
  *  equal to the max energy then it is assumed the distribution is zero and it
- *  is not included in the distribution.
+ *  is not included in the distribution. The distributions at the primary
+ *  energies are generated concurrently using the number of threads requested
+ *  from Utility::OpenMPProperties.
  */
 template<typename TwoDInterpPolicy>
 void AdjointElectronGridGenerator<TwoDInterpPolicy>::generateAndEvaluateDistributionOnPrimaryEnergyGrid(
@@ -428,19 +432,58 @@ void AdjointElectronGridGenerator<TwoDInterpPolicy>::generateAndEvaluateDistribu
   testPrecondition( threshold_index >= 0 );
   testPrecondition( adjoint_cross_sections.size() + threshold_index == primary_energy_grid.size() );
 
+  // Find the primary energies where the distribution is not zero
+  std::vector<unsigned> nonzero_indices;
+
   for( unsigned i = 0; i < adjoint_cross_sections.size(); ++i )
   {
     double incoming_energy = primary_energy_grid[i + threshold_index];
 
     if( this->getNudgedMinEnergy( incoming_energy ) < this->getMaxOutgoingEnergy() )
-    {
+      nonzero_indices.push_back( i );
+  }
+
+  // Generate the distributions concurrently
+  std::vector<std::vector<double> >
+    local_outgoing_energy_grids( nonzero_indices.size() ),
+    local_evaluated_pdfs( nonzero_indices.size() );
+
+  std::vector<std::string> error_messages( nonzero_indices.size() );
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t j = 0; j < nonzero_indices.size(); ++j )
+  {
+    const unsigned i = nonzero_indices[j];
+
+    try{
       this->generateAndEvaluateDistribution(
-              outgoing_energy_grid[incoming_energy],
-              evaluated_pdf[incoming_energy],
+              local_outgoing_energy_grids[j],
+              local_evaluated_pdfs[j],
               evaluation_tol,
-              incoming_energy,
+              primary_energy_grid[i + threshold_index],
               adjoint_cross_sections[i] );
     }
+    catch( const std::exception& exception )
+    {
+      error_messages[j] = exception.what();
+    }
+  }
+
+  // Store the distributions (in primary energy order)
+  for( size_t j = 0; j < nonzero_indices.size(); ++j )
+  {
+    double incoming_energy =
+      primary_energy_grid[nonzero_indices[j] + threshold_index];
+
+    TEST_FOR_EXCEPTION( !error_messages[j].empty(),
+                        std::runtime_error,
+                        "The distribution could not be generated at incoming "
+                        "energy " << incoming_energy << ": "
+                        << error_messages[j] );
+
+    outgoing_energy_grid[incoming_energy].swap(
+                                              local_outgoing_energy_grids[j] );
+    evaluated_pdf[incoming_energy].swap( local_evaluated_pdfs[j] );
   }
 }
 
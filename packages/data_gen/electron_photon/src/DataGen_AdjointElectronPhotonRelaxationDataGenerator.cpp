@@ -242,6 +242,31 @@ double AdjointElectronPhotonRelaxationDataGenerator::getDefaultPhotonGridDistanc
   return d_default_photon_grid_generator->getDistanceTolerance();
 }
 
+// Set parallel grid refinement mode on (default off)
+/*! \details When this mode is on the midpoints of every grid refinement pass
+ * will be evaluated concurrently using the OpenMP threads that are available.
+ * The generated grids are identical to the ones generated sequentially. All
+ * of the grid functions used by the generator only evaluate const data.
+ */
+void AdjointElectronPhotonRelaxationDataGenerator::setParallelGridRefinementModeOn()
+{
+  d_default_photon_grid_generator->enableParallelRefinement();
+  d_default_electron_grid_generator->enableParallelRefinement();
+}
+
+// Set parallel grid refinement mode off (default off)
+void AdjointElectronPhotonRelaxationDataGenerator::setParallelGridRefinementModeOff()
+{
+  d_default_photon_grid_generator->disableParallelRefinement();
+  d_default_electron_grid_generator->disableParallelRefinement();
+}
+
+// Return if the parallel grid refinement mode is on (default off)
+bool AdjointElectronPhotonRelaxationDataGenerator::isParallelGridRefinementModeOn() const
+{
+  return d_default_photon_grid_generator->isParallelRefinementEnabled();
+}
+
 // Set the photon threshold energy nudge factor
 void AdjointElectronPhotonRelaxationDataGenerator::setPhotonThresholdEnergyNudgeFactor( const double nudge_factor )
 {
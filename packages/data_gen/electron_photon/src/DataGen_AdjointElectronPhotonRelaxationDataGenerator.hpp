@@ -80,6 +80,15 @@ public:
   //! Get the default photon grid distance tolerance
   double getDefaultPhotonGridDistanceTolerance() const;
 
+  //! Set parallel grid refinement mode on (default off)
+  void setParallelGridRefinementModeOn();
+
+  //! Set parallel grid refinement mode off (default off)
+  void setParallelGridRefinementModeOff();
+
+  //! Return if the parallel grid refinement mode is on (default off)
+  bool isParallelGridRefinementModeOn() const;
+
   //! Set the photon threshold energy nudge factor
   void setPhotonThresholdEnergyNudgeFactor( const double nudge_factor );
 
@@ -2252,6 +2252,10 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedBremsstrahlungDistribu
                     this->getBremsstrahlungAbsoluteDifferenceTolerance(),
                     this->getBremsstrahlungDistanceTolerance() );
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
@@ -2400,6 +2404,10 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedElectroionizationSubsh
                     this->getElectroionizationAbsoluteDifferenceTolerance(),
                     this->getElectroionizationDistanceTolerance() );
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
@@ -36,6 +36,7 @@
 #include "Utility_GridGenerator.hpp"
 #include "Utility_SloanRadauQuadrature.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_StaticOutputFormatter.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -143,17 +144,36 @@ StandardAdjointElectronPhotonRelaxationDataGenerator::StandardAdjointElectronPho
 }
 
 // Populate the adjoint electron-photon-relaxation data container
+/*! \details The energy grid points and subshells will be processed
+ * concurrently using the number of threads requested from
+ * Utility::OpenMPProperties. The generated data does not depend on the
+ * number of threads. The time spent in each phase will be logged.
+ */
 void StandardAdjointElectronPhotonRelaxationDataGenerator::populateEPRDataContainer(
     const bool populate_photons,
     const bool populate_electrons )
 {
+  FRENSIE_LOG_NOTIFICATION( "Generating the adjoint data with "
+                            << Utility::OpenMPProperties::getRequestedNumberOfThreads()
+                            << " thread(s)" );
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  double relaxation_time = 0.0, photon_time = 0.0, electron_time = 0.0;
+
   // Set the relaxation data
   FRENSIE_LOG_PARTIAL_NOTIFICATION( Utility::Bold( "Setting the adjoint relaxation data" )
                                     << " ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   this->setAdjointRelaxationData();
 
+  timer->stop();
+  relaxation_time = timer->elapsed().count();
+
   FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
 
   if( populate_photons )
@@ -161,9 +181,15 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::populateEPRDataContai
     // Set the photon data
     FRENSIE_LOG_NOTIFICATION( Utility::Bold( "Setting the adjoint photon data: " ) );
 
+    timer->start();
+
     this->setAdjointPhotonData();
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+    photon_time = timer->elapsed().count();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." )
+                              << " (" << photon_time << " s)" );
   }
   else
   {
@@ -176,15 +202,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::populateEPRDataContai
     // Set the electron data
     FRENSIE_LOG_NOTIFICATION( Utility::Bold( "Setting the adjoint electron data: " ) );
 
+    timer->start();
+
     this->setAdjointElectronData();
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+    electron_time = timer->elapsed().count();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." )
+                              << " (" << electron_time << " s)" );
   }
   else
   {
     // No electron data
     FRENSIE_LOG_WARNING( " No adjoint electron data will be set!" );
   }
+
+  // Log the timing breakdown
+  FRENSIE_LOG_NOTIFICATION( Utility::Bold( "Adjoint data generation time:" ) );
+  FRENSIE_LOG_NOTIFICATION( "   relaxation: " << relaxation_time << " s" );
+  FRENSIE_LOG_NOTIFICATION( "   photon: " << photon_time << " s" );
+  FRENSIE_LOG_NOTIFICATION( "   electron: " << electron_time << " s" );
+  FRENSIE_LOG_NOTIFICATION( "   total: "
+                            << relaxation_time+photon_time+electron_time
+                            << " s" );
+  FRENSIE_FLUSH_ALL_LOGS();
 }
 
 // Set the relaxation data
@@ -364,6 +406,9 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
   this->createWallerHartreeIncoherentAdjointCrossSectionEvaluator(
                               waller_hartree_incoherent_adjoint_cs_evaluator );
 
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
   // Create the impulse approx. incoherent adjoint cross section evaluators
   std::vector<std::pair<unsigned,std::shared_ptr<const MonteCarlo::SubshellIncoherentAdjointPhotonScatteringDistribution> > >
     impulse_approx_incoherent_adjoint_cs_evaluators;
@@ -384,6 +429,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                                     Utility::Italicized( "union energy grid " ) );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   std::list<double> union_energy_grid;
 
   this->initializeAdjointPhotonUnionEnergyGrid( union_energy_grid );
@@ -407,7 +454,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
   this->updateAdjointPhotonUnionEnergyGrid(
                           union_energy_grid, impulse_approx_total_forward_cs );
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( " done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( " done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
   FRENSIE_FLUSH_ALL_LOGS();
 
   Data::AdjointElectronPhotonRelaxationVolatileDataContainer& data_container =
@@ -427,6 +477,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                                       << " cross section ... " );
     FRENSIE_FLUSH_ALL_LOGS();
 
+    timer->start();
+
     this->createCrossSectionOnUnionEnergyGrid(
                                 union_energy_grid,
                                 waller_hartree_incoherent_adjoint_cs_evaluator,
@@ -438,7 +490,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
     data_container.setAdjointWallerHartreeIncoherentCrossSection(
                                                                cross_section );
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                              << timer->elapsed().count() << " s)" );
 
     for( unsigned i = 0u; i < impulse_approx_incoherent_adjoint_cs_evaluators.size(); ++i )
     {
@@ -449,8 +504,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                                         << "cross section ... " );
       FRENSIE_FLUSH_ALL_LOGS();
 
+      timer->start();
+
       unsigned threshold_index = 0;
-      
+
       this->createCrossSectionOnUnionEnergyGrid(
                      union_energy_grid,
                      impulse_approx_incoherent_adjoint_cs_evaluators[i].second,
@@ -468,16 +525,24 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                       impulse_approx_incoherent_adjoint_cs_evaluators[i].first,
                       threshold_index );
 
-      FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+      timer->stop();
+
+      FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                                << timer->elapsed().count() << " s)" );
     }
 
     FRENSIE_LOG_NOTIFICATION( "   Setting the " <<
                               Utility::Italicized( "impulse approx total incoherent adjoint" )
                               << " cross section ... " );
 
+    timer->start();
+
     this->calculateAdjointImpulseApproxTotalIncoherentCrossSection();
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                              << timer->elapsed().count() << " s)" );
     FRENSIE_FLUSH_ALL_LOGS();
 
     for( unsigned i = 0u; i < doppler_broadened_impulse_approx_incoherent_adjoint_cs_evaluators.size(); ++i )
@@ -489,6 +554,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                                         << "cross section ... " );
       FRENSIE_FLUSH_ALL_LOGS();
 
+      timer->start();
+
       this->createCrossSectionOnUnionEnergyGrid(
                      union_energy_grid,
                      doppler_broadened_impulse_approx_incoherent_adjoint_cs_evaluators[i].second,
@@ -505,16 +572,24 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPhotonData(
                       doppler_broadened_impulse_approx_incoherent_adjoint_cs_evaluators[i].first,
                       0 );
 
-      FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+      timer->stop();
+
+      FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                                << timer->elapsed().count() << " s)" );
     }
 
     FRENSIE_LOG_NOTIFICATION( "   Setting the " <<
                               Utility::Italicized( "doppler broadened impulse approx total incoherent adjoint" )
                               << " cross section ... " );
 
+    timer->start();
+
     this->calculateAdjointDopplerBroadenedImpulseApproxTotalIncoherentCrossSection();
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                              << timer->elapsed().count() << " s)" );
     FRENSIE_FLUSH_ALL_LOGS();
   }
 
@@ -786,12 +861,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createSubshellImpulse
   {
     cs_evaluators[i].first = subshell;
 
-    this->createSubshellImpulseApproxIncoherentAdjointCrossSectionEvaluator(
-                                                     cs_evaluators[i].first,
-                                                     cs_evaluators[i].second );
-
     ++i;
   }
+
+  // Create the evaluators concurrently (the evaluators are stored in subshell
+  // order)
+  std::vector<std::string> error_messages( cs_evaluators.size() );
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t j = 0; j < cs_evaluators.size(); ++j )
+  {
+    try{
+      this->createSubshellImpulseApproxIncoherentAdjointCrossSectionEvaluator(
+                                                     cs_evaluators[j].first,
+                                                     cs_evaluators[j].second );
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[j] = exception.what();
+    }
+  }
+
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not create the impulse approx. "
+                                       "incoherent adjoint cross section "
+                                       "evaluator for subshell index" );
 }
 
 // Create the subshell impulse approx incoherent adjoint cs evaluators
@@ -811,12 +905,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createSubshellImpulse
   {
     cs_evaluators[i].first = subshell;
 
-    this->createSubshellImpulseApproxIncoherentAdjointCrossSectionEvaluator(
-                                                     cs_evaluators[i].first,
-                                                     cs_evaluators[i].second );
-
     ++i;
   }
+
+  // Create the evaluators concurrently (the evaluators are stored in subshell
+  // order)
+  std::vector<std::string> error_messages( cs_evaluators.size() );
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t j = 0; j < cs_evaluators.size(); ++j )
+  {
+    try{
+      this->createSubshellImpulseApproxIncoherentAdjointCrossSectionEvaluator(
+                                                     cs_evaluators[j].first,
+                                                     cs_evaluators[j].second );
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[j] = exception.what();
+    }
+  }
+
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not create the impulse approx. "
+                                       "incoherent adjoint cross section "
+                                       "evaluator for subshell index" );
 }
 
 // Create a subshell impulse approx incoherent adjoint cs evaluator
@@ -994,6 +1107,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
   // Throw an exception if dirty convergence occurs
   grid_generator.throwExceptionOnDirtyConvergence();
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   std::function<double(double,double)> cs_evaluation_wrapper =
     grid_generator.createCrossSectionEvaluator(
                 cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
@@ -1039,6 +1156,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
     // Throw an exception if dirty convergence occurs
     grid_generator.throwExceptionOnDirtyConvergence();
 
+    // Evaluate the refinement midpoints concurrently if requested
+    if( this->isParallelGridRefinementModeOn() )
+      grid_generator.enableParallelRefinement();
+
     std::function<double(double,double)> cs_evaluation_wrapper =
       grid_generator.createCrossSectionEvaluator(
                 cs_evaluator,  this->getAdjointIncoherentEvaluationTolerance() );
@@ -1103,6 +1224,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
     // Throw an exception if dirty convergence occurs
     grid_generator.throwExceptionOnDirtyConvergence();
 
+    // Evaluate the refinement midpoints concurrently if requested
+    if( this->isParallelGridRefinementModeOn() )
+      grid_generator.enableParallelRefinement();
+
     std::function<double(double,double)> cs_evaluation_wrapper =
       grid_generator.createCrossSectionEvaluator(
                 cs_evaluator,  this->getAdjointIncoherentEvaluationTolerance() );
@@ -1170,43 +1295,24 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
   // Throw an exception if dirty convergence occurs
   grid_generator.throwExceptionOnDirtyConvergence();
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   std::function<double(double,double)> cs_evaluation_wrapper =
     grid_generator.createCrossSectionEvaluator(
                            cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+  // Evaluate the cross section at every energy grid point concurrently
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-    // Check if the first max energy grid point is valid. The energy to
-    // max energy nudge value is used to improve convergence time by ignoring
-    // the secondary grid point where the cross section is zero
-    // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() > *energy_grid_it )
-    {
-      // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert( max_energy_grid_it->begin(),
-                                  *energy_grid_it );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
-    }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  this->createCrossSectionOnEnergyGrid( energy_grid,
+                                        grid_generator,
+                                        cs_evaluation_wrapper,
+                                        0.0,
+                                        max_energy_grid,
+                                        cross_section );
 }
 
 // Create the cross section on the union energy grid
@@ -1244,45 +1350,24 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
   // Throw an exception if dirty convergence occurs
   grid_generator.throwExceptionOnDirtyConvergence();
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   std::function<double(double,double)> cs_evaluation_wrapper =
     grid_generator.createCrossSectionEvaluator(
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
   // Evaluate the cross section at every energy grid point at or above the
-  // threshold energy
-  std::list<double>::const_iterator energy_grid_it = start;
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
-
-    // Check if the first max energy grid point is valid. The energy to
-    // max energy nudge value is used to improve convergence time by ignoring
-    // the secondary grid point where the cross section is zero
-    // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
-    {
-      // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
-    }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  // threshold energy concurrently
+  const std::vector<double> energy_grid( start, union_energy_grid.end() );
+
+  this->createCrossSectionOnEnergyGrid( energy_grid,
+                                        grid_generator,
+                                        cs_evaluation_wrapper,
+                                        cs_evaluator->getSubshellBindingEnergy(),
+                                        max_energy_grid,
+                                        cross_section );
 }
 
 // Create the cross section on the union energy grid
@@ -1308,45 +1393,77 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
   // Throw an exception if dirty convergence occurs
   grid_generator.throwExceptionOnDirtyConvergence();
 
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator.enableParallelRefinement();
+
   std::function<double(double,double)> cs_evaluation_wrapper =
     grid_generator.createCrossSectionEvaluator(
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
+  // Evaluate the cross section at every energy grid point concurrently
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
+  this->createCrossSectionOnEnergyGrid( energy_grid,
+                                        grid_generator,
+                                        cs_evaluation_wrapper,
+                                        cs_evaluator->getSubshellBindingEnergy(),
+                                        max_energy_grid,
+                                        cross_section );
+}
+
+// Create the incoherent cross section on an energy grid
+/*! \details The max energy grid and cross section at each energy grid point
+ * will be generated concurrently. The grids only depend on the energy grid
+ * point so the generated data does not depend on the number of threads.
+ */
+void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnEnergyGrid(
+          const std::vector<double>& energy_grid,
+          const AdjointIncoherentGridGenerator<Utility::LinLinLin>& grid_generator,
+          const std::function<double(double,double)>& cs_evaluator,
+          const double binding_energy,
+          std::vector<std::vector<double> >& max_energy_grid,
+          std::vector<std::vector<double> >& cross_section ) const
+{
+  // Make sure the arrays are valid
+  testPrecondition( max_energy_grid.size() == energy_grid.size() );
+  testPrecondition( cross_section.size() == energy_grid.size() );
 
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
+  std::vector<std::string> error_messages( energy_grid.size() );
 
-  while( energy_grid_it != union_energy_grid.end() )
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < energy_grid.size(); ++i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    try{
+      grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                          cross_section[i],
+                                                          energy_grid[i],
+                                                          cs_evaluator );
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[i] = exception.what();
+      continue;
+    }
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
+    if( max_energy_grid[i].front() > energy_grid[i] + binding_energy )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert( max_energy_grid[i].begin(),
+                                 energy_grid[i] + binding_energy );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
   }
+
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not generate the incoherent "
+                                       "adjoint cross section at energy grid "
+                                       "index" );
 }
 
 // Create the cross section on the union energy grid
@@ -1387,66 +1504,78 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointImpul
   std::vector<std::vector<double> > max_energy_grid( energy_grid.size() );
   std::vector<std::vector<double> > cross_section( energy_grid.size() );
 
-  // The max_energy_grid at an energy
-  std::list<double> local_max_energy_grid;
-
   // Get the subshells
   const std::set<unsigned>& subshells = data_container.getSubshells();
 
-  // Generate the max energy grid at each energy grid point
-  for( unsigned i = 0u; i < energy_grid.size(); ++i )
-  {
-    local_max_energy_grid.clear();
+  std::vector<std::string> error_messages( energy_grid.size() );
 
-    std::set<unsigned>::const_iterator subshell = subshells.begin();
+  // Generate the max energy grid at each energy grid point concurrently
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    try{
+      // The max_energy_grid at an energy
+      std::list<double> local_max_energy_grid;
 
-    while( subshell != subshells.end() )
-    {
-      unsigned threshold_index = data_container.getAdjointImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( *subshell );
+      std::set<unsigned>::const_iterator subshell = subshells.begin();
 
-      if( i >= threshold_index )
+      while( subshell != subshells.end() )
       {
-        local_max_energy_grid.insert(
-          local_max_energy_grid.end(),
-          data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index].begin(),
-          data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index].end() );
-      }
+        unsigned threshold_index = data_container.getAdjointImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( *subshell );
 
-      ++subshell;
-    }
+        if( i >= threshold_index )
+        {
+          local_max_energy_grid.insert(
+            local_max_energy_grid.end(),
+            data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index].begin(),
+            data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index].end() );
+        }
 
-    // Sort the local max energy grid
-    local_max_energy_grid.sort();
+        ++subshell;
+      }
 
-    // Remove duplicate grid points from the local max energy grid
-    local_max_energy_grid.unique();
+      // Sort the local max energy grid
+      local_max_energy_grid.sort();
 
-    // Assign the max energy grid at this energy
-    max_energy_grid[i].assign( local_max_energy_grid.begin(),
-                               local_max_energy_grid.end() );
-    cross_section[i].resize( max_energy_grid[i].size(), 0 );
+      // Remove duplicate grid points from the local max energy grid
+      local_max_energy_grid.unique();
 
-    // Evaluate the cross section on the max energy grid at this energy
-    subshell = subshells.begin();
+      // Assign the max energy grid at this energy
+      max_energy_grid[i].assign( local_max_energy_grid.begin(),
+                                 local_max_energy_grid.end() );
+      cross_section[i].resize( max_energy_grid[i].size(), 0 );
 
-    while( subshell != subshells.end() )
-    {
-      unsigned threshold_index = data_container.getAdjointImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( *subshell );
+      // Evaluate the cross section on the max energy grid at this energy
+      subshell = subshells.begin();
 
-      if( i >= threshold_index )
+      while( subshell != subshells.end() )
       {
-        Utility::TabularDistribution<Utility::LinLin> subshell_cs(
-          data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index],
-          data_container.getAdjointImpulseApproxSubshellIncoherentCrossSection( *subshell )[i-threshold_index] );
+        unsigned threshold_index = data_container.getAdjointImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( *subshell );
 
-        for( unsigned j = 0u; j < max_energy_grid[i].size(); ++j )
-          cross_section[i][j] += subshell_cs.evaluate( max_energy_grid[i][j] );
-      }
+        if( i >= threshold_index )
+        {
+          Utility::TabularDistribution<Utility::LinLin> subshell_cs(
+            data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i-threshold_index],
+            data_container.getAdjointImpulseApproxSubshellIncoherentCrossSection( *subshell )[i-threshold_index] );
+
+          for( unsigned j = 0u; j < max_energy_grid[i].size(); ++j )
+            cross_section[i][j] += subshell_cs.evaluate( max_energy_grid[i][j] );
+        }
 
-      ++subshell;
+        ++subshell;
+      }
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[i] = exception.what();
     }
   }
 
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not calculate the impulse "
+                                       "approx. total incoherent adjoint cross "
+                                       "section at energy grid index" );
+
   // Set the adjoint impulse approx total incoherent cross section
   data_container.setAdjointImpulseApproxIncoherentMaxEnergyGrid(
                                                              max_energy_grid );
@@ -1471,56 +1600,69 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointDoppl
   std::vector<std::vector<double> > max_energy_grid( energy_grid.size() );
   std::vector<std::vector<double> > cross_section( energy_grid.size() );
 
-  // The max_energy_grid at an energy
-  std::list<double> local_max_energy_grid;
-
   // Get the subshells
   const std::set<unsigned>& subshells = data_container.getSubshells();
 
-  // Generate the max energy grid at each energy grid point
-  for( unsigned i = 0u; i < energy_grid.size(); ++i )
+  std::vector<std::string> error_messages( energy_grid.size() );
+
+  // Generate the max energy grid at each energy grid point concurrently
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < energy_grid.size(); ++i )
   {
-    local_max_energy_grid.clear();
+    try{
+      // The max_energy_grid at an energy
+      std::list<double> local_max_energy_grid;
 
-    std::set<unsigned>::const_iterator subshell = subshells.begin();
+      std::set<unsigned>::const_iterator subshell = subshells.begin();
 
-    while( subshell != subshells.end() )
-    {
-      local_max_energy_grid.insert(
-        local_max_energy_grid.end(),
-        data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i].begin(),
-        data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i].end() );
+      while( subshell != subshells.end() )
+      {
+        local_max_energy_grid.insert(
+          local_max_energy_grid.end(),
+          data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i].begin(),
+          data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i].end() );
 
-      ++subshell;
-    }
+        ++subshell;
+      }
 
-    // Sort the local max energy grid
-    local_max_energy_grid.sort();
+      // Sort the local max energy grid
+      local_max_energy_grid.sort();
 
-    // Remove duplicate grid points from the local max energy grid
-    local_max_energy_grid.unique();
+      // Remove duplicate grid points from the local max energy grid
+      local_max_energy_grid.unique();
 
-    // Assign the max energy grid at this energy
-    max_energy_grid[i].assign( local_max_energy_grid.begin(),
-                               local_max_energy_grid.end() );
-    cross_section[i].resize( max_energy_grid[i].size(), 0 );
+      // Assign the max energy grid at this energy
+      max_energy_grid[i].assign( local_max_energy_grid.begin(),
+                                 local_max_energy_grid.end() );
+      cross_section[i].resize( max_energy_grid[i].size(), 0 );
 
-    // Evaluate the cross section on the max energy grid at this energy
-    subshell = subshells.begin();
+      // Evaluate the cross section on the max energy grid at this energy
+      subshell = subshells.begin();
 
-    while( subshell != subshells.end() )
-    {
-      Utility::TabularDistribution<Utility::LinLin> subshell_cs(
-        data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i],
-        data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSection( *subshell )[i] );
+      while( subshell != subshells.end() )
+      {
+        Utility::TabularDistribution<Utility::LinLin> subshell_cs(
+          data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( *subshell )[i],
+          data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSection( *subshell )[i] );
 
-      for( unsigned j = 0u; j < max_energy_grid[i].size(); ++j )
-        cross_section[i][j] += subshell_cs.evaluate( max_energy_grid[i][j] );
+        for( unsigned j = 0u; j < max_energy_grid[i].size(); ++j )
+          cross_section[i][j] += subshell_cs.evaluate( max_energy_grid[i][j] );
 
-      ++subshell;
+        ++subshell;
+      }
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[i] = exception.what();
     }
   }
 
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not calculate the Doppler "
+                                       "broadened impulse approx. total "
+                                       "incoherent adjoint cross section at "
+                                       "energy grid index" );
+
   // Set the adjoint Doppler broadened impulse approx total incoherent cross section
   data_container.setAdjointDopplerBroadenedImpulseApproxIncoherentMaxEnergyGrid(
                                                              max_energy_grid );
@@ -1639,6 +1781,11 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
                             Utility::Italicized( "union energy grid " ) );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  timer->start();
+
   Data::AdjointElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
@@ -1668,14 +1815,42 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
 
   std::set<unsigned>::iterator shell = data_container.getSubshells().begin();
 
-  // Loop through electroionization evaluator for every subshell
-  for ( auto&& shell : data_container.getSubshells() )
   {
-    this->createAdjointElectroionizationSubshellGridGenerator(
-      forward_electron_energy_grid,
-      forward_grid_searcher,
-      ionization_grid_generators[shell],
-      shell );
+    // Create the map entries before the generators are created concurrently
+    std::vector<std::pair<const unsigned,std::shared_ptr<ElectronGridGenerator> >*>
+      ionization_grid_generator_entries;
+
+    for ( auto&& shell : data_container.getSubshells() )
+    {
+      ionization_grid_generator_entries.push_back(
+                         &*ionization_grid_generators.emplace( shell,
+                                  std::shared_ptr<ElectronGridGenerator>() ).first );
+    }
+
+    std::vector<std::string> error_messages(
+                                   ionization_grid_generator_entries.size() );
+
+    // Create the electroionization grid generator for every subshell
+    #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+    for( size_t i = 0; i < ionization_grid_generator_entries.size(); ++i )
+    {
+      try{
+        this->createAdjointElectroionizationSubshellGridGenerator(
+                             forward_electron_energy_grid,
+                             forward_grid_searcher,
+                             ionization_grid_generator_entries[i]->second,
+                             ionization_grid_generator_entries[i]->first );
+      }
+      catch( const std::exception& exception )
+      {
+        error_messages[i] = exception.what();
+      }
+    }
+
+    this->throwParallelEvaluationErrors( error_messages,
+                                         "Could not create the adjoint "
+                                         "electroionization grid generator "
+                                         "for subshell index" );
   }
 
   std::list<double> union_energy_grid;
@@ -1824,7 +1999,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
     FRENSIE_FLUSH_ALL_LOGS();
   }
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( " done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( " done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
   //---------------------------------------------------------------------------//
   // Set the Union Energy Grid and Generate Cross Section on it.
@@ -1848,6 +2026,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
                                     << " cross section ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   std::vector<double> total_cross_section;
   this->createCrossSectionOnUnionEnergyGrid(
       union_energy_grid,
@@ -1857,13 +2037,18 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
   data_container.setAdjointTotalElasticCrossSection( total_cross_section );
   data_container.setAdjointTotalElasticCrossSectionThresholdEnergyIndex( threshold );
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
   FRENSIE_LOG_PARTIAL_NOTIFICATION( "   Setting the " <<
                                     Utility::Italicized( "adjoint cutoff elastic " )
                                     << " cross section and distribution ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   std::vector<double> cutoff_cross_section;
   this->createCrossSectionOnUnionEnergyGrid(
       union_energy_grid,
@@ -1908,7 +2093,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
   data_container.setAdjointCutoffElasticAngles( elastic_angle );
   data_container.setAdjointCutoffElasticPDF( elastic_pdf );
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
   if( moment_preserving_angles.size() > 0 )
   {
@@ -1972,6 +2160,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
                                     << " cross section ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   std::vector<double> forward_cross_section;
   this->createCrossSectionOnUnionEnergyGrid(
       union_energy_grid,
@@ -2006,7 +2196,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
   data_container.setForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex(
     threshold );
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
 //---------------------------------------------------------------------------//
 // Set Atomic Excitation Data
@@ -2016,6 +2209,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
                                     << " cross section ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   {
     std::vector<double> excitation_cross_section;
     this->createCrossSectionOnUnionEnergyGrid(
@@ -2049,7 +2244,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
     data_container.setAdjointAtomicExcitationEnergyGain( excitation_energy_gain );
   }
 
-    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
 
 //---------------------------------------------------------------------------//
@@ -2060,6 +2258,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
                                     << " cross section and distribution ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
+  timer->start();
+
   {
     std::vector<double> cross_section;
     unsigned threshold;
@@ -2112,20 +2312,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
     data_container.setAdjointElectronBremsstrahlungPDF( brem_pdfs );
   }
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+  timer->stop();
+
+  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                            << timer->elapsed().count() << " s)" );
 
 //---------------------------------------------------------------------------//
 // Set Electroionization Data
 //---------------------------------------------------------------------------//
-  FRENSIE_LOG_PARTIAL_NOTIFICATION( "   Setting the " <<
-                                    Utility::Italicized( "adjoint electroionization subshell" )
-                                    << " cross sections and distributions ... " );
+  FRENSIE_LOG_NOTIFICATION( "   Setting the " <<
+                            Utility::Italicized( "adjoint electroionization subshell" )
+                            << " cross sections and distributions:" );
   FRENSIE_FLUSH_ALL_LOGS();
 
   // Loop through the electroionization subshells
   shell = data_container.getSubshells().begin();
   for( shell; shell != data_container.getSubshells().end(); ++shell )
   {
+    FRENSIE_LOG_PARTIAL_NOTIFICATION( "     Setting " <<
+                                      Utility::Italicized( "subshell " ) <<
+                                      Utility::Italicized( Data::convertENDFDesignatorToSubshellEnum( *shell ) )
+                                      << " ... " );
+    FRENSIE_FLUSH_ALL_LOGS();
+
+    timer->start();
+
     std::vector<double> cross_section;
     unsigned threshold;
 
@@ -2179,9 +2390,12 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointElectronDat
     data_container.setAdjointElectroionizationRecoilEnergy(
       *shell,
       ionization_energies );
-  }
 
-  FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) );
+    timer->stop();
+
+    FRENSIE_LOG_NOTIFICATION( Utility::BoldGreen( "done." ) << " ("
+                              << timer->elapsed().count() << " s)" );
+  }
 }
 
 // Create the inelastic cross section distribution
@@ -2483,6 +2697,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createAdjointBremsstr
         this->getAdjointBremsstrahlungAbsoluteDifferenceTolerance(),
         this->getAdjointBremsstrahlungDistanceTolerance(),
         this->isElectronScatterAboveMaxModeOn() ) );
+
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator->enableParallelRefinement();
 }
 
 // Create the adjoint electroionization subshell grid generator
@@ -2661,6 +2879,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createAdjointElectroi
         this->getAdjointElectroionizationAbsoluteDifferenceTolerance(),
         this->getAdjointElectroionizationDistanceTolerance(),
         this->isElectronScatterAboveMaxModeOn() ) );
+
+  // Evaluate the refinement midpoints concurrently if requested
+  if( this->isParallelGridRefinementModeOn() )
+    grid_generator->enableParallelRefinement();
 }
 
 // Initialize the electron union energy grid
@@ -2734,6 +2956,24 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::findLowerAndUpperBinB
               max_energy );
 }
 
+// Throw an exception if a concurrent evaluation failed
+/*! \details Exceptions cannot propagate out of a parallel block. The error
+ * message of each item that failed is stored and the first error (in item
+ * order) is rethrown after the block.
+ */
+void StandardAdjointElectronPhotonRelaxationDataGenerator::throwParallelEvaluationErrors(
+                               const std::vector<std::string>& error_messages,
+                               const std::string& description )
+{
+  for( size_t i = 0; i < error_messages.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !error_messages[i].empty(),
+                        std::runtime_error,
+                        description << " " << i << ": "
+                        << error_messages[i] );
+  }
+}
+
 } // end DataGen namespace
 
 //---------------------------------------------------------------------------//
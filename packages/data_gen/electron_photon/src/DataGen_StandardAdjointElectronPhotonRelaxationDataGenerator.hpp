@@ -12,6 +12,8 @@
 // Std Lib Includes
 #include <utility>
 #include <iostream>
+#include <string>
+#include <vector>
 
 // FRENSIE Includes
 #include "DataGen_AdjointElectronPhotonRelaxationDataGenerator.hpp"
@@ -96,6 +98,11 @@ private:
   // The if a value is not equal to zero
   static bool notEqualZero( const double value );
 
+  // Throw an exception if a concurrent evaluation failed
+  static void throwParallelEvaluationErrors(
+                               const std::vector<std::string>& error_messages,
+                               const std::string& description );
+
 // Find the lower and upper bin boundary for a min and max energy
   void findLowerAndUpperBinBoundary(
     const double min_energy,
@@ -226,6 +233,15 @@ private:
           std::vector<std::vector<double> >& max_energy_grid,
           std::vector<std::vector<double> >& cross_section ) const;
 
+  // Create the incoherent cross section on an energy grid
+  void createCrossSectionOnEnergyGrid(
+          const std::vector<double>& energy_grid,
+          const AdjointIncoherentGridGenerator<Utility::LinLinLin>& grid_generator,
+          const std::function<double(double,double)>& cs_evaluator,
+          const double binding_energy,
+          std::vector<std::vector<double> >& max_energy_grid,
+          std::vector<std::vector<double> >& cross_section ) const;
+
   // Calculate the impulse approx total incoherent adjoint cross section
   void calculateAdjointImpulseApproxTotalIncoherentCrossSection();
 
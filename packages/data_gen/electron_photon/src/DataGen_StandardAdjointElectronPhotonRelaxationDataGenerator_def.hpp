@@ -9,6 +9,9 @@
 #ifndef DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 #define DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+
 namespace DataGen{
 
 // Create the cross section on the union energy grid
@@ -22,21 +25,30 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
    std::vector<double>& cross_section,
    unsigned& threshold_index ) const
 {
-   std::vector<double> raw_cross_section( union_energy_grid.size() );
+   // The functor will be called concurrently at every energy grid point
+   const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                          union_energy_grid.end() );
 
-   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
+   std::vector<double> raw_cross_section( energy_grid.size() );
 
-   unsigned index = 0u;
+   std::vector<std::string> error_messages( energy_grid.size() );
 
-   while( energy_grid_pt != union_energy_grid.end() )
+   #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+   for( size_t i = 0; i < energy_grid.size(); ++i )
    {
-     raw_cross_section[index] =
-       adjoint_cross_section_functor( *energy_grid_pt );
-
-     ++energy_grid_pt;
-     ++index;
+     try{
+       raw_cross_section[i] = adjoint_cross_section_functor( energy_grid[i] );
+     }
+     catch( const std::exception& exception )
+     {
+       error_messages[i] = exception.what();
+     }
    }
 
+   this->throwParallelEvaluationErrors( error_messages,
+                                        "Could not evaluate the adjoint cross "
+                                        "section at energy grid index" );
+
    std::vector<double>::iterator start =
      std::find_if( raw_cross_section.begin(),
                    raw_cross_section.end(),
@@ -63,6 +75,10 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
 {
   std::vector<double> raw_cross_section( union_energy_grid.size() );
 
+  // Copy the old cross section values and find the energy grid points that
+  // still need to be evaluated
+  std::vector<std::pair<size_t,double> > new_energy_grid_points;
+
   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
   std::list<double>::const_iterator old_energy_grid_pt =
     old_union_energy_grid.begin();
@@ -75,20 +91,40 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
     if ( *energy_grid_pt == *old_energy_grid_pt )
     {
       raw_cross_section[index] = old_cross_section[old_index];
-   
+
       ++old_energy_grid_pt;
       ++old_index;
     }
     else
     {
-      raw_cross_section[index] =
-        adjoint_cross_section_functor( *energy_grid_pt );
+      new_energy_grid_points.push_back(
+                                    std::make_pair( index, *energy_grid_pt ) );
     }
 
     ++energy_grid_pt;
     ++index;
   }
 
+  // Evaluate the cross section at the new energy grid points concurrently
+  std::vector<std::string> error_messages( new_energy_grid_points.size() );
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < new_energy_grid_points.size(); ++i )
+  {
+    try{
+      raw_cross_section[new_energy_grid_points[i].first] =
+        adjoint_cross_section_functor( new_energy_grid_points[i].second );
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[i] = exception.what();
+    }
+  }
+
+  this->throwParallelEvaluationErrors( error_messages,
+                                       "Could not evaluate the adjoint cross "
+                                       "section at new energy grid point" );
+
   std::vector<double>::iterator start =
     std::find_if( raw_cross_section.begin(),
                   raw_cross_section.end(),
@@ -299,6 +299,23 @@ FRENSIE_UNIT_TEST( ENDLElectronPhotonRelaxationDataGenerator,
                        MonteCarlo::UNIT_BASE_CORRELATED_GRID );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the parallel grid refinement mode can be set
+FRENSIE_UNIT_TEST( ENDLElectronPhotonRelaxationDataGenerator,
+                   setParallelGridRefinementMode )
+{
+  DataGen::ENDLElectronPhotonRelaxationDataGenerator
+    generator( h_endl_data_container );
+
+  FRENSIE_CHECK( !generator.isParallelGridRefinementModeOn() );
+
+  generator.setParallelGridRefinementModeOn();
+  FRENSIE_CHECK( generator.isParallelGridRefinementModeOn() );
+
+  generator.setParallelGridRefinementModeOff();
+  FRENSIE_CHECK( !generator.isParallelGridRefinementModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the notes can be set
 FRENSIE_UNIT_TEST( ENDLElectronPhotonRelaxationDataGenerator, setNotes )
@@ -1488,6 +1505,7 @@ FRENSIE_UNIT_TEST( ENDLElectronPhotonRelaxationDataGenerator,
     raw_data_generator->setDefaultElectronGridDistanceTolerance( 1e-20 );
 
     raw_data_generator->setRefineSecondaryElectronGridsModeOn();
+    raw_data_generator->setParallelGridRefinementModeOn();
 
     data_generator.reset( raw_data_generator );
   }
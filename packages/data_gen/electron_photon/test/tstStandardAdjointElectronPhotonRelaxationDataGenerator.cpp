@@ -18,6 +18,7 @@
 #include "DataGen_StandardAdjointElectronPhotonRelaxationDataGenerator.hpp"
 #include "Data_AdjointElectronPhotonRelaxationVolatileDataContainer.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -80,6 +81,9 @@ std::shared_ptr<TestStandardAdjointElectronPhotonRelaxationDataGenerator>
 std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>
   h_epr_data_container;
 
+std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>
+  si_epr_data_container;
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -523,6 +527,23 @@ FRENSIE_UNIT_TEST( StandardAdjointElectronPhotonRelaxationDataGenerator,
                        1e-14 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the parallel grid refinement mode can be set
+FRENSIE_UNIT_TEST( StandardAdjointElectronPhotonRelaxationDataGenerator,
+                   setParallelGridRefinementMode )
+{
+  DataGen::StandardAdjointElectronPhotonRelaxationDataGenerator
+    generator( h_epr_data_container );
+
+  FRENSIE_CHECK( !generator.isParallelGridRefinementModeOn() );
+
+  generator.setParallelGridRefinementModeOn();
+  FRENSIE_CHECK( generator.isParallelGridRefinementModeOn() );
+
+  generator.setParallelGridRefinementModeOff();
+  FRENSIE_CHECK( !generator.isParallelGridRefinementModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the Photon grid convergence tolerance can be set
 FRENSIE_UNIT_TEST( StandardAdjointElectronPhotonRelaxationDataGenerator,
@@ -1833,18 +1854,169 @@ FRENSIE_UNIT_TEST( StandardAdjointElectronPhotonRelaxationDataGenerator,
   h_data_container.saveToFile( "test_h_aepr.xml", true);
 }
 
+//---------------------------------------------------------------------------//
+// Check that the adjoint photon and electron data do not depend on the number
+// of threads
+FRENSIE_UNIT_TEST( StandardAdjointElectronPhotonRelaxationDataGenerator,
+                   setAdjointData_multiple_threads )
+{
+  if( !Utility::OpenMPProperties::isOpenMPUsed() )
+  {
+    FRENSIE_CHECK( true );
+    return;
+  }
+
+  const unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  // Silicon has multiple subshells (coarse tolerances keep the test short)
+  std::shared_ptr<TestStandardAdjointElectronPhotonRelaxationDataGenerator>
+    generator_si( new TestStandardAdjointElectronPhotonRelaxationDataGenerator(
+                           si_epr_data_container, 1e-3, 1.0, 1e-3, 1.0 ) );
+
+  generator_si->setDefaultPhotonGridConvergenceTolerance( 1e-2 );
+  generator_si->setDefaultPhotonGridAbsoluteDifferenceTolerance( 1e-42 );
+  generator_si->setDefaultPhotonGridDistanceTolerance( 1e-15 );
+  generator_si->setAdjointIncoherentEvaluationTolerance( 1e-2 );
+  generator_si->setAdjointIncoherentGridConvergenceTolerance( 0.5 );
+  generator_si->setAdjointIncoherentGridAbsoluteDifferenceTolerance( 1e-42 );
+  generator_si->setAdjointIncoherentGridDistanceTolerance( 1e-18 );
+  generator_si->setDefaultElectronGridConvergenceTolerance( 0.5 );
+  generator_si->setDefaultElectronGridAbsoluteDifferenceTolerance( 1e-20 );
+  generator_si->setDefaultElectronGridDistanceTolerance( 1e-18 );
+  generator_si->setAdjointBremsstrahlungEvaluationTolerance( 1e-2 );
+  generator_si->setAdjointBremsstrahlungGridConvergenceTolerance( 0.5 );
+  generator_si->setAdjointElectroionizationEvaluationTolerance( 1e-2 );
+  generator_si->setAdjointElectroionizationGridConvergenceTolerance( 0.5 );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+
+  generator_si->setAdjointRelaxationData();
+  generator_si->setComptonProfileData();
+  generator_si->setOccupationNumberData();
+  generator_si->setWallerHartreeScatteringFunctionData();
+  generator_si->setWallerHartreeAtomicFormFactorData();
+  generator_si->setAdjointPhotonData();
+  generator_si->setAdjointElectronData();
+
+  FRENSIE_REQUIRE( generator_si->getDataContainer().getSubshells().size() > 1 );
+
+  // The hydrogen data was generated by the previous tests
+  std::vector<std::shared_ptr<TestStandardAdjointElectronPhotonRelaxationDataGenerator> >
+    generators( {generator_h, generator_si} );
+
+  for( auto&& generator : generators )
+  {
+    // Get the serial data
+    const Data::AdjointElectronPhotonRelaxationDataContainer serial_data_container =
+      generator->getDataContainer();
+
+    Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+    generator->setAdjointPhotonData();
+    generator->setAdjointElectronData();
+
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+    // Get the data container
+    auto data_container = generator->getDataContainer();
+
+    // Check the photon data
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointPhotonEnergyGrid(),
+                         serial_data_container.getAdjointPhotonEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointWallerHartreeIncoherentMaxEnergyGrid(),
+                         serial_data_container.getAdjointWallerHartreeIncoherentMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointWallerHartreeIncoherentCrossSection(),
+                         serial_data_container.getAdjointWallerHartreeIncoherentCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxIncoherentMaxEnergyGrid(),
+                         serial_data_container.getAdjointImpulseApproxIncoherentMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxIncoherentCrossSection(),
+                         serial_data_container.getAdjointImpulseApproxIncoherentCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxIncoherentMaxEnergyGrid(),
+                         serial_data_container.getAdjointDopplerBroadenedImpulseApproxIncoherentMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxIncoherentCrossSection(),
+                         serial_data_container.getAdjointDopplerBroadenedImpulseApproxIncoherentCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointWallerHartreeTotalMaxEnergyGrid(),
+                         serial_data_container.getAdjointWallerHartreeTotalMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointWallerHartreeTotalCrossSection(),
+                         serial_data_container.getAdjointWallerHartreeTotalCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxTotalMaxEnergyGrid(),
+                         serial_data_container.getAdjointImpulseApproxTotalMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxTotalCrossSection(),
+                         serial_data_container.getAdjointImpulseApproxTotalCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxTotalMaxEnergyGrid(),
+                         serial_data_container.getAdjointDopplerBroadenedImpulseApproxTotalMaxEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxTotalCrossSection(),
+                         serial_data_container.getAdjointDopplerBroadenedImpulseApproxTotalCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getWallerHartreeTotalCrossSection(),
+                         serial_data_container.getWallerHartreeTotalCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getImpulseApproxTotalCrossSection(),
+                         serial_data_container.getImpulseApproxTotalCrossSection() );
+
+    // Check the electron data
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointElectronEnergyGrid(),
+                         serial_data_container.getAdjointElectronEnergyGrid() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointTotalElasticCrossSection(),
+                         serial_data_container.getAdjointTotalElasticCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointCutoffElasticCrossSection(),
+                         serial_data_container.getAdjointCutoffElasticCrossSection() );
+    FRENSIE_CHECK_EQUAL( data_container.getAdjointBremsstrahlungElectronCrossSection(),
+                         serial_data_container.getAdjointBremsstrahlungElectronCrossSection() );
+
+    for( auto&& energy : serial_data_container.getAdjointElectronBremsstrahlungEnergyGrid() )
+    {
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointElectronBremsstrahlungEnergy( energy ),
+                           serial_data_container.getAdjointElectronBremsstrahlungEnergy( energy ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointElectronBremsstrahlungPDF( energy ),
+                           serial_data_container.getAdjointElectronBremsstrahlungPDF( energy ) );
+    }
+
+    // Check the subshell data
+    for( auto&& subshell : serial_data_container.getSubshells() )
+    {
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( subshell ),
+                           serial_data_container.getAdjointImpulseApproxSubshellIncoherentMaxEnergyGrid( subshell ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointImpulseApproxSubshellIncoherentCrossSection( subshell ),
+                           serial_data_container.getAdjointImpulseApproxSubshellIncoherentCrossSection( subshell ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( subshell ),
+                           serial_data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentMaxEnergyGrid( subshell ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSection( subshell ),
+                           serial_data_container.getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSection( subshell ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointElectroionizationCrossSection( subshell ),
+                           serial_data_container.getAdjointElectroionizationCrossSection( subshell ) );
+      FRENSIE_CHECK_EQUAL( data_container.getAdjointElectroionizationCrossSectionThresholdEnergyIndex( subshell ),
+                           serial_data_container.getAdjointElectroionizationCrossSectionThresholdEnergyIndex( subshell ) );
+
+      for( auto&& energy : serial_data_container.getAdjointElectroionizationEnergyGrid( subshell ) )
+      {
+        FRENSIE_CHECK_EQUAL( data_container.getAdjointElectroionizationRecoilEnergy( subshell, energy ),
+                             serial_data_container.getAdjointElectroionizationRecoilEnergy( subshell, energy ) );
+        FRENSIE_CHECK_EQUAL( data_container.getAdjointElectroionizationRecoilPDF( subshell, energy ),
+                             serial_data_container.getAdjointElectroionizationRecoilPDF( subshell, energy ) );
+      }
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( Utility::OpenMPProperties::getRequestedNumberOfThreads(),
+                       threads );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
 FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
 
 std::string test_h_native_file;
+std::string test_si_native_file;
 
 FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
 {
   ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_h_native_file",
                                         test_h_native_file, "",
                                         "Test NATIVE H file name" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_si_native_file",
+                                        test_si_native_file, "",
+                                        "Test NATIVE Si file name" );
 }
 
 FRENSIE_CUSTOM_UNIT_TEST_INIT()
@@ -1852,6 +2024,10 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
   // Create the native data file container for h
   h_epr_data_container.reset( new Data::ElectronPhotonRelaxationDataContainer(
                                                         test_h_native_file ) );
+
+  // Create the native data file container for si
+  si_epr_data_container.reset( new Data::ElectronPhotonRelaxationDataContainer(
+                                                       test_si_native_file ) );
 }
 
 FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
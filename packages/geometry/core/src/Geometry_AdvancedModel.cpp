@@ -0,0 +1,97 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_AdvancedModel.cpp
+//! \author Alex Robinson
+//! \brief  The advanced geometry model base class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Geometry_AdvancedModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Geometry{
+
+// Get the number of indexed surfaces
+/*! \details Only the surfaces of models that have assigned the dense surface
+ * indices will be counted (see Geometry::AdvancedModel::assignSurfaceIndices).
+ */
+size_t AdvancedModel::getNumberOfSurfaces() const
+{
+  return d_indexed_surfaces.size();
+}
+
+// Get the dense index of a surface
+/*! \details The dense surface indices are in [0,N) where N is the number of
+ * surfaces. The invalid entity index will be returned if the surface has not
+ * been indexed.
+ */
+auto AdvancedModel::getSurfaceIndex( const EntityId surface_id ) const
+  -> EntityIndex
+{
+  std::unordered_map<EntityId,EntityIndex>::const_iterator surface_index_it =
+    d_surface_id_index_map.find( surface_id );
+
+  if( surface_index_it != d_surface_id_index_map.end() )
+    return surface_index_it->second;
+  else
+    return Model::invalidEntityIndex();
+}
+
+// Get the surface with the dense index
+/*! \details The invalid surface id will be returned if the index is not
+ * valid.
+ */
+auto AdvancedModel::getSurfaceAtIndex( const EntityIndex surface_index ) const
+  -> EntityId
+{
+  if( surface_index < d_indexed_surfaces.size() )
+    return d_indexed_surfaces[surface_index];
+  else
+    return Model::invalidSurfaceId();
+}
+
+// Check if the surface with the dense index is a reflecting surface
+bool AdvancedModel::isReflectingSurfaceAtIndex(
+                                   const EntityIndex surface_index ) const
+{
+  if( surface_index < d_indexed_reflecting_surface_flags.size() )
+    return d_indexed_reflecting_surface_flags[surface_index];
+  else
+    return false;
+}
+
+// Assign a dense index to every surface
+/*! \details This method must be called by the derived model once the
+ * surface properties are available (e.g. at the end of the model
+ * initialization). The surfaces will be indexed in ascending order of their
+ * ids.
+ */
+void AdvancedModel::assignSurfaceIndices()
+{
+  SurfaceIdSet surfaces;
+
+  this->getSurfaces( surfaces );
+
+  TEST_FOR_EXCEPTION( surfaces.size() >= Model::invalidEntityIndex(),
+                      std::runtime_error,
+                      "The model has too many surfaces to index!" );
+
+  d_surface_id_index_map.clear();
+  d_indexed_surfaces.assign( surfaces.begin(), surfaces.end() );
+  d_indexed_reflecting_surface_flags.resize( d_indexed_surfaces.size() );
+
+  for( size_t i = 0; i < d_indexed_surfaces.size(); ++i )
+  {
+    d_surface_id_index_map[d_indexed_surfaces[i]] = i;
+
+    d_indexed_reflecting_surface_flags[i] =
+      this->isReflectingSurface( d_indexed_surfaces[i] );
+  }
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_AdvancedModel.cpp
+//---------------------------------------------------------------------------//
@@ -74,6 +74,23 @@ public:
   virtual bool isReflectingSurface(
                             const EntityId surface_id ) const = 0;
 
+  //! Get the number of indexed surfaces
+  size_t getNumberOfSurfaces() const;
+
+  //! Get the dense index of a surface
+  EntityIndex getSurfaceIndex( const EntityId surface_id ) const;
+
+  //! Get the surface with the dense index
+  EntityId getSurfaceAtIndex( const EntityIndex surface_index ) const;
+
+  //! Check if the surface with the dense index is a reflecting surface
+  bool isReflectingSurfaceAtIndex( const EntityIndex surface_index ) const;
+
+protected:
+
+  //! Assign a dense index to every surface
+  void assignSurfaceIndices();
+
 private:
 
   // Save the model to an archive
@@ -90,6 +107,15 @@ private:
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
+
+  // The surface id index map
+  std::unordered_map<EntityId,EntityIndex> d_surface_id_index_map;
+
+  // The indexed surfaces
+  std::vector<EntityId> d_indexed_surfaces;
+
+  // The indexed reflecting surface flags
+  std::vector<unsigned char> d_indexed_reflecting_surface_flags;
 };
 
 } // end Geometry namespace
@@ -115,6 +115,51 @@ auto InfiniteMediumModel::getCellVolume(
     return Utility::QuantityTraits<Volume>::zero();
 }
 
+// Get the number of indexed cells
+size_t InfiniteMediumModel::getNumberOfCells() const
+{
+  return 1;
+}
+
+// Get the dense index of a cell
+/*! \details The infinite medium cell always has index 0 (a particle state
+ * creates an infinite medium model when it is not embedded in a model so
+ * the cell index map is not stored).
+ */
+auto InfiniteMediumModel::getCellIndex( const EntityId cell ) const
+  -> EntityIndex
+{
+  if( cell == d_cell )
+    return 0;
+  else
+    return Model::invalidEntityIndex();
+}
+
+// Get the cell with the dense index
+auto InfiniteMediumModel::getCellAtIndex( const EntityIndex cell_index ) const
+  -> EntityId
+{
+  if( cell_index == 0 )
+    return d_cell;
+  else
+    return Model::invalidCellId();
+}
+
+// Check if the cell with the dense index is a termination cell
+bool InfiniteMediumModel::isTerminationCellAtIndex( const EntityIndex ) const
+{
+  return false;
+}
+
+// Check if the cell with the dense index is void
+bool InfiniteMediumModel::isVoidCellAtIndex( const EntityIndex cell_index ) const
+{
+  if( cell_index == 0 )
+    return d_density == 0.0*Model::DensityUnit();
+  else
+    return false;
+}
+
 // Create a raw, heap-allocated navigator
 InfiniteMediumNavigator* InfiniteMediumModel::createNavigatorAdvanced(
     const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
@@ -67,6 +67,21 @@ public:
   //! Get the cell volume
   Volume getCellVolume( const EntityId cell ) const override;
 
+  //! Get the number of indexed cells
+  size_t getNumberOfCells() const override;
+
+  //! Get the dense index of a cell
+  EntityIndex getCellIndex( const EntityId cell ) const override;
+
+  //! Get the cell with the dense index
+  EntityId getCellAtIndex( const EntityIndex cell_index ) const override;
+
+  //! Check if the cell with the dense index is a termination cell
+  bool isTerminationCellAtIndex( const EntityIndex cell_index ) const override;
+
+  //! Check if the cell with the dense index is void
+  bool isVoidCellAtIndex( const EntityIndex cell_index ) const override;
+
   //! Create a raw, heap-allocated navigator
   InfiniteMediumNavigator* createNavigatorAdvanced(
                                     const Navigator::AdvanceCompleteCallback&
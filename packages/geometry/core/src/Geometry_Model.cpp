@@ -12,9 +12,98 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "Geometry_Model.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Geometry{
 
+// Get the number of indexed cells
+/*! \details Only the cells of models that have assigned the dense cell
+ * indices will be counted (see Geometry::Model::assignCellIndices).
+ */
+size_t Model::getNumberOfCells() const
+{
+  return d_indexed_cells.size();
+}
+
+// Get the dense index of a cell
+/*! \details The dense cell indices are in [0,N) where N is the number of
+ * cells. The invalid entity index will be returned if the cell has not been
+ * indexed. This lookup only needs to be done when a particle enters a new
+ * cell - the other cell properties can then be retrieved with the index.
+ */
+auto Model::getCellIndex( const EntityId cell ) const -> EntityIndex
+{
+  std::unordered_map<EntityId,EntityIndex>::const_iterator cell_index_it =
+    d_cell_id_index_map.find( cell );
+
+  if( cell_index_it != d_cell_id_index_map.end() )
+    return cell_index_it->second;
+  else
+    return Model::invalidEntityIndex();
+}
+
+// Get the cell with the dense index
+/*! \details The invalid cell id will be returned if the index is not valid.
+ */
+auto Model::getCellAtIndex( const EntityIndex cell_index ) const -> EntityId
+{
+  if( cell_index < d_indexed_cells.size() )
+    return d_indexed_cells[cell_index];
+  else
+    return Model::invalidCellId();
+}
+
+// Check if the cell with the dense index is a termination cell
+bool Model::isTerminationCellAtIndex( const EntityIndex cell_index ) const
+{
+  if( cell_index < d_indexed_cell_flags.size() )
+    return d_indexed_cell_flags[cell_index] & TERMINATION_CELL_FLAG;
+  else
+    return false;
+}
+
+// Check if the cell with the dense index is void
+bool Model::isVoidCellAtIndex( const EntityIndex cell_index ) const
+{
+  if( cell_index < d_indexed_cell_flags.size() )
+    return d_indexed_cell_flags[cell_index] & VOID_CELL_FLAG;
+  else
+    return false;
+}
+
+// Assign a dense index to every cell
+/*! \details This method must be called by the derived model once the cell
+ * properties are available (e.g. at the end of the model initialization).
+ * The cells will be indexed in ascending order of their ids.
+ */
+void Model::assignCellIndices()
+{
+  CellIdSet cells;
+
+  this->getCells( cells, true, true );
+
+  TEST_FOR_EXCEPTION( cells.size() >= Model::invalidEntityIndex(),
+                      std::runtime_error,
+                      "The model has too many cells to index!" );
+
+  d_cell_id_index_map.clear();
+  d_indexed_cells.assign( cells.begin(), cells.end() );
+  d_indexed_cell_flags.resize( d_indexed_cells.size() );
+
+  for( size_t i = 0; i < d_indexed_cells.size(); ++i )
+  {
+    d_cell_id_index_map[d_indexed_cells[i]] = i;
+
+    d_indexed_cell_flags[i] = 0;
+
+    if( this->isTerminationCell( d_indexed_cells[i] ) )
+      d_indexed_cell_flags[i] |= TERMINATION_CELL_FLAG;
+
+    if( this->isVoidCell( d_indexed_cells[i] ) )
+      d_indexed_cell_flags[i] |= VOID_CELL_FLAG;
+  }
+}
+
 // The invalid cell id
 auto Model::invalidCellId() -> EntityId
 {
@@ -38,6 +127,12 @@ auto Model::invalidEstimatorId() -> EstimatorId
 {
   return std::numeric_limits<EstimatorId>::max();
 }
+
+// The invalid entity index
+auto Model::invalidEntityIndex() -> EntityIndex
+{
+  return std::numeric_limits<EntityIndex>::max();
+}
   
 } // end Geometry namespace
 
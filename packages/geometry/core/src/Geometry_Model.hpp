@@ -48,6 +48,9 @@ public:
   //! The estimator id type
   typedef uint32_t EstimatorId;
 
+  //! The dense entity (cell or surface) index type
+  typedef uint32_t EntityIndex;
+
   //! The length unit
   typedef Navigator::LengthUnit LengthUnit;
 
@@ -140,6 +143,21 @@ public:
   //! Get the cell volume
   virtual Volume getCellVolume( const EntityId cell ) const = 0;
 
+  //! Get the number of indexed cells
+  virtual size_t getNumberOfCells() const;
+
+  //! Get the dense index of a cell
+  virtual EntityIndex getCellIndex( const EntityId cell ) const;
+
+  //! Get the cell with the dense index
+  virtual EntityId getCellAtIndex( const EntityIndex cell_index ) const;
+
+  //! Check if the cell with the dense index is a termination cell
+  virtual bool isTerminationCellAtIndex( const EntityIndex cell_index ) const;
+
+  //! Check if the cell with the dense index is void
+  virtual bool isVoidCellAtIndex( const EntityIndex cell_index ) const;
+
   //! The invalid cell id
   static EntityId invalidCellId();
 
@@ -152,6 +170,9 @@ public:
   //! The invalid estimator id
   static EstimatorId invalidEstimatorId();
 
+  //! The invalid entity index
+  static EntityIndex invalidEntityIndex();
+
   //! Create a raw, heap-allocated navigator
   virtual Geometry::Navigator* createNavigatorAdvanced(
         const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const = 0;
@@ -172,8 +193,18 @@ protected:
   //! Initialize the model just-in-time
   virtual void initializeJustInTime() = 0;
 
+  //! Assign a dense index to every cell
+  void assignCellIndices();
+
 private:
 
+  // The cell property flags
+  enum CellFlag
+  {
+    TERMINATION_CELL_FLAG = 1,
+    VOID_CELL_FLAG = 2
+  };
+
   // Save the model to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const
@@ -188,6 +219,15 @@ private:
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
+
+  // The cell id index map
+  std::unordered_map<EntityId,EntityIndex> d_cell_id_index_map;
+
+  // The indexed cells
+  std::vector<EntityId> d_indexed_cells;
+
+  // The indexed cell flags (see CellFlag)
+  std::vector<unsigned char> d_indexed_cell_flags;
 };
 
 // Check if this is an advanced model
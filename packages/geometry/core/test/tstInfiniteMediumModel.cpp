@@ -177,6 +177,44 @@ FRENSIE_UNIT_TEST( InfiniteMediumModel, isVoidCell )
   FRENSIE_CHECK( !model_b.isVoidCell( 4 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cell indices can be returned
+FRENSIE_UNIT_TEST( InfiniteMediumModel, getCellIndex )
+{
+  Geometry::InfiniteMediumModel model( 2 );
+
+  FRENSIE_CHECK_EQUAL( model.getNumberOfCells(), 1 );
+  FRENSIE_CHECK_EQUAL( model.getCellIndex( 2 ), 0 );
+  FRENSIE_CHECK_EQUAL( model.getCellIndex( 3 ),
+                       Geometry::Model::invalidEntityIndex() );
+  FRENSIE_CHECK_EQUAL( model.getCellAtIndex( 0 ), 2 );
+  FRENSIE_CHECK_EQUAL( model.getCellAtIndex( 1 ),
+                       Geometry::Model::invalidCellId() );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the cell with the index is a termination cell
+FRENSIE_UNIT_TEST( InfiniteMediumModel, isTerminationCellAtIndex )
+{
+  Geometry::InfiniteMediumModel model( 2 );
+
+  FRENSIE_CHECK( !model.isTerminationCellAtIndex( 0 ) );
+  FRENSIE_CHECK( !model.isTerminationCellAtIndex( 1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the cell with the index is a void cell
+FRENSIE_UNIT_TEST( InfiniteMediumModel, isVoidCellAtIndex )
+{
+  Geometry::InfiniteMediumModel model_a( 3 );
+
+  FRENSIE_CHECK( model_a.isVoidCellAtIndex( 0 ) );
+
+  Geometry::InfiniteMediumModel model_b( 4, 1, 1.0*Geometry::Model::DensityUnit() );
+
+  FRENSIE_CHECK( !model_b.isVoidCellAtIndex( 0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check if the cell volume can be returned
 FRENSIE_UNIT_TEST( InfiniteMediumModel, getCellVolume )
@@ -47,6 +47,17 @@ bool DagMCEntityHandler::doesEntityHandleExist(
   return d_entities.find( entity_handle ) != d_entities.end();
 }
 
+// Get the dense index of the entity (-1 if it does not exist)
+/*! \details The dense index is the position of the entity in the range of
+ * entities. DagMC creates its entity sets contiguously so this lookup is
+ * usually constant time.
+ */
+int DagMCEntityHandler::getEntityIndex(
+                                 const moab::EntityHandle entity_handle ) const
+{
+  return d_entities.index( entity_handle );
+}
+
 // Get the beginning const iterator
 moab::Range::const_iterator DagMCEntityHandler::begin() const
 {
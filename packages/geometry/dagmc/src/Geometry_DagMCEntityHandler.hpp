@@ -47,6 +47,9 @@ protected:
   //! Check if the entity exists
   bool doesEntityHandleExist( const moab::EntityHandle entity_handle ) const;
 
+  //! Get the dense index of the entity (-1 if it does not exist)
+  int getEntityIndex( const moab::EntityHandle entity_handle ) const;
+
 private:
 
   // The entities
@@ -114,6 +114,14 @@ void DagMCModel::initialize( const bool suppress_dagmc_output )
   EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
                            "Unable to extract the reflecting surfaces!" );
 
+  // Assign the dense cell and surface indices
+  try{
+    this->assignCellIndices();
+    this->assignSurfaceIndices();
+  }
+  EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                           "Unable to index the cells and surfaces!" );
+
   FRENSIE_LOG_NOTIFICATION( "done!" );
   FRENSIE_FLUSH_ALL_LOGS();
 }
@@ -15,11 +15,14 @@ namespace Geometry{
 // Constructor
 FastDagMCCellHandler::FastDagMCCellHandler( const moab::DagMC* dagmc_instance )
   : DagMCCellHandler( dagmc_instance ),
+    d_cell_ids(),
     d_cell_id_handle_map()
 {
   // Make sure the DagMC instance is valid
   testPrecondition( dagmc_instance != NULL );
 
+  d_cell_ids.reserve( this->getNumberOfCells() );
+
   moab::Range::const_iterator cell_it = this->begin();
 
   while( cell_it != this->end() )
@@ -27,8 +30,10 @@ FastDagMCCellHandler::FastDagMCCellHandler( const moab::DagMC* dagmc_instance )
     EntityId cell_id =
       const_cast<moab::DagMC*>( dagmc_instance )->get_entity_id( *cell_it );
 
-    d_cell_id_handle_map.insert(
-                            CellIdHandleMap::value_type( cell_id, *cell_it ) );
+    // The range iteration order is the dense cell handle index order
+    d_cell_ids.push_back( cell_id );
+
+    d_cell_id_handle_map[cell_id] = *cell_it;
 
     ++cell_it;
   }
@@ -41,7 +46,7 @@ auto FastDagMCCellHandler::getCellId(
   // Make sure the cell handle exists
   testPrecondition( this->doesCellHandleExist( cell_handle ) );
 
-  return d_cell_id_handle_map.right.find( cell_handle )->second;
+  return d_cell_ids[this->getEntityIndex( cell_handle )];
 }
 
 // Get the cell handle from a cell id
@@ -51,24 +56,21 @@ moab::EntityHandle FastDagMCCellHandler::getCellHandle(
   // Make sure the cell id exists
   testPrecondition( this->doesCellExist( cell_id ) );
 
-
-  return d_cell_id_handle_map.left.find( cell_id )->second;
+  return d_cell_id_handle_map.find( cell_id )->second;
 }
 
 // Check if the cell exists
 bool FastDagMCCellHandler::doesCellExist(
                                        const EntityId cell_id ) const
 {
-  return d_cell_id_handle_map.left.find( cell_id ) !=
-    d_cell_id_handle_map.left.end();
+  return d_cell_id_handle_map.find( cell_id ) != d_cell_id_handle_map.end();
 }
 
 // Check if the cell handle exists
 bool FastDagMCCellHandler::doesCellHandleExist(
                                    const moab::EntityHandle cell_handle ) const
 {
-  return d_cell_id_handle_map.right.find( cell_handle ) !=
-    d_cell_id_handle_map.right.end();
+  return this->getEntityIndex( cell_handle ) >= 0;
 }
 
 } // end Geometry namespace
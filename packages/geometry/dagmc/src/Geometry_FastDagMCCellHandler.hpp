@@ -10,11 +10,8 @@
 #define GEOMETRY_FAST_DAGMC_CELL_HANDLER_HPP
 
 // Std Lib Includes
-#include <unordered_set>
-
-// Boost Includes
-#include <boost/bimap.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
+#include <vector>
+#include <unordered_map>
 
 // FRENSIE Includes
 #include "Geometry_DagMCCellHandler.hpp"
@@ -23,9 +20,11 @@ namespace Geometry{
 
 /*! The FastDagMCCellHandler class
  * \details This class is optimized for performance. The conversion from
- * cell handle to cell id or cell id to cell handle is fast. The handles
- * are stored twice to allow for the fast lookup times (extra storage
- * overhead).
+ * cell handle to cell id uses the dense index of the cell handle (the
+ * position of the handle in the cell range), which is the lookup done every
+ * time a particle enters a new cell. The conversion from cell id to cell
+ * handle uses a hash map. The handles are stored twice to allow for the fast
+ * lookup times (extra storage overhead).
  */
 class FastDagMCCellHandler : public DagMCCellHandler
 {
@@ -53,10 +52,11 @@ public:
 
 private:
 
-  // The cell id to cell handle map
-  typedef boost::bimap<boost::bimaps::unordered_set_of<EntityId>,boost::bimaps::unordered_set_of<moab::EntityHandle> > CellIdHandleMap;
+  // The cell ids (stored by dense cell handle index)
+  std::vector<EntityId> d_cell_ids;
 
-  CellIdHandleMap d_cell_id_handle_map;
+  // The cell id to cell handle map
+  std::unordered_map<EntityId,moab::EntityHandle> d_cell_id_handle_map;
 };
 
 } // end Geometry namespace
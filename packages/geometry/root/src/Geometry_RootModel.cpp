@@ -94,6 +94,13 @@ void RootModel::initialize( const RootModelProperties& model_properties,
     EXCEPTION_CATCH_RETHROW( InvalidRootGeometry,
                              "Invalid root geometry detected!" );
 
+    // Assign the dense cell indices
+    try{
+      this->assignCellIndices();
+    }
+    EXCEPTION_CATCH_RETHROW( InvalidRootGeometry,
+                             "Unable to index the cells!" );
+
     FRENSIE_LOG_NOTIFICATION( "done!" );
     FRENSIE_FLUSH_ALL_LOGS();
   }
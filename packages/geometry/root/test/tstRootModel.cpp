@@ -235,6 +235,49 @@ FRENSIE_UNIT_TEST( RootModel, isVoidCell )
   FRENSIE_CHECK( !model->isVoidCell( 3 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cell indices can be returned
+FRENSIE_UNIT_TEST( RootModel, getCellIndex )
+{
+  std::shared_ptr<const Geometry::RootModel> model =
+    Geometry::RootModel::getInstance();
+
+  FRENSIE_CHECK_EQUAL( model->getNumberOfCells(), 3 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 2 ), 1 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 3 ), 2 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 4 ),
+                       Geometry::Model::invalidEntityIndex() );
+
+  FRENSIE_CHECK_EQUAL( model->getCellAtIndex( 0 ), 1 );
+  FRENSIE_CHECK_EQUAL( model->getCellAtIndex( 1 ), 2 );
+  FRENSIE_CHECK_EQUAL( model->getCellAtIndex( 2 ), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the cell with the index is a termination cell
+FRENSIE_UNIT_TEST( RootModel, isTerminationCellAtIndex )
+{
+  std::shared_ptr<const Geometry::RootModel> model =
+    Geometry::RootModel::getInstance();
+
+  FRENSIE_CHECK( !model->isTerminationCellAtIndex( 0 ) );
+  FRENSIE_CHECK( !model->isTerminationCellAtIndex( 1 ) );
+  FRENSIE_CHECK( model->isTerminationCellAtIndex( 2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the cell with the index is a void cell
+FRENSIE_UNIT_TEST( RootModel, isVoidCellAtIndex )
+{
+  std::shared_ptr<const Geometry::RootModel> model =
+    Geometry::RootModel::getInstance();
+
+  FRENSIE_CHECK( model->isVoidCellAtIndex( 0 ) );
+  FRENSIE_CHECK( !model->isVoidCellAtIndex( 1 ) );
+  FRENSIE_CHECK( !model->isVoidCellAtIndex( 2 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Get if the cell volume
 FRENSIE_UNIT_TEST( RootModel, getCellVolume )
@@ -0,0 +1,379 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceComponent.cpp
+//! \author Alex Robinson
+//! \brief  The surface source component class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <sstream>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_SurfaceSourceComponent.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+SurfaceSourceComponent::SurfaceSourceComponent()
+  : d_sampling_mode( REPLAY_SAMPLING_MODE ),
+    d_normalize_weights( false ),
+    d_number_of_recorded_histories( 0 ),
+    d_total_recorded_weight( 0.0 ),
+    d_sampled_weight( 1.0 )
+{ /* ... */ }
+
+// Constructor
+SurfaceSourceComponent::SurfaceSourceComponent(
+                  const Id id,
+                  const double selection_weight,
+                  const std::shared_ptr<const Geometry::Model>& model,
+                  const std::vector<boost::filesystem::path>& file_names,
+                  const SamplingMode sampling_mode,
+                  const bool normalize_weights )
+  : SurfaceSourceComponent( id,
+                            selection_weight,
+                            CellIdSet(),
+                            model,
+                            file_names,
+                            sampling_mode,
+                            normalize_weights )
+{ /* ... */ }
+
+// Constructor (with rejection cells)
+/*! \details The records from all of the files will be combined (e.g. the
+ * files written by each process of a distributed simulation). The number
+ * of source histories used to generate the records is the sum of the number
+ * of histories stored in each file header.
+ */
+SurfaceSourceComponent::SurfaceSourceComponent(
+                  const Id id,
+                  const double selection_weight,
+                  const CellIdSet& rejection_cells,
+                  const std::shared_ptr<const Geometry::Model>& model,
+                  const std::vector<boost::filesystem::path>& file_names,
+                  const SamplingMode sampling_mode,
+                  const bool normalize_weights )
+  : ParticleSourceComponent( id, selection_weight, rejection_cells, model ),
+    d_file_names( file_names ),
+    d_sampling_mode( sampling_mode ),
+    d_normalize_weights( normalize_weights ),
+    d_number_of_recorded_histories( 0 ),
+    d_total_recorded_weight( 0.0 ),
+    d_sampled_weight( 1.0 )
+{
+  // Make sure that there is at least one file
+  TEST_FOR_EXCEPTION( file_names.empty(),
+                      std::runtime_error,
+                      "At least one surface source file must be specified!" );
+
+  try{
+    this->loadRecords();
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Could not create surface source component "
+                           << id << "!" );
+}
+
+// Return the surface source file names
+const std::vector<boost::filesystem::path>&
+SurfaceSourceComponent::getFileNames() const
+{
+  return d_file_names;
+}
+
+// Return the sampling mode
+auto SurfaceSourceComponent::getSamplingMode() const -> SamplingMode
+{
+  return d_sampling_mode;
+}
+
+// Check if the weights are normalized
+bool SurfaceSourceComponent::areWeightsNormalized() const
+{
+  return d_normalize_weights;
+}
+
+// Return the number of records
+size_t SurfaceSourceComponent::getNumberOfRecords() const
+{
+  return d_records.size();
+}
+
+// Return the number of source histories used to generate the records
+uint64_t SurfaceSourceComponent::getNumberOfRecordedHistories() const
+{
+  return d_number_of_recorded_histories;
+}
+
+// Return the total recorded weight
+double SurfaceSourceComponent::getTotalRecordedWeight() const
+{
+  return d_total_recorded_weight;
+}
+
+// Return the number of sampling trials in the phase space dimension
+/*! \details The phase space dimensions are not sampled (the recorded states
+ * are used directly).
+ */
+auto SurfaceSourceComponent::getNumberOfDimensionTrials(
+                          const PhaseSpaceDimension dimension ) const -> Counter
+{
+  return 0;
+}
+
+// Return the number of samples in the phase space dimension
+/*! \details The phase space dimensions are not sampled (the recorded states
+ * are used directly).
+ */
+auto SurfaceSourceComponent::getNumberOfDimensionSamples(
+                          const PhaseSpaceDimension dimension ) const -> Counter
+{
+  return 0;
+}
+
+// Return the sampling efficiency in the phase space dimension
+double SurfaceSourceComponent::getDimensionSamplingEfficiency(
+                                   const PhaseSpaceDimension dimension ) const
+{
+  return 1.0;
+}
+
+// Print a summary of the sampling statistics
+void SurfaceSourceComponent::printSummary( std::ostream& os ) const
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  std::ostringstream particle_types;
+
+  for( auto&& particle_type : d_particle_types )
+  {
+    if( particle_types.tellp() > 0 )
+      particle_types << ", ";
+
+    particle_types << particle_type;
+  }
+
+  // Print the source sampling statistics
+  this->printStandardSummary( "Surface Source Component",
+                              particle_types.str(),
+                              this->getNumberOfTrials(),
+                              this->getNumberOfSamples(),
+                              this->getSamplingEfficiency(),
+                              os );
+
+  os << "  Sampling mode: "
+     << (d_sampling_mode == REPLAY_SAMPLING_MODE ? "Replay" : "Resample")
+     << "\n"
+     << "  Number of records: " << d_records.size() << "\n"
+     << "  Number of recorded histories: " << d_number_of_recorded_histories
+     << "\n"
+     << "  Total recorded weight: " << d_total_recorded_weight << std::endl;
+
+  // Print the starting cell summary
+  CellIdSet starting_cells;
+  this->getStartingCells( starting_cells );
+
+  this->printStandardStartingCellSummary( starting_cells, os );
+}
+
+// Enable thread support
+void SurfaceSourceComponent::enableThreadSupportImpl( const size_t threads )
+{ /* ... */ }
+
+// Reset the sampling statistics
+void SurfaceSourceComponent::resetDataImpl()
+{ /* ... */ }
+
+// Reduce the sampling statistics on the root process
+void SurfaceSourceComponent::reduceDataImpl( const Utility::Communicator& comm,
+                                             const int root_process )
+{ /* ... */ }
+
+// Return the number of particle states that will be sampled for the given
+// history number
+/*! \details In the replay sampling mode a history will sample the states
+ * recorded by a single recorded history. Every N consecutive histories
+ * will replay all of the recorded histories once.
+ */
+unsigned long long SurfaceSourceComponent::getNumberOfParticleStateSamples(
+                                       const unsigned long long history ) const
+{
+  if( d_sampling_mode == RESAMPLE_SAMPLING_MODE )
+    return 1;
+  else
+  {
+    const unsigned long long recorded_history =
+      history % d_number_of_recorded_histories;
+
+    if( recorded_history + 1 < d_recorded_history_offsets.size() )
+    {
+      return d_recorded_history_offsets[recorded_history+1] -
+        d_recorded_history_offsets[recorded_history];
+    }
+    else
+      return 0;
+  }
+}
+
+// Initialize a particle state
+std::shared_ptr<ParticleState> SurfaceSourceComponent::initializeParticleState(
+                                    const unsigned long long history,
+                                    const unsigned long long history_state_id )
+{
+  // Make sure that the history state id is valid
+  testPrecondition( history_state_id <
+                    this->getNumberOfParticleStateSamples( history ) );
+
+  const SurfaceSourceFile::Record& record =
+    d_records[this->getRecordIndex( history, history_state_id )];
+
+  std::shared_ptr<ParticleState> particle =
+    SurfaceSourceFile::createParticleState( record, history );
+
+  if( d_sampling_mode == RESAMPLE_SAMPLING_MODE )
+    particle->setWeight( d_sampled_weight );
+  else
+    particle->multiplyWeight( d_sampled_weight );
+
+  return particle;
+}
+
+// Sample a particle state from the source
+/*! \details The recorded state is set when the particle state is
+ * initialized. A particle state that is rejected will not be resampled.
+ */
+bool SurfaceSourceComponent::sampleParticleStateImpl(
+                                const std::shared_ptr<ParticleState>& particle,
+                                const unsigned long long history_state_id )
+{
+  return false;
+}
+
+// Return the index of the record that will be used for a history state
+size_t SurfaceSourceComponent::getRecordIndex(
+                             const unsigned long long history,
+                             const unsigned long long history_state_id ) const
+{
+  if( d_sampling_mode == RESAMPLE_SAMPLING_MODE )
+  {
+    const double random_weight =
+      Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      d_cumulative_weights.back();
+
+    const size_t index =
+      std::upper_bound( d_cumulative_weights.begin(),
+                        d_cumulative_weights.end(),
+                        random_weight ) - d_cumulative_weights.begin();
+
+    return std::min( index, d_records.size() - 1 );
+  }
+  else
+  {
+    return d_recorded_history_offsets[history % d_number_of_recorded_histories]
+      + history_state_id;
+  }
+}
+
+// Load the records
+void SurfaceSourceComponent::loadRecords()
+{
+  d_records.clear();
+  d_recorded_history_offsets.clear();
+  d_cumulative_weights.clear();
+  d_particle_types.clear();
+  d_number_of_recorded_histories = 0;
+  d_total_recorded_weight = 0.0;
+
+  for( auto&& file_name : d_file_names )
+  {
+    uint64_t number_of_histories;
+
+    SurfaceSourceFile::readRecords( file_name,
+                                    d_records,
+                                    number_of_histories );
+
+    d_number_of_recorded_histories += number_of_histories;
+  }
+
+  TEST_FOR_EXCEPTION( d_records.empty() ||
+                      d_number_of_recorded_histories == 0,
+                      std::runtime_error,
+                      "The surface source files do not contain any "
+                      "records!" );
+
+  // Group the records by history (the order of the records within a history
+  // is preserved)
+  std::stable_sort( d_records.begin(),
+                    d_records.end(),
+                    []( const SurfaceSourceFile::Record& a,
+                        const SurfaceSourceFile::Record& b ){
+                      return a.history_number < b.history_number; } );
+
+  d_cumulative_weights.resize( d_records.size() );
+
+  for( size_t i = 0; i < d_records.size(); ++i )
+  {
+    if( i == 0 ||
+        d_records[i].history_number != d_records[i-1].history_number )
+      d_recorded_history_offsets.push_back( i );
+
+    d_particle_types.insert(
+                     static_cast<ParticleType>( d_records[i].particle_type ) );
+
+    d_total_recorded_weight += d_records[i].weight;
+    d_cumulative_weights[i] = d_total_recorded_weight;
+  }
+
+  d_recorded_history_offsets.push_back( d_records.size() );
+
+  TEST_FOR_EXCEPTION( d_recorded_history_offsets.size() - 1 >
+                      d_number_of_recorded_histories,
+                      std::runtime_error,
+                      "The surface source files contain more recorded "
+                      "histories than source histories!" );
+
+  TEST_FOR_EXCEPTION( d_total_recorded_weight <= 0.0,
+                      std::runtime_error,
+                      "The total recorded weight must be greater than 0.0!" );
+
+  // The cumulative weights are only needed by the resample mode
+  if( d_sampling_mode == REPLAY_SAMPLING_MODE )
+  {
+    d_cumulative_weights.clear();
+
+    if( d_normalize_weights )
+    {
+      d_sampled_weight =
+        d_number_of_recorded_histories/d_total_recorded_weight;
+    }
+    else
+      d_sampled_weight = 1.0;
+  }
+  else
+  {
+    if( d_normalize_weights )
+      d_sampled_weight = 1.0;
+    else
+    {
+      d_sampled_weight =
+        d_total_recorded_weight/d_number_of_recorded_histories;
+    }
+  }
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::SurfaceSourceComponent );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::SurfaceSourceComponent );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceComponent.cpp
+//---------------------------------------------------------------------------//
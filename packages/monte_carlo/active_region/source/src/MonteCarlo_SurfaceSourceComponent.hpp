@@ -0,0 +1,251 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceComponent.hpp
+//! \author Alex Robinson
+//! \brief  The surface source component class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_COMPONENT_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_COMPONENT_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <string>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSourceComponent.hpp"
+#include "MonteCarlo_SurfaceSourceFile.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source component class
+ * \details This source component replays the particle states that were
+ * recorded in one or more surface source files (see
+ * MonteCarlo::SurfaceSourceRecorder) so that a simulation can be restarted
+ * from the recorded surfaces. The records are grouped by the history that
+ * generated them. Let N be the number of source histories that were used to
+ * generate the records. In the replay sampling mode, every N consecutive
+ * histories will replay every recorded history exactly once (histories that
+ * did not generate any records will not produce any particles). In the
+ * resample sampling mode, a single record will be sampled for each history
+ * with a probability proportional to its weight and the weight of the
+ * particle will be set to W/N, where W is the total recorded weight. Both
+ * modes preserve the expected weight per source history of the original
+ * simulation. When the weights are normalized, the weights will be scaled so
+ * that the expected weight per source history is one.
+ */
+class SurfaceSourceComponent : public ParticleSourceComponent
+{
+
+public:
+
+  //! The id type
+  typedef ParticleSourceComponent::Id Id;
+
+  //! The trial counter type
+  typedef ParticleSourceComponent::Counter Counter;
+
+  //! The cell id set
+  typedef ParticleSourceComponent::CellIdSet CellIdSet;
+
+  //! The sampling mode
+  enum SamplingMode
+  {
+    REPLAY_SAMPLING_MODE = 0,
+    RESAMPLE_SAMPLING_MODE
+  };
+
+  //! Constructor
+  SurfaceSourceComponent(
+              const Id id,
+              const double selection_weight,
+              const std::shared_ptr<const Geometry::Model>& model,
+              const std::vector<boost::filesystem::path>& file_names,
+              const SamplingMode sampling_mode = REPLAY_SAMPLING_MODE,
+              const bool normalize_weights = false );
+
+  //! Constructor (with rejection cells)
+  SurfaceSourceComponent(
+              const Id id,
+              const double selection_weight,
+              const CellIdSet& rejection_cells,
+              const std::shared_ptr<const Geometry::Model>& model,
+              const std::vector<boost::filesystem::path>& file_names,
+              const SamplingMode sampling_mode = REPLAY_SAMPLING_MODE,
+              const bool normalize_weights = false );
+
+  //! Destructor
+  ~SurfaceSourceComponent()
+  { /* ... */ }
+
+  //! Return the surface source file names
+  const std::vector<boost::filesystem::path>& getFileNames() const;
+
+  //! Return the sampling mode
+  SamplingMode getSamplingMode() const;
+
+  //! Check if the weights are normalized
+  bool areWeightsNormalized() const;
+
+  //! Return the number of records
+  size_t getNumberOfRecords() const;
+
+  //! Return the number of source histories used to generate the records
+  uint64_t getNumberOfRecordedHistories() const;
+
+  //! Return the total recorded weight
+  double getTotalRecordedWeight() const;
+
+  //! Return the number of sampling trials in the phase space dimension
+  Counter getNumberOfDimensionTrials(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Return the number of samples in the phase space dimension
+  Counter getNumberOfDimensionSamples(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Return the sampling efficiency in the phase space dimension
+  double getDimensionSamplingEfficiency(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Print a summary of the sampling statistics
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Default constructor
+  SurfaceSourceComponent();
+
+  //! Enable thread support
+  void enableThreadSupportImpl( const size_t threads ) final override;
+
+  //! Reset the sampling statistics
+  void resetDataImpl() final override;
+
+  //! Reduce the sampling statistics on the root process
+  void reduceDataImpl( const Utility::Communicator& comm,
+                       const int root_process ) final override;
+
+  /*! \brief Return the number of particle states that will be sampled for the
+   * given history number
+   */
+  unsigned long long getNumberOfParticleStateSamples(
+                       const unsigned long long history ) const final override;
+
+  //! Initialize a particle state
+  std::shared_ptr<ParticleState> initializeParticleState(
+                    const unsigned long long history,
+                    const unsigned long long history_state_id ) final override;
+
+  //! Sample a particle state from the source
+  bool sampleParticleStateImpl(
+                    const std::shared_ptr<ParticleState>& particle,
+                    const unsigned long long history_state_id ) final override;
+
+private:
+
+  // Load the records
+  void loadRecords();
+
+  // Return the index of the record that will be used for a history state
+  size_t getRecordIndex( const unsigned long long history,
+                         const unsigned long long history_state_id ) const;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The surface source file names
+  std::vector<boost::filesystem::path> d_file_names;
+
+  // The sampling mode
+  SamplingMode d_sampling_mode;
+
+  // Records if the weights are normalized
+  bool d_normalize_weights;
+
+  // The records (sorted by history number)
+  std::vector<SurfaceSourceFile::Record> d_records;
+
+  // The first record of each recorded history (plus the end record)
+  std::vector<size_t> d_recorded_history_offsets;
+
+  // The cumulative record weights (only used by the resample mode)
+  std::vector<double> d_cumulative_weights;
+
+  // The particle types that have been recorded
+  std::set<ParticleType> d_particle_types;
+
+  // The number of source histories used to generate the records
+  uint64_t d_number_of_recorded_histories;
+
+  // The total recorded weight
+  double d_total_recorded_weight;
+
+  // The weight that is assigned to every sampled record (resample mode) or
+  // the factor that every record weight is multiplied by (replay mode)
+  double d_sampled_weight;
+};
+
+// Save the data to an archive
+template<typename Archive>
+void SurfaceSourceComponent::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceComponent );
+
+  // Save the local data
+  std::vector<std::string> file_names;
+
+  for( auto&& file_name : d_file_names )
+    file_names.push_back( file_name.string() );
+
+  ar & BOOST_SERIALIZATION_NVP( file_names );
+  ar & BOOST_SERIALIZATION_NVP( d_sampling_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_normalize_weights );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void SurfaceSourceComponent::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceComponent );
+
+  // Load the local data
+  std::vector<std::string> file_names;
+
+  ar & BOOST_SERIALIZATION_NVP( file_names );
+  ar & BOOST_SERIALIZATION_NVP( d_sampling_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_normalize_weights );
+
+  d_file_names.assign( file_names.begin(), file_names.end() );
+
+  // The records are not archived - they will be reloaded from the files
+  this->loadRecords();
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( SurfaceSourceComponent, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( SurfaceSourceComponent, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, SurfaceSourceComponent );
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_COMPONENT_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceComponent.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,308 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSurfaceSourceComponent.cpp
+//! \author Alex Robinson
+//! \brief  The surface source component unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <fstream>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceComponent.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::Model> model;
+
+std::vector<boost::filesystem::path> file_names;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Write a surface source file
+void writeSurfaceSourceFile( const boost::filesystem::path& file_name,
+                             const uint64_t number_of_histories,
+                             const std::vector<std::shared_ptr<MonteCarlo::ParticleState> >& particles )
+{
+  MonteCarlo::SurfaceSourceFile::Header header =
+    MonteCarlo::SurfaceSourceFile::createHeader( number_of_histories );
+
+  std::ofstream file( file_name.string().c_str(), std::ofstream::binary );
+
+  file.write( reinterpret_cast<const char*>( &header ), sizeof(header) );
+
+  for( auto&& particle : particles )
+  {
+    MonteCarlo::SurfaceSourceFile::Record record;
+
+    MonteCarlo::SurfaceSourceFile::createRecord( *particle, 1, record );
+
+    file.write( reinterpret_cast<const char*>( &record ), sizeof(record) );
+  }
+}
+
+// Create a particle
+std::shared_ptr<MonteCarlo::ParticleState> createParticle(
+                                      const MonteCarlo::ParticleType type,
+                                      const uint64_t history,
+                                      const double energy,
+                                      const double weight )
+{
+  std::shared_ptr<MonteCarlo::ParticleState> particle;
+
+  if( type == MonteCarlo::PHOTON )
+    particle.reset( new MonteCarlo::PhotonState( history ) );
+  else
+    particle.reset( new MonteCarlo::NeutronState( history ) );
+
+  particle->setPosition( 1.0, 0.0, 0.0 );
+  particle->setDirection( 1.0, 0.0, 0.0 );
+  particle->setEnergy( energy );
+  particle->setWeight( weight );
+
+  return particle;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the recorded data can be returned
+FRENSIE_UNIT_TEST( SurfaceSourceComponent, constructor )
+{
+  MonteCarlo::SurfaceSourceComponent source_component( 0, 1.0, model, file_names );
+
+  FRENSIE_CHECK_EQUAL( source_component.getId(), 0 );
+  FRENSIE_CHECK_EQUAL( source_component.getSelectionWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( source_component.getFileNames().size(), 2 );
+  FRENSIE_CHECK_EQUAL( source_component.getSamplingMode(),
+                       MonteCarlo::SurfaceSourceComponent::REPLAY_SAMPLING_MODE );
+  FRENSIE_CHECK( !source_component.areWeightsNormalized() );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfRecords(), 4 );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfRecordedHistories(), 5 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( source_component.getTotalRecordedWeight(),
+                                   2.0,
+                                   1e-15 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SurfaceSourceComponent( 0, 1.0, model, std::vector<boost::filesystem::path>() ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the recorded histories can be replayed
+FRENSIE_UNIT_TEST( SurfaceSourceComponent, sampleParticleState_replay )
+{
+  MonteCarlo::SurfaceSourceComponent source_component( 0, 1.0, model, file_names );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Recorded history 0 (two photons)
+  source_component.sampleParticleState( bank, 0 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 0.5 );
+  FRENSIE_CHECK_EQUAL( bank.top().getSourceId(), 0 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 2.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 0.25 );
+
+  bank.pop();
+
+  // Recorded history 2 (one photon)
+  source_component.sampleParticleState( bank, 1 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 3.0 );
+
+  bank.pop();
+
+  // Recorded history 7 (one neutron)
+  source_component.sampleParticleState( bank, 2 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 4.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 1.0 );
+
+  bank.pop();
+
+  // Histories that did not generate any records
+  source_component.sampleParticleState( bank, 3 );
+  source_component.sampleParticleState( bank, 4 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  // The recorded histories are replayed every 5 histories
+  source_component.sampleParticleState( bank, 5 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 5 );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfSamples(), 6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the replayed weights can be normalized
+FRENSIE_UNIT_TEST( SurfaceSourceComponent, sampleParticleState_replay_normalized )
+{
+  MonteCarlo::SurfaceSourceComponent source_component(
+                 0, 1.0, model, file_names,
+                 MonteCarlo::SurfaceSourceComponent::REPLAY_SAMPLING_MODE,
+                 true );
+
+  MonteCarlo::ParticleBank bank;
+
+  source_component.sampleParticleState( bank, 2 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getWeight(), 2.5, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the recorded states can be resampled
+FRENSIE_UNIT_TEST( SurfaceSourceComponent, sampleParticleState_resample )
+{
+  MonteCarlo::SurfaceSourceComponent source_component(
+                 0, 1.0, model, file_names,
+                 MonteCarlo::SurfaceSourceComponent::RESAMPLE_SAMPLING_MODE );
+
+  // The cumulative weights are 0.5, 0.75, 1.0, 2.0
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.3;
+  fake_stream[2] = 0.45;
+  fake_stream[3] = 0.9;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  const double expected_energies[4] = {1.0, 2.0, 3.0, 4.0};
+
+  MonteCarlo::ParticleBank bank;
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    source_component.sampleParticleState( bank, i );
+
+    FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+    FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), i );
+    FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), expected_energies[i] );
+    FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getWeight(), 0.4, 1e-15 );
+
+    bank.pop();
+  }
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that a surface source component can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceSourceComponent,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_surface_source_component" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<const MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::SurfaceSourceComponent(
+                 3, 2.0, model, file_names,
+                 MonteCarlo::SurfaceSourceComponent::RESAMPLE_SAMPLING_MODE,
+                 true ) );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( source_component ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distributions
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<const MonteCarlo::ParticleSourceComponent> source_component;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( source_component ) );
+
+  iarchive.reset();
+
+  const MonteCarlo::SurfaceSourceComponent& surface_source_component =
+    dynamic_cast<const MonteCarlo::SurfaceSourceComponent&>( *source_component );
+
+  FRENSIE_CHECK_EQUAL( surface_source_component.getId(), 3 );
+  FRENSIE_CHECK_EQUAL( surface_source_component.getSelectionWeight(), 2.0 );
+  FRENSIE_CHECK_EQUAL( surface_source_component.getSamplingMode(),
+                       MonteCarlo::SurfaceSourceComponent::RESAMPLE_SAMPLING_MODE );
+  FRENSIE_CHECK( surface_source_component.areWeightsNormalized() );
+  FRENSIE_CHECK_EQUAL( surface_source_component.getNumberOfRecords(), 4 );
+  FRENSIE_CHECK_EQUAL( surface_source_component.getNumberOfRecordedHistories(), 5 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create the model
+  model.reset( new Geometry::InfiniteMediumModel( 1 ) );
+
+  // Create the surface source files (e.g. one from each process). The
+  // records from history 0 are intentionally out of order in the files.
+  file_names.push_back( "test_surface_source_component_0.ssrc" );
+  file_names.push_back( "test_surface_source_component_1.ssrc" );
+
+  writeSurfaceSourceFile( file_names[0], 3,
+                          {createParticle( MonteCarlo::PHOTON, 2, 3.0, 0.25 ),
+                           createParticle( MonteCarlo::PHOTON, 0, 1.0, 0.5 )} );
+
+  writeSurfaceSourceFile( file_names[1], 2,
+                          {createParticle( MonteCarlo::PHOTON, 0, 2.0, 0.25 ),
+                           createParticle( MonteCarlo::NEUTRON, 7, 4.0, 1.0 )} );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSurfaceSourceComponent.cpp
+//---------------------------------------------------------------------------//
@@ -97,10 +97,6 @@ private:
   static typename BaseType::MicroscopicCrossSectionEvaluationFunctor
   s_total_forward_cs_evaluation_functor;
 
-  // The getMacroscopicTotalLineEnergyCrossSection function wrapper
-  typename BaseType::MacroscopicCrossSectionEvaluationFunctor
-  d_macroscopic_total_line_energy_cs_evaluation_functor;
-
   // The critical line energies
   std::vector<double> d_critical_line_energies;
 };
@@ -42,10 +42,6 @@ AdjointMaterial<ScatteringCenter>::AdjointMaterial(
               scattering_center_name_map,
               scattering_center_fractions,
               scattering_center_names ),
-    d_macroscopic_total_line_energy_cs_evaluation_functor(
-       std::bind<double>( &ThisType::getMacroscopicTotalLineEnergyCrossSection,
-                          std::cref(*this),
-                          std::placeholders::_1 ) ),
     d_critical_line_energies()
 {
   // Get the critical line energies used by all scattering centers
@@ -188,7 +184,6 @@ size_t AdjointMaterial<ScatteringCenter>::sampleCollisionAtomAtLineEnergy( const
 {
   return this->sampleCollisionScatteringCenterImpl(
                  energy,
-                 d_macroscopic_total_line_energy_cs_evaluation_functor,
                  s_total_line_energy_cs_evaluation_functor );
 }
 
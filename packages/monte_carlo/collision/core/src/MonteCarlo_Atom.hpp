@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <string>
+#include <vector>
 
 // FRENSIE Includes
 #include "Utility_HashBasedGridSearcher.hpp"
@@ -29,6 +30,9 @@ namespace MonteCarlo{
 template<typename AtomCore>
 class Atom
 {
+  // Typedef for this type
+  typedef Atom<AtomCore> ThisType;
+
   // Typedef for QuantityTraits
   typedef Utility::QuantityTraits<double> QT;
 
@@ -49,6 +53,9 @@ public:
   //! Typedef for the const reaction map
   typedef typename AtomCore::ConstReactionMap ConstReactionMap;
 
+  //! Typedef for the const reaction array
+  typedef typename AtomCore::ConstReactionArray ConstReactionArray;
+
   //! Destructor
   virtual ~Atom()
   { /* ... */ }
@@ -181,17 +188,19 @@ private:
   double getAtomicAbsorptionCrossSection( const double energy,
                                           const unsigned energy_grid_bin ) const;
 
-  // Sample an absorption reaction
-  void sampleAbsorptionReaction( const double scaled_random_number,
-                                 const unsigned energy_grid_bin,
-                                 ParticleStateType& particle,
-                                 ParticleBank& bank ) const;
-
-  // Sample a scattering reaction
-  void sampleScatteringReaction( const double scaled_random_number,
-                                 const unsigned energy_grid_bin,
-                                 ParticleStateType& particle,
-                                 ParticleBank& bank ) const;
+  // Evaluate the partial cross sections of the reactions
+  static double evaluatePartialCrossSections(
+                                const ConstReactionArray& reactions,
+                                const double energy,
+                                const unsigned energy_grid_bin,
+                                std::vector<double>& partial_cross_sections );
+
+  // Sample a reaction using the partial cross sections of the reactions
+  void sampleReaction( const double scaled_random_number,
+                       const ConstReactionArray& reactions,
+                       const std::vector<double>& partial_cross_sections,
+                       ParticleStateType& particle,
+                       ParticleBank& bank ) const;
 
   // The atom name
   std::string d_name;
@@ -66,6 +66,9 @@ public:
   //! Typedef for the const reaction map
   typedef MapType<ReactionEnumType,std::shared_ptr<const ReactionType> > ConstReactionMap;
 
+  //! Typedef for the const reaction array
+  typedef std::vector<std::shared_ptr<const ReactionType> > ConstReactionArray;
+
   //! Destructor
   virtual ~AtomCore()
   { /* ... */ }
@@ -82,12 +85,18 @@ public:
   //! Return the scattering reactions
   const ConstReactionMap& getScatteringReactions() const;
 
+  //! Return the scattering reactions (map iteration order)
+  const ConstReactionArray& getScatteringReactionArray() const;
+
   //! Return the scattering reaction types
   void getScatteringReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
   //! Return the absorption reactions
   const ConstReactionMap& getAbsorptionReactions() const;
 
+  //! Return the absorption reactions (map iteration order)
+  const ConstReactionArray& getAbsorptionReactionArray() const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -179,6 +188,13 @@ protected:
   
 private:
 
+  // Initialize the reaction arrays
+  void initializeReactionArrays();
+
+  // Fill a reaction array
+  static void fillReactionArray( const ConstReactionMap& reactions,
+                                 ConstReactionArray& reaction_array );
+
   // The reaction types that will be treated as absorption
   static ReactionEnumTypeSet s_absorption_reaction_types;
 
@@ -197,6 +213,12 @@ private:
   // The miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
 
+  // The scattering reactions stored contiguously (map iteration order)
+  ConstReactionArray d_scattering_reaction_array;
+
+  // The absorption reactions stored contiguously (map iteration order)
+  ConstReactionArray d_absorption_reaction_array;
+
   // The atomic relaxation model
   std::shared_ptr<const AtomicRelaxationModel> d_relaxation_model;
 
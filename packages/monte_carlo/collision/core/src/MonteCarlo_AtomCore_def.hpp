@@ -53,6 +53,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_scattering_reactions(),
     d_absorption_reactions(),
     d_miscellaneous_reactions(),
+    d_scattering_reaction_array(),
+    d_absorption_reaction_array(),
     d_relaxation_model( relaxation_model ),
     d_grid_searcher( grid_searcher )
 {
@@ -90,6 +92,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     ++rxn_type_pointer;
   }
 
+  this->initializeReactionArrays();
+
   // Make sure the reactions have been organized appropriately
   testPostcondition( d_scattering_reactions.size() > 0 );
   testPostcondition( d_scattering_reactions.size() +
@@ -121,9 +125,11 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
           grid_searcher )
   : d_total_reaction( total_reaction ),
     d_total_absorption_reaction( total_absorption_reaction ),
-    d_scattering_reactions( d_scattering_reactions ),
+    d_scattering_reactions( scattering_reactions ),
     d_absorption_reactions( absorption_reactions ),
     d_miscellaneous_reactions( miscellaneous_reactions ),
+    d_scattering_reaction_array(),
+    d_absorption_reaction_array(),
     d_relaxation_model( relaxation_model ),
     d_grid_searcher( grid_searcher )
 {
@@ -139,6 +145,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
   testPrecondition( relaxation_model.get() );
   // Make sure the grid searcher is valid
   testPrecondition( d_grid_searcher.get() );
+
+  this->initializeReactionArrays();
 }
 
 // Copy constructor
@@ -153,6 +161,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_scattering_reactions( instance.d_scattering_reactions ),
     d_absorption_reactions( instance.d_absorption_reactions ),
     d_miscellaneous_reactions( instance.d_miscellaneous_reactions ),
+    d_scattering_reaction_array(),
+    d_absorption_reaction_array(),
     d_relaxation_model( instance.d_relaxation_model ),
     d_grid_searcher( instance.d_grid_searcher )
 {
@@ -167,6 +177,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
   testPrecondition( instance.d_relaxation_model.get() );
   // Make sure the grid searcher is valid
   testPrecondition( instance.d_grid_searcher.get() );
+
+  this->initializeReactionArrays();
 }
 
 // Assignment operator
@@ -200,6 +212,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::op
     d_miscellaneous_reactions = instance.d_miscellaneous_reactions;
     d_relaxation_model = instance.d_relaxation_model;
     d_grid_searcher = instance.d_grid_searcher;
+
+    this->initializeReactionArrays();
   }
 
   return *this;
@@ -590,6 +604,17 @@ inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,
   return d_scattering_reactions;
 }
 
+// Return the scattering reactions (map iteration order)
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getScatteringReactionArray() const -> const ConstReactionArray&
+{
+  return d_scattering_reaction_array;
+}
+
 // Return the scattering reaction types
 template<typename _ReactionEnumType,
          typename _ReactionType,
@@ -620,6 +645,17 @@ inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,
   return d_absorption_reactions;
 }
 
+// Return the absorption reactions (map iteration order)
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getAbsorptionReactionArray() const -> const ConstReactionArray&
+{
+  return d_absorption_reaction_array;
+}
+
 // Return the absorption reaction types
 template<typename _ReactionEnumType,
          typename _ReactionType,
@@ -757,7 +793,48 @@ bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 
   return true;
 }
-  
+
+// Initialize the reaction arrays
+/*! \details The reaction arrays store the scattering and absorption reactions
+ * in the iteration order of the reaction maps so that the reactions can be
+ * traversed (e.g. during a collision) without walking the map nodes.
+ */
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::initializeReactionArrays()
+{
+  ThisType::fillReactionArray( d_scattering_reactions,
+                               d_scattering_reaction_array );
+  ThisType::fillReactionArray( d_absorption_reactions,
+                               d_absorption_reaction_array );
+}
+
+// Fill a reaction array
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::fillReactionArray(
+                                         const ConstReactionMap& reactions,
+                                         ConstReactionArray& reaction_array )
+{
+  reaction_array.clear();
+  reaction_array.reserve( reactions.size() );
+
+  typename ConstReactionMap::const_iterator reaction_it = reactions.begin();
+
+  while( reaction_it != reactions.end() )
+  {
+    reaction_array.push_back( reaction_it->second );
+
+    ++reaction_it;
+  }
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_ATOM_CORE_DEF_HPP
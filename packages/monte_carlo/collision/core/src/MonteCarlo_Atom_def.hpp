@@ -248,18 +248,12 @@ inline double Atom<AtomCore>::getAtomicAbsorptionCrossSection(
                                           const double energy,
                                           const unsigned energy_grid_bin ) const
 {
-  double cross_section = 0.0;
-
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getAbsorptionReactions().begin();
+  const ConstReactionArray& reactions = d_core.getAbsorptionReactionArray();
 
-  while( atomic_reaction != d_core.getAbsorptionReactions().end() )
-  {
-    cross_section +=
-      atomic_reaction->second->getCrossSection( energy, energy_grid_bin );
+  double cross_section = 0.0;
 
-    ++atomic_reaction;
-  }
+  for( size_t i = 0; i < reactions.size(); ++i )
+    cross_section += reactions[i]->getCrossSection( energy, energy_grid_bin );
 
   return cross_section;
 }
@@ -292,18 +286,12 @@ inline double Atom<AtomCore>::getAtomicScatteringCrossSection(
                                       const double energy,
                                       const unsigned energy_grid_bin ) const
 {
-  double cross_section = 0.0;
+  const ConstReactionArray& reactions = d_core.getScatteringReactionArray();
 
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getScatteringReactions().begin();
-
-  while( atomic_reaction != d_core.getScatteringReactions().end() )
-  {
-    cross_section +=
-      atomic_reaction->second->getCrossSection( energy, energy_grid_bin );
+  double cross_section = 0.0;
 
-    ++atomic_reaction;
-  }
+  for( size_t i = 0; i < reactions.size(); ++i )
+    cross_section += reactions[i]->getCrossSection( energy, energy_grid_bin );
 
   return cross_section;
 }
@@ -441,6 +429,10 @@ void Atom<AtomCore>::getReactionTypes( ReactionEnumTypeSet& reaction_types ) con
 }
 
 // Collide with a particle
+/*! \details The cross section of each reaction is only evaluated once. The
+ * partial cross sections are stored in (thread local) scratch buffers that
+ * are reused by every collision.
+ */
 template<typename AtomCore>
 void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
                                       ParticleBank& bank ) const
@@ -448,17 +440,26 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   // Make sure the particle energy is valid
   testPrecondition( d_core.getGridSearcher().isValueWithinGridBounds( particle.getEnergy() ) )
 
+  static thread_local std::vector<double> partial_scattering_cross_sections;
+  static thread_local std::vector<double> partial_absorption_cross_sections;
+
   unsigned energy_grid_bin =
     d_core.getGridSearcher().findLowerBinIndex( particle.getEnergy() );
 
   double scattering_cross_section =
-    this->getAtomicScatteringCrossSection( particle.getEnergy(),
-                                            energy_grid_bin );
+    ThisType::evaluatePartialCrossSections(
+                                          d_core.getScatteringReactionArray(),
+                                          particle.getEnergy(),
+                                          energy_grid_bin,
+                                          partial_scattering_cross_sections );
 
   double absorption_cross_section =
-    this->getAtomicAbsorptionCrossSection( particle.getEnergy(),
-                                            energy_grid_bin );
-  
+    ThisType::evaluatePartialCrossSections(
+                                          d_core.getAbsorptionReactionArray(),
+                                          particle.getEnergy(),
+                                          energy_grid_bin,
+                                          partial_absorption_cross_sections );
+
   double scaled_random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
     (scattering_cross_section+absorption_cross_section);
@@ -466,25 +467,29 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
   {
-    this->sampleAbsorptionReaction( scaled_random_number,
-                                    energy_grid_bin,
-                                    particle,
-                                    bank );
+    this->sampleReaction( scaled_random_number,
+                          d_core.getAbsorptionReactionArray(),
+                          partial_absorption_cross_sections,
+                          particle,
+                          bank );
 
     // Set the particle as gone regardless of the reaction that occurred
     particle.setAsGone();
   }
   else
   {
-    this->sampleScatteringReaction(
-                              scaled_random_number - absorption_cross_section,
-                              energy_grid_bin,
-                              particle,
-                              bank );
+    this->sampleReaction( scaled_random_number - absorption_cross_section,
+                          d_core.getScatteringReactionArray(),
+                          partial_scattering_cross_sections,
+                          particle,
+                          bank );
   }
 }
 
 // Collide with a particle and survival bias
+/*! \details The cross section of each reaction is only evaluated once (see
+ * collideAnalogue).
+ */
 template<typename AtomCore>
 void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
                                           ParticleBank& bank ) const
@@ -492,18 +497,27 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
   // Make sure the particle energy is valid
   testPrecondition( d_core.getGridSearcher().isValueWithinGridBounds( particle.getEnergy() ) )
 
+  static thread_local std::vector<double> partial_scattering_cross_sections;
+  static thread_local std::vector<double> partial_absorption_cross_sections;
+
   unsigned energy_grid_bin =
     d_core.getGridSearcher().findLowerBinIndex( particle.getEnergy() );
 
   double scattering_cross_section =
-    this->getAtomicScatteringCrossSection( particle.getEnergy(),
-                                           energy_grid_bin );
+    ThisType::evaluatePartialCrossSections(
+                                          d_core.getScatteringReactionArray(),
+                                          particle.getEnergy(),
+                                          energy_grid_bin,
+                                          partial_scattering_cross_sections );
 
-  if( d_core.getAbsorptionReactions().size() > 0 )
+  if( d_core.getAbsorptionReactionArray().size() > 0 )
   {
     double absorption_cross_section =
-      this->getAtomicAbsorptionCrossSection( particle.getEnergy(),
-                                             energy_grid_bin );
+      ThisType::evaluatePartialCrossSections(
+                                          d_core.getAbsorptionReactionArray(),
+                                          particle.getEnergy(),
+                                          energy_grid_bin,
+                                          partial_absorption_cross_sections );
 
     double survival_prob = scattering_cross_section/
       (scattering_cross_section+absorption_cross_section);
@@ -516,28 +530,31 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
 
       particle.multiplyWeight( survival_prob );
 
-      this->sampleScatteringReaction(
+      this->sampleReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             scattering_cross_section,
-            energy_grid_bin,
+            d_core.getScatteringReactionArray(),
+            partial_scattering_cross_sections,
             particle,
             bank );
 
       particle_copy.multiplyWeight( 1.0 - survival_prob );
 
-      this->sampleAbsorptionReaction(
+      this->sampleReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             absorption_cross_section,
-            energy_grid_bin,
+            d_core.getAbsorptionReactionArray(),
+            partial_absorption_cross_sections,
             particle_copy,
             bank );
     }
     else
     {
-      this->sampleAbsorptionReaction(
+      this->sampleReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             absorption_cross_section,
-            energy_grid_bin,
+            d_core.getAbsorptionReactionArray(),
+            partial_absorption_cross_sections,
             particle,
             bank );
 
@@ -546,83 +563,73 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
   }
   else
   {
-    this->sampleScatteringReaction(
+    this->sampleReaction(
           Utility::RandomNumberGenerator::getRandomNumber<double>()*
           scattering_cross_section,
-          energy_grid_bin,
+          d_core.getScatteringReactionArray(),
+          partial_scattering_cross_sections,
           particle,
           bank );
   }
 }
 
-// Sample an absorption reaction
+// Evaluate the partial cross sections of the reactions
+/*! \details The partial cross section of a reaction is the sum of its cross
+ * section and the cross sections of all of the reactions that preceed it in
+ * the array. The total cross section (last partial cross section) will be
+ * returned.
+ */
 template<typename AtomCore>
-void Atom<AtomCore>::sampleAbsorptionReaction( const double scaled_random_number,
-                                     unsigned energy_grid_bin,
-                                     ParticleStateType& particle,
-                                     ParticleBank& bank ) const
+inline double Atom<AtomCore>::evaluatePartialCrossSections(
+                                 const ConstReactionArray& reactions,
+                                 const double energy,
+                                 const unsigned energy_grid_bin,
+                                 std::vector<double>& partial_cross_sections )
 {
-  double partial_cross_section = 0.0;
+  partial_cross_sections.resize( reactions.size() );
 
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getAbsorptionReactions().begin();
+  double partial_cross_section = 0.0;
 
-  while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+  for( size_t i = 0; i < reactions.size(); ++i )
   {
     partial_cross_section +=
-      atomic_reaction->second->getCrossSection( particle.getEnergy(),
-                                                energy_grid_bin );
-
-    if( scaled_random_number < partial_cross_section )
-      break;
+      reactions[i]->getCrossSection( energy, energy_grid_bin );
 
-    ++atomic_reaction;
+    partial_cross_sections[i] = partial_cross_section;
   }
 
-  // Make sure a reaction was selected
-  testPostcondition( atomic_reaction != d_core.getAbsorptionReactions().end() );
-
-  // Undergo reaction selected
-  Data::SubshellType subshell_vacancy;
-
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
-
-  // Relax the atom
-  this->relaxAtom( subshell_vacancy, particle, bank );
+  return partial_cross_section;
 }
 
-// Sample a scattering reaction
+// Sample a reaction using the partial cross sections of the reactions
 template<typename AtomCore>
-void Atom<AtomCore>::sampleScatteringReaction(
-                                             const double scaled_random_number,
-                                             unsigned energy_grid_bin,
-                                             ParticleStateType& particle,
-                                             ParticleBank& bank ) const
+void Atom<AtomCore>::sampleReaction(
+                             const double scaled_random_number,
+                             const ConstReactionArray& reactions,
+                             const std::vector<double>& partial_cross_sections,
+                             ParticleStateType& particle,
+                             ParticleBank& bank ) const
 {
-  double partial_cross_section = 0.0;
+  // Make sure the partial cross sections are valid
+  testPrecondition( partial_cross_sections.size() == reactions.size() );
 
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getScatteringReactions().begin();
+  size_t reaction_index = 0;
 
-  while( atomic_reaction != d_core.getScatteringReactions().end() )
+  while( reaction_index < partial_cross_sections.size() )
   {
-    partial_cross_section +=
-      atomic_reaction->second->getCrossSection( particle.getEnergy(),
-                                                energy_grid_bin );
-
-    if( scaled_random_number < partial_cross_section )
+    if( scaled_random_number < partial_cross_sections[reaction_index] )
       break;
 
-    ++atomic_reaction;
+    ++reaction_index;
   }
 
-  // Make sure the reaction was found
-  testPostcondition( atomic_reaction != d_core.getScatteringReactions().end() );
+  // Make sure a reaction was selected
+  testPostcondition( reaction_index < reactions.size() );
 
   // Undergo reaction selected
   Data::SubshellType subshell_vacancy;
 
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
+  reactions[reaction_index]->react( particle, bank, subshell_vacancy );
 
   // Relax the atom
   this->relaxAtom( subshell_vacancy, particle, bank );
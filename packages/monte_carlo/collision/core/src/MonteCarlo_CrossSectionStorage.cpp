@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CrossSectionStorage.cpp
+//! \author Alex Robinson
+//! \brief  The cross section storage class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_CrossSectionStorage.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+//! Convert the cross section to the storage precision
+template<typename T>
+inline std::shared_ptr<const std::vector<T> > convertCrossSection(
+             const std::shared_ptr<const std::vector<double> >& cross_section )
+{
+  std::shared_ptr<std::vector<T> >
+    stored_cross_section( new std::vector<T>( cross_section->size() ) );
+
+  for( size_t i = 0; i < cross_section->size(); ++i )
+  {
+    T& stored_value = (*stored_cross_section)[i];
+
+    stored_value = static_cast<T>( (*cross_section)[i] );
+
+    // Values that are not representable must not become zero - a zero value
+    // is treated as a special case by the log interpolation policies
+    if( stored_value == T(0) && (*cross_section)[i] != 0.0 )
+    {
+      stored_value = std::copysign( std::numeric_limits<T>::denorm_min(),
+                                    (*cross_section)[i] );
+    }
+  }
+
+  return stored_cross_section;
+}
+
+//! Convert the cross section to the storage precision (no conversion needed)
+template<>
+inline std::shared_ptr<const std::vector<double> > convertCrossSection<double>(
+             const std::shared_ptr<const std::vector<double> >& cross_section )
+{
+  return cross_section;
+}
+
+} // end Details namespace
+
+namespace{
+
+//! The stored cross section registry entry (cross section, stored values)
+typedef std::pair<std::weak_ptr<const std::vector<double> >,
+                  std::weak_ptr<const CrossSectionStorage::StoredCrossSection> >
+StoredCrossSectionRegistryEntry;
+
+//! The stored cross section registry
+typedef std::unordered_map<const std::vector<double>*,StoredCrossSectionRegistryEntry>
+StoredCrossSectionRegistry;
+
+//! The number of stored cross section values that are in use
+std::atomic<uint64_t> number_of_stored_values( 0 );
+
+//! Get the stored cross section registry mutex
+std::mutex& getStoredCrossSectionRegistryMutex()
+{
+  static std::mutex registry_mutex;
+
+  return registry_mutex;
+}
+
+//! Get the stored cross section registry
+StoredCrossSectionRegistry& getStoredCrossSectionRegistry()
+{
+  static StoredCrossSectionRegistry registry;
+
+  return registry;
+}
+
+//! Remove the registry entries of stored cross sections that are not in use
+void purgeStoredCrossSectionRegistry( StoredCrossSectionRegistry& registry )
+{
+  StoredCrossSectionRegistry::iterator entry_it = registry.begin();
+
+  while( entry_it != registry.end() )
+  {
+    if( entry_it->second.second.expired() )
+      entry_it = registry.erase( entry_it );
+    else
+      ++entry_it;
+  }
+}
+
+//! Track the stored cross section values while they are in use
+/*! \details The returned pointer aliases the stored cross section. The
+ * stored values will be released and uncounted as soon as the last copy of
+ * the returned pointer is destroyed (the registry only holds weak pointers).
+ */
+template<typename T>
+std::shared_ptr<const std::vector<T> > trackStoredCrossSection(
+       const std::shared_ptr<const std::vector<T> >& stored_cross_section )
+{
+  const uint64_t size = stored_cross_section->size();
+
+  number_of_stored_values += size;
+
+  std::shared_ptr<const std::vector<T> > owner = stored_cross_section;
+
+  return std::shared_ptr<const std::vector<T> >(
+                                   stored_cross_section.get(),
+                                   [owner, size]( const std::vector<T>* ) mutable
+                                   {
+                                     number_of_stored_values -= size;
+
+                                     owner.reset();
+                                   } );
+}
+
+} // end anonymous namespace
+
+// Create the stored cross section
+/*! \details When the cross sections are stored in double precision the
+ * cross section will not be copied. A cross section that is shared by
+ * several reactions will only be converted (and counted) once.
+ */
+auto CrossSectionStorage::createStoredCrossSection(
+             const std::shared_ptr<const std::vector<double> >& cross_section )
+  -> std::shared_ptr<const StoredCrossSection>
+{
+  // Make sure that the cross section is valid
+  testPrecondition( cross_section.get() );
+
+  std::lock_guard<std::mutex> registry_lock(
+                                        getStoredCrossSectionRegistryMutex() );
+
+  StoredCrossSectionRegistry& registry = getStoredCrossSectionRegistry();
+
+  StoredCrossSectionRegistry::iterator entry_it =
+    registry.find( cross_section.get() );
+
+  // Check if the cross section has already been stored (the address may have
+  // been reused by a different cross section after the original was released)
+  if( entry_it != registry.end() )
+  {
+    std::shared_ptr<const StoredCrossSection> stored_cross_section =
+      entry_it->second.second.lock();
+
+    if( stored_cross_section &&
+        entry_it->second.first.lock() == cross_section )
+      return stored_cross_section;
+  }
+
+  std::shared_ptr<const StoredCrossSection> stored_cross_section =
+    trackStoredCrossSection(
+                    Details::convertCrossSection<ValueType>( cross_section ) );
+
+  // Keep the registry from growing with the entries of released cross
+  // sections
+  if( entry_it == registry.end() &&
+      registry.size() == registry.bucket_count() )
+    purgeStoredCrossSectionRegistry( registry );
+
+  registry[cross_section.get()] =
+    StoredCrossSectionRegistryEntry( cross_section, stored_cross_section );
+
+  return stored_cross_section;
+}
+
+// Return the number of stored cross section values that are in use
+uint64_t CrossSectionStorage::getNumberOfStoredValues()
+{
+  return number_of_stored_values;
+}
+
+// Return the memory used by the stored cross section values (bytes)
+uint64_t CrossSectionStorage::getStoredValueMemory()
+{
+  return number_of_stored_values*sizeof(ValueType);
+}
+
+// Return the memory saved by the storage precision (bytes)
+uint64_t CrossSectionStorage::getSavedMemory()
+{
+  return number_of_stored_values*(sizeof(double) - sizeof(ValueType));
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CrossSectionStorage.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CrossSectionStorage.hpp
+//! \author Alex Robinson
+//! \brief  The cross section storage class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CROSS_SECTION_STORAGE_HPP
+#define MONTE_CARLO_CROSS_SECTION_STORAGE_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+#include "FRENSIE_config.hpp"
+
+namespace MonteCarlo{
+
+/*! The cross section storage class
+ * \details This class converts the cross section values that are evaluated
+ * on a reaction's incoming energy grid to the storage precision and records
+ * the memory that is used by the stored values. When FRENSIE is configured
+ * with FRENSIE_ENABLE_SINGLE_PRECISION_CROSS_SECTIONS the values will be
+ * stored as floats. The energy grids are always stored in double precision
+ * and the stored values are always promoted to double precision before they
+ * are interpolated. Reactions that share a cross section array will also
+ * share the stored cross section. Only the stored cross sections that are
+ * currently in use are counted.
+ */
+class CrossSectionStorage
+{
+
+public:
+
+  //! The stored cross section value type
+#if HAVE_FRENSIE_SINGLE_PRECISION_CROSS_SECTIONS
+  typedef float ValueType;
+#else
+  typedef double ValueType;
+#endif
+
+  //! The stored cross section type
+  typedef std::vector<ValueType> StoredCrossSection;
+
+  //! Check if the cross sections are stored in single precision
+  static constexpr bool isSinglePrecision()
+  { return sizeof(ValueType) < sizeof(double); }
+
+  //! Create the stored cross section
+  static std::shared_ptr<const StoredCrossSection> createStoredCrossSection(
+            const std::shared_ptr<const std::vector<double> >& cross_section );
+
+  //! Return the number of stored cross section values that are in use
+  static uint64_t getNumberOfStoredValues();
+
+  //! Return the memory used by the stored cross section values (bytes)
+  static uint64_t getStoredValueMemory();
+
+  //! Return the memory saved by the storage precision (bytes)
+  static uint64_t getSavedMemory();
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CROSS_SECTION_STORAGE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CrossSectionStorage.hpp
+//---------------------------------------------------------------------------//
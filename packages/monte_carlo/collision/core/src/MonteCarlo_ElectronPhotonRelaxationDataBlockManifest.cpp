@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.cpp
+//! \author Alex Robinson
+//! \brief  Electron-photon-relaxation data block manifest definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
+#include "Utility_PhysicalConstants.hpp"
+
+namespace MonteCarlo{
+
+// Get the data blocks that are needed to construct a photoatom
+/*! \details The data blocks that are not in the manifest can still be
+ * accessed - they will simply be loaded on demand.
+ */
+ElectronPhotonRelaxationDataBlockManifest
+getPhotoatomicDataBlockManifest( const SimulationProperties& properties )
+{
+  ElectronPhotonRelaxationDataBlockManifest manifest;
+
+  // The cross sections and the coherent form factor are always needed
+  manifest.insert( Data::ElectronPhotonRelaxationDataContainer::PHOTON_CROSS_SECTION_DATA_BLOCK );
+  manifest.insert( Data::ElectronPhotonRelaxationDataContainer::FORM_FACTOR_DATA_BLOCK );
+
+  // The Compton profiles are only needed by the impulse and Doppler
+  // broadening incoherent models
+  if( properties.getIncoherentModelType() != KN_INCOHERENT_MODEL &&
+      properties.getIncoherentModelType() != WH_INCOHERENT_MODEL )
+  {
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::COMPTON_PROFILE_DATA_BLOCK );
+  }
+
+  if( properties.isAtomicRelaxationModeOn( PHOTON ) )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::RELAXATION_DATA_BLOCK );
+
+  return manifest;
+}
+
+// Get the data blocks that are needed to construct an electroatom
+/*! \details The data blocks that are not in the manifest can still be
+ * accessed - they will simply be loaded on demand.
+ */
+ElectronPhotonRelaxationDataBlockManifest
+getElectroatomicDataBlockManifest( const SimulationProperties& properties )
+{
+  ElectronPhotonRelaxationDataBlockManifest manifest;
+
+  // The cross sections are always needed
+  manifest.insert( Data::ElectronPhotonRelaxationDataContainer::ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
+  if( properties.isElasticModeOn() )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::ELASTIC_DATA_BLOCK );
+
+  if( properties.isElectroionizationModeOn() )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::ELECTROIONIZATION_DATA_BLOCK );
+
+  if( properties.isBremsstrahlungModeOn() )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::BREMSSTRAHLUNG_DATA_BLOCK );
+
+  if( properties.isAtomicExcitationModeOn() )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::ATOMIC_EXCITATION_DATA_BLOCK );
+
+  if( properties.isAtomicRelaxationModeOn( ELECTRON ) )
+    manifest.insert( Data::ElectronPhotonRelaxationDataContainer::RELAXATION_DATA_BLOCK );
+
+  return manifest;
+}
+
+// Get the data blocks that are needed to construct an adjoint photoatom
+/*! \details The data blocks that are not in the manifest can still be
+ * accessed - they will simply be loaded on demand.
+ */
+AdjointElectronPhotonRelaxationDataBlockManifest
+getAdjointPhotoatomicDataBlockManifest(
+                         const SimulationAdjointPhotonProperties& properties )
+{
+  AdjointElectronPhotonRelaxationDataBlockManifest manifest;
+
+  // The cross sections and the coherent form factor are always needed
+  manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::PHOTON_CROSS_SECTION_DATA_BLOCK );
+  manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::FORM_FACTOR_DATA_BLOCK );
+
+  // The Compton profiles are only needed by the impulse and Doppler
+  // broadening incoherent models
+  if( properties.getIncoherentAdjointModelType() != KN_INCOHERENT_ADJOINT_MODEL &&
+      properties.getIncoherentAdjointModelType() != WH_INCOHERENT_ADJOINT_MODEL )
+  {
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::COMPTON_PROFILE_DATA_BLOCK );
+  }
+
+  // The pair and triplet production distributions are only needed above
+  // the pair production threshold
+  if( properties.getMaxAdjointPhotonEnergy() >
+      2*Utility::PhysicalConstants::electron_rest_mass_energy )
+  {
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::PAIR_PRODUCTION_DATA_BLOCK );
+  }
+
+  return manifest;
+}
+
+// Get the data blocks that are needed to construct an adjoint electroatom
+/*! \details The data blocks that are not in the manifest can still be
+ * accessed - they will simply be loaded on demand.
+ */
+AdjointElectronPhotonRelaxationDataBlockManifest
+getAdjointElectroatomicDataBlockManifest( const SimulationProperties& properties )
+{
+  AdjointElectronPhotonRelaxationDataBlockManifest manifest;
+
+  // The cross sections are always needed
+  manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
+  if( properties.isAdjointElasticModeOn() )
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::ELASTIC_DATA_BLOCK );
+
+  if( properties.isAdjointElectroionizationModeOn() )
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::ELECTROIONIZATION_DATA_BLOCK );
+
+  if( properties.isAdjointBremsstrahlungModeOn() )
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::ELECTRON_BREMSSTRAHLUNG_DATA_BLOCK );
+
+  if( properties.isAdjointAtomicExcitationModeOn() )
+    manifest.insert( Data::AdjointElectronPhotonRelaxationDataContainer::ATOMIC_EXCITATION_DATA_BLOCK );
+
+  return manifest;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,51 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp
+//! \author Alex Robinson
+//! \brief  Electron-photon-relaxation data block manifest declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ELECTRON_PHOTON_RELAXATION_DATA_BLOCK_MANIFEST_HPP
+#define MONTE_CARLO_ELECTRON_PHOTON_RELAXATION_DATA_BLOCK_MANIFEST_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_Set.hpp"
+
+namespace MonteCarlo{
+
+//! The electron-photon-relaxation data block manifest
+typedef std::set<Data::ElectronPhotonRelaxationDataContainer::DataBlock>
+ElectronPhotonRelaxationDataBlockManifest;
+
+//! The adjoint electron-photon-relaxation data block manifest
+typedef std::set<Data::AdjointElectronPhotonRelaxationDataContainer::DataBlock>
+AdjointElectronPhotonRelaxationDataBlockManifest;
+
+//! Get the data blocks that are needed to construct a photoatom
+ElectronPhotonRelaxationDataBlockManifest
+getPhotoatomicDataBlockManifest( const SimulationProperties& properties );
+
+//! Get the data blocks that are needed to construct an electroatom
+ElectronPhotonRelaxationDataBlockManifest
+getElectroatomicDataBlockManifest( const SimulationProperties& properties );
+
+//! Get the data blocks that are needed to construct an adjoint photoatom
+AdjointElectronPhotonRelaxationDataBlockManifest
+getAdjointPhotoatomicDataBlockManifest(
+                         const SimulationAdjointPhotonProperties& properties );
+
+//! Get the data blocks that are needed to construct an adjoint electroatom
+AdjointElectronPhotonRelaxationDataBlockManifest
+getAdjointElectroatomicDataBlockManifest( const SimulationProperties& properties );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ELECTRON_PHOTON_RELAXATION_DATA_BLOCK_MANIFEST_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp
+//---------------------------------------------------------------------------//
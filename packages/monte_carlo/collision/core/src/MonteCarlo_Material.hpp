@@ -108,9 +108,6 @@ public:
 
 protected:
 
-  //! The macroscopic cross section evaluation functor type
-  typedef std::function<double(const double)> MacroscopicCrossSectionEvaluationFunctor;
-
   //! The microscopic cross section evaluation functor type
   typedef std::function<double(const ScatteringCenter&, const double)> MicroscopicCrossSectionEvaluationFunctor;
 
@@ -130,8 +127,6 @@ protected:
   //! Sample the collision atom
   size_t sampleCollisionScatteringCenterImpl(
                            const double energy,
-                           const MacroscopicCrossSectionEvaluationFunctor&
-                           macroscopic_total_cs_evaluation_functor,
                            const MicroscopicCrossSectionEvaluationFunctor&
                            total_cs_evaluation_functor ) const;
 
@@ -166,10 +161,6 @@ private:
 
   // The scattering center names that make up the material
   std::map<std::string,size_t> d_scattering_center_names;
-
-  // The getMacroscopicTotalCrossSection function wrapper
-  MacroscopicCrossSectionEvaluationFunctor
-  d_macroscopic_total_cs_evaluation_functor;
 };
 
 } // end MonteCarlo namespace
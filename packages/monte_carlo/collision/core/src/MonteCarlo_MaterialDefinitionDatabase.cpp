@@ -174,6 +174,52 @@ const std::string& MaterialDefinitionDatabase::getMaterialName(
   return id_it->second;
 }
 
+// Set the material temperature (MeV)
+/*! \details The scattering centers of the material will be evaluated at this
+ * temperature. Scattering centers with data that has been evaluated at a
+ * higher temperature will not be modified. A material without a temperature
+ * will use the temperatures of its scattering center data.
+ */
+void MaterialDefinitionDatabase::setMaterialTemperature(
+                                                    const size_t material_id,
+                                                    const double temperature )
+{
+  TEST_FOR_EXCEPTION( d_material_id_definition_map.find( material_id ) ==
+                      d_material_id_definition_map.end(),
+                      std::runtime_error,
+                      "There is no material definition corresponding to id "
+                      << material_id << "!" );
+
+  TEST_FOR_EXCEPTION( !(temperature > 0.0),
+                      std::runtime_error,
+                      "The temperature of material " << material_id <<
+                      " must be greater than zero!" );
+
+  d_material_id_temperature_map[material_id] = temperature;
+}
+
+// Check if a material temperature has been set
+bool MaterialDefinitionDatabase::isMaterialTemperatureSet(
+                                               const size_t material_id ) const
+{
+  return d_material_id_temperature_map.find( material_id ) !=
+    d_material_id_temperature_map.end();
+}
+
+// Get the material temperature (MeV)
+double MaterialDefinitionDatabase::getMaterialTemperature(
+                                               const size_t material_id ) const
+{
+  auto temperature_it = d_material_id_temperature_map.find( material_id );
+
+  TEST_FOR_EXCEPTION( temperature_it == d_material_id_temperature_map.end(),
+                      std::runtime_error,
+                      "There is no temperature corresponding to material id "
+                      << material_id << "!" );
+
+  return temperature_it->second;
+}
+
 // Remove material definition
 void MaterialDefinitionDatabase::removeDefinition( const std::string& material_name )
 {
@@ -182,6 +228,7 @@ void MaterialDefinitionDatabase::removeDefinition( const std::string& material_n
   if( name_it != d_material_id_name_map.right.end() )
   {
     d_material_id_definition_map.erase( name_it->second );
+    d_material_id_temperature_map.erase( name_it->second );
     d_material_id_name_map.right.erase( name_it );
   }
 }
@@ -194,6 +241,7 @@ void MaterialDefinitionDatabase::removeDefinition( const size_t material_id )
   if( id_it != d_material_id_name_map.left.end() )
   {
     d_material_id_definition_map.erase( material_id );
+    d_material_id_temperature_map.erase( material_id );
     d_material_id_name_map.left.erase( id_it );
   }
 }
@@ -36,6 +36,9 @@ class MaterialDefinitionDatabase : public Utility::OStreamableObject
   // The material id definition map type
   typedef std::map<size_t,MaterialDefinitionArrayPrivate> MaterialIdDefinitionMap;
 
+  // The material id temperature map type
+  typedef std::map<size_t,double> MaterialIdTemperatureMap;
+
   // The material id name map type
   typedef boost::bimap<size_t,std::string> MaterialIdNameBimap;
 
@@ -102,6 +105,16 @@ public:
   //! Get the material name
   const std::string& getMaterialName( const size_t material_id ) const;
 
+  //! Set the material temperature (MeV)
+  void setMaterialTemperature( const size_t material_id,
+                               const double temperature );
+
+  //! Check if a material temperature has been set
+  bool isMaterialTemperatureSet( const size_t material_id ) const;
+
+  //! Get the material temperature (MeV)
+  double getMaterialTemperature( const size_t material_id ) const;
+
   //! Remove material definition
   void removeDefinition( const std::string& material_name );
 
@@ -166,6 +179,9 @@ private:
 
   // The material id name map
   MaterialIdNameBimap d_material_id_name_map;
+
+  // The material id temperature map
+  MaterialIdTemperatureMap d_material_id_temperature_map;
 };
 
 // Save the object to an archive
@@ -174,6 +190,7 @@ void MaterialDefinitionDatabase::save( Archive& ar, const unsigned version ) con
 {
   ar & BOOST_SERIALIZATION_NVP( d_material_id_definition_map );
   ar & BOOST_SERIALIZATION_NVP( d_material_id_name_map );
+  ar & BOOST_SERIALIZATION_NVP( d_material_id_temperature_map );
 }
 
 // Load the object from an archive
@@ -182,6 +199,12 @@ void MaterialDefinitionDatabase::load( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_material_id_definition_map );
   ar & BOOST_SERIALIZATION_NVP( d_material_id_name_map );
+
+  // Temperatures added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_material_id_temperature_map );
+  else
+    d_material_id_temperature_map.clear();
 }
 
 // SWIG has trouble parsing complex templates and throws a syntax error.
@@ -231,7 +254,7 @@ auto MaterialDefinitionDatabase::getUniqueScatteringCenterNames(
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( MaterialDefinitionDatabase, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( MaterialDefinitionDatabase, MonteCarlo, 1 );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, MaterialDefinitionDatabase );
 
 #endif // end MONTE_CARLO_MATERIAL_DEFINITION_DATABASE_HPP
@@ -44,11 +44,7 @@ Material<ScatteringCenter>::Material(
   : d_id( id ),
     d_number_density( density ),
     d_scattering_centers( scattering_center_fractions.size() ),
-    d_scattering_center_names(),
-    d_macroscopic_total_cs_evaluation_functor(
-                 std::bind<double>( &ThisType::getMacroscopicTotalCrossSection,
-                                    std::cref(*this),
-                                    std::placeholders::_1 ) )
+    d_scattering_center_names()
 {
   // Make sure the id is valid
   testPrecondition( ThisType::isIdValid( id ) );
@@ -365,22 +361,24 @@ double Material<ScatteringCenter>::getAtomicWeightFromPair(
 }
 
 // Sample the collision atom
+/*! \details The microscopic cross section of each scattering center is only
+ * evaluated once. The cross sections are stored in a (thread local) scratch
+ * buffer that is reused by every collision. The scattering centers are summed
+ * in the same order as the macroscopic cross section so that the sampled
+ * scattering center is identical to the one that would be sampled using the
+ * macroscopic cross section.
+ */
 template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
                            const double energy,
-                           const MacroscopicCrossSectionEvaluationFunctor&
-                           macroscopic_total_cs_evaluation_functor,
                            const MicroscopicCrossSectionEvaluationFunctor&
                            total_cs_evaluation_functor ) const
 {
-  double scaled_random_number =
-    Utility::RandomNumberGenerator::getRandomNumber<double>()*
-    macroscopic_total_cs_evaluation_functor( energy );
+  static thread_local std::vector<double> partial_total_cross_sections;
 
-  double partial_total_cs = 0.0;
+  partial_total_cross_sections.resize( d_scattering_centers.size() );
 
-  size_t collision_scattering_center_index =
-    std::numeric_limits<size_t>::max();
+  double partial_total_cs = 0.0;
 
   for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
   {
@@ -389,7 +387,18 @@ size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
       total_cs_evaluation_functor( *Utility::get<1>( d_scattering_centers[i] ),
                                    energy );
 
-    if( scaled_random_number < partial_total_cs )
+    partial_total_cross_sections[i] = partial_total_cs;
+  }
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*partial_total_cs;
+
+  size_t collision_scattering_center_index =
+    std::numeric_limits<size_t>::max();
+
+  for( size_t i = 0u; i < partial_total_cross_sections.size(); ++i )
+  {
+    if( scaled_random_number < partial_total_cross_sections[i] )
     {
       collision_scattering_center_index = i;
 
@@ -409,9 +418,8 @@ template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter( const double energy ) const
 {
   return this->sampleCollisionScatteringCenterImpl(
-                                     energy,
-                                     d_macroscopic_total_cs_evaluation_functor,
-                                     s_total_cs_evaluation_functor );
+                                               energy,
+                                               s_total_cs_evaluation_functor );
 }
 
 } // end MonteCarlo namespace
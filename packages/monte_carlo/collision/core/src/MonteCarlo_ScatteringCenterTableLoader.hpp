@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterTableLoader.hpp
+//! \author Alex Robinson
+//! \brief  The scattering center table loader class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_HPP
+#define MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The scattering center table loader
+ *
+ * \details The scattering center factories register every scattering
+ * center with the loader along with a key that identifies the data table
+ * that it will be constructed from. Scattering centers that share a table
+ * will share the scattering center that gets constructed from it. Loading a
+ * table and constructing its scattering center is independent of every other
+ * table so the unique tables are handled concurrently by the requested
+ * number of OpenMP threads (see Utility::OpenMPProperties). Every table has
+ * its own result slot and the results are merged in the order that the
+ * tables were registered, which means that the constructed scattering
+ * centers do not depend on the number of threads that were used.
+ *
+ * The table load loop is an ordered loop. Any part of the table load
+ * function that is not thread safe (e.g. caching an atomic relaxation model)
+ * can be placed in an omp ordered block, which will be executed in table
+ * registration order.
+ */
+template<typename ScatteringCenterType, typename DataPropertiesType>
+class ScatteringCenterTableLoader
+{
+
+public:
+
+  //! The scattering center name map
+  typedef std::unordered_map<std::string,std::shared_ptr<const ScatteringCenterType> > ScatteringCenterNameMap;
+
+  //! Constructor
+  ScatteringCenterTableLoader();
+
+  //! Destructor
+  ~ScatteringCenterTableLoader()
+  { /* ... */ }
+
+  //! Register a scattering center
+  void registerScatteringCenter( const std::string& scattering_center_name,
+                                 const std::string& table_key,
+                                 const std::string& table_description,
+                                 const double atomic_weight,
+                                 const DataPropertiesType& data_properties );
+
+  //! Get the number of unique tables that have been registered
+  size_t getNumberOfTables() const;
+
+  //! Load the tables and construct the scattering centers
+  template<typename TableLoadFunction>
+  void loadTables( TableLoadFunction table_load_function,
+                   const bool verbose );
+
+  //! Get the wall time that was spent loading the tables (s)
+  double getLoadTime() const;
+
+  //! Add the constructed scattering centers to the name map
+  void addScatteringCentersToNameMap(
+                         ScatteringCenterNameMap& scattering_center_name_map );
+
+private:
+
+  // The table data
+  struct TableData
+  {
+    // The table key
+    std::string key;
+
+    // The table description (used for logging)
+    std::string description;
+
+    // The names of the scattering centers that use the table
+    std::vector<std::string> scattering_center_names;
+
+    // The atomic weight (ratio) of the first registered scattering center
+    double atomic_weight;
+
+    // The data properties of the first registered scattering center
+    const DataPropertiesType* data_properties;
+
+    // The constructed scattering center
+    std::shared_ptr<const ScatteringCenterType> scattering_center;
+
+    // The load time (s)
+    double load_time;
+
+    // The error message (empty if the table was loaded successfully)
+    std::string error_message;
+  };
+
+  // The tables (in registration order)
+  std::vector<TableData> d_tables;
+
+  // The table key index map
+  std::unordered_map<std::string,size_t> d_table_key_index_map;
+
+  // The wall time spent loading the tables (s)
+  double d_load_time;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_ScatteringCenterTableLoader_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterTableLoader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterTableLoader_def.hpp
+//! \author Alex Robinson
+//! \brief  The scattering center table loader class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_DEF_HPP
+#define MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_DEF_HPP
+
+// Std Lib Includes
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<typename ScatteringCenterType, typename DataPropertiesType>
+ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::ScatteringCenterTableLoader()
+  : d_tables(),
+    d_table_key_index_map(),
+    d_load_time( 0.0 )
+{ /* ... */ }
+
+// Register a scattering center
+/*! \details If the table has already been registered the scattering center
+ * will simply share the scattering center that will be constructed from it.
+ * The data properties must outlive the loader.
+ */
+template<typename ScatteringCenterType, typename DataPropertiesType>
+void ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::registerScatteringCenter(
+                                    const std::string& scattering_center_name,
+                                    const std::string& table_key,
+                                    const std::string& table_description,
+                                    const double atomic_weight,
+                                    const DataPropertiesType& data_properties )
+{
+  std::unordered_map<std::string,size_t>::const_iterator table_index_it =
+    d_table_key_index_map.find( table_key );
+
+  if( table_index_it == d_table_key_index_map.end() )
+  {
+    d_table_key_index_map[table_key] = d_tables.size();
+
+    d_tables.resize( d_tables.size() + 1 );
+
+    TableData& table = d_tables.back();
+    table.key = table_key;
+    table.description = table_description;
+    table.scattering_center_names.push_back( scattering_center_name );
+    table.atomic_weight = atomic_weight;
+    table.data_properties = &data_properties;
+    table.load_time = 0.0;
+  }
+  else
+  {
+    d_tables[table_index_it->second].scattering_center_names.push_back(
+                                                      scattering_center_name );
+  }
+}
+
+// Get the number of unique tables that have been registered
+template<typename ScatteringCenterType, typename DataPropertiesType>
+size_t ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::getNumberOfTables() const
+{
+  return d_tables.size();
+}
+
+// Load the tables and construct the scattering centers
+/*! \details The table load function must have the following signature:
+ * void( const DataPropertiesType& data_properties,
+ *       const double atomic_weight,
+ *       std::shared_ptr<const ScatteringCenterType>& scattering_center ).
+ * It will be called once for each unique table and it will usually be
+ * called concurrently (inside of an ordered loop). Exceptions are caught
+ * and the first error (in table registration order) will be rethrown once
+ * all of the tables have been processed. Exceptions must not propagate out of
+ * an ordered block in the table load function - they must be caught inside
+ * of the block and rethrown after it.
+ */
+template<typename ScatteringCenterType, typename DataPropertiesType>
+template<typename TableLoadFunction>
+void ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::loadTables(
+                                        TableLoadFunction table_load_function,
+                                        const bool verbose )
+{
+  std::shared_ptr<Utility::Timer> total_timer =
+    Utility::OpenMPProperties::createTimer();
+
+  total_timer->start();
+
+  #pragma omp parallel for ordered schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < d_tables.size(); ++i )
+  {
+    TableData& table = d_tables[i];
+
+    std::shared_ptr<Utility::Timer> table_timer =
+      Utility::OpenMPProperties::createTimer();
+
+    table_timer->start();
+
+    // Exceptions cannot propagate out of the parallel block
+    try{
+      table_load_function( *table.data_properties,
+                           table.atomic_weight,
+                           table.scattering_center );
+
+      TEST_FOR_EXCEPTION( !table.scattering_center,
+                          std::runtime_error,
+                          "The scattering center was not constructed!" );
+    }
+    catch( const std::exception& exception )
+    {
+      table.error_message = exception.what();
+    }
+    catch( ... )
+    {
+      table.error_message = "an unknown exception was thrown";
+    }
+
+    table_timer->stop();
+
+    table.load_time = table_timer->elapsed().count();
+  }
+
+  total_timer->stop();
+
+  d_load_time = total_timer->elapsed().count();
+
+  // Report the tables in registration order
+  for( size_t i = 0; i < d_tables.size(); ++i )
+  {
+    const TableData& table = d_tables[i];
+
+    TEST_FOR_EXCEPTION( !table.error_message.empty(),
+                        std::runtime_error,
+                        "Could not load " << table.description << " (used "
+                        "by " << table.scattering_center_names.front() <<
+                        "): " << table.error_message );
+
+    if( verbose )
+    {
+      FRENSIE_LOG_NOTIFICATION( " Loaded " << table.description <<
+                                " (" << table.load_time << " s)" );
+    }
+  }
+
+  if( verbose )
+    FRENSIE_FLUSH_ALL_LOGS();
+}
+
+// Get the wall time that was spent loading the tables (s)
+template<typename ScatteringCenterType, typename DataPropertiesType>
+double ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::getLoadTime() const
+{
+  return d_load_time;
+}
+
+// Add the constructed scattering centers to the name map
+template<typename ScatteringCenterType, typename DataPropertiesType>
+void ScatteringCenterTableLoader<ScatteringCenterType,DataPropertiesType>::addScatteringCentersToNameMap(
+                          ScatteringCenterNameMap& scattering_center_name_map )
+{
+  for( size_t i = 0; i < d_tables.size(); ++i )
+  {
+    const TableData& table = d_tables[i];
+
+    // Make sure that the table has been loaded
+    testPrecondition( table.scattering_center.get() );
+
+    for( size_t j = 0; j < table.scattering_center_names.size(); ++j )
+    {
+      scattering_center_name_map[table.scattering_center_names[j]] =
+        table.scattering_center;
+    }
+  }
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SCATTERING_CENTER_TABLE_LOADER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterTableLoader_def.hpp
+//---------------------------------------------------------------------------//
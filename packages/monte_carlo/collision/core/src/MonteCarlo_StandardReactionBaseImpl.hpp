@@ -14,6 +14,7 @@
 #include <functional>
 
 // FRENSIE Includes
+#include "MonteCarlo_CrossSectionStorage.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
@@ -31,7 +32,8 @@ namespace MonteCarlo{
  * ACE photon library would use the Utility::LogLog policy with
  * processed_cross_section = true. Cross section data from a ACE neutron
  * library or a native library would use Utility::LinLin with
- * processed_cross_section = false.
+ * processed_cross_section = false. The cross section values are stored with
+ * the precision defined by MonteCarlo::CrossSectionStorage.
  */
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -81,7 +83,8 @@ protected:
   const double* getEnergyGridHead() const final override;
 
   //! Return the cross section at the given energy
-  double getCrossSectionImpl( const std::vector<double>& cross_section,
+  template<typename T>
+  double getCrossSectionImpl( const std::vector<T>& cross_section,
                               const double energy,
                               const size_t bin_index ) const;
 
@@ -100,7 +103,8 @@ private:
   std::shared_ptr<const std::vector<double> > d_incoming_energy_grid;
 
   // The processed cross section values evaluated on the incoming e. grid
-  std::shared_ptr<const std::vector<double> > d_cross_section;
+  std::shared_ptr<const CrossSectionStorage::StoredCrossSection>
+  d_cross_section;
 
   // The threshold energy index
   size_t d_threshold_energy_index;
@@ -285,7 +285,7 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
        const std::shared_ptr<const std::vector<double> >& cross_section,
        const size_t threshold_energy_index )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section( CrossSectionStorage::createStoredCrossSection( cross_section ) ),
     d_threshold_energy_index( threshold_energy_index ),
     d_max_energy_index()
 {
@@ -326,7 +326,7 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
       grid_searcher )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section(),
     d_threshold_energy_index( threshold_energy_index ),
     d_grid_searcher( grid_searcher )
 {
@@ -346,6 +346,9 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
   // Make sure the grid searcher is valid
   testPrecondition( grid_searcher.get() );
 
+  d_cross_section =
+    CrossSectionStorage::createStoredCrossSection( cross_section );
+
   // Set the max energy index
   this->setMaxEnergyIndex();
 
@@ -391,13 +394,15 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
 /*! \details This method is exposed so that a different cross section can
  * be temporarily supplied to this class. The temporary cross section must have
  * the same properties as the stored cross section (same threshold index, max
- * index, and processed flag).
+ * index, and processed flag). The cross section values will be promoted to
+ * double precision before they are interpolated.
  */
 template<typename ReactionBase,
          typename InterpPolicy,
          bool processed_cross_section>
+template<typename T>
 double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getCrossSectionImpl(
-                                      const std::vector<double>& cross_section,
+                                      const std::vector<T>& cross_section,
                                       const double energy,
                                       const size_t bin_index ) const
 {
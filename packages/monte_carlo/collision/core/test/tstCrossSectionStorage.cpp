@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCrossSectionStorage.cpp
+//! \author Alex Robinson
+//! \brief  Cross section storage unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_CrossSectionStorage.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a stored cross section can be created
+FRENSIE_UNIT_TEST( CrossSectionStorage, createStoredCrossSection )
+{
+  std::shared_ptr<const std::vector<double> > cross_section(
+     new std::vector<double>( {0.0, 1.0/3.0, 2.5e-3, 1.7e4, std::log(1e-5)} ) );
+
+  const uint64_t initial_number_of_values =
+    MonteCarlo::CrossSectionStorage::getNumberOfStoredValues();
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section =
+    MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+
+  FRENSIE_REQUIRE_EQUAL( stored_cross_section->size(), cross_section->size() );
+  FRENSIE_CHECK_EQUAL( stored_cross_section->front(), 0.0 );
+
+  // The stored values must agree with the values to the storage precision
+  const double tol = (MonteCarlo::CrossSectionStorage::isSinglePrecision() ?
+                      1e-7 : 1e-15);
+
+  for( size_t i = 1; i < cross_section->size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( (double)(*stored_cross_section)[i],
+                                     (*cross_section)[i],
+                                     tol );
+  }
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values + cross_section->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that non-zero values are never stored as zero
+FRENSIE_UNIT_TEST( CrossSectionStorage, createStoredCrossSection_tiny )
+{
+  std::shared_ptr<const std::vector<double> > cross_section(
+                             new std::vector<double>( {0.0, 1e-300, 1.0} ) );
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section =
+    MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+
+  FRENSIE_CHECK_EQUAL( (*stored_cross_section)[0], 0.0 );
+  FRENSIE_CHECK( (*stored_cross_section)[1] > 0.0 );
+  FRENSIE_CHECK_EQUAL( (*stored_cross_section)[2], 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a shared cross section is only stored once
+FRENSIE_UNIT_TEST( CrossSectionStorage, createStoredCrossSection_shared )
+{
+  std::shared_ptr<const std::vector<double> > cross_section(
+                              new std::vector<double>( {1.0, 2.0, 3.0} ) );
+
+  const uint64_t initial_number_of_values =
+    MonteCarlo::CrossSectionStorage::getNumberOfStoredValues();
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section_a =
+    MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section_b =
+    MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+
+  FRENSIE_CHECK( stored_cross_section_a.get() == stored_cross_section_b.get() );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values + cross_section->size() );
+
+  // A copy of the cross section values must be stored separately
+  std::shared_ptr<const std::vector<double> > cross_section_copy(
+                                  new std::vector<double>( *cross_section ) );
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section_c =
+    MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section_copy );
+
+  FRENSIE_CHECK( stored_cross_section_a.get() != stored_cross_section_c.get() );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values + 2*cross_section->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that released stored cross sections are no longer counted
+FRENSIE_UNIT_TEST( CrossSectionStorage, getNumberOfStoredValues_released )
+{
+  const uint64_t initial_number_of_values =
+    MonteCarlo::CrossSectionStorage::getNumberOfStoredValues();
+
+  std::shared_ptr<const MonteCarlo::CrossSectionStorage::StoredCrossSection>
+    stored_cross_section_a, stored_cross_section_b;
+
+  {
+    std::shared_ptr<const std::vector<double> > cross_section(
+                         new std::vector<double>( {1.0, 2.0, 3.0, 4.0} ) );
+
+    stored_cross_section_a =
+      MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+
+    stored_cross_section_b =
+      MonteCarlo::CrossSectionStorage::createStoredCrossSection( cross_section );
+  }
+
+  // The stored values must outlive the original cross section
+  FRENSIE_REQUIRE_EQUAL( stored_cross_section_b->size(), 4 );
+  FRENSIE_CHECK_EQUAL( (*stored_cross_section_b)[3], 4.0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values + 4 );
+
+  stored_cross_section_a.reset();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values + 4 );
+
+  stored_cross_section_b.reset();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getNumberOfStoredValues(),
+                       initial_number_of_values );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the stored value memory can be returned
+FRENSIE_UNIT_TEST( CrossSectionStorage, getStoredValueMemory )
+{
+  const uint64_t number_of_values =
+    MonteCarlo::CrossSectionStorage::getNumberOfStoredValues();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getStoredValueMemory(),
+                       number_of_values*sizeof(MonteCarlo::CrossSectionStorage::ValueType) );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getStoredValueMemory() +
+                       MonteCarlo::CrossSectionStorage::getSavedMemory(),
+                       number_of_values*sizeof(double) );
+
+  if( MonteCarlo::CrossSectionStorage::isSinglePrecision() )
+  {
+    FRENSIE_CHECK( MonteCarlo::CrossSectionStorage::getSavedMemory() > 0 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( MonteCarlo::CrossSectionStorage::getSavedMemory(), 0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// end tstCrossSectionStorage.cpp
+//---------------------------------------------------------------------------//
@@ -192,6 +192,35 @@ FRENSIE_UNIT_TEST( MaterialDefinitionDatabase, removeDefinition )
   FRENSIE_CHECK( !database.doesDefinitionExist( 2 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a material temperature can be set
+FRENSIE_UNIT_TEST( MaterialDefinitionDatabase, setMaterialTemperature )
+{
+  MonteCarlo::MaterialDefinitionDatabase database;
+
+  FRENSIE_CHECK_THROW( database.setMaterialTemperature( 1, 2.53010e-8 ),
+                       std::runtime_error );
+
+  database.addDefinition( 1, {"H", "O"}, {2.0, 1.0} );
+  database.addDefinition( "D2O", 2, {"H2", "O"}, {2.0, 1.0} );
+
+  FRENSIE_CHECK( !database.isMaterialTemperatureSet( 1 ) );
+  FRENSIE_CHECK_THROW( database.getMaterialTemperature( 1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( database.setMaterialTemperature( 1, 0.0 ),
+                       std::runtime_error );
+
+  database.setMaterialTemperature( 1, 2.53010e-8 );
+
+  FRENSIE_CHECK( database.isMaterialTemperatureSet( 1 ) );
+  FRENSIE_CHECK_EQUAL( database.getMaterialTemperature( 1 ), 2.53010e-8 );
+  FRENSIE_CHECK( !database.isMaterialTemperatureSet( 2 ) );
+
+  database.removeDefinition( 1 );
+
+  FRENSIE_CHECK( !database.isMaterialTemperatureSet( 1 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the material definitions can be iterated over
 FRENSIE_UNIT_TEST( MaterialDefinitionDatabase, iterate )
@@ -323,6 +352,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( MaterialDefinitionDatabase,
     database.addDefinition( 1, {"H", "O"}, {2.0, 1.0} );
     database.addDefinition( "D2O", 2, {"H2", "O"}, {2.0, 1.0} );
     database.addDefinition( 3, {"H", "C", "O"}, {4, 1, 1} );
+    database.setMaterialTemperature( 2, 5.1704e-8 );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP(database) );
   }
@@ -348,6 +378,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( MaterialDefinitionDatabase,
   FRENSIE_REQUIRE( database.doesDefinitionExist( "D2O" ) );
   FRENSIE_REQUIRE( database.doesDefinitionExist( 2 ) );
   FRENSIE_CHECK_EQUAL( database.getDefinition( 2 ).size(), 2 );
+  FRENSIE_CHECK( database.isMaterialTemperatureSet( 2 ) );
+  FRENSIE_CHECK_EQUAL( database.getMaterialTemperature( 2 ), 5.1704e-8 );
 
   
   FRENSIE_REQUIRE( database.doesDefinitionExist( "3" ) );
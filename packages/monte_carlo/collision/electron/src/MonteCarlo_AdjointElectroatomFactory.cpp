@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_AdjointElectroatomFactory.hpp"
 #include "MonteCarlo_AdjointElectroatomNativeFactory.hpp"
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
@@ -131,9 +132,11 @@ void AdjointElectroatomFactory::createAdjointElectroatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the native data container
+    // Create the aepr data container - only the data blocks that are needed
+    // will be loaded
     Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+      data_container( native_file_path,
+                      getAdjointElectroatomicDataBlockManifest( properties ) );
 
     // Make sure the min adjoint electron energy are within the energy grid limits
     TEST_FOR_EXCEPTION( properties.getMinAdjointElectronEnergy() < data_container.getAdjointElectronEnergyGrid().front(),
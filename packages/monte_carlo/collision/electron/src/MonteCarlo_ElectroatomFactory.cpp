@@ -6,14 +6,20 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <functional>
+
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomFactory.hpp"
+#include "MonteCarlo_ScatteringCenterTableLoader.hpp"
 #include "MonteCarlo_ElectroatomACEFactory.hpp"
 #include "MonteCarlo_ElectroatomNativeFactory.hpp"
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_ToStringTraits.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -29,15 +35,17 @@ ElectroatomFactory::ElectroatomFactory(
              const std::shared_ptr<AtomicRelaxationModelFactory>&
              atomic_relaxation_model_factory,
              const SimulationProperties& properties,
-             const bool verbose )
-  : d_electroatom_name_map(),
-    d_electroatomic_table_name_map(),
-    d_verbose( verbose )
+             const bool verbose,
+             const std::shared_ptr<Data::ACETableCache>& ace_table_cache )
+  : d_electroatom_name_map()
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load electroatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
-  // Create each electroatom in the set
+  // Register each electroatom in the set with the table that it uses
+  ScatteringCenterTableLoader<Electroatom,Data::ElectroatomicDataProperties>
+    table_loader;
+
   ScatteringCenterNameSet::const_iterator electroatom_name =
     electroatom_names.begin();
 
@@ -63,39 +71,35 @@ ElectroatomFactory::ElectroatomFactory(
     const Data::ElectroatomicDataProperties& electroatom_data_properties =
       electroatom_definition.getElectroatomicDataProperties( &atomic_weight );
 
+    boost::filesystem::path data_file_path = data_directory;
+    data_file_path /= electroatom_data_properties.filePath();
+    data_file_path.make_preferred();
+
     if( electroatom_data_properties.fileType() ==
         Data::ElectroatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for ACE_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::ACE_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE];
-      }
-
-      this->createElectroatomFromACETable( data_directory,
-                                           *electroatom_name,
-                                           atomic_weight,
-                                           electroatom_data_properties,
-                                           atomic_relaxation_model_factory,
-                                           properties );
+      table_loader.registerScatteringCenter(
+                     *electroatom_name,
+                     "ACE_EPR:" + electroatom_data_properties.tableName(),
+                     "ACE EPR electroatomic cross section table " +
+                     electroatom_data_properties.tableName() + " from " +
+                     data_file_path.string(),
+                     atomic_weight,
+                     electroatom_data_properties );
     }
     else if( electroatom_data_properties.fileType() ==
              Data::ElectroatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the electroatomic table name map for Native_EPR files
-      if( d_electroatomic_table_name_map.find( Data::ElectroatomicDataProperties::Native_EPR_FILE ) ==
-          d_electroatomic_table_name_map.end() )
-      {
-        d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE];
-      }
-
-      this->createElectroatomFromNativeTable( data_directory,
-                                              *electroatom_name,
-                                              atomic_weight,
-                                              electroatom_data_properties,
-                                              atomic_relaxation_model_factory,
-                                              properties );
+      table_loader.registerScatteringCenter(
+                     *electroatom_name,
+                     "Native_EPR:" + electroatom_data_properties.filePath().string(),
+                     "native EPR cross section table (v " +
+                     Utility::toString( electroatom_data_properties.fileVersion() ) +
+                     ") for " +
+                     Utility::toString( electroatom_data_properties.atom() ) +
+                     " from " + data_file_path.string(),
+                     atomic_weight,
+                     electroatom_data_properties );
     }
     else
     {
@@ -110,10 +114,27 @@ ElectroatomFactory::ElectroatomFactory(
     ++electroatom_name;
   }
 
+  // Load the tables and create the electroatoms
+  table_loader.loadTables(
+              std::bind<void>( &ElectroatomFactory::createElectroatomFromTable,
+                               std::cref( data_directory ),
+                               std::cref( atomic_relaxation_model_factory ),
+                               std::cref( properties ),
+                               std::cref( ace_table_cache ),
+                               std::placeholders::_1,
+                               std::placeholders::_2,
+                               std::placeholders::_3 ),
+              verbose );
+
+  table_loader.addScatteringCentersToNameMap( d_electroatom_name_map );
+
   // Make sure that every electroatom has been created
   testPostcondition( d_electroatom_name_map.size() == electroatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading electroatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading electroatom data tables ("
+                            << table_loader.getNumberOfTables() <<
+                            " tables in " << table_loader.getLoadTime() <<
+                            " s)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -124,158 +145,169 @@ void ElectroatomFactory::createElectroatomMap(
   electroatom_name_map = d_electroatom_name_map;
 }
 
+// Create an electroatom from a table
+/*! \details This function will be called concurrently.
+ */
+void ElectroatomFactory::createElectroatomFromTable(
+                      const boost::filesystem::path& data_directory,
+                      const std::shared_ptr<AtomicRelaxationModelFactory>&
+                      atomic_relaxation_model_factory,
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache,
+                      const Data::ElectroatomicDataProperties& data_properties,
+                      const double atomic_weight,
+                      std::shared_ptr<const Electroatom>& electroatom )
+{
+  if( data_properties.fileType() ==
+      Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+  {
+    ElectroatomFactory::createElectroatomFromACETable(
+                                               data_directory,
+                                               atomic_weight,
+                                               data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               ace_table_cache,
+                                               electroatom );
+  }
+  else
+  {
+    ElectroatomFactory::createElectroatomFromNativeTable(
+                                               data_directory,
+                                               atomic_weight,
+                                               data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               electroatom );
+  }
+}
+
 // Create a electroatom from an ACE table
 void ElectroatomFactory::createElectroatomFromACETable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
 		      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache,
+                      std::shared_ptr<const Electroatom>& electroatom )
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].end() )
-  {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading ACE EPR electroatomic cross section "
-                                "table " << data_properties.tableName() <<
-                                " from " << ace_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true,
+                                         ace_table_cache );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
                                          ace_file_handler.getTableNXSArray(),
                                          ace_file_handler.getTableJXSArray(),
                                          ace_file_handler.getTableXSSArray() );
 
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+  // Create the atomic relaxation model - the factory cache is shared so the
+  // models must be created in table order (see ScatteringCenterTableLoader)
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
 
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             xss_data_extractor,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
+  // Exceptions cannot propagate out of the ordered block - the error will be
+  // rethrown once the block has been left
+  std::string relaxation_model_error_message;
 
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomACEFactory::createElectroatom( xss_data_extractor,
-                                              data_properties.tableName(),
-                                              atomic_weight,
-                                              atomic_relaxation_model,
-                                              properties,
-                                              electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = electroatom;
-
-    if( d_verbose )
+  #pragma omp ordered
+  {
+    try{
+      atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               xss_data_extractor,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
+    }
+    catch( const std::exception& exception )
     {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
+      relaxation_model_error_message = exception.what();
     }
   }
-  // The table has already been loaded
-  else
-  {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
-  }
-}
 
+  TEST_FOR_EXCEPTION( !relaxation_model_error_message.empty(),
+                      std::runtime_error,
+                      "Could not create the atomic relaxation model: "
+                      << relaxation_model_error_message );
+
+  // Create the new electroatom
+  ElectroatomACEFactory::createElectroatom( xss_data_extractor,
+                                            data_properties.tableName(),
+                                            atomic_weight,
+                                            atomic_relaxation_model,
+                                            properties,
+                                            electroatom );
+}
 
 // Create an electroatom from a Native table
 void ElectroatomFactory::createElectroatomFromNativeTable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
                       const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+                      const SimulationProperties& properties,
+                      std::shared_ptr<const Electroatom>& electroatom )
 {
-  // Check if the table has already been loaded
-  if( d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE].end() )
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Create the epr data container - only the data blocks that are needed
+  // will be loaded
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path,
+                    getElectroatomicDataBlockManifest( properties ) );
+
+  // Create the atomic relaxation model - the factory cache is shared so the
+  // models must be created in table order (see ScatteringCenterTableLoader)
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  // Exceptions cannot propagate out of the ordered block - the error will be
+  // rethrown once the block has been left
+  std::string relaxation_model_error_message;
+
+  #pragma omp ordered
   {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                     " Loading native EPR cross section table "
-                                     "(v " << data_properties.fileVersion() <<
-                                     ") for " << data_properties.atom() <<
-                                     " from " << native_file_path.string() <<
-                                     " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
+    try{
+      atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                               data_container,
+                               atomic_relaxation_model,
+                               properties.getMinPhotonEnergy(),
+                               properties.getMinElectronEnergy(),
+                               properties.isAtomicRelaxationModeOn( ELECTRON ) );
     }
-
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                             data_container,
-                             atomic_relaxation_model,
-                             properties.getMinPhotonEnergy(),
-                             properties.getMinElectronEnergy(),
-                             properties.isAtomicRelaxationModeOn( ELECTRON ) );
-
-    // Initialize the new electroatom
-    ElectroatomNameMap::mapped_type& electroatom =
-      d_electroatom_name_map[electroatom_name];
-
-    // Create the new electroatom
-    ElectroatomNativeFactory::createElectroatom( data_container,
-                                                 data_properties.filePath().string(),
-                                                 atomic_weight,
-                                                 atomic_relaxation_model,
-                                                 properties,
-                                                 electroatom );
-
-    // Cache the new electroatom in the table name map
-    d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = electroatom;
-
-    if( d_verbose )
+    catch( const std::exception& exception )
     {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
+      relaxation_model_error_message = exception.what();
     }
   }
-  // The table has already been loaded
-  else
-  {
-    d_electroatom_name_map[electroatom_name] =
-      d_electroatomic_table_name_map[Data::ElectroatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
-  }
+
+  TEST_FOR_EXCEPTION( !relaxation_model_error_message.empty(),
+                      std::runtime_error,
+                      "Could not create the atomic relaxation model: "
+                      << relaxation_model_error_message );
+
+  // Create the new electroatom
+  ElectroatomNativeFactory::createElectroatom( data_container,
+                                               data_properties.filePath().string(),
+                                               atomic_weight,
+                                               atomic_relaxation_model,
+                                               properties,
+                                               electroatom );
 }
 
 } // end MonteCarlo namespace
@@ -23,6 +23,7 @@
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 
@@ -40,7 +41,13 @@ public:
   //! The scattering center name set
   typedef MaterialDefinitionDatabase::ScatteringCenterNameSet ScatteringCenterNameSet;
 
-  //! Constructor
+  /*! Constructor
+   *
+   * \details The electroatomic data tables are loaded concurrently (see
+   * MonteCarlo::ScatteringCenterTableLoader). If an ACE table cache is
+   * given the ACE tables will be restored from it if possible (see
+   * Data::ACETableCache).
+   */
   ElectroatomFactory(
              const boost::filesystem::path& data_directory,
              const ScatteringCenterNameSet& electroatom_names,
@@ -48,7 +55,9 @@ public:
              const std::shared_ptr<AtomicRelaxationModelFactory>&
              atomic_relaxation_model_factory,
              const SimulationProperties& properties,
-             const bool verbose = false );
+             const bool verbose = false,
+             const std::shared_ptr<Data::ACETableCache>& ace_table_cache =
+             std::shared_ptr<Data::ACETableCache>() );
 
   //! Destructor
   ~ElectroatomFactory()
@@ -59,35 +68,42 @@ public:
 
 private:
 
+  // Create an electroatom from a table
+  static void createElectroatomFromTable(
+                      const boost::filesystem::path& data_directory,
+                      const std::shared_ptr<AtomicRelaxationModelFactory>&
+                      atomic_relaxation_model_factory,
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache,
+                      const Data::ElectroatomicDataProperties& data_properties,
+                      const double atomic_weight,
+                      std::shared_ptr<const Electroatom>& electroatom );
+
   // Create a electroatom from an ACE table
-  void createElectroatomFromACETable(
+  static void createElectroatomFromACETable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
 		      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache,
+                      std::shared_ptr<const Electroatom>& electroatom );
 
   // Create a electroatom from a Native table
-  void createElectroatomFromNativeTable(
+  static void createElectroatomFromNativeTable(
                       const boost::filesystem::path& data_directory,
-                      const std::string& electroatom_name,
                       const double atomic_weight,
                       const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                      const SimulationProperties& properties,
+                      std::shared_ptr<const Electroatom>& electroatom );
 
   // The electroatom map
   ElectroatomNameMap d_electroatom_name_map;
-
-  // The table map
-  std::map<Data::ElectroatomicDataProperties::FileType,ElectroatomNameMap>
-  d_electroatomic_table_name_map;
-
-  // Verbose electroatom construction
-  bool d_verbose;
 };
 
 } // end MonteCarlo namespace
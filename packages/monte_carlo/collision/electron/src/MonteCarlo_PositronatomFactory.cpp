@@ -10,6 +10,7 @@
 #include "MonteCarlo_PositronatomFactory.hpp"
 #include "MonteCarlo_PositronatomACEFactory.hpp"
 #include "MonteCarlo_PositronatomNativeFactory.hpp"
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
@@ -29,7 +30,8 @@ PositronatomFactory::PositronatomFactory(
             const std::shared_ptr<AtomicRelaxationModelFactory>&
             atomic_relaxation_model_factory,
             const SimulationProperties& properties,
-            const bool verbose )
+            const bool verbose,
+            const std::shared_ptr<Data::ACETableCache>& ace_table_cache )
   : d_positronatom_name_map(),
     d_positronatomic_table_name_map(),
     d_verbose( verbose )
@@ -78,7 +80,8 @@ PositronatomFactory::PositronatomFactory(
                                             atomic_weight,
                                             electroatom_data_properties,
                                             atomic_relaxation_model_factory,
-                                            properties );
+                                            properties,
+                                            ace_table_cache );
     }
     else if( electroatom_data_properties.fileType() ==
              Data::ElectroatomicDataProperties::Native_EPR_FILE )
@@ -125,7 +128,9 @@ void PositronatomFactory::createPositronatomFromACETable(
 		      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties )
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache )
 {
   // Check if the table has already been loaded
   if( d_positronatomic_table_name_map[Data::ElectroatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
@@ -150,7 +155,8 @@ void PositronatomFactory::createPositronatomFromACETable(
     Data::ACEFileHandler ace_file_handler( ace_file_path,
                                            data_properties.tableName(),
                                            data_properties.fileStartLine(),
-                                           true );
+                                           true,
+                                           ace_table_cache );
 
     // Create the XSS data extractor
     Data::XSSEPRDataExtractor xss_data_extractor(
@@ -228,9 +234,11 @@ void PositronatomFactory::createPositronatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the epr data container
+    // Create the epr data container - only the data blocks that are needed
+    // will be loaded
     Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+      data_container( native_file_path,
+                      getElectroatomicDataBlockManifest( properties ) );
 
     // Create the atomic relaxation model
     std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
@@ -19,6 +19,7 @@
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 
@@ -36,7 +37,11 @@ public:
   //! The scattering center name set
   typedef MaterialDefinitionDatabase::ScatteringCenterNameSet ScatteringCenterNameSet;
 
-  //! Constructor
+  /*! Constructor
+   *
+   * \details If an ACE table cache is given the ACE tables will be restored
+   * from it if possible (see Data::ACETableCache).
+   */
   PositronatomFactory(
             const boost::filesystem::path& data_directory,
             const ScatteringCenterNameSet& positronatom_names,
@@ -44,7 +49,9 @@ public:
             const std::shared_ptr<AtomicRelaxationModelFactory>&
             atomic_relaxation_model_factory,
             const SimulationProperties& properties,
-            const bool verbose = false );
+            const bool verbose = false,
+            const std::shared_ptr<Data::ACETableCache>& ace_table_cache =
+            std::shared_ptr<Data::ACETableCache>() );
 
   //! Destructor
   ~PositronatomFactory()
@@ -63,7 +70,9 @@ private:
 		      const Data::ElectroatomicDataProperties& data_properties,
                       const std::shared_ptr<AtomicRelaxationModelFactory>&
                       atomic_relaxation_model_factory,
-                      const SimulationProperties& properties );
+                      const SimulationProperties& properties,
+                      const std::shared_ptr<Data::ACETableCache>&
+                      ace_table_cache );
 
   // Create a positron-atom from a Native table
   void createPositronatomFromNativeTable(
@@ -20,6 +20,7 @@ void FilledAdjointElectronGeometryModel::loadScatteringCenters(
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>&,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const
 {
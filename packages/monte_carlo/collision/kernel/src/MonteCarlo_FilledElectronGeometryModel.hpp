@@ -56,6 +56,7 @@ protected:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
 };
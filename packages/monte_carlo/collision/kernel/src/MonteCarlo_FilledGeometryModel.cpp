@@ -8,12 +8,15 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <sstream>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // Must included first
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
+#include "MonteCarlo_CrossSectionStorage.hpp"
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -22,6 +25,7 @@ namespace MonteCarlo{
 
 // Initialize static member data
 boost::filesystem::path FilledGeometryModel::s_default_database_path;
+boost::filesystem::path FilledGeometryModel::s_ace_table_cache_directory;
 
 // Set the default database path
 void FilledGeometryModel::setDefaultDatabasePath(
@@ -34,6 +38,30 @@ void FilledGeometryModel::setDefaultDatabasePath(
     s_default_database_path = default_database_path;
 }
 
+// Set the ACE table cache directory (an empty path disables the cache)
+/*! \details When an ACE table cache directory has been set the ACE tables
+ * that are used by the materials will be stored in a binary cache file after
+ * they have been read from the data files. Later runs that use the same
+ * scattering center definitions will restore the tables from the cache file
+ * instead of reading them from the data files (see Data::ACETableCache).
+ * Only the parsing of the ACE tables is saved. The scattering centers and
+ * materials are still constructed from the restored tables (the scattering
+ * center and reaction classes are not serializable) and the native data
+ * files, which are already binary archives that support partial loading,
+ * are never cached.
+ */
+void FilledGeometryModel::setACETableCacheDirectory(
+                     const boost::filesystem::path& ace_table_cache_directory )
+{
+  s_ace_table_cache_directory = ace_table_cache_directory;
+}
+
+// Get the ACE table cache directory
+const boost::filesystem::path& FilledGeometryModel::getACETableCacheDirectory()
+{
+  return s_ace_table_cache_directory;
+}
+
 // Default constructor
 FilledGeometryModel::FilledGeometryModel()
   : d_database_path(),
@@ -250,6 +278,107 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
     ++cell_id_density_it;
   }
 
+  // Restore the preprocessed ACE tables from the ACE table cache if possible
+  std::shared_ptr<Data::ACETableCache> ace_table_cache;
+  boost::filesystem::path ace_table_cache_file;
+
+  if( !s_ace_table_cache_directory.empty() )
+  {
+    const std::string ace_table_cache_key =
+      this->createACETableCacheKey( unique_scattering_center_names );
+
+    ace_table_cache_file = s_ace_table_cache_directory;
+    ace_table_cache_file /=
+      Data::ACETableCache::getCacheFileName( ace_table_cache_key );
+
+    try{
+      ace_table_cache =
+        Data::ACETableCache::load( ace_table_cache_file, ace_table_cache_key );
+    }
+    catch( const std::exception& exception )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "FilledGeometryModel",
+                                  "The ACE table cache will be rebuilt: "
+                                  << exception.what() );
+    }
+
+    if( ace_table_cache )
+    {
+      if( verbose )
+      {
+        FRENSIE_LOG_NOTIFICATION( "Using ACE table cache "
+                                  << ace_table_cache_file.string() << " ("
+                                  << ace_table_cache->getNumberOfTables() <<
+                                  " tables)" );
+      }
+    }
+    else
+      ace_table_cache.reset( new Data::ACETableCache( ace_table_cache_key ) );
+  }
+
+  this->fillModelWithMaterials( unique_scattering_center_names,
+                                cell_id_mat_id_map,
+                                cell_id_density_map,
+                                ace_table_cache,
+                                verbose );
+
+  // Report the memory used by the reaction cross sections
+  if( verbose )
+  {
+    std::ostringstream oss;
+
+    oss << "Stored " << CrossSectionStorage::getNumberOfStoredValues()
+        << " reaction cross section values ("
+        << CrossSectionStorage::getStoredValueMemory()/1048576.0 << " MB";
+
+    if( CrossSectionStorage::isSinglePrecision() )
+    {
+      oss << ", " << CrossSectionStorage::getSavedMemory()/1048576.0
+          << " MB saved by single precision storage";
+    }
+
+    oss << ")";
+
+    FRENSIE_LOG_NOTIFICATION( oss.str() );
+  }
+
+  // Save the tables that had to be read from the data files
+  if( ace_table_cache )
+  {
+    if( ace_table_cache->getNumberOfStoredTables() > 0 )
+    {
+      try{
+        ace_table_cache->save( ace_table_cache_file );
+
+        if( verbose )
+        {
+          FRENSIE_LOG_NOTIFICATION( "Saved "
+                                    << ace_table_cache->getNumberOfStoredTables() <<
+                                    " new tables to ACE table cache "
+                                    << ace_table_cache_file.string() );
+        }
+      }
+      catch( const std::exception& exception )
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "FilledGeometryModel",
+                                    "The ACE table cache could not be saved: "
+                                    << exception.what() );
+      }
+    }
+  }
+
+  d_filled = true;
+}
+
+// Fill the geometry with the materials
+void FilledGeometryModel::fillModelWithMaterials(
+                   const MaterialDefinitionDatabase::ScatteringCenterNameSet&
+                   unique_scattering_center_names,
+                   const Geometry::Model::CellIdMatIdMap& cell_id_mat_id_map,
+                   const Geometry::Model::CellIdDensityMap& cell_id_density_map,
+                   const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
+                   const bool verbose )
+{
   // Initialize an atomic relaxation model factory
   std::shared_ptr<AtomicRelaxationModelFactory>
     atomic_relaxation_model_factory( new AtomicRelaxationModelFactory );
@@ -267,6 +396,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -287,6 +417,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -307,6 +438,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -327,6 +459,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -343,6 +476,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -363,6 +497,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
                                               *d_properties,
+                                              ace_table_cache,
                                               verbose,
                                               *d_material_definitions,
                                               cell_id_mat_id_map,
@@ -372,8 +507,42 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                              "Could not fill the model with adjoint electron "
                              "materials!" );
   }
+}
 
-  d_filled = true;
+// Create the ACE table cache key
+/*! \details The key is created from the database path, the particle mode and
+ * the definitions of the scattering centers that are used by the materials
+ * (i.e. the data tables that will be loaded).
+ */
+std::string FilledGeometryModel::createACETableCacheKey(
+                   const MaterialDefinitionDatabase::ScatteringCenterNameSet&
+                   unique_scattering_center_names ) const
+{
+  std::ostringstream key_data;
+
+  {
+    boost::archive::text_oarchive key_data_archive( key_data,
+                                                    boost::archive::no_header );
+
+    const std::string database_path = d_database_path.string();
+    const int particle_mode = d_properties->getParticleMode();
+
+    key_data_archive << database_path << particle_mode;
+
+    MaterialDefinitionDatabase::ScatteringCenterNameSet::const_iterator
+      scattering_center_name_it = unique_scattering_center_names.begin();
+
+    while( scattering_center_name_it != unique_scattering_center_names.end() )
+    {
+      key_data_archive << *scattering_center_name_it
+                       << d_scattering_center_definitions->getDefinition(
+                                                 *scattering_center_name_it );
+
+      ++scattering_center_name_it;
+    }
+  }
+
+  return Data::ACETableCache::createKey( key_data.str() );
 }
 
 // Check if the model is initialized
@@ -65,6 +65,13 @@ public:
   static void setDefaultDatabasePath(
                         const boost::filesystem::path& default_database_path );
 
+  //! Set the ACE table cache directory (an empty path disables the cache)
+  static void setACETableCacheDirectory(
+                    const boost::filesystem::path& ace_table_cache_directory );
+
+  //! Get the ACE table cache directory
+  static const boost::filesystem::path& getACETableCacheDirectory();
+
   //! Check if a cell is void (as experienced by the given particle type)
   bool isCellVoid( const Geometry::Model::EntityId cell,
                    const MonteCarlo::ParticleType particle_type ) const;
@@ -73,6 +80,10 @@ public:
   template<typename ParticleStateType>
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell containing the particle is void
+  template<typename State>
+  bool isCellVoid( const State& particle ) const;
+
   //! Check if a cell is a termination cell
   using FilledNeutronGeometryModel::isTerminationCell;
 
@@ -223,6 +234,20 @@ private:
   // Fill the geometry
   void fillGeometry( const bool verbose );
 
+  // Fill the geometry with the materials
+  void fillModelWithMaterials(
+                   const MaterialDefinitionDatabase::ScatteringCenterNameSet&
+                   unique_scattering_center_names,
+                   const Geometry::Model::CellIdMatIdMap& cell_id_mat_id_map,
+                   const Geometry::Model::CellIdDensityMap& cell_id_density_map,
+                   const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
+                   const bool verbose );
+
+  // Create the ACE table cache key
+  std::string createACETableCacheKey(
+                   const MaterialDefinitionDatabase::ScatteringCenterNameSet&
+                   unique_scattering_center_names ) const;
+
   // Initialize the geometry just-in-time
   void initializeJustInTime();
 
@@ -245,6 +270,9 @@ private:
   // The default path to the cross section database
   static boost::filesystem::path s_default_database_path;
 
+  // The ACE table cache directory
+  static boost::filesystem::path s_ace_table_cache_directory;
+
   // The path to the cross section database
   boost::filesystem::path d_database_path;
 
@@ -126,6 +126,16 @@ bool FilledGeometryModel::isCellVoid(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::isCellVoid( cell );
 }
 
+// Check if the cell containing the particle is void
+/*! \details The dense cell index cached by the particle will be used to
+ * look up the cell material.
+ */
+template<typename State>
+bool FilledGeometryModel::isCellVoid( const State& particle ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<State>::UpcastType::isCellVoid( particle );
+}
+
 // Get the total macroscopic cross section of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getMacroscopicTotalCrossSection(
@@ -20,6 +20,7 @@ void FilledNeutronGeometryModel::loadScatteringCenters(
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const
 {
@@ -28,10 +29,46 @@ void FilledNeutronGeometryModel::loadScatteringCenters(
                                   unique_scattering_center_names,
                                   scattering_center_definitions,
                                   properties,
-                                  verbose );
+                                  verbose,
+                                  ace_table_cache );
 
   nuclide_factory.createNuclideMap( scattering_center_name_map );
 }
+
+// Create a material
+/*! \details If a temperature has been assigned to the material the nuclides
+ * of the material will be evaluated at that temperature.
+ */
+auto FilledNeutronGeometryModel::createMaterial(
+             const MaterialType::MaterialId material_id,
+             const double density,
+             const ScatteringCenterNameMap& scattering_center_name_map,
+             const std::vector<double>& scattering_center_fractions,
+             const std::vector<std::string>& scattering_center_names,
+             const MaterialDefinitionDatabase& material_definitions ) const
+  -> std::shared_ptr<const MaterialType>
+{
+  if( material_definitions.isMaterialTemperatureSet( material_id ) )
+  {
+    return std::shared_ptr<const MaterialType>(
+             new MaterialType( material_id,
+                               density,
+                               scattering_center_name_map,
+                               scattering_center_fractions,
+                               scattering_center_names,
+                               material_definitions.getMaterialTemperature(
+                                                           material_id ) ) );
+  }
+  else
+  {
+    return BaseType::createMaterial( material_id,
+                                     density,
+                                     scattering_center_name_map,
+                                     scattering_center_fractions,
+                                     scattering_center_names,
+                                     material_definitions );
+  }
+}
   
 } // end MonteCarlo namespace
 
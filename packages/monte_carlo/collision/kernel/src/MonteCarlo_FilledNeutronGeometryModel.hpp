@@ -56,8 +56,18 @@ protected:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
+
+  //! Create a material
+  std::shared_ptr<const MaterialType> createMaterial(
+             const MaterialType::MaterialId material_id,
+             const double density,
+             const ScatteringCenterNameMap& scattering_center_name_map,
+             const std::vector<double>& scattering_center_fractions,
+             const std::vector<std::string>& scattering_center_names,
+             const MaterialDefinitionDatabase& material_definitions ) const final override;
 };
   
 } // end MonteCarlo namespace
@@ -21,6 +21,7 @@ void FilledPositronGeometryModel::loadScatteringCenters(
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const
 {
@@ -29,7 +30,8 @@ void FilledPositronGeometryModel::loadScatteringCenters(
                                             scattering_center_definitions,
                                             atomic_relaxation_model_factory,
                                             properties,
-                                            verbose );
+                                            verbose,
+                                            ace_table_cache );
 
   positronatom_factory.createPositronatomMap( scattering_center_name_map );
 }
@@ -21,6 +21,7 @@
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Geometry_Model.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 #include "Utility_Vector.hpp"
@@ -54,13 +55,30 @@ public:
   //! Check if a cell is void
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell containing the particle is void
+  bool isCellVoid( const ParticleStateType& particle ) const;
+
+  //! Check if the cell with the dense index is void
+  bool isCellVoidAtIndex( const Geometry::Model::EntityIndex cell_index ) const;
+
   //! Check if a cell is a termination cell
   bool isTerminationCell( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell containing the particle is a termination cell
+  bool isTerminationCell( const ParticleState& particle ) const;
+
   //! Get the material contained in a cell
   const std::shared_ptr<const MaterialType>&
   getMaterial( const Geometry::Model::EntityId cell ) const;
 
+  //! Get the material contained in the cell containing the particle
+  const std::shared_ptr<const MaterialType>&
+  getMaterial( const ParticleStateType& particle ) const;
+
+  //! Get the material contained in the cell with the dense index
+  const std::shared_ptr<const MaterialType>& getMaterialAtCellIndex(
+                       const Geometry::Model::EntityIndex cell_index ) const;
+
   //! Destructor
   virtual ~StandardFilledParticleGeometryModel()
   { /* ... */ }
@@ -147,6 +165,7 @@ protected:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose_material_construction,
        const MaterialDefinitionDatabase& material_definitions,
        const Geometry::Model::CellIdMatIdMap& cell_id_mat_id_map,
@@ -161,6 +180,7 @@ protected:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const = 0;
   
@@ -168,6 +188,15 @@ protected:
   virtual void processLoadedScatteringCenters(
                    const ScatteringCenterNameMap& scattering_centers );
 
+  //! Create a material
+  virtual std::shared_ptr<const MaterialType> createMaterial(
+             const typename MaterialType::MaterialId material_id,
+             const double density,
+             const ScatteringCenterNameMap& scattering_center_name_map,
+             const std::vector<double>& scattering_center_fractions,
+             const std::vector<std::string>& scattering_center_names,
+             const MaterialDefinitionDatabase& material_definitions ) const;
+
 private:
 
   // Add a material to the collision kernel
@@ -175,6 +204,13 @@ private:
                     const std::vector<Geometry::Model::EntityId>&
                     cells_containing_material );
 
+  // Assign the materials to the dense cell indices
+  void assignCellIndexMaterials();
+
+  // Get the dense index of the cell containing the particle
+  Geometry::Model::EntityIndex getCellIndex(
+                                       const ParticleState& particle ) const;
+
   // The unfilled model
   std::shared_ptr<const Geometry::Model> d_unfilled_model;
 
@@ -192,6 +228,10 @@ private:
   CellIdMaterialMap;
 
   CellIdMaterialMap d_cell_id_material_map;  
+
+  // The material in each cell (indexed by the dense cell index - void cells
+  // store a null pointer)
+  std::vector<std::shared_ptr<const MaterialType> > d_cell_index_materials;
 };
   
 } // end MonteCarlo namespace
@@ -29,7 +29,8 @@ StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryMod
   : d_unfilled_model( unfilled_model ),
     d_scattering_center_name_map(),
     d_material_name_map(),
-    d_cell_id_material_map()
+    d_cell_id_material_map(),
+    d_cell_index_materials()
 {
   // Make sure that the unfilled model is valid
   testPrecondition( unfilled_model.get() );
@@ -56,6 +57,7 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache,
        const bool verbose_material_construction,
        const MaterialDefinitionDatabase& material_definitions,
        const Geometry::Model::CellIdMatIdMap& cell_id_mat_id_map,
@@ -67,6 +69,7 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
                                  scattering_center_definitions,
                                  atomic_relaxation_model_factory,
                                  properties,
+                                 ace_table_cache,
                                  verbose_material_construction,
                                  d_scattering_center_name_map );
   }
@@ -125,11 +128,12 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      new_material = this->createMaterial( material_id,
+                                           density,
+                                           d_scattering_center_name_map,
+                                           scattering_center_fractions,
+                                           scattering_center_names,
+                                           material_definitions );
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -148,6 +152,30 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     
     ++material_name_it;
   }
+
+  this->assignCellIndexMaterials();
+}
+
+// Create a material
+/*! \details Override this method if the material definition database stores
+ * additional material properties that are needed by the material type.
+ */
+template<typename Material>
+auto StandardFilledParticleGeometryModel<Material>::createMaterial(
+             const typename MaterialType::MaterialId material_id,
+             const double density,
+             const ScatteringCenterNameMap& scattering_center_name_map,
+             const std::vector<double>& scattering_center_fractions,
+             const std::vector<std::string>& scattering_center_names,
+             const MaterialDefinitionDatabase& ) const
+  -> std::shared_ptr<const MaterialType>
+{
+  return std::shared_ptr<const MaterialType>(
+                               new MaterialType( material_id,
+                                                 density,
+                                                 scattering_center_name_map,
+                                                 scattering_center_fractions,
+                                                 scattering_center_names ) );
 }
 
 // Add a material to the collision kernel
@@ -175,6 +203,51 @@ void StandardFilledParticleGeometryModel<Material>::addMaterial(
   }
 }
 
+// Assign the materials to the dense cell indices
+/*! \details The material lookups for particles can then be done with the
+ * dense cell index cached by the particle state instead of the cell id map.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::assignCellIndexMaterials()
+{
+  d_cell_index_materials.clear();
+  d_cell_index_materials.resize( d_unfilled_model->getNumberOfCells() );
+
+  typename CellIdMaterialMap::const_iterator cell_id_material_it =
+    d_cell_id_material_map.begin();
+
+  while( cell_id_material_it != d_cell_id_material_map.end() )
+  {
+    Geometry::Model::EntityIndex cell_index =
+      d_unfilled_model->getCellIndex( cell_id_material_it->first );
+
+    TEST_FOR_EXCEPTION( cell_index >= d_cell_index_materials.size(),
+                        std::logic_error,
+                        "cell " << cell_id_material_it->first <<
+                        " has not been assigned a dense index by the "
+                        "model!" );
+
+    d_cell_index_materials[cell_index] = cell_id_material_it->second;
+
+    ++cell_id_material_it;
+  }
+}
+
+// Get the dense index of the cell containing the particle
+/*! \details The index cached by the particle will only be used if the
+ * particle is embedded in the unfilled model.
+ */
+template<typename Material>
+inline Geometry::Model::EntityIndex
+StandardFilledParticleGeometryModel<Material>::getCellIndex(
+                                        const ParticleState& particle ) const
+{
+  if( particle.isEmbeddedInModel( *d_unfilled_model ) )
+    return particle.getCellIndex();
+  else
+    return d_unfilled_model->getCellIndex( particle.getCell() );
+}
+
 // Get the material contained in a cell
 template<typename Material>
 auto StandardFilledParticleGeometryModel<Material>::getMaterial(
@@ -191,6 +264,37 @@ auto StandardFilledParticleGeometryModel<Material>::getMaterial(
   return d_cell_id_material_map.find( cell )->second;
 }
 
+// Get the material contained in the cell containing the particle
+template<typename Material>
+inline auto StandardFilledParticleGeometryModel<Material>::getMaterial(
+                         const ParticleStateType& particle ) const
+  -> const std::shared_ptr<const MaterialType>&
+{
+  const Geometry::Model::EntityIndex cell_index =
+    this->getCellIndex( particle );
+
+  TEST_FOR_EXCEPTION( this->isCellVoidAtIndex( cell_index ),
+                      std::runtime_error,
+                      "Cell " << particle.getCell() << " is void!" );
+
+  return d_cell_index_materials[cell_index];
+}
+
+// Get the material contained in the cell with the dense index
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+inline auto StandardFilledParticleGeometryModel<Material>::getMaterialAtCellIndex(
+                         const Geometry::Model::EntityIndex cell_index ) const
+  -> const std::shared_ptr<const MaterialType>&
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return d_cell_index_materials[cell_index];
+}
+
 // Process loaded scattering centers
 template<typename Material>
 void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCenters(
@@ -212,6 +316,27 @@ bool StandardFilledParticleGeometryModel<Material>::isCellVoid(
   return d_cell_id_material_map.find( cell ) == d_cell_id_material_map.end();
 }
 
+// Check if the cell containing the particle is void
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isCellVoid(
+                                     const ParticleStateType& particle ) const
+{
+  return this->isCellVoidAtIndex( this->getCellIndex( particle ) );
+}
+
+// Check if the cell with the dense index is void
+/*! \details Cells that have not been indexed are void.
+ */
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isCellVoidAtIndex(
+                         const Geometry::Model::EntityIndex cell_index ) const
+{
+  if( cell_index < d_cell_index_materials.size() )
+    return !d_cell_index_materials[cell_index];
+  else
+    return true;
+}
+
 // Check if a cell is a termination cell
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isTerminationCell(
@@ -220,13 +345,30 @@ bool StandardFilledParticleGeometryModel<Material>::isTerminationCell(
   return d_unfilled_model->isTerminationCell( cell );
 }
 
+// Check if the cell containing the particle is a termination cell
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isTerminationCell(
+                                          const ParticleState& particle ) const
+{
+  return d_unfilled_model->isTerminationCellAtIndex(
+                                             this->getCellIndex( particle ) );
+}
+
 // Get the total macroscopic cross section of a material
 template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSection(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSection( particle.getCell(),
-                                                particle.getEnergy() );
+  const Geometry::Model::EntityIndex cell_index =
+    this->getCellIndex( particle );
+
+  if( this->isCellVoidAtIndex( cell_index ) )
+    return 0.0;
+  else
+  {
+    return d_cell_index_materials[cell_index]->getMacroscopicTotalCrossSection(
+                                                       particle.getEnergy() );
+  }
 }
 
 // Get the total macroscopic cross section of a material
@@ -249,8 +391,8 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSectionQuick(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSectionQuick( particle.getCell(),
-                                                     particle.getEnergy() );
+  return this->getMaterialAtCellIndex( this->getCellIndex( particle ) )->getMacroscopicTotalCrossSection(
+                                                       particle.getEnergy() );
 }
 
 // Get the total macroscopic cross section of a material
@@ -327,9 +469,16 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSection( particle.getCell(),
-                                                   particle.getEnergy(),
-                                                   reaction );
+  const Geometry::Model::EntityIndex cell_index =
+    this->getCellIndex( particle );
+
+  if( this->isCellVoidAtIndex( cell_index ) )
+    return 0.0;
+  else
+  {
+    return d_cell_index_materials[cell_index]->getMacroscopicReactionCrossSection(
+                                             particle.getEnergy(), reaction );
+  }
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
@@ -357,9 +506,8 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSectionQuick( particle.getCell(),
-                                                        particle.getEnergy(),
-                                                        reaction );
+  return this->getMaterialAtCellIndex( this->getCellIndex( particle ) )->getMacroscopicReactionCrossSection(
+                                             particle.getEnergy(), reaction );
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
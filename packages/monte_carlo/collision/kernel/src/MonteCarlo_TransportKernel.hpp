@@ -76,7 +76,7 @@ double TransportKernel::sampleSimpleDistanceToNextCollisionSite(
   // to collision)
   double distance_to_collision = std::numeric_limits<double>::infinity();
 
-  if( !d_model->isCellVoid<ParticleStateType>( particle.getCell() ) )
+  if( !d_model->isCellVoid<ParticleStateType>( particle ) )
   {
     macroscopic_total_cross_section =
       d_model->getMacroscopicTotalForwardCrossSectionQuick<ParticleStateType>(
@@ -106,7 +106,7 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
   // transport kernel is defined in.
   testPrecondition( particle.isEmbeddedInModel( *d_model ) );
   // Make sure that the particle is still in the geometry
-  testPrecondition( !d_model->isTerminationCell( particle.getCell() ) );
+  testPrecondition( !d_model->isTerminationCell( particle ) );
 
   // Sample an optical path
   double remaining_optical_path_length =
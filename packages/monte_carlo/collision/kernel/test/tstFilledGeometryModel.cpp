@@ -631,6 +631,79 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, isCellVoid_adjoint_electron_mode )
   // FRENSIE_CHECK( !filled_model.isCellVoid<MonteCarlo::AdjointPositronState>( 1 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cell data can be returned using the dense cell indices
+FRENSIE_UNIT_TEST( FilledGeometryModel, cell_index_accessors_neutron_mode )
+{
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+  MonteCarlo::FilledGeometryModel filled_model( test_scattering_center_database_name,
+                                                scattering_center_definition_database,
+                                                material_definition_database,
+                                                properties,
+                                                unfilled_model,
+                                                true );
+
+  const MonteCarlo::FilledNeutronGeometryModel& neutron_model = filled_model;
+  const MonteCarlo::FilledPhotonGeometryModel& photon_model = filled_model;
+
+  FRENSIE_REQUIRE_EQUAL( unfilled_model->getCellIndex( 1 ), 0 );
+
+  FRENSIE_CHECK( !neutron_model.isCellVoidAtIndex( 0 ) );
+  FRENSIE_CHECK( photon_model.isCellVoidAtIndex( 0 ) );
+
+  // Indices outside of the model are always void
+  FRENSIE_CHECK( neutron_model.isCellVoidAtIndex( 1 ) );
+  FRENSIE_CHECK( neutron_model.isCellVoidAtIndex( Geometry::Model::invalidEntityIndex() ) );
+
+  FRENSIE_CHECK( neutron_model.getMaterialAtCellIndex( 0 ).get() ==
+                 neutron_model.getMaterial( 1 ).get() );
+
+  // Check the particle accessors (the cached cell index will be used)
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.embedInModel( filled_model );
+  neutron.setEnergy( 1.0 );
+
+  FRENSIE_REQUIRE_EQUAL( neutron.getCellIndex(), 0 );
+
+  FRENSIE_CHECK( !neutron_model.isCellVoid( neutron ) );
+  FRENSIE_CHECK( !filled_model.isTerminationCell( neutron ) );
+  FRENSIE_CHECK( neutron_model.getMaterial( neutron ).get() ==
+                 neutron_model.getMaterial( 1 ).get() );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                  filled_model.getMacroscopicTotalCrossSectionQuick( neutron ),
+                  5.565644507161069399e-01,
+                  1e-15 );
+
+  // Check the particle accessors when the particle is in a different model
+  std::shared_ptr<const Geometry::Model> other_model(
+                                      new Geometry::InfiniteMediumModel( 1 ) );
+
+  MonteCarlo::NeutronState other_neutron( 1ull );
+  other_neutron.embedInModel( other_model );
+  other_neutron.setEnergy( 1.0 );
+
+  FRENSIE_REQUIRE_EQUAL( other_neutron.getCell(), 1 );
+
+  FRENSIE_CHECK( !neutron_model.isCellVoid( other_neutron ) );
+  FRENSIE_CHECK( neutron_model.getMaterial( other_neutron ).get() ==
+                 neutron_model.getMaterial( 1 ).get() );
+
+  // The material of a void cell cannot be returned
+  MonteCarlo::PhotonState photon( 1ull );
+  photon.embedInModel( filled_model );
+  photon.setEnergy( 1.0 );
+
+  FRENSIE_CHECK( photon_model.isCellVoid( photon ) );
+  FRENSIE_CHECK_THROW( photon_model.getMaterial( photon ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the macroscopic total cross section can be returned
 FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_neutron_mode )
@@ -94,6 +94,32 @@ void DecoupledPhotonProductionNuclide::collideSurvivalBias(
   Nuclide::collideSurvivalBias( neutron, bank );
 }
 
+// Collide with a neutron at the temperature
+void DecoupledPhotonProductionNuclide::collideAnalogue(
+                                              NeutronState& neutron,
+                                              ParticleBank& bank,
+                                              const double temperature ) const
+{
+  // Sample photon production stochastically before the neutron's state changes
+  this->samplePhotonProductionReaction( neutron, bank );
+
+  // Call the base class implementation for the neutron
+  Nuclide::collideAnalogue( neutron, bank, temperature );
+}
+
+// Collide with a neutron and survival bias at the temperature
+void DecoupledPhotonProductionNuclide::collideSurvivalBias(
+                                              NeutronState& neutron,
+                                              ParticleBank& bank,
+                                              const double temperature ) const
+{
+  // Sample photon production stochastically before the neutron's state changes
+  this->samplePhotonProductionReaction( neutron, bank );
+
+  // Call the base class implementation for the neutron
+  Nuclide::collideSurvivalBias( neutron, bank, temperature );
+}
+
 // Sample a decoupled photon production reaction
 void DecoupledPhotonProductionNuclide::samplePhotonProductionReaction(
                                                    const NeutronState& neutron,
@@ -64,6 +64,16 @@ public:
   //! Collide with a neutron and survival bias
   void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Collide with a neutron at the temperature
+  void collideAnalogue( NeutronState& neutron,
+                        ParticleBank& bank,
+                        const double temperature ) const override;
+
+  //! Collide with a neutron and survival bias at the temperature
+  void collideSurvivalBias( NeutronState& neutron,
+                            ParticleBank& bank,
+                            const double temperature ) const override;
+
   // Get total photon production cross section
   double getTotalPhotonProductionCrossSection( const double energy ) const;
 
@@ -127,6 +127,18 @@ double EnergyDependentNeutronMultiplicityReaction::getAverageNumberOfEmittedPart
 void EnergyDependentNeutronMultiplicityReaction::react(
 						     NeutronState& neutron,
 						     ParticleBank& bank ) const
+{
+  this->react( neutron, bank, this->getTemperature() );
+}
+
+// Simulate the reaction with a target at the temperature (in MeV)
+/*! \details The temperature is used by the scattering distribution to sample
+ * the target velocity.
+ */
+void EnergyDependentNeutronMultiplicityReaction::react(
+                                              NeutronState& neutron,
+                                              ParticleBank& bank,
+                                              const double temperature ) const
 {
   neutron.incrementCollisionNumber();
 
@@ -140,8 +152,7 @@ void EnergyDependentNeutronMultiplicityReaction::react(
     std::shared_ptr<NeutronState> new_neutron(
 				    new NeutronState( neutron, true, false ) );
 
-    d_scattering_distribution->scatterParticle( *new_neutron,
-						this->getTemperature() );
+    d_scattering_distribution->scatterParticle( *new_neutron, temperature );
 
     // Add the new neutron to the bank
     bank.push( new_neutron, this->getReactionType() );
@@ -152,8 +163,7 @@ void EnergyDependentNeutronMultiplicityReaction::react(
   // zero or between zero and one
   if( num_outgoing_neutrons > 0u )
   {
-    d_scattering_distribution->scatterParticle( neutron,
-						this->getTemperature() );
+    d_scattering_distribution->scatterParticle( neutron, temperature );
   }
   else
     neutron.setAsGone();
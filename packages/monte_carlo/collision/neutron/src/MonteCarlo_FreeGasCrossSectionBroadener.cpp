@@ -0,0 +1,217 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FreeGasCrossSectionBroadener.cpp
+//! \author Alex Robinson
+//! \brief  The free gas cross section broadener class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_FreeGasCrossSectionBroadener.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The kernel width (in units of the reduced speed)
+const double FreeGasCrossSectionBroadener::s_kernel_width = 6.0;
+
+// Constructor
+FreeGasCrossSectionBroadener::FreeGasCrossSectionBroadener(
+               const std::shared_ptr<const std::vector<double> >& energy_grid,
+               const double atomic_weight_ratio )
+  : d_energy_grid( energy_grid ),
+    d_atomic_weight_ratio( atomic_weight_ratio )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.get() );
+  testPrecondition( energy_grid->size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid->begin(),
+                                                      energy_grid->end() ) );
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+}
+
+// Return the broadened cross section at the energy (MeV)
+/*! \details The temperature difference must be in units of MeV (kT). The
+ * cross section evaluator will be called with a grid energy and the index of
+ * the grid bin that the energy falls in (the last grid point will be
+ * evaluated with the last bin index).
+ */
+double FreeGasCrossSectionBroadener::getBroadenedCrossSection(
+                          const double energy,
+                          const double temperature_difference,
+                          const CrossSectionEvaluator& cross_section ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the temperature difference is valid
+  testPrecondition( temperature_difference > 0.0 );
+
+  const std::vector<double>& energy_grid = *d_energy_grid;
+
+  // Calculate the reduced speed of the neutron and the kernel limits
+  const double alpha = d_atomic_weight_ratio/temperature_difference;
+  const double y = std::sqrt( alpha*energy );
+
+  const double x_min = std::max( y - s_kernel_width, 0.0 );
+  const double x_max = y + s_kernel_width;
+
+  const double energy_min = x_min*x_min/alpha;
+  const double energy_max = x_max*x_max/alpha;
+
+  // Find the first grid point above the lower kernel limit
+  size_t grid_index =
+    std::upper_bound( energy_grid.begin(), energy_grid.end(), energy_min ) -
+    energy_grid.begin();
+
+  const size_t last_bin_index = energy_grid.size() - 2;
+
+  double lower_cross_section;
+
+  if( grid_index > 0 )
+  {
+    lower_cross_section =
+      cross_section( energy_grid[grid_index-1],
+                     std::min( grid_index-1, last_bin_index ) );
+  }
+  else
+    lower_cross_section = cross_section( energy_grid[0], 0 );
+
+  // Integrate the kernel over each linear segment of the cross section
+  double segment_start = energy_min;
+  double integral = 0.0;
+
+  while( segment_start < energy_max )
+  {
+    double segment_end;
+    double constant_coeff = lower_cross_section;
+    double linear_coeff = 0.0;
+
+    // The cross section is constant below the first grid point
+    if( grid_index == 0 )
+      segment_end = std::min( energy_grid[0], energy_max );
+
+    // The cross section is constant above the last grid point
+    else if( grid_index == energy_grid.size() )
+      segment_end = energy_max;
+
+    // The cross section is linear between grid points
+    else
+    {
+      const double upper_cross_section =
+        cross_section( energy_grid[grid_index],
+                       std::min( grid_index-1, last_bin_index ) );
+
+      // Discontinuities (repeated grid points) do not have a segment
+      if( energy_grid[grid_index] > energy_grid[grid_index-1] )
+      {
+        linear_coeff = (upper_cross_section - lower_cross_section)/
+          (energy_grid[grid_index] - energy_grid[grid_index-1]);
+
+        constant_coeff =
+          lower_cross_section - linear_coeff*energy_grid[grid_index-1];
+      }
+
+      segment_end = std::min( energy_grid[grid_index], energy_max );
+
+      lower_cross_section = upper_cross_section;
+    }
+
+    if( segment_end > segment_start )
+    {
+      integral += FreeGasCrossSectionBroadener::integrateSegment(
+                                           std::sqrt( alpha*segment_start ),
+                                           std::sqrt( alpha*segment_end ),
+                                           y,
+                                           constant_coeff,
+                                           linear_coeff/alpha );
+    }
+
+    segment_start = segment_end;
+
+    ++grid_index;
+  }
+
+  return integral/(y*y*std::sqrt( Utility::PhysicalConstants::pi ));
+}
+
+// Integrate the kernel over a linear cross section segment
+/*! \details The cross section is a + c*x^2 where x is the reduced speed of
+ * the target. The kernel is x^2*(exp(-(x-y)^2) - exp(-(x+y)^2)).
+ */
+double FreeGasCrossSectionBroadener::integrateSegment(
+                                             const double x_start,
+                                             const double x_end,
+                                             const double y,
+                                             const double constant_coeff,
+                                             const double quadratic_coeff )
+{
+  return FreeGasCrossSectionBroadener::integrateKernelTerm( x_start - y,
+                                                            x_end - y,
+                                                            y,
+                                                            constant_coeff,
+                                                            quadratic_coeff ) -
+    FreeGasCrossSectionBroadener::integrateKernelTerm( x_start + y,
+                                                       x_end + y,
+                                                       -y,
+                                                       constant_coeff,
+                                                       quadratic_coeff );
+}
+
+// Integrate a kernel term over a linear cross section segment
+/*! \details The integral of (z+s)^2*(a + c*(z+s)^2)*exp(-z^2) will be
+ * calculated with the closed form moments of exp(-z^2).
+ */
+double FreeGasCrossSectionBroadener::integrateKernelTerm(
+                                             const double z_start,
+                                             const double z_end,
+                                             const double shift,
+                                             const double constant_coeff,
+                                             const double quadratic_coeff )
+{
+  const double a = constant_coeff;
+  const double c = quadratic_coeff;
+  const double s = shift;
+  const double s2 = s*s;
+
+  // Calculate the moments of exp(-z^2) (H_0 to H_4)
+  double h0;
+
+  // Use the complementary error function to avoid cancellation in the tails
+  if( z_start >= 0.0 )
+    h0 = std::erfc( z_start ) - std::erfc( z_end );
+  else if( z_end <= 0.0 )
+    h0 = std::erfc( -z_end ) - std::erfc( -z_start );
+  else
+    h0 = std::erf( z_end ) - std::erf( z_start );
+
+  h0 *= std::sqrt( Utility::PhysicalConstants::pi )/2;
+
+  const double exp_start = std::exp( -z_start*z_start );
+  const double exp_end = std::exp( -z_end*z_end );
+
+  const double h1 = (exp_start - exp_end)/2;
+  const double h2 = (z_start*exp_start - z_end*exp_end)/2 + h0/2;
+  const double h3 =
+    (z_start*z_start*exp_start - z_end*z_end*exp_end)/2 + h1;
+  const double h4 = (z_start*z_start*z_start*exp_start -
+                     z_end*z_end*z_end*exp_end)/2 + 1.5*h2;
+
+  return (a*s2 + c*s2*s2)*h0 +
+    (2*a*s + 4*c*s2*s)*h1 +
+    (a + 6*c*s2)*h2 +
+    4*c*s*h3 +
+    c*h4;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FreeGasCrossSectionBroadener.cpp
+//---------------------------------------------------------------------------//
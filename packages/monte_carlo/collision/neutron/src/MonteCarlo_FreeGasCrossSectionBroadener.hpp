@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FreeGasCrossSectionBroadener.hpp
+//! \author Alex Robinson
+//! \brief  The free gas cross section broadener class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FREE_GAS_CROSS_SECTION_BROADENER_HPP
+#define MONTE_CARLO_FREE_GAS_CROSS_SECTION_BROADENER_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <functional>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The free gas cross section broadener class
+ * \details This class calculates the Doppler broadened value of a cross
+ * section at a single energy on demand using the exact free gas kernel
+ * (the kernel used by SIGMA1). The cross section must be linearly
+ * interpolated on the energy grid. It will be treated as constant below the
+ * first grid point and above the last grid point. Because the free gas
+ * kernels of two temperatures combine into the kernel of the summed
+ * temperature, a cross section that is tabulated at a temperature T0 can be
+ * broadened to a temperature T by using the temperature difference T-T0. The
+ * kernel is truncated where its value drops below exp(-36) of the maximum
+ * value, so only the grid points close to the energy of interest will be
+ * evaluated.
+ */
+class FreeGasCrossSectionBroadener
+{
+
+public:
+
+  //! The cross section evaluator type (energy, energy grid bin index)
+  typedef std::function<double(const double,const size_t)>
+  CrossSectionEvaluator;
+
+  //! Constructor
+  FreeGasCrossSectionBroadener(
+         const std::shared_ptr<const std::vector<double> >& energy_grid,
+         const double atomic_weight_ratio );
+
+  //! Destructor
+  ~FreeGasCrossSectionBroadener()
+  { /* ... */ }
+
+  //! Return the broadened cross section at the energy (MeV)
+  double getBroadenedCrossSection(
+                         const double energy,
+                         const double temperature_difference,
+                         const CrossSectionEvaluator& cross_section ) const;
+
+private:
+
+  // Integrate the kernel over a linear cross section segment
+  static double integrateSegment( const double x_start,
+                                  const double x_end,
+                                  const double y,
+                                  const double constant_coeff,
+                                  const double quadratic_coeff );
+
+  // Integrate a kernel term over a linear cross section segment
+  static double integrateKernelTerm( const double z_start,
+                                     const double z_end,
+                                     const double shift,
+                                     const double constant_coeff,
+                                     const double quadratic_coeff );
+
+  // The kernel width (in units of the reduced speed)
+  static const double s_kernel_width;
+
+  // The energy grid
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+
+  // The atomic weight ratio
+  double d_atomic_weight_ratio;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FREE_GAS_CROSS_SECTION_BROADENER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FreeGasCrossSectionBroadener.hpp
+//---------------------------------------------------------------------------//
@@ -13,20 +13,179 @@
 #include "MonteCarlo_NeutronMaterial.hpp"
 #include "MonteCarlo_MaterialHelpers.hpp"
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
 // Constructor
+/*! \details The nuclides will be evaluated at the temperature of their data.
+ */
 NeutronMaterial::NeutronMaterial(
                                 const MaterialId id,
                                 const double density,
                                 const NuclideNameMap& nuclide_name_map,
                                 const std::vector<double>& nuclide_fractions,
                                 const std::vector<std::string>& nuclide_names )
-  : BaseType( id, density, nuclide_name_map, nuclide_fractions, nuclide_names )
+  : NeutronMaterial( id,
+                     density,
+                     nuclide_name_map,
+                     nuclide_fractions,
+                     nuclide_names,
+                     0.0 )
 { /* ... */ }
 
+// Constructor (nuclides evaluated at the material temperature)
+/*! \details The temperature must be in units of MeV (kT). The nuclide cross
+ * sections will be broadened to the material temperature when they are
+ * evaluated (see MonteCarlo::Nuclide::getTotalCrossSection) and the target
+ * velocity will be sampled at the material temperature. The nuclide data
+ * cannot be evaluated at a lower temperature so an exception will be thrown
+ * if the temperature of any nuclide is higher than the material temperature.
+ * A temperature of zero indicates that the nuclides should be evaluated at
+ * the temperature of their data.
+ */
+NeutronMaterial::NeutronMaterial(
+                                const MaterialId id,
+                                const double density,
+                                const NuclideNameMap& nuclide_name_map,
+                                const std::vector<double>& nuclide_fractions,
+                                const std::vector<std::string>& nuclide_names,
+                                const double temperature )
+  : BaseType( id, density, nuclide_name_map, nuclide_fractions, nuclide_names ),
+    d_temperature( temperature ),
+    d_total_cs_evaluation_functor(
+              std::bind<double>( static_cast<double(Nuclide::*)(const double, const double) const>(&Nuclide::getTotalCrossSection),
+                                 std::placeholders::_1,
+                                 std::placeholders::_2,
+                                 temperature ) ),
+    d_absorption_cs_evaluation_functor(
+              std::bind<double>( static_cast<double(Nuclide::*)(const double, const double) const>(&Nuclide::getAbsorptionCrossSection),
+                                 std::placeholders::_1,
+                                 std::placeholders::_2,
+                                 temperature ) )
+{
+  // Make sure the temperature is valid
+  testPrecondition( !QT::isnaninf( temperature ) );
+  testPrecondition( temperature >= 0.0 );
+
+  if( temperature > 0.0 )
+    this->checkNuclideTemperatures();
+}
+
+// Check that the nuclides can be evaluated at the temperature
+void NeutronMaterial::checkNuclideTemperatures() const
+{
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    const Nuclide& nuclide = this->getScatteringCenter( i );
+
+    TEST_FOR_EXCEPTION( d_temperature < nuclide.getTemperature(),
+                        std::runtime_error,
+                        "The temperature of material " << this->getId() <<
+                        " (" << d_temperature << " MeV) is below the "
+                        "temperature of nuclide " << nuclide.getName() <<
+                        " (" << nuclide.getTemperature() << " MeV)! "
+                        "Nuclide data can only be broadened to a higher "
+                        "temperature." );
+
+    if( d_temperature == nuclide.getTemperature() )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "NeutronMaterial",
+                                  "The temperature of material "
+                                  << this->getId() << " is the temperature "
+                                  "of nuclide " << nuclide.getName() <<
+                                  " - the nuclide cross sections will not "
+                                  "be broadened!" );
+    }
+  }
+}
+
+// Return the macroscopic total cross section (1/cm)
+double NeutronMaterial::getMacroscopicTotalCrossSection(
+                                                    const double energy ) const
+{
+  return this->getMacroscopicCrossSection( energy,
+                                           d_total_cs_evaluation_functor );
+}
+
+// Return the macroscopic absorption cross section (1/cm)
+double NeutronMaterial::getMacroscopicAbsorptionCrossSection(
+                                                    const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+                                          energy,
+                                          d_absorption_cs_evaluation_functor );
+}
+
+// Return the survival probability
+double NeutronMaterial::getSurvivalProbability( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  double survival_prob;
+  double total_cross_sec = this->getMacroscopicTotalCrossSection( energy );
+
+  if( total_cross_sec > 0.0 )
+  {
+    survival_prob = 1.0 -
+      this->getMacroscopicAbsorptionCrossSection( energy )/total_cross_sec;
+  }
+  else
+    survival_prob = 1.0;
+
+  // Make sure the survival probability is valid
+  testPostcondition( !QT::isnaninf( survival_prob ) );
+  testPostcondition( survival_prob >= 0.0 );
+  testPostcondition( survival_prob <= 1.0 );
+
+  return survival_prob;
+}
+
+// Return the macroscopic cross section (1/cm) for a specific reaction
+double NeutronMaterial::getMacroscopicReactionCrossSection(
+                                        const double energy,
+                                        const ReactionEnumType reaction ) const
+{
+  return this->getMacroscopicCrossSection(
+                              energy,
+                              std::bind<double>( static_cast<double (Nuclide::*)(const double, const double, const ReactionEnumType) const>(&Nuclide::getReactionCrossSection),
+                                                 std::placeholders::_1,
+                                                 std::placeholders::_2,
+                                                 d_temperature,
+                                                 reaction ) );
+}
+
+// Collide with a nuclide
+void NeutronMaterial::collideAnalogue( ParticleStateType& neutron,
+                                       ParticleBank& bank ) const
+{
+  size_t nuclide_index =
+    this->sampleCollisionScatteringCenterImpl( neutron.getEnergy(),
+                                               d_total_cs_evaluation_functor );
+
+  this->getScatteringCenter( nuclide_index ).collideAnalogue( neutron,
+                                                              bank,
+                                                              d_temperature );
+}
+
+// Collide with a nuclide and survival bias
+void NeutronMaterial::collideSurvivalBias( ParticleStateType& neutron,
+                                           ParticleBank& bank ) const
+{
+  size_t nuclide_index =
+    this->sampleCollisionScatteringCenterImpl( neutron.getEnergy(),
+                                               d_total_cs_evaluation_functor );
+
+  this->getScatteringCenter( nuclide_index ).collideSurvivalBias(
+                                                               neutron,
+                                                               bank,
+                                                               d_temperature );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
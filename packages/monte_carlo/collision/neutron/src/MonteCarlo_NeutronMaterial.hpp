@@ -21,7 +21,15 @@
 
 namespace MonteCarlo{
 
-//! The neutron material class
+/*! The neutron material class
+ * \details A material can be given a temperature that is higher than the
+ * temperature of its nuclide data. The nuclide cross sections will then be
+ * broadened to the material temperature when they are evaluated (during
+ * distance to collision sampling and collisions) and the target motion will
+ * be sampled at the material temperature. No broadened copies of the nuclide
+ * data are created so memory use does not grow with the number of material
+ * temperatures.
+ */
 class NeutronMaterial : public Material<Nuclide>
 {
   // Typedef for QuantityTraits
@@ -57,9 +65,53 @@ public:
                    const std::vector<double>& nuclide_fractions,
                    const std::vector<std::string>& nuclide_names );
 
+  //! Constructor (nuclides evaluated at the material temperature)
+  NeutronMaterial( const MaterialId id,
+                   const double density,
+                   const NuclideNameMap& nuclide_name_map,
+                   const std::vector<double>& nuclide_fractions,
+                   const std::vector<std::string>& nuclide_names,
+                   const double temperature );
+
   //! Destructor
   ~NeutronMaterial()
   { /* ... */ }
+
+  //! Return the macroscopic total cross section (1/cm)
+  double getMacroscopicTotalCrossSection( const double energy ) const;
+
+  //! Return the macroscopic absorption cross section (1/cm)
+  double getMacroscopicAbsorptionCrossSection( const double energy ) const;
+
+  //! Return the survival probability
+  double getSurvivalProbability( const double energy ) const;
+
+  //! Return the macroscopic cross section (1/cm) for a specific reaction
+  double getMacroscopicReactionCrossSection(
+                                       const double energy,
+                                       const ReactionEnumType reaction ) const;
+
+  //! Collide with a nuclide
+  void collideAnalogue( ParticleStateType& neutron,
+                        ParticleBank& bank ) const override;
+
+  //! Collide with a nuclide and survival bias
+  void collideSurvivalBias( ParticleStateType& neutron,
+                            ParticleBank& bank ) const override;
+
+private:
+
+  // Check that the nuclides can be evaluated at the temperature
+  void checkNuclideTemperatures() const;
+
+  // The material temperature (MeV)
+  double d_temperature;
+
+  // The Nuclide::getTotalCrossSection function wrapper
+  MicroscopicCrossSectionEvaluationFunctor d_total_cs_evaluation_functor;
+
+  // The Nuclide::getAbsorptionCrossSection function wrapper
+  MicroscopicCrossSectionEvaluationFunctor d_absorption_cs_evaluation_functor;
 };
 
 } // end MonteCarlo namespace
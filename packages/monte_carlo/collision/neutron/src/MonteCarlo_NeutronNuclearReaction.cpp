@@ -11,6 +11,17 @@
 
 namespace MonteCarlo{
 
+// Simulate the reaction with a target at the temperature (in MeV)
+/*! \details Only reactions that sample the target motion depend on the
+ * temperature. By default the temperature will be ignored.
+ */
+void NeutronNuclearReaction::react( NeutronState& neutron,
+                                    ParticleBank& bank,
+                                    const double ) const
+{
+  this->react( neutron, bank );
+}
+
 EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,false> );
 EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,true> );
 
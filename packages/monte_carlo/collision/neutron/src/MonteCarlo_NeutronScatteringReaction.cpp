@@ -79,6 +79,17 @@ unsigned NeutronScatteringReaction::getNumberOfEmittedParticles(
 // Simulate the reaction
 void NeutronScatteringReaction::react( NeutronState& neutron,
 				       ParticleBank& bank ) const
+{
+  this->react( neutron, bank, this->getTemperature() );
+}
+
+// Simulate the reaction with a target at the temperature (in MeV)
+/*! \details The temperature is used by the scattering distribution to sample
+ * the target velocity.
+ */
+void NeutronScatteringReaction::react( NeutronState& neutron,
+                                       ParticleBank& bank,
+                                       const double temperature ) const
 {
   neutron.incrementCollisionNumber();
 
@@ -92,16 +103,14 @@ void NeutronScatteringReaction::react( NeutronState& neutron,
     std::shared_ptr<NeutronState> new_neutron(
 				   new NeutronState( neutron, true, false ) );
 
-    d_scattering_distribution->scatterParticle( *new_neutron,
-						this->getTemperature() );
+    d_scattering_distribution->scatterParticle( *new_neutron, temperature );
 
     // Add the new neutron to the bank
     bank.push( new_neutron, this->getReactionType() );
   }
 
   // Scatter the "original" neutron
-  d_scattering_distribution->scatterParticle( neutron,
-					      this->getTemperature() );
+  d_scattering_distribution->scatterParticle( neutron, temperature );
 }
 
 } // end MonteCarlo namespace
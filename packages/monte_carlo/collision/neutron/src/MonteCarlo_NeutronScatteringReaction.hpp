@@ -63,6 +63,11 @@ public:
   //! Simulate the reaction
   void react( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Simulate the reaction with a target at the temperature (in MeV)
+  void react( NeutronState& neutron,
+              ParticleBank& bank,
+              const double temperature ) const override;
+
 private:
 
   // The neutron multiplicity
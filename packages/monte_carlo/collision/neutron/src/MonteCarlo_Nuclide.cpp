@@ -119,7 +119,9 @@ Nuclide::Nuclide(
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
     d_total_reaction(),
-    d_total_absorption_reaction()
+    d_total_absorption_reaction(),
+    d_broadener( new FreeGasCrossSectionBroadener( energy_grid,
+                                                   atomic_weight_ratio ) )
 {
   // Make sure the atomic weight ratio is valid
   testPrecondition( atomic_weight_ratio > 0.0 );
@@ -226,12 +228,38 @@ double Nuclide::getTotalCrossSection( const double energy ) const
   return d_total_reaction->getCrossSection( energy );
 }
 
+// Return the total cross section at the desired energy and temperature
+/*! \details The temperature must be in units of MeV (kT). The cross section
+ * cannot be broadened to a temperature that is lower than the temperature of
+ * the nuclide data - the stored cross section will be returned instead.
+ */
+double Nuclide::getTotalCrossSection( const double energy,
+                                      const double temperature ) const
+{
+  return this->getReactionCrossSection( energy,
+                                        temperature,
+                                        *d_total_reaction );
+}
+
 // Return the total absorption cross section at the desired energy
 double Nuclide::getAbsorptionCrossSection( const double energy ) const
 {
   return d_total_absorption_reaction->getCrossSection( energy );
 }
 
+// Return the total absorption cross section at the energy and temperature
+/*! \details The temperature must be in units of MeV (kT). The cross section
+ * cannot be broadened to a temperature that is lower than the temperature of
+ * the nuclide data - the stored cross section will be returned instead.
+ */
+double Nuclide::getAbsorptionCrossSection( const double energy,
+                                           const double temperature ) const
+{
+  return this->getReactionCrossSection( energy,
+                                        temperature,
+                                        *d_total_absorption_reaction );
+}
+
 // Return the survival probability at the desired energy
 double Nuclide::getSurvivalProbability( const double energy ) const
 {
@@ -282,6 +310,89 @@ double Nuclide::getReactionCrossSection(
   }
 }
 
+// Return the cross section for a specific reaction at the temperature
+/*! \details The temperature must be in units of MeV (kT). The cross section
+ * cannot be broadened to a temperature that is lower than the temperature of
+ * the nuclide data - the stored cross section will be returned instead.
+ */
+double Nuclide::getReactionCrossSection(
+                                    const double energy,
+                                    const double temperature,
+                                    const NuclearReactionType reaction ) const
+{
+  const NeutronNuclearReaction* nuclear_reaction =
+    this->getReaction( reaction );
+
+  // If the reaction does not exist for the nuclide, return 0
+  if( nuclear_reaction )
+  {
+    return this->getReactionCrossSection( energy,
+                                          temperature,
+                                          *nuclear_reaction );
+  }
+  else
+    return 0.0;
+}
+
+// Return the reaction
+const NeutronNuclearReaction* Nuclide::getReaction(
+                                   const NuclearReactionType reaction ) const
+{
+  switch( reaction )
+  {
+  case N__TOTAL_REACTION:
+    return d_total_reaction.get();
+  case N__TOTAL_ABSORPTION_REACTION:
+    return d_total_absorption_reaction.get();
+  default:
+    ConstReactionMap::const_iterator nuclear_reaction =
+      d_scattering_reactions.find( reaction );
+
+    if( nuclear_reaction != d_scattering_reactions.end() )
+      return nuclear_reaction->second.get();
+
+    nuclear_reaction = d_absorption_reactions.find( reaction );
+
+    if( nuclear_reaction != d_absorption_reactions.end() )
+      return nuclear_reaction->second.get();
+
+    nuclear_reaction = d_miscellaneous_reactions.find( reaction );
+
+    if( nuclear_reaction != d_miscellaneous_reactions.end() )
+      return nuclear_reaction->second.get();
+    else
+      return NULL;
+  }
+}
+
+// Return the reaction cross section at the temperature
+/*! \details All reactions are defined on the nuclide energy grid so the
+ * reaction cross section can be broadened by evaluating it at the grid
+ * points.
+ */
+double Nuclide::getReactionCrossSection(
+                                 const double energy,
+                                 const double temperature,
+                                 const NeutronNuclearReaction& reaction ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  if( temperature > d_temperature )
+  {
+    return d_broadener->getBroadenedCrossSection(
+                       energy,
+                       temperature - d_temperature,
+                       [&reaction]( const double grid_energy,
+                                    const size_t bin_index ){
+                         return reaction.getCrossSection( grid_energy,
+                                                          bin_index ); } );
+  }
+  else
+    return reaction.getCrossSection( energy );
+}
+
 // Return the absorption reaction types
 void Nuclide::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 {
@@ -394,6 +505,95 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
     neutron.setAsGone();
 }
 
+// Collide with a neutron at the temperature
+/*! \details The temperature must be in units of MeV (kT). The reaction will
+ * be sampled using the cross sections broadened to the temperature and the
+ * target motion will be sampled at the temperature. At or below the
+ * temperature of the nuclide data the standard collision will be done.
+ */
+void Nuclide::collideAnalogue( NeutronState& neutron,
+                               ParticleBank& bank,
+                               const double temperature ) const
+{
+  if( temperature > d_temperature )
+  {
+    double total_cross_section =
+      this->getTotalCrossSection( neutron.getEnergy(), temperature );
+
+    double scaled_random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      total_cross_section;
+
+    double absorption_cross_section =
+      this->getAbsorptionCrossSection( neutron.getEnergy(), temperature );
+
+    // Check if absorption occurs
+    if( scaled_random_number < absorption_cross_section )
+    {
+      this->sampleReaction( scaled_random_number,
+                            temperature,
+                            d_absorption_reactions,
+                            neutron,
+                            bank );
+
+      // Set the neutron as gone regardless of the reaction that occurred.
+      neutron.setAsGone();
+    }
+    else
+    {
+      this->sampleReaction( scaled_random_number - absorption_cross_section,
+                            temperature,
+                            d_scattering_reactions,
+                            neutron,
+                            bank );
+    }
+  }
+  else
+    Nuclide::collideAnalogue( neutron, bank );
+}
+
+// Collide with a neutron and survival bias at the temperature
+/*! \details The temperature must be in units of MeV (kT). The survival
+ * probability and the scattering reaction will be calculated using the cross
+ * sections broadened to the temperature and the target motion will be
+ * sampled at the temperature. At or below the temperature of the nuclide
+ * data the standard collision will be done.
+ */
+void Nuclide::collideSurvivalBias( NeutronState& neutron,
+                                   ParticleBank& bank,
+                                   const double temperature ) const
+{
+  if( temperature > d_temperature )
+  {
+    double random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    double total_cross_section =
+      this->getTotalCrossSection( neutron.getEnergy(), temperature );
+
+    double scattering_cross_section = total_cross_section -
+      this->getAbsorptionCrossSection( neutron.getEnergy(), temperature );
+
+    double survival_prob = scattering_cross_section/total_cross_section;
+
+    // Multiply the neutron's weight by the survival probability
+    if( survival_prob > 0.0 )
+    {
+      neutron.multiplyWeight( survival_prob );
+
+      this->sampleReaction( random_number*scattering_cross_section,
+                            temperature,
+                            d_scattering_reactions,
+                            neutron,
+                            bank );
+    }
+    else
+      neutron.setAsGone();
+  }
+  else
+    Nuclide::collideSurvivalBias( neutron, bank );
+}
+
 // Calculate the total absorption cross section
 void Nuclide::calculateTotalAbsorptionReaction(
           const std::shared_ptr<const std::vector<double> >& energy_grid,
@@ -541,6 +741,42 @@ void Nuclide::sampleAbsorptionReaction( const double scaled_random_number,
   nuclear_reaction->second->react( neutron, bank );
 }
 
+// Sample a reaction at the temperature
+// NOTE: The scaled random number must be a random number multiplied by the
+//       sum of the reaction cross sections at the temperature.
+void Nuclide::sampleReaction( const double scaled_random_number,
+                              const double temperature,
+                              const ConstReactionMap& reactions,
+                              NeutronState& neutron,
+                              ParticleBank& bank ) const
+{
+  double partial_cross_section = 0.0;
+
+  ConstReactionMap::const_iterator nuclear_reaction, nuclear_reaction_end;
+
+  nuclear_reaction = reactions.begin();
+  nuclear_reaction_end = reactions.end();
+
+  while( nuclear_reaction != nuclear_reaction_end )
+  {
+    partial_cross_section +=
+      this->getReactionCrossSection( neutron.getEnergy(),
+                                     temperature,
+                                     *nuclear_reaction->second );
+
+    if( scaled_random_number < partial_cross_section )
+      break;
+
+    ++nuclear_reaction;
+  }
+
+  // Make sure a reaction was selected
+  testPostcondition( nuclear_reaction != nuclear_reaction_end );
+
+  // Undergo the reaction selected with the target at the temperature
+  nuclear_reaction->second->react( neutron, bank, temperature );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -16,6 +16,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_NeutronNuclearReaction.hpp"
+#include "MonteCarlo_FreeGasCrossSectionBroadener.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Set.hpp"
@@ -25,7 +26,14 @@ namespace MonteCarlo{
 
 /*! The nuclide class
  * \details This is the base class for all nuclides. No unresolved
- * resonance data is stored in this base class.
+ * resonance data is stored in this base class. The cross sections can also
+ * be evaluated at a temperature that is higher than the temperature of the
+ * nuclide data. The broadened cross sections are calculated on demand (see
+ * MonteCarlo::FreeGasCrossSectionBroadener) so a single nuclide can be used
+ * at any number of temperatures. The nuclide can also be collided with at
+ * a higher temperature, in which case the broadened cross sections are used
+ * to sample the reaction and the target motion is sampled at the higher
+ * temperature.
  */
 class Nuclide
 {
@@ -106,9 +114,17 @@ public:
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energy and temperature
+  double getTotalCrossSection( const double energy,
+                               const double temperature ) const;
+
   //! Return the total absorption cross section at the desired energy
   double getAbsorptionCrossSection( const double energy ) const;
 
+  //! Return the total absorption cross section at the energy and temperature
+  double getAbsorptionCrossSection( const double energy,
+                                    const double temperature ) const;
+
   //! Return the survival probability at the desired energy
   double getSurvivalProbability( const double energy ) const;
 
@@ -116,6 +132,11 @@ public:
   double getReactionCrossSection( const double energy,
 				  const NuclearReactionType reaction ) const;
 
+  //! Return the cross section for a specific reaction at the temperature
+  double getReactionCrossSection( const double energy,
+                                  const double temperature,
+                                  const NuclearReactionType reaction ) const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -134,6 +155,16 @@ public:
   //! Collide with a neutron and survival bias
   virtual void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const;
 
+  //! Collide with a neutron at the temperature
+  virtual void collideAnalogue( NeutronState& neutron,
+                                ParticleBank& bank,
+                                const double temperature ) const;
+
+  //! Collide with a neutron and survival bias at the temperature
+  virtual void collideSurvivalBias( NeutronState& neutron,
+                                    ParticleBank& bank,
+                                    const double temperature ) const;
+
 private:
 
   // Set the default absorption reaction types
@@ -152,6 +183,15 @@ private:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher );
 
+  // Return the reaction
+  const NeutronNuclearReaction* getReaction(
+                                  const NuclearReactionType reaction ) const;
+
+  // Return the reaction cross section at the temperature
+  double getReactionCrossSection( const double energy,
+                                  const double temperature,
+                                  const NeutronNuclearReaction& reaction ) const;
+
   // Sample an absorption reaction
   void sampleAbsorptionReaction( const double scaled_random_number,
 				 NeutronState& neutron,
@@ -162,6 +202,13 @@ private:
 				 NeutronState& neutron,
 				 ParticleBank& bank ) const;
 
+  // Sample a reaction at the temperature
+  void sampleReaction( const double scaled_random_number,
+                       const double temperature,
+                       const ConstReactionMap& reactions,
+                       NeutronState& neutron,
+                       ParticleBank& bank ) const;
+
   // Reactions that should be treated as absorption
   static std::unordered_set<NuclearReactionType> absorption_reaction_types;
 
@@ -200,6 +247,9 @@ private:
 
   // Miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
+
+  // The cross section broadener
+  std::unique_ptr<const FreeGasCrossSectionBroadener> d_broadener;
 };
 
 } // end MonteCarlo namespace
@@ -6,9 +6,13 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <functional>
+
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
 #include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_ScatteringCenterTableLoader.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -23,12 +27,17 @@ NuclideFactory::NuclideFactory(
                  const ScatteringCenterNameSet& nuclide_names,
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
-                 const bool verbose )
+                 const bool verbose,
+                 const std::shared_ptr<Data::ACETableCache>& ace_table_cache )
+  : d_nuclide_name_map()
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
-  
-  // Create each nuclide in the set
+
+  // Register each nuclide in the set with the table that it uses
+  ScatteringCenterTableLoader<Nuclide,Data::NuclearDataProperties>
+    table_loader;
+
   ScatteringCenterNameSet::const_iterator nuclide_name =
     nuclide_names.begin();
 
@@ -57,18 +66,18 @@ NuclideFactory::NuclideFactory(
     if( nuclear_data_properties.fileType() ==
         Data::NuclearDataProperties::ACE_FILE )
     {
-      // Initialize the nuclear table name map for ACE files
-      if( d_nuclear_table_name_map.find( Data::NuclearDataProperties::ACE_FILE ) ==
-          d_nuclear_table_name_map.end() )
-      {
-        d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE];
-      }
-      
-      this->createNuclideFromACETable( data_directory,
-                                       *nuclide_name,
-                                       atomic_weight_ratio,
-                                       nuclear_data_properties,
-                                       properties );
+      boost::filesystem::path ace_file_path = data_directory;
+      ace_file_path /= nuclear_data_properties.filePath();
+      ace_file_path.make_preferred();
+
+      table_loader.registerScatteringCenter(
+                   *nuclide_name,
+                   "ACE:" + nuclear_data_properties.tableName(),
+                   "ACE cross section table " +
+                   nuclear_data_properties.tableName() + " from " +
+                   ace_file_path.string(),
+                   atomic_weight_ratio,
+                   nuclear_data_properties );
     }
     else
     {
@@ -83,10 +92,26 @@ NuclideFactory::NuclideFactory(
     ++nuclide_name;
   }
 
+  // Load the tables and create the nuclides
+  table_loader.loadTables(
+                    std::bind<void>( &NuclideFactory::createNuclideFromACETable,
+                                     std::cref( data_directory ),
+                                     std::placeholders::_1,
+                                     std::placeholders::_2,
+                                     std::cref( properties ),
+                                     std::cref( ace_table_cache ),
+                                     std::placeholders::_3 ),
+                    verbose );
+
+  table_loader.addScatteringCentersToNameMap( d_nuclide_name_map );
+
   // Make sure that every nuclide has been created
   testPostcondition( d_nuclide_name_map.size() == nuclide_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading nuclide data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading nuclide data tables ("
+                            << table_loader.getNumberOfTables() <<
+                            " tables in " << table_loader.getLoadTime() <<
+                            " s)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -97,48 +122,37 @@ void NuclideFactory::createNuclideMap( NuclideNameMap& nuclide_map ) const
 }
 
 // Create a nuclide from an ACE table
+/*! \details This function will be called concurrently.
+ */
 void NuclideFactory::createNuclideFromACETable(
                             const boost::filesystem::path& data_directory,
-                            const std::string& nuclide_name,
-                            const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
-                            const SimulationProperties& properties )
+                            const double atomic_weight_ratio,
+                            const SimulationProperties& properties,
+                            const std::shared_ptr<Data::ACETableCache>&
+                            ace_table_cache,
+                            std::shared_ptr<const Nuclide>& nuclide )
 {
-  // Check if the table has already been loaded
-  if( d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].find( data_properties.tableName() ) ==
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE].end() )
-  {
-    // Construct the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION( " Loading ACE cross section table "
-                                        << data_properties.tableName() <<
-                                        " from " << ace_file_path.string() <<
-                                        " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-
-    // The ACE table reader
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
-    
-    // The XSS neutron data extractor
-    Data::XSSNeutronDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-				         ace_file_handler.getTableXSSArray() );
-
-    // Initialize the new nuclide
-    NuclideNameMap::mapped_type& nuclide = d_nuclide_name_map[nuclide_name];
-
-    // Create the new nuclide
-    NuclideACEFactory::createNuclide(
+  // Construct the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // The ACE table reader
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true,
+                                         ace_table_cache );
+
+  // The XSS neutron data extractor
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  // Create the new nuclide
+  NuclideACEFactory::createNuclide(
                           xss_data_extractor,
                           data_properties.tableName(),
                           data_properties.zaid().atomicNumber(),
@@ -148,22 +162,6 @@ void NuclideFactory::createNuclideFromACETable(
                           data_properties.evaluationTemperatureInMeV().value(),
                           properties,
                           nuclide );
-
-    // Cache the new nuclide in the table name map
-    d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()] = nuclide;
-    
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_nuclide_name_map[nuclide_name] =
-      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()];
-  }
 }
 
 } // end MonteCarlo namespace
@@ -21,6 +21,7 @@
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 
@@ -38,12 +39,20 @@ public:
   //! The scattering center name set
   typedef MaterialDefinitionDatabase::ScatteringCenterNameSet ScatteringCenterNameSet;
 
-  //! Constructor
+  /*! Constructor
+   *
+   * \details The nuclear data tables are loaded concurrently (see
+   * MonteCarlo::ScatteringCenterTableLoader). If an ACE table cache is
+   * given the ACE tables will be restored from it if possible (see
+   * Data::ACETableCache).
+   */
   NuclideFactory( const boost::filesystem::path& data_directory,
                   const ScatteringCenterNameSet& nuclide_names,
                   const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                   const SimulationProperties& properties,
-                  const bool verbose = false );
+                  const bool verbose = false,
+                  const std::shared_ptr<Data::ACETableCache>& ace_table_cache =
+                  std::shared_ptr<Data::ACETableCache>() );
 
   //! Destructor
   ~NuclideFactory()
@@ -55,22 +64,17 @@ public:
 private:
 
   // Create a nuclide from an ACE table
-  void createNuclideFromACETable(
+  static void createNuclideFromACETable(
                             const boost::filesystem::path& data_directory,
-                            const std::string& nuclide_name,
-                            const double atomic_weight_ratio,
                             const Data::NuclearDataProperties& data_properties,
-                            const SimulationProperties& properties );
+                            const double atomic_weight_ratio,
+                            const SimulationProperties& properties,
+                            const std::shared_ptr<Data::ACETableCache>&
+                            ace_table_cache,
+                            std::shared_ptr<const Nuclide>& nuclide );
 
   // The nuclide  map
   NuclideNameMap d_nuclide_name_map;
-
-  // The table map (used to prevent multiple reads of the same data file
-  std::map<Data::NuclearDataProperties::FileType,NuclideNameMap>
-  d_nuclear_table_name_map;
-
-  // Verbose nuclide construction
-  bool d_verbose;
 };
 
 } // end MonteCarlo namespace
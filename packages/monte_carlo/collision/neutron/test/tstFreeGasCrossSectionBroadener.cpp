@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFreeGasCrossSectionBroadener.cpp
+//! \author Alex Robinson
+//! \brief  Free gas cross section broadener unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_FreeGasCrossSectionBroadener.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const std::vector<double> > energy_grid;
+
+std::unique_ptr<const MonteCarlo::FreeGasCrossSectionBroadener> broadener;
+
+const double atomic_weight_ratio = 2.0;
+
+const double temperature_difference = 2.53010e-8;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a constant cross section can be broadened
+FRENSIE_UNIT_TEST( FreeGasCrossSectionBroadener,
+                   getBroadenedCrossSection_constant )
+{
+  MonteCarlo::FreeGasCrossSectionBroadener::CrossSectionEvaluator
+    cross_section = []( const double, const size_t ){ return 2.0; };
+
+  // The broadened cross section has an analytic form
+  const double pi = Utility::PhysicalConstants::pi;
+
+  for( double energy : {1e-9, 2.53010e-8, 1e-6, 1e-3} )
+  {
+    const double y =
+      std::sqrt( atomic_weight_ratio*energy/temperature_difference );
+
+    const double expected_cross_section =
+      2.0*((1.0 + 1.0/(2*y*y))*std::erf( y ) +
+           std::exp( -y*y )/(std::sqrt( pi )*y));
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                broadener->getBroadenedCrossSection( energy,
+                                                     temperature_difference,
+                                                     cross_section ),
+                expected_cross_section,
+                1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a linear cross section can be broadened
+FRENSIE_UNIT_TEST( FreeGasCrossSectionBroadener,
+                   getBroadenedCrossSection_linear )
+{
+  // The cross section is 1.0 + 1e5*E
+  MonteCarlo::FreeGasCrossSectionBroadener::CrossSectionEvaluator
+    cross_section = []( const double energy, const size_t bin_index )
+    {
+      FRENSIE_CHECK( bin_index < energy_grid->size() - 1 );
+
+      return 1.0 + 1e5*energy;
+    };
+
+  // Away from the grid limits (y >> 1) the broadened cross section has an
+  // analytic form
+  const double kt = temperature_difference/atomic_weight_ratio;
+
+  for( double energy : {1e-6, 1e-5, 1e-4} )
+  {
+    const double y2 = energy/kt;
+
+    const double expected_cross_section =
+      1.0*(1.0 + 0.5/y2) + 1e5*(energy + 3*kt + 0.75*kt/y2);
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                broadener->getBroadenedCrossSection( energy,
+                                                     temperature_difference,
+                                                     cross_section ),
+                expected_cross_section,
+                1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a 1/v cross section is not changed by broadening
+FRENSIE_UNIT_TEST( FreeGasCrossSectionBroadener,
+                   getBroadenedCrossSection_one_over_v )
+{
+  MonteCarlo::FreeGasCrossSectionBroadener::CrossSectionEvaluator
+    cross_section = []( const double energy, const size_t )
+    {
+      return 1.0/std::sqrt( energy );
+    };
+
+  for( double energy : {1e-7, 1e-6, 1e-5} )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                broadener->getBroadenedCrossSection( energy,
+                                                     temperature_difference,
+                                                     cross_section ),
+                1.0/std::sqrt( energy ),
+                1e-6 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create a log spaced grid from 1e-11 MeV to 20 MeV
+  std::shared_ptr<std::vector<double> > grid( new std::vector<double> );
+
+  for( size_t i = 0; i <= 10000; ++i )
+    grid->push_back( 1e-11*std::pow( 2e12, i/10000.0 ) );
+
+  grid->back() = 20.0;
+
+  energy_grid = grid;
+
+  broadener.reset( new MonteCarlo::FreeGasCrossSectionBroadener(
+                                          energy_grid, atomic_weight_ratio ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstFreeGasCrossSectionBroadener.cpp
+//---------------------------------------------------------------------------//
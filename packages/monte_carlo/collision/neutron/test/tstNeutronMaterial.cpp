@@ -28,6 +28,8 @@ using boost::units::si::kelvin;
 
 std::shared_ptr<const MonteCarlo::NeutronMaterial> material;
 
+std::shared_ptr<const MonteCarlo::NeutronMaterial> hot_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -245,6 +247,81 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the nuclides of a material can be evaluated at a temperature
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, constructor_temperature )
+{
+  const double temperature = 10*2.53010e-8;
+
+  const MonteCarlo::Nuclide& nuclide =
+    *material->getScatteringCenter( "H-1_293.6K" );
+
+  // The nuclide data is shared (no broadened copy is created)
+  FRENSIE_CHECK_EQUAL( hot_material->getScatteringCenter( "H-1_293.6K" ).get(),
+                       &nuclide );
+  FRENSIE_CHECK_EQUAL( hot_material->getNumberDensity(),
+                       material->getNumberDensity() );
+
+  // The macroscopic cross sections use the broadened cross sections
+  FRENSIE_CHECK_FLOATING_EQUALITY( hot_material->getMacroscopicTotalCrossSection( 1.0e-8 ),
+                                   hot_material->getNumberDensity()*
+                                   nuclide.getTotalCrossSection( 1.0e-8, temperature ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( hot_material->getMacroscopicAbsorptionCrossSection( 1.0e-8 ),
+                                   hot_material->getNumberDensity()*
+                                   nuclide.getAbsorptionCrossSection( 1.0e-8, temperature ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( hot_material->getMacroscopicReactionCrossSection( 1.0e-8, MonteCarlo::N__N_ELASTIC_REACTION ),
+                                   hot_material->getNumberDensity()*
+                                   nuclide.getReactionCrossSection( 1.0e-8, temperature, MonteCarlo::N__N_ELASTIC_REACTION ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( hot_material->getSurvivalProbability( 1.0e-8 ),
+                                   1.0 - nuclide.getAbsorptionCrossSection( 1.0e-8, temperature )/
+                                   nuclide.getTotalCrossSection( 1.0e-8, temperature ),
+                                   1e-12 );
+  FRENSIE_CHECK( hot_material->getMacroscopicTotalCrossSection( 1.0e-8 ) !=
+                 material->getMacroscopicTotalCrossSection( 1.0e-8 ) );
+
+  // The survival biased collision weight uses the broadened cross sections
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.0e-8 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  hot_material->collideSurvivalBias( neutron, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(),
+                                   hot_material->getSurvivalProbability( 1.0e-8 ),
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( neutron.getCollisionNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  MonteCarlo::NeutronMaterial::NuclideNameMap nuclide_map;
+  nuclide_map["H-1_293.6K"] = material->getScatteringCenter( "H-1_293.6K" );
+
+  // A material at the nuclide data temperature uses the nuclide data
+  MonteCarlo::NeutronMaterial data_temperature_material( 1,
+                                                         -1.0,
+                                                         nuclide_map,
+                                                         {-1.0},
+                                                         {"H-1_293.6K"},
+                                                         2.53010e-8 );
+
+  FRENSIE_CHECK_EQUAL( data_temperature_material.getMacroscopicTotalCrossSection( 1.0e-8 ),
+                       material->getMacroscopicTotalCrossSection( 1.0e-8 ) );
+
+  // A material that is colder than the nuclide data cannot be created
+  FRENSIE_CHECK_THROW( MonteCarlo::NeutronMaterial( 1,
+                                                    -1.0,
+                                                    nuclide_map,
+                                                    {-1.0},
+                                                    {"H-1_293.6K"},
+                                                    1e-10 ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -318,6 +395,13 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                    nuclide_fractions,
                                                    nuclide_names ) );
 
+  hot_material.reset( new MonteCarlo::NeutronMaterial( 1,
+                                                       -1.0,
+                                                       nuclide_map,
+                                                       nuclide_fractions,
+                                                       nuclide_names,
+                                                       10*2.53010e-8 ) );
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -14,6 +14,7 @@
 #include "MonteCarlo_NeutronNuclearReactionACEFactory.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSNeutronDataExtractor.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -164,6 +165,43 @@ FRENSIE_UNIT_TEST( Nuclide_hydrogen, getAbsorptionCrossSection )
   FRENSIE_CHECK_EQUAL( cross_section, 2.722354e-5 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cross sections can be returned at a temperature
+FRENSIE_UNIT_TEST( Nuclide_hydrogen, getCrossSection_temperature )
+{
+  // The cross sections will not be broadened at the data temperature
+  FRENSIE_CHECK_EQUAL( h1_nuclide->getTotalCrossSection( 1.0e-6, 2.53010e-8 ),
+                       h1_nuclide->getTotalCrossSection( 1.0e-6 ) );
+  FRENSIE_CHECK_EQUAL( h1_nuclide->getAbsorptionCrossSection( 1.0e-6, 2.53010e-8 ),
+                       h1_nuclide->getAbsorptionCrossSection( 1.0e-6 ) );
+  FRENSIE_CHECK_EQUAL( h1_nuclide->getReactionCrossSection( 1.0e-6, 1e-10, MonteCarlo::N__N_ELASTIC_REACTION ),
+                       h1_nuclide->getReactionCrossSection( 1.0e-6, MonteCarlo::N__N_ELASTIC_REACTION ) );
+
+  // The hydrogen absorption cross section is approximately 1/v, which is
+  // preserved by broadening
+  FRENSIE_CHECK_FLOATING_EQUALITY( h1_nuclide->getAbsorptionCrossSection( 2.53010e-8, 10*2.53010e-8 ),
+                                   h1_nuclide->getAbsorptionCrossSection( 2.53010e-8 ),
+                                   1e-2 );
+
+  // Broadening has a negligible effect on the smooth fast cross sections
+  FRENSIE_CHECK_FLOATING_EQUALITY( h1_nuclide->getTotalCrossSection( 1.0, 10*2.53010e-8 ),
+                                   h1_nuclide->getTotalCrossSection( 1.0 ),
+                                   1e-6 );
+
+  // The total cross section is the sum of the broadened reaction cross
+  // sections
+  const double temperature = 10*2.53010e-8;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( h1_nuclide->getTotalCrossSection( 1.0e-8, temperature ),
+                                   h1_nuclide->getReactionCrossSection( 1.0e-8, temperature, MonteCarlo::N__N_ELASTIC_REACTION ) +
+                                   h1_nuclide->getReactionCrossSection( 1.0e-8, temperature, MonteCarlo::N__GAMMA_REACTION ),
+                                   1e-5 );
+
+  // Reactions that do not exist have a zero cross section
+  FRENSIE_CHECK_EQUAL( h1_nuclide->getReactionCrossSection( 1.0e-8, temperature, MonteCarlo::N__FISSION_REACTION ),
+                       0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the survival probability can be returned
 FRENSIE_UNIT_TEST( Nuclide_hydrogen, getSurvivalProbability )
@@ -345,6 +383,71 @@ FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideSurvivalBias)
   std::cout << neutron << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+// Check that a neutron can collide with a nuclide at a temperature
+FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideAnalogue_temperature )
+{
+  const double temperature = 10*2.53010e-8;
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.0e-8 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Absorption will be sampled using the broadened cross sections
+  std::vector<double> fake_stream( 1 );
+  fake_stream[0] = 0.999*
+    h1_nuclide->getAbsorptionCrossSection( 1.0e-8, temperature )/
+    h1_nuclide->getTotalCrossSection( 1.0e-8, temperature );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  h1_nuclide->collideAnalogue( neutron, bank, temperature );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK( neutron.isGone() );
+  FRENSIE_CHECK_EQUAL( neutron.getWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can collide with a nuclide at a temperature
+FRENSIE_UNIT_TEST( Nuclide_hydrogen, collideSurvivalBias_temperature )
+{
+  const double temperature = 10*2.53010e-8;
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.0e-8 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  h1_nuclide->collideSurvivalBias( neutron, bank, temperature );
+
+  // The survival probability is calculated from the broadened cross sections
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(),
+                                   1.0 - h1_nuclide->getAbsorptionCrossSection( 1.0e-8, temperature )/
+                                   h1_nuclide->getTotalCrossSection( 1.0e-8, temperature ),
+                                   1e-12 );
+  FRENSIE_CHECK( neutron.getWeight() !=
+                 h1_nuclide->getSurvivalProbability( 1.0e-8 ) );
+  FRENSIE_CHECK_EQUAL( neutron.getCollisionNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  // At the data temperature the standard collision is done
+  neutron.setEnergy( 1.03125e-11 );
+  neutron.setWeight( 1.0 );
+
+  h1_nuclide->collideSurvivalBias( neutron, bank, 2.53010e-8 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 0.98581348192787, 1e-14 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a neutron can collide with a nuclide
 // FRENSIE_UNIT_TEST( Nuclide_oxygen, collideSurvivalBias)
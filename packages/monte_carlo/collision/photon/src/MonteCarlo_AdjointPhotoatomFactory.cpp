@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_AdjointPhotoatomFactory.hpp"
 #include "MonteCarlo_AdjointPhotoatomNativeFactory.hpp"
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
@@ -139,9 +140,11 @@ void AdjointPhotoatomFactory::createAdjointPhotoatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the aepr data container
+    // Create the aepr data container - only the data blocks that are needed
+    // will be loaded
     Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+      data_container( native_file_path,
+                      getAdjointPhotoatomicDataBlockManifest( properties ) );
 
     // Initialize the new adjoint photoatom
     AdjointPhotoatomNameMap::mapped_type& adjoint_photoatom =
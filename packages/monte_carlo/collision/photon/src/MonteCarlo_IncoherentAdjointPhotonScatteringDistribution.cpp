@@ -13,7 +13,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentAdjointPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_AdjointPhotonKinematicsHelpers.hpp"
-#include "MonteCarlo_AdjointPhotonProbeState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeRay.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -703,18 +703,15 @@ void IncoherentAdjointPhotonScatteringDistribution::createProbeParticle(
       this->evaluatePDF( adjoint_photon.getEnergy(), scattering_angle_cosine )*
       pdf_conversion;
 
-    // Create the probe with the desired energy and modified weight
-    std::shared_ptr<AdjointPhotonProbeState> probe(
-			       new AdjointPhotonProbeState( adjoint_photon ) );
-
-    probe->setEnergy( energy_of_interest );
-    probe->rotateDirection( scattering_angle_cosine,
-			    this->sampleAzimuthalAngle() );
-    probe->multiplyWeight( weight_mult );
-    probe->activate();
+    // Create the probe ray with the desired energy and modified weight
+    const AdjointPhotonProbeRay probe_ray( adjoint_photon,
+                                           energy_of_interest,
+                                           scattering_angle_cosine,
+                                           this->sampleAzimuthalAngle(),
+                                           weight_mult );
 
     // Add the probe to the bank
-    bank.push( probe );
+    bank.push( adjoint_photon, probe_ray );
   }
 }
 
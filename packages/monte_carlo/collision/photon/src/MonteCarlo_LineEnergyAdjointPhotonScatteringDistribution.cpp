@@ -8,7 +8,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_LineEnergyAdjointPhotonScatteringDistribution.hpp"
-#include "MonteCarlo_AdjointPhotonProbeState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeRay.hpp"
 #include "Utility_UniformDistribution.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -266,18 +266,18 @@ void LineEnergyAdjointPhotonScatteringDistribution::createProbeParticles(
       const double weight_mult =
         d_energy_dist->evaluatePDF( (*d_critical_line_energies)[i] );
 
-      // Create a probe with the desired energy and modified weight
-      std::shared_ptr<AdjointPhotonProbeState> probe(
-                               new AdjointPhotonProbeState( adjoint_photon ) );
+      // Create a probe ray with the desired energy and modified weight
+      const double scattering_angle_cosine =
+        this->samplePolarScatteringAngleCosine();
 
-      probe->setEnergy( (*d_critical_line_energies)[i] );
-      probe->rotateDirection( this->samplePolarScatteringAngleCosine(),
-                              this->sampleAzimuthalAngle() );
-      probe->multiplyWeight( weight_mult );
-      probe->activate();
+      const AdjointPhotonProbeRay probe_ray( adjoint_photon,
+                                             (*d_critical_line_energies)[i],
+                                             scattering_angle_cosine,
+                                             this->sampleAzimuthalAngle(),
+                                             weight_mult );
 
       // Add the probe to the bank
-      bank.push( probe );
+      bank.push( adjoint_photon, probe_ray );
     }
   }
 }
@@ -6,14 +6,20 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <functional>
+
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomFactory.hpp"
+#include "MonteCarlo_ScatteringCenterTableLoader.hpp"
 #include "MonteCarlo_PhotoatomACEFactory.hpp"
 #include "MonteCarlo_PhotoatomNativeFactory.hpp"
+#include "MonteCarlo_ElectronPhotonRelaxationDataBlockManifest.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSEPRDataExtractor.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_ToStringTraits.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -29,15 +35,17 @@ PhotoatomFactory::PhotoatomFactory(
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
-       const bool verbose )
-  : d_photoatom_name_map(),
-    d_photoatomic_table_name_map(),
-    d_verbose( verbose )
+       const bool verbose,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache )
+  : d_photoatom_name_map()
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load photoatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
-  
-  // Create each photoatom in the set
+
+  // Register each photoatom in the set with the table that it uses
+  ScatteringCenterTableLoader<Photoatom,Data::PhotoatomicDataProperties>
+    table_loader;
+
   ScatteringCenterNameSet::const_iterator photoatom_name =
     photoatom_names.begin();
 
@@ -63,39 +71,35 @@ PhotoatomFactory::PhotoatomFactory(
     const Data::PhotoatomicDataProperties& photoatom_data_properties =
       photoatom_definition.getPhotoatomicDataProperties( &atomic_weight );
 
+    boost::filesystem::path data_file_path = data_directory;
+    data_file_path /= photoatom_data_properties.filePath();
+    data_file_path.make_preferred();
+
     if( photoatom_data_properties.fileType() ==
         Data::PhotoatomicDataProperties::ACE_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for ACE_EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::ACE_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE];
-      }
-        
-      this->createPhotoatomFromACETable( data_directory,
-                                         *photoatom_name,
-                                         atomic_weight,
-                                         photoatom_data_properties,
-                                         atomic_relaxation_model_factory,
-                                         properties );
+      table_loader.registerScatteringCenter(
+                     *photoatom_name,
+                     "ACE_EPR:" + photoatom_data_properties.tableName(),
+                     "ACE EPR photoatomic cross section table " +
+                     photoatom_data_properties.tableName() + " from " +
+                     data_file_path.string(),
+                     atomic_weight,
+                     photoatom_data_properties );
     }
     else if( photoatom_data_properties.fileType() ==
              Data::PhotoatomicDataProperties::Native_EPR_FILE )
     {
-      // Initialize the photoatomic table name map for Native EPR files
-      if( d_photoatomic_table_name_map.find( Data::PhotoatomicDataProperties::Native_EPR_FILE ) ==
-          d_photoatomic_table_name_map.end() )
-      {
-        d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE];
-      }
-      
-      this->createPhotoatomFromNativeTable( data_directory,
-                                            *photoatom_name,
-                                            atomic_weight,
-                                            photoatom_data_properties,
-                                            atomic_relaxation_model_factory,
-                                            properties );
+      table_loader.registerScatteringCenter(
+                     *photoatom_name,
+                     "Native_EPR:" + photoatom_data_properties.filePath().string(),
+                     "native EPR cross section table (v " +
+                     Utility::toString( photoatom_data_properties.fileVersion() ) +
+                     ") for " +
+                     Utility::toString( photoatom_data_properties.atom() ) +
+                     " from " + data_file_path.string(),
+                     atomic_weight,
+                     photoatom_data_properties );
     }
     else
     {
@@ -110,10 +114,27 @@ PhotoatomFactory::PhotoatomFactory(
     ++photoatom_name;
   }
 
+  // Load the tables and create the photoatoms
+  table_loader.loadTables(
+                  std::bind<void>( &PhotoatomFactory::createPhotoatomFromTable,
+                                   std::cref( data_directory ),
+                                   std::cref( atomic_relaxation_model_factory ),
+                                   std::cref( properties ),
+                                   std::cref( ace_table_cache ),
+                                   std::placeholders::_1,
+                                   std::placeholders::_2,
+                                   std::placeholders::_3 ),
+                  verbose );
+
+  table_loader.addScatteringCentersToNameMap( d_photoatom_name_map );
+
   // Make sure that every photoatom has been created
   testPostcondition( d_photoatom_name_map.size() == photoatom_names.size() );
 
-  FRENSIE_LOG_NOTIFICATION( "Finished loading photoatom data tables." );
+  FRENSIE_LOG_NOTIFICATION( "Finished loading photoatom data tables ("
+                            << table_loader.getNumberOfTables() <<
+                            " tables in " << table_loader.getLoadTime() <<
+                            " s)." );
   FRENSIE_FLUSH_ALL_LOGS();
 }
 
@@ -124,159 +145,169 @@ void PhotoatomFactory::createPhotoatomMap(
   photoatom_map = d_photoatom_name_map;
 }
 
+// Create a photoatom from a table
+/*! \details This function will be called concurrently.
+ */
+void PhotoatomFactory::createPhotoatomFromTable(
+                        const boost::filesystem::path& data_directory,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        const std::shared_ptr<Data::ACETableCache>&
+                        ace_table_cache,
+                        const Data::PhotoatomicDataProperties& data_properties,
+                        const double atomic_weight,
+                        std::shared_ptr<const Photoatom>& photoatom )
+{
+  if( data_properties.fileType() ==
+      Data::PhotoatomicDataProperties::ACE_EPR_FILE )
+  {
+    PhotoatomFactory::createPhotoatomFromACETable(
+                                               data_directory,
+                                               atomic_weight,
+                                               data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               ace_table_cache,
+                                               photoatom );
+  }
+  else
+  {
+    PhotoatomFactory::createPhotoatomFromNativeTable(
+                                               data_directory,
+                                               atomic_weight,
+                                               data_properties,
+                                               atomic_relaxation_model_factory,
+                                               properties,
+                                               photoatom );
+  }
+}
+
 // Create a photoatom from an ACE table
 void PhotoatomFactory::createPhotoatomFromACETable(
 			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
 			const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                        const SimulationProperties& properties,
+                        const std::shared_ptr<Data::ACETableCache>&
+                        ace_table_cache,
+                        std::shared_ptr<const Photoatom>& photoatom )
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].find( data_properties.tableName() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE].end() )
+  // Construct the the path to the data file
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  // Create the ACEFileHandler
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true,
+                                         ace_table_cache );
+
+  // Create the XSS data extractor
+  Data::XSSEPRDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  // Create the atomic relaxation model - the factory cache is shared so the
+  // models must be created in table order (see ScatteringCenterTableLoader)
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  // Exceptions cannot propagate out of the ordered block - the error will be
+  // rethrown once the block has been left
+  std::string relaxation_model_error_message;
+
+  #pragma omp ordered
   {
-    // Construct the the path to the data file
-    boost::filesystem::path ace_file_path = data_directory;
-    ace_file_path /= data_properties.filePath();
-    ace_file_path.make_preferred();
-    
-    if( d_verbose )
+    try{
+      atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                                 xss_data_extractor,
+                                 atomic_relaxation_model,
+                                 properties.getMinPhotonEnergy(),
+                                 properties.getMinElectronEnergy(),
+                                 properties.isAtomicRelaxationModeOn( PHOTON ) );
+    }
+    catch( const std::exception& exception )
     {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                   " Loading ACE EPR photoatomic cross section "
-                                   "table " << data_properties.tableName() <<
-                                   " from " << ace_file_path.string() <<
-                                   " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
+      relaxation_model_error_message = exception.what();
     }
-    
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-					   data_properties.tableName(),
-					   data_properties.fileStartLine(),
-					   true );
-
-    // Create the XSS data extractor
-    Data::XSSEPRDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-					 ace_file_handler.getTableXSSArray() );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                               xss_data_extractor,
-                               atomic_relaxation_model,
-                               properties.getMinPhotonEnergy(),
-                               properties.getMinElectronEnergy(),
-			       properties.isAtomicRelaxationModeOn( PHOTON ) );
-
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
-
-    // Create the new photoatom
-    PhotoatomACEFactory::createPhotoatom(
-                                        xss_data_extractor,
+  }
+
+  TEST_FOR_EXCEPTION( !relaxation_model_error_message.empty(),
+                      std::runtime_error,
+                      "Could not create the atomic relaxation model: "
+                      << relaxation_model_error_message );
+
+  // Create the new photoatom
+  PhotoatomACEFactory::createPhotoatom( xss_data_extractor,
                                         data_properties.tableName(),
                                         atomic_weight,
                                         atomic_relaxation_model,
                                         properties,
                                         photoatom );
-    
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()] = photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::ACE_EPR_FILE][data_properties.tableName()];
-  }
 }
 
 // Create a photoatom from a Native table
 void PhotoatomFactory::createPhotoatomFromNativeTable(
 			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
                         const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties )
+                        const SimulationProperties& properties,
+                        std::shared_ptr<const Photoatom>& photoatom )
 {
-  // Check if the table has already been loaded
-  if( d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].find( data_properties.filePath().string() ) ==
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE].end() )
-  {
-    // Construct the path to the native file
-    boost::filesystem::path native_file_path = data_directory;
-    native_file_path /= data_properties.filePath();
-    native_file_path.make_preferred();
+  // Construct the path to the native file
+  boost::filesystem::path native_file_path = data_directory;
+  native_file_path /= data_properties.filePath();
+  native_file_path.make_preferred();
+
+  // Create the epr data container - only the data blocks that are needed
+  // will be loaded
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( native_file_path,
+                    getPhotoatomicDataBlockManifest( properties ) );
 
-    if( d_verbose )
+  // Create the atomic relaxation model - the factory cache is shared so the
+  // models must be created in table order (see ScatteringCenterTableLoader)
+  std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
+
+  // Exceptions cannot propagate out of the ordered block - the error will be
+  // rethrown once the block has been left
+  std::string relaxation_model_error_message;
+
+  #pragma omp ordered
+  {
+    try{
+      atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
+                                 data_container,
+                                 atomic_relaxation_model,
+                                 properties.getMinPhotonEnergy(),
+                                 properties.getMinElectronEnergy(),
+                                 properties.isAtomicRelaxationModeOn( PHOTON ) );
+    }
+    catch( const std::exception& exception )
     {
-      FRENSIE_LOG_PARTIAL_NOTIFICATION(
-                                " Loading native EPR cross section table "
-                                "(v " << data_properties.fileVersion() <<
-                                ") for " << data_properties.atom() <<
-                                " from " << native_file_path.string() <<
-                                " ... " );
-      FRENSIE_FLUSH_ALL_LOGS();
+      relaxation_model_error_message = exception.what();
     }
-    
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
-
-    // Create the atomic relaxation model
-    std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
-
-    atomic_relaxation_model_factory->createAndCacheAtomicRelaxationModel(
-                               data_container,
-                               atomic_relaxation_model,
-                               properties.getMinPhotonEnergy(),
-                               properties.getMinElectronEnergy(),
-                               properties.isAtomicRelaxationModeOn( PHOTON ) );
-
-    // Initialize the new photoatom
-    PhotoatomNameMap::mapped_type& photoatom =
-      d_photoatom_name_map[photoatom_name];
-
-    // Create the new photoatom
-    PhotoatomNativeFactory::createPhotoatom(
-                                           data_container,
+  }
+
+  TEST_FOR_EXCEPTION( !relaxation_model_error_message.empty(),
+                      std::runtime_error,
+                      "Could not create the atomic relaxation model: "
+                      << relaxation_model_error_message );
+
+  // Create the new photoatom
+  PhotoatomNativeFactory::createPhotoatom( data_container,
                                            data_properties.filePath().string(),
                                            atomic_weight,
                                            atomic_relaxation_model,
                                            properties,
                                            photoatom );
-
-    // Cache the new photoatom in the table name map
-    d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()] = photoatom;
-
-    if( d_verbose )
-    {
-      FRENSIE_LOG_NOTIFICATION( "done." );
-      FRENSIE_FLUSH_ALL_LOGS();
-    }
-  }
-  // The table has already been loaded
-  else
-  {
-    d_photoatom_name_map[photoatom_name] =
-      d_photoatomic_table_name_map[Data::PhotoatomicDataProperties::Native_EPR_FILE][data_properties.filePath().string()];
-  }
 }
 
 } // end MonteCarlo namespace
@@ -23,6 +23,7 @@
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACETableCache.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
 
@@ -40,7 +41,13 @@ public:
   //! The scattering center name set
   typedef MaterialDefinitionDatabase::ScatteringCenterNameSet ScatteringCenterNameSet;
 
-  //! Constructor
+  /*! Constructor
+   *
+   * \details The photoatomic data tables are loaded concurrently (see
+   * MonteCarlo::ScatteringCenterTableLoader). If an ACE table cache is
+   * given the ACE tables will be restored from it if possible (see
+   * Data::ACETableCache).
+   */
   PhotoatomFactory(
        const boost::filesystem::path& data_directory,
        const ScatteringCenterNameSet& photoatom_names,
@@ -48,7 +55,9 @@ public:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
-       const bool verbose = false );
+       const bool verbose = false,
+       const std::shared_ptr<Data::ACETableCache>& ace_table_cache =
+       std::shared_ptr<Data::ACETableCache>() );
 
   //! Destructor
   ~PhotoatomFactory()
@@ -59,35 +68,42 @@ public:
 
 private:
 
+  // Create a photoatom from a table
+  static void createPhotoatomFromTable(
+                        const boost::filesystem::path& data_directory,
+                        const std::shared_ptr<AtomicRelaxationModelFactory>&
+                        atomic_relaxation_model_factory,
+                        const SimulationProperties& properties,
+                        const std::shared_ptr<Data::ACETableCache>&
+                        ace_table_cache,
+                        const Data::PhotoatomicDataProperties& data_properties,
+                        const double atomic_weight,
+                        std::shared_ptr<const Photoatom>& photoatom );
+
   // Create a photoatom from an ACE table
-  void createPhotoatomFromACETable(
+  static void createPhotoatomFromACETable(
                         const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
 			const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties );
+                        const SimulationProperties& properties,
+                        const std::shared_ptr<Data::ACETableCache>&
+                        ace_table_cache,
+                        std::shared_ptr<const Photoatom>& photoatom );
 
   // Create a photoatom from a Native table
-  void createPhotoatomFromNativeTable(
+  static void createPhotoatomFromNativeTable(
 			const boost::filesystem::path& data_directory,
-                        const std::string& photoatom_name,
                         const double atomic_weight,
                         const Data::PhotoatomicDataProperties& data_properties,
                         const std::shared_ptr<AtomicRelaxationModelFactory>&
                         atomic_relaxation_model_factory,
-                        const SimulationProperties& properties );
+                        const SimulationProperties& properties,
+                        std::shared_ptr<const Photoatom>& photoatom );
 
   // The photoatom map
   PhotoatomNameMap d_photoatom_name_map;
-
-  // The table map (used to prevent multiple reads of the same data file)
-  std::map<Data::PhotoatomicDataProperties::FileType,PhotoatomNameMap>
-  d_photoatomic_table_name_map;
-
-  // Verbose photoatom construction
-  bool d_verbose;
 };
 
 } // end MonteCarlo namespace
@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <algorithm>
+#include <stdexcept>
 
 // FRENSIE Includes
 #include "MonteCarlo_Photoatom.hpp"
@@ -27,6 +28,144 @@
 
 std::shared_ptr<const MonteCarlo::Photoatom> ace_photoatom;
 
+std::shared_ptr<const MonteCarlo::Photoatom> test_photoatom;
+
+std::vector<MonteCarlo::PhotoatomicReactionType> reaction_history;
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+// Photoatomic reaction with a constant cross section that records each
+// reaction that it simulates
+class TestPhotoatomicReaction : public MonteCarlo::PhotoatomicReaction
+{
+
+public:
+
+  TestPhotoatomicReaction( const MonteCarlo::PhotoatomicReactionType type,
+                           const double cross_section )
+    : d_type( type ),
+      d_cross_section( cross_section )
+  { /* ... */ }
+
+  ~TestPhotoatomicReaction()
+  { /* ... */ }
+
+  using MonteCarlo::PhotoatomicReaction::react;
+
+  bool isEnergyWithinEnergyGrid( const double ) const override
+  { return true; }
+
+  double getThresholdEnergy() const override
+  { return 1e-3; }
+
+  double getMaxEnergy() const override
+  { return 20.0; }
+
+  double getCrossSection( const double ) const override
+  { return d_cross_section; }
+
+  double getCrossSection( const double, const size_t ) const override
+  { return d_cross_section; }
+
+  unsigned getNumberOfEmittedPhotons( const double ) const override
+  { return 0u; }
+
+  unsigned getNumberOfEmittedElectrons( const double ) const override
+  { return 0u; }
+
+  unsigned getNumberOfEmittedPositrons( const double ) const override
+  { return 0u; }
+
+  MonteCarlo::PhotoatomicReactionType getReactionType() const override
+  { return d_type; }
+
+  void react( MonteCarlo::PhotonState&,
+              MonteCarlo::ParticleBank&,
+              Data::SubshellType& shell_of_interaction ) const override
+  {
+    shell_of_interaction = Data::INVALID_SUBSHELL;
+
+    reaction_history.push_back( d_type );
+  }
+
+protected:
+
+  const double* getEnergyGridHead() const override
+  { return &d_cross_section; }
+
+private:
+
+  MonteCarlo::PhotoatomicReactionType d_type;
+
+  double d_cross_section;
+};
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Sample a reaction by evaluating each reaction cross section while
+// iterating over the reaction map (reference reaction sampling)
+MonteCarlo::PhotoatomicReactionType sampleReferenceReaction(
+                   const MonteCarlo::Photoatom::ConstReactionMap& reactions,
+                   const double energy,
+                   const double scaled_random_number )
+{
+  double partial_cross_section = 0.0;
+
+  MonteCarlo::Photoatom::ConstReactionMap::const_iterator reaction =
+    reactions.begin();
+
+  while( reaction != reactions.end() )
+  {
+    partial_cross_section += reaction->second->getCrossSection( energy );
+
+    if( scaled_random_number < partial_cross_section )
+      break;
+
+    ++reaction;
+  }
+
+  if( reaction == reactions.end() )
+    throw std::logic_error( "A reference reaction could not be sampled!" );
+
+  return reaction->first;
+}
+
+// Sum the reaction cross sections
+double sumReferenceCrossSections(
+                   const MonteCarlo::Photoatom::ConstReactionMap& reactions,
+                   const double energy )
+{
+  double cross_section = 0.0;
+
+  MonteCarlo::Photoatom::ConstReactionMap::const_iterator reaction =
+    reactions.begin();
+
+  while( reaction != reactions.end() )
+  {
+    cross_section += reaction->second->getCrossSection( energy );
+
+    ++reaction;
+  }
+
+  return cross_section;
+}
+
+// The random numbers used to check the reaction sampling
+std::vector<double> getReactionSamplingRandomNumbers()
+{
+  std::vector<double> random_numbers;
+
+  for( size_t i = 0; i < 32; ++i )
+    random_numbers.push_back( i/32.0 );
+
+  random_numbers.push_back( 1.0 - 1e-15 );
+
+  return random_numbers;
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -629,6 +768,135 @@ FRENSIE_UNIT_TEST( Photoatom, core_constructor )
 		 ace_photoatom->getNuclearAbsorptionCrossSection( 20.0 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the reactions sampled in an analogue collision match the
+// reactions sampled by evaluating each reaction cross section in turn
+FRENSIE_UNIT_TEST( Photoatom, collideAnalogue_reaction_sampling )
+{
+  const MonteCarlo::Photoatom::ConstReactionMap& scattering_reactions =
+    test_photoatom->getCore().getScatteringReactions();
+
+  const MonteCarlo::Photoatom::ConstReactionMap& absorption_reactions =
+    test_photoatom->getCore().getAbsorptionReactions();
+
+  const double energy = 1.0;
+
+  const double scattering_cross_section =
+    sumReferenceCrossSections( scattering_reactions, energy );
+
+  const double absorption_cross_section =
+    sumReferenceCrossSections( absorption_reactions, energy );
+
+  const std::vector<double> random_numbers =
+    getReactionSamplingRandomNumbers();
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setEnergy( energy );
+    photon.setDirection( 0.0, 0.0, 1.0 );
+    photon.setWeight( 1.0 );
+
+    MonteCarlo::ParticleBank bank;
+
+    std::vector<double> fake_stream( 1, random_numbers[i] );
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    reaction_history.clear();
+
+    test_photoatom->collideAnalogue( photon, bank );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    const double scaled_random_number = random_numbers[i]*
+      (scattering_cross_section + absorption_cross_section);
+
+    FRENSIE_REQUIRE_EQUAL( reaction_history.size(), 1 );
+
+    if( scaled_random_number < absorption_cross_section )
+    {
+      FRENSIE_CHECK_EQUAL( reaction_history.front(),
+                           sampleReferenceReaction( absorption_reactions,
+                                                    energy,
+                                                    scaled_random_number ) );
+      FRENSIE_CHECK( photon.isGone() );
+    }
+    else
+    {
+      FRENSIE_CHECK_EQUAL( reaction_history.front(),
+                           sampleReferenceReaction( scattering_reactions,
+                                                    energy,
+                                                    scaled_random_number -
+                                                    absorption_cross_section ) );
+      FRENSIE_CHECK( !photon.isGone() );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the reactions sampled in a survival biased collision match the
+// reactions sampled by evaluating each reaction cross section in turn
+FRENSIE_UNIT_TEST( Photoatom, collideSurvivalBias_reaction_sampling )
+{
+  const MonteCarlo::Photoatom::ConstReactionMap& scattering_reactions =
+    test_photoatom->getCore().getScatteringReactions();
+
+  const MonteCarlo::Photoatom::ConstReactionMap& absorption_reactions =
+    test_photoatom->getCore().getAbsorptionReactions();
+
+  const double energy = 1.0;
+
+  const double scattering_cross_section =
+    sumReferenceCrossSections( scattering_reactions, energy );
+
+  const double absorption_cross_section =
+    sumReferenceCrossSections( absorption_reactions, energy );
+
+  const std::vector<double> random_numbers =
+    getReactionSamplingRandomNumbers();
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setEnergy( energy );
+    photon.setDirection( 0.0, 0.0, 1.0 );
+    photon.setWeight( 1.0 );
+
+    MonteCarlo::ParticleBank bank;
+
+    std::vector<double> fake_stream( 2 );
+    fake_stream[0] = random_numbers[i];
+    fake_stream[1] = random_numbers[random_numbers.size()-i-1];
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    reaction_history.clear();
+
+    test_photoatom->collideSurvivalBias( photon, bank );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_REQUIRE_EQUAL( reaction_history.size(), 2 );
+    FRENSIE_CHECK_EQUAL( reaction_history[0],
+                         sampleReferenceReaction( scattering_reactions,
+                                                  energy,
+                                                  fake_stream[0]*
+                                                  scattering_cross_section ) );
+    FRENSIE_CHECK_EQUAL( reaction_history[1],
+                         sampleReferenceReaction( absorption_reactions,
+                                                  energy,
+                                                  fake_stream[1]*
+                                                  absorption_cross_section ) );
+    FRENSIE_CHECK( !photon.isGone() );
+    FRENSIE_CHECK_FLOATING_EQUALITY( photon.getWeight(),
+                                     scattering_cross_section/
+                                     (scattering_cross_section +
+                                      absorption_cross_section),
+                                     1e-15 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -745,6 +1013,64 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
 				    Utility::LogLog() ) );
   }
 
+  // Create a test photoatom with constant reaction cross sections
+  {
+    MonteCarlo::Photoatom::ConstReactionMap scattering_reactions,
+      absorption_reactions;
+
+    scattering_reactions[MonteCarlo::COHERENT_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::COHERENT_PHOTOATOMIC_REACTION,
+                                       1.0 ) );
+    scattering_reactions[MonteCarlo::TOTAL_INCOHERENT_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::TOTAL_INCOHERENT_PHOTOATOMIC_REACTION,
+                                       2.0 ) );
+    scattering_reactions[MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION,
+                                       3.0 ) );
+    scattering_reactions[MonteCarlo::TRIPLET_PRODUCTION_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::TRIPLET_PRODUCTION_PHOTOATOMIC_REACTION,
+                                       0.25 ) );
+
+    absorption_reactions[MonteCarlo::K_SUBSHELL_PHOTOELECTRIC_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::K_SUBSHELL_PHOTOELECTRIC_PHOTOATOMIC_REACTION,
+                                       0.5 ) );
+    absorption_reactions[MonteCarlo::L1_SUBSHELL_PHOTOELECTRIC_PHOTOATOMIC_REACTION].reset(
+          new TestPhotoatomicReaction( MonteCarlo::L1_SUBSHELL_PHOTOELECTRIC_PHOTOATOMIC_REACTION,
+                                       1.5 ) );
+
+    std::shared_ptr<const MonteCarlo::PhotoatomicReaction> total_reaction(
+          new TestPhotoatomicReaction( MonteCarlo::TOTAL_PHOTOATOMIC_REACTION,
+                                       8.25 ) );
+
+    std::shared_ptr<const MonteCarlo::PhotoatomicReaction>
+      total_absorption_reaction( new TestPhotoatomicReaction(
+                               MonteCarlo::TOTAL_ABSORPTION_PHOTOATOMIC_REACTION,
+                               2.0 ) );
+
+    std::shared_ptr<std::vector<double> > energy_grid(
+                              new std::vector<double>( {1e-3, 20.0} ) );
+
+    std::shared_ptr<const Utility::HashBasedGridSearcher<double> > grid_searcher(
+          new Utility::StandardHashBasedGridSearcher<std::vector<double>,true>(
+                                                 energy_grid,
+                                                 energy_grid->front(),
+                                                 energy_grid->back(),
+                                                 10 ) );
+
+    std::shared_ptr<const MonteCarlo::AtomicRelaxationModel> relaxation_model(
+                                   new MonteCarlo::VoidAtomicRelaxationModel );
+
+    MonteCarlo::PhotoatomCore core( total_reaction,
+                                    total_absorption_reaction,
+                                    scattering_reactions,
+                                    absorption_reactions,
+                                    MonteCarlo::Photoatom::ConstReactionMap(),
+                                    relaxation_model,
+                                    grid_searcher );
+
+    test_photoatom.reset( new MonteCarlo::Photoatom( "test", 1, 1.0, core ) );
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
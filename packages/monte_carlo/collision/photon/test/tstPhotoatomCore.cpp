@@ -230,6 +230,54 @@ FRENSIE_UNIT_TEST( PhotoatomCore, getGridSearcher )
   FRENSIE_CHECK_EQUAL( grid_index, 1912 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the advanced constructor stores the reactions that it is given
+FRENSIE_UNIT_TEST( PhotoatomCore, advanced_constructor )
+{
+  const MonteCarlo::PhotoatomCore::ConstReactionMap& scattering_reactions =
+    ace_photoatom_core->getScatteringReactions();
+
+  const MonteCarlo::PhotoatomCore::ConstReactionMap& absorption_reactions =
+    ace_photoatom_core->getAbsorptionReactions();
+
+  std::shared_ptr<std::vector<double> > energy_grid(
+                              new std::vector<double>( {1e-3, 20.0} ) );
+
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> > grid_searcher(
+          new Utility::StandardHashBasedGridSearcher<std::vector<double>,true>(
+                                                 energy_grid,
+                                                 energy_grid->front(),
+                                                 energy_grid->back(),
+                                                 10 ) );
+
+  std::shared_ptr<const MonteCarlo::AtomicRelaxationModel> relaxation_model(
+                                   new MonteCarlo::VoidAtomicRelaxationModel );
+
+  // Only the scattering and absorption reactions are checked - any valid
+  // reactions can be used for the totals
+  MonteCarlo::PhotoatomCore photoatom_core(
+                 scattering_reactions.begin()->second,
+                 absorption_reactions.begin()->second,
+                 scattering_reactions,
+                 absorption_reactions,
+                 MonteCarlo::PhotoatomCore::ConstReactionMap(),
+                 relaxation_model,
+                 grid_searcher );
+
+  FRENSIE_REQUIRE_EQUAL( photoatom_core.getScatteringReactions().size(), 1 );
+  FRENSIE_CHECK( photoatom_core.getScatteringReactions().find( MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION )->second ==
+                 scattering_reactions.find( MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION )->second );
+  FRENSIE_CHECK_EQUAL( photoatom_core.getAbsorptionReactions().size(), 1 );
+  FRENSIE_CHECK_EQUAL( photoatom_core.getMiscReactions().size(), 0 );
+
+  FRENSIE_REQUIRE_EQUAL( photoatom_core.getScatteringReactionArray().size(), 1 );
+  FRENSIE_CHECK( photoatom_core.getScatteringReactionArray().front() ==
+                 scattering_reactions.find( MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION )->second );
+  FRENSIE_REQUIRE_EQUAL( photoatom_core.getAbsorptionReactionArray().size(), 1 );
+  FRENSIE_CHECK( photoatom_core.getAbsorptionReactionArray().front() ==
+                 absorption_reactions.begin()->second );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
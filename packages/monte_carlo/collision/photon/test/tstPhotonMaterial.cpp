@@ -8,10 +8,12 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <stdexcept>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomFactory.hpp"
 #include "MonteCarlo_PhotonMaterial.hpp"
+#include "MonteCarlo_VoidAtomicRelaxationModel.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -22,6 +24,162 @@
 
 std::shared_ptr<MonteCarlo::PhotonMaterial> material;
 
+std::shared_ptr<MonteCarlo::PhotonMaterial> test_material;
+
+std::vector<std::string> test_material_atom_names;
+
+std::vector<MonteCarlo::PhotoatomicReactionType> reaction_history;
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+// Photoatomic reaction with a constant cross section that records each
+// reaction that it simulates
+class TestPhotoatomicReaction : public MonteCarlo::PhotoatomicReaction
+{
+
+public:
+
+  TestPhotoatomicReaction( const MonteCarlo::PhotoatomicReactionType type,
+                           const double cross_section )
+    : d_type( type ),
+      d_cross_section( cross_section )
+  { /* ... */ }
+
+  ~TestPhotoatomicReaction()
+  { /* ... */ }
+
+  using MonteCarlo::PhotoatomicReaction::react;
+
+  bool isEnergyWithinEnergyGrid( const double ) const override
+  { return true; }
+
+  double getThresholdEnergy() const override
+  { return 1e-3; }
+
+  double getMaxEnergy() const override
+  { return 20.0; }
+
+  double getCrossSection( const double ) const override
+  { return d_cross_section; }
+
+  double getCrossSection( const double, const size_t ) const override
+  { return d_cross_section; }
+
+  unsigned getNumberOfEmittedPhotons( const double ) const override
+  { return 0u; }
+
+  unsigned getNumberOfEmittedElectrons( const double ) const override
+  { return 0u; }
+
+  unsigned getNumberOfEmittedPositrons( const double ) const override
+  { return 0u; }
+
+  MonteCarlo::PhotoatomicReactionType getReactionType() const override
+  { return d_type; }
+
+  void react( MonteCarlo::PhotonState&,
+              MonteCarlo::ParticleBank&,
+              Data::SubshellType& shell_of_interaction ) const override
+  {
+    shell_of_interaction = Data::INVALID_SUBSHELL;
+
+    reaction_history.push_back( d_type );
+  }
+
+protected:
+
+  const double* getEnergyGridHead() const override
+  { return &d_cross_section; }
+
+private:
+
+  MonteCarlo::PhotoatomicReactionType d_type;
+
+  double d_cross_section;
+};
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a photoatom with a single scattering reaction
+std::shared_ptr<const MonteCarlo::Photoatom> createTestPhotoatom(
+                   const std::string& name,
+                   const MonteCarlo::PhotoatomicReactionType reaction_type,
+                   const double cross_section )
+{
+  MonteCarlo::Photoatom::ConstReactionMap scattering_reactions;
+
+  scattering_reactions[reaction_type].reset(
+               new TestPhotoatomicReaction( reaction_type, cross_section ) );
+
+  std::shared_ptr<const MonteCarlo::PhotoatomicReaction> total_reaction(
+               new TestPhotoatomicReaction( MonteCarlo::TOTAL_PHOTOATOMIC_REACTION,
+                                            cross_section ) );
+
+  std::shared_ptr<const MonteCarlo::PhotoatomicReaction>
+    total_absorption_reaction( new TestPhotoatomicReaction(
+                               MonteCarlo::TOTAL_ABSORPTION_PHOTOATOMIC_REACTION,
+                               0.0 ) );
+
+  std::shared_ptr<std::vector<double> > energy_grid(
+                              new std::vector<double>( {1e-3, 20.0} ) );
+
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> > grid_searcher(
+          new Utility::StandardHashBasedGridSearcher<std::vector<double>,true>(
+                                                 energy_grid,
+                                                 energy_grid->front(),
+                                                 energy_grid->back(),
+                                                 10 ) );
+
+  std::shared_ptr<const MonteCarlo::AtomicRelaxationModel> relaxation_model(
+                                   new MonteCarlo::VoidAtomicRelaxationModel );
+
+  MonteCarlo::PhotoatomCore core( total_reaction,
+                                  total_absorption_reaction,
+                                  scattering_reactions,
+                                  MonteCarlo::Photoatom::ConstReactionMap(),
+                                  MonteCarlo::Photoatom::ConstReactionMap(),
+                                  relaxation_model,
+                                  grid_searcher );
+
+  return std::shared_ptr<const MonteCarlo::Photoatom>(
+                          new MonteCarlo::Photoatom( name, 1, 1.0, core ) );
+}
+
+// Sample a collision atom by evaluating the macroscopic total cross section
+// and then each microscopic total cross section in turn (reference sampling)
+std::string sampleReferenceCollisionAtom( const double energy,
+                                          const double random_number )
+{
+  const double scaled_random_number = random_number*
+    test_material->getMacroscopicTotalCrossSection( energy );
+
+  double partial_total_cs = 0.0;
+
+  for( size_t i = 0; i < test_material_atom_names.size(); ++i )
+  {
+    const std::string& atom_name = test_material_atom_names[i];
+
+    partial_total_cs +=
+      test_material->getScatteringCenterNumberDensity( atom_name )*
+      test_material->getScatteringCenter( atom_name )->getTotalCrossSection( energy );
+
+    if( scaled_random_number < partial_total_cs )
+      return atom_name;
+  }
+
+  throw std::logic_error( "A reference collision atom could not be sampled!" );
+}
+
+// Return the reaction that is simulated by a test atom
+MonteCarlo::PhotoatomicReactionType getTestAtomReaction(
+                                                 const std::string& atom_name )
+{
+  return test_material->getScatteringCenter( atom_name )->getCore().getScatteringReactions().begin()->first;
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -416,6 +574,75 @@ FRENSIE_UNIT_TEST( PhotonMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the atoms sampled in an analogue collision match the atoms
+// sampled using the macroscopic total cross section
+FRENSIE_UNIT_TEST( PhotonMaterial, collideAnalogue_atom_sampling )
+{
+  const double energy = 1.0;
+
+  for( size_t i = 0; i < 32; ++i )
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setEnergy( energy );
+    photon.setDirection( 0.0, 0.0, 1.0 );
+
+    MonteCarlo::ParticleBank bank;
+
+    std::vector<double> fake_stream( 2 );
+    fake_stream[0] = (i < 31 ? i/31.0 : 1.0 - 1e-15 ); // select the atom
+    fake_stream[1] = 0.5; // select the reaction
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    reaction_history.clear();
+
+    test_material->collideAnalogue( photon, bank );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_REQUIRE_EQUAL( reaction_history.size(), 1 );
+    FRENSIE_CHECK_EQUAL( reaction_history.front(),
+                         getTestAtomReaction( sampleReferenceCollisionAtom(
+                                                 energy, fake_stream[0] ) ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the atoms sampled in a survival biased collision match the atoms
+// sampled using the macroscopic total cross section
+FRENSIE_UNIT_TEST( PhotonMaterial, collideSurvivalBias_atom_sampling )
+{
+  const double energy = 1.0;
+
+  for( size_t i = 0; i < 32; ++i )
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setEnergy( energy );
+    photon.setDirection( 0.0, 0.0, 1.0 );
+
+    MonteCarlo::ParticleBank bank;
+
+    std::vector<double> fake_stream( 2 );
+    fake_stream[0] = (i < 31 ? i/31.0 : 1.0 - 1e-15 ); // select the atom
+    fake_stream[1] = 0.5; // select the reaction
+
+    Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+    reaction_history.clear();
+
+    test_material->collideSurvivalBias( photon, bank );
+
+    Utility::RandomNumberGenerator::unsetFakeStream();
+
+    FRENSIE_REQUIRE_EQUAL( reaction_history.size(), 1 );
+    FRENSIE_CHECK_EQUAL( reaction_history.front(),
+                         getTestAtomReaction( sampleReferenceCollisionAtom(
+                                                 energy, fake_stream[0] ) ) );
+    FRENSIE_CHECK_EQUAL( photon.getWeight(), 1.0 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -499,6 +726,29 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                     atom_names ) );
   }
 
+  // Create a test material from atoms with constant cross sections
+  {
+    MonteCarlo::PhotonMaterial::PhotoatomNameMap atom_map;
+
+    atom_map["A"] = createTestPhotoatom(
+                       "A", MonteCarlo::COHERENT_PHOTOATOMIC_REACTION, 1.0 );
+    atom_map["B"] = createTestPhotoatom(
+                       "B", MonteCarlo::TOTAL_INCOHERENT_PHOTOATOMIC_REACTION, 4.0 );
+    atom_map["C"] = createTestPhotoatom(
+                       "C", MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION, 2.5 );
+
+    test_material_atom_names = {"A", "B", "C"};
+
+    std::vector<double> atom_fractions( {0.2, 0.5, 0.3} );
+
+    test_material.reset( new MonteCarlo::PhotonMaterial(
+                                                    1,
+                                                    1.0,
+                                                    atom_map,
+                                                    atom_fractions,
+                                                    test_material_atom_names ) );
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
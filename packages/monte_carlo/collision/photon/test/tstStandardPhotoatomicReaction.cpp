@@ -12,6 +12,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_StandardReactionBaseImpl.hpp"
+#include "MonteCarlo_CrossSectionStorage.hpp"
 #include "MonteCarlo_PhotoatomicReaction.hpp"
 #include "Data_ACEFileHandler.hpp"
 #include "Data_XSSPhotoatomicDataExtractor.hpp"
@@ -117,6 +118,106 @@ FRENSIE_UNIT_TEST( StandardPhotoatomicReaction, getCrossSection_ace_pe )
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, exp( -1.11594725061E+01 ), 1e-12 );
 }
 
+#if HAVE_FRENSIE_SINGLE_PRECISION_CROSS_SECTIONS
+//---------------------------------------------------------------------------//
+// Check that a processed single precision cross section can be returned
+FRENSIE_UNIT_TEST( StandardPhotoatomicReaction,
+                   getCrossSection_single_precision_processed )
+{
+  FRENSIE_REQUIRE( MonteCarlo::CrossSectionStorage::isSinglePrecision() );
+
+  std::shared_ptr<const std::vector<double> > energy_grid(
+              new std::vector<double>( {std::log( 1e-3 ), std::log( 1e-2 ),
+                                        std::log( 1e-1 ), std::log( 2.0 )} ) );
+
+  std::shared_ptr<const std::vector<double> > cross_section(
+           new std::vector<double>( {std::log( 1.7e4 ), std::log( 1.0/3.0 ),
+                                     std::log( 2.5e-3 ), std::log( 7.0 )} ) );
+
+  TestPhotoatomicReaction<Utility::LogLog,true> reaction( energy_grid,
+                                                          cross_section,
+                                                          0u );
+
+  // The energy grid is always stored in double precision
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getThresholdEnergy(), 1e-3, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getMaxEnergy(), 2.0, 1e-15 );
+
+  // The processed (log) values are only stored to single precision
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 1e-3 ),
+                                   1.7e4,
+                                   1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 1e-2 ),
+                                   1.0/3.0,
+                                   1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 1e-1 ),
+                                   2.5e-3,
+                                   1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 2.0 ),
+                                   7.0,
+                                   1e-6 );
+
+  // The interpolation is done in double precision
+  const double energy = 0.5;
+
+  const double expected_cross_section =
+    std::exp( std::log( 2.5e-3 ) +
+              std::log( 7.0/2.5e-3 )*std::log( energy/1e-1 )/std::log( 2.0/1e-1 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( energy ),
+                                   expected_cross_section,
+                                   1e-6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a single precision cross section with a zero first value can
+// be returned
+FRENSIE_UNIT_TEST( StandardPhotoatomicReaction,
+                   getCrossSection_single_precision_log_zero )
+{
+  FRENSIE_REQUIRE( MonteCarlo::CrossSectionStorage::isSinglePrecision() );
+
+  std::shared_ptr<const std::vector<double> > energy_grid(
+                                new std::vector<double>( {1.0, 2.0, 3.0} ) );
+
+  // The zero value must be interpolated with the LinLog policy
+  {
+    std::shared_ptr<const std::vector<double> > cross_section(
+                                new std::vector<double>( {0.0, 2.0, 3.0} ) );
+
+    TestPhotoatomicReaction<Utility::LogLog,false> reaction( energy_grid,
+                                                             cross_section,
+                                                             0u );
+
+    FRENSIE_CHECK_EQUAL( reaction.getCrossSection( 1.0 ), 0.0 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 1.5 ),
+                                     2.0*std::log( 1.5 )/std::log( 2.0 ),
+                                     1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 2.5 ),
+                                     2.5,
+                                     1e-12 );
+  }
+
+  // A value that underflows in single precision must not become zero
+  {
+    std::shared_ptr<const std::vector<double> > cross_section(
+                              new std::vector<double>( {1e-60, 2.0, 3.0} ) );
+
+    TestPhotoatomicReaction<Utility::LogLog,false> reaction( energy_grid,
+                                                             cross_section,
+                                                             0u );
+
+    FRENSIE_CHECK( reaction.getCrossSection( 1.0 ) > 0.0 );
+    FRENSIE_CHECK( reaction.getCrossSection( 1.5 ) > 0.0 );
+    FRENSIE_CHECK( reaction.getCrossSection( 1.5 ) <
+                   2.0*std::log( 1.5 )/std::log( 2.0 ) );
+    FRENSIE_CHECK_FLOATING_EQUALITY( reaction.getCrossSection( 2.0 ),
+                                     2.0,
+                                     1e-12 );
+  }
+}
+
+#endif // end HAVE_FRENSIE_SINGLE_PRECISION_CROSS_SECTIONS
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdjointPhotonProbeRay.cpp
+//! \author Alex Robinson
+//! \brief  Adjoint photon probe ray class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_AdjointPhotonProbeRay.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The probe ray will start at the adjoint photon position. Its
+ * direction will be the adjoint photon direction rotated through the
+ * scattering angle and the azimuthal angle and its weight will be the
+ * adjoint photon weight multiplied by the weight multiplier.
+ */
+AdjointPhotonProbeRay::AdjointPhotonProbeRay(
+                                      const AdjointPhotonState& adjoint_photon,
+                                      const double energy,
+                                      const double scattering_angle_cosine,
+                                      const double azimuthal_angle,
+                                      const double weight_multiplier )
+  : d_position{ adjoint_photon.getXPosition(),
+                adjoint_photon.getYPosition(),
+                adjoint_photon.getZPosition() },
+    d_direction(),
+    d_energy( energy ),
+    d_weight( adjoint_photon.getWeight()*weight_multiplier )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+  // Make sure the weight multiplier is valid
+  testPrecondition( weight_multiplier > 0.0 );
+
+  Utility::rotateUnitVectorThroughPolarAndAzimuthalAngle(
+                                                  scattering_angle_cosine,
+                                                  azimuthal_angle,
+                                                  adjoint_photon.getDirection(),
+                                                  d_direction );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdjointPhotonProbeRay.cpp
+//---------------------------------------------------------------------------//
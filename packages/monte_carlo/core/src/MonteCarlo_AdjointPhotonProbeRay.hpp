@@ -0,0 +1,96 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdjointPhotonProbeRay.hpp
+//! \author Alex Robinson
+//! \brief  Adjoint photon probe ray class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_HPP
+#define MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_AdjointPhotonState.hpp"
+
+namespace MonteCarlo{
+
+/*! The adjoint photon probe ray class
+ * \details A probe ray stores the phase space of an adjoint photon probe
+ * that leaves a collision site (position, direction, energy and weight).
+ * Unlike an adjoint photon probe state it does not own a navigator, which
+ * makes it cheap to create at every collision.
+ */
+class AdjointPhotonProbeRay
+{
+
+public:
+
+  //! Constructor
+  AdjointPhotonProbeRay( const AdjointPhotonState& adjoint_photon,
+                         const double energy,
+                         const double scattering_angle_cosine,
+                         const double azimuthal_angle,
+                         const double weight_multiplier );
+
+  //! Destructor
+  ~AdjointPhotonProbeRay()
+  { /* ... */ }
+
+  //! Return the position of the probe ray
+  const double* getPosition() const;
+
+  //! Return the direction of the probe ray
+  const double* getDirection() const;
+
+  //! Return the energy of the probe ray (MeV)
+  double getEnergy() const;
+
+  //! Return the weight of the probe ray
+  double getWeight() const;
+
+private:
+
+  // The position of the probe ray
+  double d_position[3];
+
+  // The direction of the probe ray
+  double d_direction[3];
+
+  // The energy of the probe ray (MeV)
+  double d_energy;
+
+  // The weight of the probe ray
+  double d_weight;
+};
+
+// Return the position of the probe ray
+inline const double* AdjointPhotonProbeRay::getPosition() const
+{
+  return d_position;
+}
+
+// Return the direction of the probe ray
+inline const double* AdjointPhotonProbeRay::getDirection() const
+{
+  return d_direction;
+}
+
+// Return the energy of the probe ray (MeV)
+inline double AdjointPhotonProbeRay::getEnergy() const
+{
+  return d_energy;
+}
+
+// Return the weight of the probe ray
+inline double AdjointPhotonProbeRay::getWeight() const
+{
+  return d_weight;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdjointPhotonProbeRay.hpp
+//---------------------------------------------------------------------------//
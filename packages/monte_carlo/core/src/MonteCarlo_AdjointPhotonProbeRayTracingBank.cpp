@@ -0,0 +1,36 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdjointPhotonProbeRayTracingBank.cpp
+//! \author Alex Robinson
+//! \brief  Adjoint photon probe ray tracing bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_AdjointPhotonProbeRayTracingBank.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+AdjointPhotonProbeRayTracingBank::AdjointPhotonProbeRayTracingBank(
+                                      const ProbeRayTracer& probe_ray_tracer )
+  : d_probe_ray_tracer( probe_ray_tracer )
+{
+  // Make sure that the probe ray tracer is valid
+  testPrecondition( probe_ray_tracer );
+}
+
+// Trace an adjoint photon probe ray instead of inserting it into the bank
+void AdjointPhotonProbeRayTracingBank::push(
+                                      const AdjointPhotonState& adjoint_photon,
+                                      const AdjointPhotonProbeRay& probe_ray )
+{
+  d_probe_ray_tracer( adjoint_photon, probe_ray );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdjointPhotonProbeRayTracingBank.cpp
+//---------------------------------------------------------------------------//
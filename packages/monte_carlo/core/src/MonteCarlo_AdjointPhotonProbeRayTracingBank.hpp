@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdjointPhotonProbeRayTracingBank.hpp
+//! \author Alex Robinson
+//! \brief  Adjoint photon probe ray tracing bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_TRACING_BANK_HPP
+#define MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_TRACING_BANK_HPP
+
+// Std Lib Includes
+#include <functional>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleBank.hpp"
+
+namespace MonteCarlo{
+
+/*! The adjoint photon probe ray tracing bank class
+ * \details Adjoint photon probe rays that are pushed into this bank will be
+ * handed to the probe ray tracer immediately. No probe states will be
+ * created or stored. All other particles are stored in the bank.
+ */
+class AdjointPhotonProbeRayTracingBank : public ParticleBank
+{
+
+public:
+
+  //! The probe ray tracer type
+  typedef std::function<void(const AdjointPhotonState&,const AdjointPhotonProbeRay&)> ProbeRayTracer;
+
+  //! Constructor
+  AdjointPhotonProbeRayTracingBank( const ProbeRayTracer& probe_ray_tracer );
+
+  //! Trace an adjoint photon probe ray instead of inserting it into the bank
+  void push( const AdjointPhotonState& adjoint_photon,
+             const AdjointPhotonProbeRay& probe_ray ) final override;
+
+private:
+
+  // The probe ray tracer
+  ProbeRayTracer d_probe_ray_tracer;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ADJOINT_PHOTON_PROBE_RAY_TRACING_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdjointPhotonProbeRayTracingBank.hpp
+//---------------------------------------------------------------------------//
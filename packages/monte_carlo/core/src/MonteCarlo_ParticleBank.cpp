@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_AdjointPhotonProbeState.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -84,6 +85,31 @@ void ParticleBank::push( const NeutronState& neutron,
   this->push( neutron );
 }
 
+// Insert an adjoint photon probe into the bank
+/*! \details An active adjoint photon probe state will be created from the
+ * adjoint photon that generated the probe ray. This function can be
+ * overridden in a derived class that needs to handle the probe ray without
+ * creating a probe state (i.e. probe ray tracing).
+ */
+void ParticleBank::push( const AdjointPhotonState& adjoint_photon,
+                         const AdjointPhotonProbeRay& probe_ray )
+{
+  // Make sure the probe ray starts at the adjoint photon position
+  testPrecondition( probe_ray.getPosition()[0] == adjoint_photon.getXPosition() );
+  testPrecondition( probe_ray.getPosition()[1] == adjoint_photon.getYPosition() );
+  testPrecondition( probe_ray.getPosition()[2] == adjoint_photon.getZPosition() );
+
+  std::shared_ptr<AdjointPhotonProbeState> probe(
+                               new AdjointPhotonProbeState( adjoint_photon ) );
+
+  probe->setEnergy( probe_ray.getEnergy() );
+  probe->setDirection( probe_ray.getDirection() );
+  probe->setWeight( probe_ray.getWeight() );
+  probe->activate();
+
+  this->push( probe );
+}
+
 // Pop a particle from the bank
 void ParticleBank::pop()
 {
@@ -22,6 +22,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeRay.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_List.hpp"
 
@@ -79,6 +80,10 @@ public:
   virtual void push( const NeutronState& neutron,
 		     const int reaction );
 
+  //! Insert an adjoint photon probe into the bank
+  virtual void push( const AdjointPhotonState& adjoint_photon,
+                     const AdjointPhotonProbeRay& probe_ray );
+
   //! Pop the top particle from bank
   void pop();
 
@@ -40,7 +40,12 @@ ParticleState::ParticleState()
     d_gone( false ),
     d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( std::make_pair(1.0, 1.0))
+    d_importance_pair( std::make_pair(1.0, 1.0)),
+    d_indexed_cell( Geometry::Model::invalidCellId() ),
+    d_cell_index( Geometry::Model::invalidEntityIndex() ),
+    d_indexed_mesh( NULL ),
+    d_indexed_mesh_position(),
+    d_mesh_element_index( 0 )
 { /* ... */ }
 
 // Constructor
@@ -66,7 +71,12 @@ ParticleState::ParticleState(
     d_gone( false ),
     d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( std::make_pair(1.0, 1.0))
+    d_importance_pair( std::make_pair(1.0, 1.0)),
+    d_indexed_cell( Geometry::Model::invalidCellId() ),
+    d_cell_index( Geometry::Model::invalidEntityIndex() ),
+    d_indexed_mesh( NULL ),
+    d_indexed_mesh_position(),
+    d_mesh_element_index( 0 )
 { /* ... */ }
 
 // Copy constructor
@@ -99,7 +109,12 @@ ParticleState::ParticleState( const ParticleState& existing_base_state,
     d_gone( false ),
     d_model( existing_base_state.d_model ),
     d_navigator( existing_base_state.d_navigator->clone( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( existing_base_state.d_importance_pair )
+    d_importance_pair( existing_base_state.d_importance_pair ),
+    d_indexed_cell( existing_base_state.d_indexed_cell ),
+    d_cell_index( existing_base_state.d_cell_index ),
+    d_indexed_mesh( existing_base_state.d_indexed_mesh ),
+    d_indexed_mesh_position( existing_base_state.d_indexed_mesh_position ),
+    d_mesh_element_index( existing_base_state.d_mesh_element_index )
 {
   // Increment the generation number if requested
   if( increment_generation_number )
@@ -218,6 +233,82 @@ Geometry::Model::EntityId ParticleState::getCell() const
   return d_navigator->getCurrentCell();
 }
 
+// Return the dense index of the cell containing the particle
+/*! \details The index is cached - it will only be looked up in the model
+ * when the particle has entered a different cell since the last call (see
+ * Geometry::Model::getCellIndex). The invalid entity index will be returned
+ * if the model has not indexed the cell.
+ */
+Geometry::Model::EntityIndex ParticleState::getCellIndex() const
+{
+  Geometry::Model::EntityId cell = d_navigator->getCurrentCell();
+
+  if( cell != d_indexed_cell )
+  {
+    d_cell_index = d_model->getCellIndex( cell );
+    d_indexed_cell = cell;
+  }
+
+  return d_cell_index;
+}
+
+// Check if the particle is inside of a mesh
+/*! \details The mesh element containing the particle will be located (and
+ * cached) if the particle is inside of the mesh so that a subsequent call to
+ * getMeshElementIndex does not need to locate it again.
+ */
+bool ParticleState::isInMesh( const Utility::Mesh& mesh ) const
+{
+  if( this->isMeshElementIndexCached( mesh ) )
+    return d_mesh_element_index < mesh.getNumberOfElements();
+  else if( mesh.isPointInMesh( this->getPosition() ) )
+  {
+    this->getMeshElementIndex( mesh );
+
+    return true;
+  }
+  else
+    return false;
+}
+
+// Return the dense index of the mesh element containing the particle
+/*! \details The index is cached - it will only be looked up in the mesh
+ * when the particle has moved or a different mesh is queried since the last
+ * call (see Utility::Mesh::whichElementIndexIsPointIn). The source particle
+ * and every collision site therefore require a single point location, which
+ * is shared by all of the mesh lookups at that position, and the cached index
+ * is inherited by the progeny that are created at the same position. The
+ * particle must be inside of the mesh (see isInMesh).
+ */
+size_t ParticleState::getMeshElementIndex( const Utility::Mesh& mesh ) const
+{
+  if( !this->isMeshElementIndexCached( mesh ) )
+  {
+    const double* position = this->getPosition();
+
+    d_mesh_element_index = mesh.whichElementIndexIsPointIn( position );
+    d_indexed_mesh = &mesh;
+    d_indexed_mesh_position = {position[0], position[1], position[2]};
+  }
+
+  return d_mesh_element_index;
+}
+
+// Check if the cached mesh element index belongs to the mesh
+bool ParticleState::isMeshElementIndexCached( const Utility::Mesh& mesh ) const
+{
+  if( d_indexed_mesh == &mesh )
+  {
+    const double* position = this->getPosition();
+
+    return position[0] == d_indexed_mesh_position[0] &&
+      position[1] == d_indexed_mesh_position[1] &&
+      position[2] == d_indexed_mesh_position[2];
+  }
+  else
+    return false;
+}
+
 // Return the x position of the particle
 double ParticleState::getXPosition() const
 {
@@ -379,7 +470,7 @@ void ParticleState::advance( double raw_distance )
     distance -= distance_to_surface;
 
     // Determine the distance to the next surface
-    if( !d_model->isTerminationCell( this->getCell() ) )
+    if( !d_model->isTerminationCellAtIndex( this->getCellIndex() ) )
       distance_to_surface = d_navigator->fireRay();
 
     // The particle has exited the model
@@ -647,6 +738,9 @@ void ParticleState::embedInModel(
   // Cache the new model
   d_model = model;
 
+  // The cached cell index belongs to the old model
+  d_indexed_cell = Geometry::Model::invalidCellId();
+
   // Try to initialize the new navigator. If it fails to initialize, the
   // particle is lost.
   try{
@@ -680,6 +774,9 @@ void ParticleState::embedInModel(
   // Cache the new model
   d_model = model;
 
+  // The cached cell index belongs to the old model
+  d_indexed_cell = Geometry::Model::invalidCellId();
+
   // Try to initialize the new navigator. If it fails to initialize, the
   // particle is lost.
   try{
@@ -715,6 +812,9 @@ void ParticleState::extractFromModel()
 
   d_model.reset( new Geometry::InfiniteMediumModel( d_source_cell ) );
 
+  // The cached cell index belongs to the old model
+  d_indexed_cell = Geometry::Model::invalidCellId();
+
   // Create the dummy navigator
   d_navigator.reset( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) );
 
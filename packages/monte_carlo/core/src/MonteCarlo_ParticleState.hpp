@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <array>
 
 // Boost Includes
 #include <boost/serialization/shared_ptr.hpp>
@@ -23,6 +24,7 @@
 #include "MonteCarlo_ParticleType.hpp"
 #include "Geometry_Navigator.hpp"
 #include "Geometry_Model.hpp"
+#include "Utility_Mesh.hpp"
 #include "Utility_OStreamableObject.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
@@ -132,6 +134,15 @@ public:
   //! Return the cell handle for the cell containing the particle
   Geometry::Model::EntityId getCell() const;
 
+  //! Return the dense index of the cell containing the particle
+  Geometry::Model::EntityIndex getCellIndex() const;
+
+  //! Check if the particle is inside of a mesh
+  bool isInMesh( const Utility::Mesh& mesh ) const;
+
+  //! Return the dense index of the mesh element containing the particle
+  size_t getMeshElementIndex( const Utility::Mesh& mesh ) const;
+
   //! Return the x position of the particle
   double getXPosition() const;
 
@@ -313,6 +324,9 @@ private:
   // Create the navigator AdvanceComplete callback method
   Geometry::Navigator::AdvanceCompleteCallback createAdvanceCompleteCallback();
 
+  // Check if the cached mesh element index belongs to the mesh
+  bool isMeshElementIndexCached( const Utility::Mesh& mesh ) const;
+
   // Save the state to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -385,6 +399,21 @@ private:
 
   // The navigator used by the particle
   std::unique_ptr<Geometry::Navigator> d_navigator;
+
+  // The cell that the cached dense cell index belongs to
+  mutable Geometry::Model::EntityId d_indexed_cell;
+
+  // The cached dense cell index
+  mutable Geometry::Model::EntityIndex d_cell_index;
+
+  // The mesh that the cached mesh element index belongs to
+  mutable const Utility::Mesh* d_indexed_mesh;
+
+  // The position where the cached mesh element index was determined
+  mutable std::array<double,3> d_indexed_mesh_position;
+
+  // The cached dense mesh element index
+  mutable size_t d_mesh_element_index;
 };
 
 // Set the position of the particle
@@ -30,7 +30,8 @@ SimulationAdjointPhotonProperties::SimulationAdjointPhotonProperties()
     d_adjoint_kn_sampling_type( TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING ),
     d_critical_line_energies(),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_probe_ray_tracing_mode_on( false )
 { /* ... */ }
 
 // Set the minimum adjoint photon energy (MeV)
@@ -215,6 +216,32 @@ double SimulationAdjointPhotonProperties::getAdjointPhotonRouletteSurvivalWeight
   return d_survival_weight;
 }
 
+// Set adjoint photon probe ray tracing mode to on (off by default)
+/*! \details When this mode is on the adjoint photon probes that are created
+ * at the critical line energies will not be banked and transported. Instead,
+ * a ray will be traced from the collision site to the geometry boundary and
+ * the uncollided probe weight will be attenuated deterministically by the
+ * forward total cross section of each cell that is crossed. A collision
+ * site is still sampled along each ray so that the collided (e.g. coherent
+ * scattering) contributions of the probes are kept.
+ */
+void SimulationAdjointPhotonProperties::setAdjointPhotonProbeRayTracingModeOn()
+{
+  d_probe_ray_tracing_mode_on = true;
+}
+
+// Set adjoint photon probe ray tracing mode to off (off by default)
+void SimulationAdjointPhotonProperties::setAdjointPhotonProbeRayTracingModeOff()
+{
+  d_probe_ray_tracing_mode_on = false;
+}
+
+// Check if adjoint photon probe ray tracing mode is on
+bool SimulationAdjointPhotonProperties::isAdjointPhotonProbeRayTracingModeOn() const
+{
+  return d_probe_ray_tracing_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationAdjointPhotonProperties );
 
 } // end MonteCarlo namespace
@@ -92,6 +92,15 @@ public:
   //! Return the cutoff roulette survival weight
   double getAdjointPhotonRouletteSurvivalWeight() const;
 
+  //! Set adjoint photon probe ray tracing mode to on (off by default)
+  void setAdjointPhotonProbeRayTracingModeOn();
+
+  //! Set adjoint photon probe ray tracing mode to off (off by default)
+  void setAdjointPhotonProbeRayTracingModeOff();
+
+  //! Check if adjoint photon probe ray tracing mode is on
+  bool isAdjointPhotonProbeRayTracingModeOn() const;
+
 private:
 
   // Save the state to an archive
@@ -130,6 +139,9 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The adjoint photon probe ray tracing mode
+  bool d_probe_ray_tracing_mode_on;
 };
 
 // Save the state to an archive
@@ -145,13 +157,21 @@ void SimulationAdjointPhotonProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_critical_line_energies );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  // Properties added in version 1
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_probe_ray_tracing_mode_on );
+  }
+  else
+    d_probe_ray_tracing_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationAdjointPhotonProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationAdjointPhotonProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationAdjointPhotonProperties, "SimulationAdjointPhotonProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationAdjointPhotonProperties );
 
@@ -25,8 +25,12 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_max_batch_size( d_max_rendezvous_batch_size ),
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
+    d_adaptive_batching_mode_on( false ),
+    d_number_of_processes_per_work_group( 0 ),
+    d_max_number_of_pending_rendezvous_archives( 0 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_interleaved_estimator_moments_mode_on( false )
 { /* ... */ }
 
 // Set the particle mode
@@ -166,6 +170,79 @@ uint64_t SimulationGeneralProperties::getNumberOfSnapshotsPerBatch() const
   return d_number_of_snapshots_per_batch;
 }
 
+// Set adaptive batching mode to on (off by default)
+/*! \details When adaptive batching is used by a batched distributed
+ * simulation, every process (including the root process) simulates
+ * histories, every process requests its next batch before it starts the
+ * current one and the size of each batch is based on the measured history
+ * rate of the process that it is assigned to. The number of batches per
+ * processor will only be used to size the first batch that gets assigned to
+ * each process.
+ */
+void SimulationGeneralProperties::setAdaptiveBatchingModeOn()
+{
+  d_adaptive_batching_mode_on = true;
+}
+
+// Set adaptive batching mode to off (off by default)
+void SimulationGeneralProperties::setAdaptiveBatchingModeOff()
+{
+  d_adaptive_batching_mode_on = false;
+}
+
+// Check if adaptive batching mode has been set
+bool SimulationGeneralProperties::isAdaptiveBatchingModeOn() const
+{
+  return d_adaptive_batching_mode_on;
+}
+
+// Set the number of processes per work group for an MPI configuration
+/*! \details This property is only used when adaptive batching mode is on.
+ * The processes will be split into groups of consecutive ranks. The lowest
+ * rank in each group will request work for the entire group from the root
+ * process and then distribute it to the other processes in the group, which
+ * keeps the number of requests that the root process must handle independent
+ * of the total number of processes. A value of 0 or 1 indicates that every
+ * process should request work from the root process directly.
+ */
+void SimulationGeneralProperties::setNumberOfProcessesPerWorkGroup(
+                                                     const uint64_t processes )
+{
+  d_number_of_processes_per_work_group = processes;
+}
+
+// Get the number of processes per work group for an MPI configuration
+uint64_t SimulationGeneralProperties::getNumberOfProcessesPerWorkGroup() const
+{
+  return d_number_of_processes_per_work_group;
+}
+
+// Set the max number of rendezvous archives that can be written in the background
+/*! \details When this property is greater than 0 the state of the
+ * simulation will be saved to an in-memory archive at each rendezvous and
+ * the archive will be written to its file by a background thread while the
+ * simulation continues. Only the file write is done in the background - the
+ * state is still serialized before the simulation continues. If the max number of archives are still being
+ * written when a rendezvous occurs the simulation will wait for the oldest
+ * one to be written. A value of 0 (the default) indicates that the archives
+ * should be written before the simulation continues. Every rendezvous
+ * archive is written to a temporary file first, which then replaces the
+ * previous archive, so an interrupted write will never corrupt the previous
+ * archive. Note that the "h5fa" archive type can only be written directly
+ * to a file so it will always be written before the simulation continues.
+ */
+void SimulationGeneralProperties::setMaxNumberOfPendingRendezvousArchives(
+                                                  const uint64_t max_archives )
+{
+  d_max_number_of_pending_rendezvous_archives = max_archives;
+}
+
+// Get the max number of rendezvous archives that can be written in the background
+uint64_t SimulationGeneralProperties::getMaxNumberOfPendingRendezvousArchives() const
+{
+  return d_max_number_of_pending_rendezvous_archives;
+}
+
 // Set the history simulation wall time
 void SimulationGeneralProperties::setSimulationWallTime( const double wall_time )
 {
@@ -201,6 +278,28 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set interleaved estimator moments mode to on (off by default)
+/*! \details The moments of the estimators that are created by the event
+ * handler will be interleaved while the histories of a batch are simulated
+ * (see MonteCarlo::EntityEstimator::enableInterleavedMoments).
+ */
+void SimulationGeneralProperties::setInterleavedEstimatorMomentsModeOn()
+{
+  d_interleaved_estimator_moments_mode_on = true;
+}
+
+// Set interleaved estimator moments mode to off (off by default)
+void SimulationGeneralProperties::setInterleavedEstimatorMomentsModeOff()
+{
+  d_interleaved_estimator_moments_mode_on = false;
+}
+
+// Check if interleaved estimator moments mode has been set
+bool SimulationGeneralProperties::isInterleavedEstimatorMomentsModeOn() const
+{
+  return d_interleaved_estimator_moments_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
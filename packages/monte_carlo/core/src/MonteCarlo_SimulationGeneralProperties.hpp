@@ -86,6 +86,27 @@ public:
   //! Get the number of snapshots per batch
   uint64_t getNumberOfSnapshotsPerBatch() const;
 
+  //! Set adaptive batching mode to on (off by default)
+  void setAdaptiveBatchingModeOn();
+
+  //! Set adaptive batching mode to off (off by default)
+  void setAdaptiveBatchingModeOff();
+
+  //! Check if adaptive batching mode has been set
+  bool isAdaptiveBatchingModeOn() const;
+
+  //! Set the number of processes per work group for an MPI configuration
+  void setNumberOfProcessesPerWorkGroup( const uint64_t processes );
+
+  //! Get the number of processes per work group for an MPI configuration
+  uint64_t getNumberOfProcessesPerWorkGroup() const;
+
+  //! Set the max number of rendezvous archives that can be written in the background
+  void setMaxNumberOfPendingRendezvousArchives( const uint64_t max_archives );
+
+  //! Get the max number of rendezvous archives that can be written in the background
+  uint64_t getMaxNumberOfPendingRendezvousArchives() const;
+
   //! Set the history simulation wall time (s)
   void setSimulationWallTime( const double wall_time );
 
@@ -101,6 +122,15 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set interleaved estimator moments mode to on (off by default)
+  void setInterleavedEstimatorMomentsModeOn();
+
+  //! Set interleaved estimator moments mode to off (off by default)
+  void setInterleavedEstimatorMomentsModeOff();
+
+  //! Check if interleaved estimator moments mode has been set
+  bool isInterleavedEstimatorMomentsModeOn() const;
+
 private:
 
   // Save the state to an archive
@@ -140,11 +170,23 @@ private:
   // The number of snapshots per batch
   uint64_t d_number_of_snapshots_per_batch;
 
+  // The adaptive batching mode (true = on, false = off - default)
+  bool d_adaptive_batching_mode_on;
+
+  // The number of processes per work group for an MPI configuration
+  uint64_t d_number_of_processes_per_work_group;
+
+  // The max number of rendezvous archives that can be written in the background
+  uint64_t d_max_number_of_pending_rendezvous_archives;
+
   // The simulation wall time
   double d_wall_time;
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The interleaved estimator moments mode (true = on, false = off - default)
+  bool d_interleaved_estimator_moments_mode_on;
 };
 
 // Save the state to an archive
@@ -179,6 +221,10 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_adaptive_batching_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_processes_per_work_group );
+  ar & BOOST_SERIALIZATION_NVP( d_max_number_of_pending_rendezvous_archives );
+  ar & BOOST_SERIALIZATION_NVP( d_interleaved_estimator_moments_mode_on );
 }
 
 // Load the state to an archive
@@ -203,13 +249,41 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  // Properties added in version 1
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_adaptive_batching_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_processes_per_work_group );
+  }
+  else
+  {
+    d_adaptive_batching_mode_on = false;
+    d_number_of_processes_per_work_group = 0;
+  }
+
+  // Properties added in version 2
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_max_number_of_pending_rendezvous_archives );
+  }
+  else
+    d_max_number_of_pending_rendezvous_archives = 0;
+
+  // Properties added in version 3
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_interleaved_estimator_moments_mode_on );
+  }
+  else
+    d_interleaved_estimator_moments_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 3 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
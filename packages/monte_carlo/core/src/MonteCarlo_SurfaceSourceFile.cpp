@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFile.cpp
+//! \author Alex Robinson
+//! \brief  Surface source file class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+#include <type_traits>
+#include <stdexcept>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceFile.hpp"
+#include "MonteCarlo_ParticleStateFactory.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+// The records are written to (and read from) file as raw bytes
+static_assert( std::is_trivially_copyable<SurfaceSourceFile::Record>::value &&
+               sizeof(SurfaceSourceFile::Record) == 104,
+               "The surface source record layout is not fixed!" );
+static_assert( std::is_trivially_copyable<SurfaceSourceFile::Header>::value &&
+               sizeof(SurfaceSourceFile::Header) == 24,
+               "The surface source header layout is not fixed!" );
+
+// The surface source file identifier
+static const char s_surface_source_file_identifier[8] =
+  {'F','R','N','S','S','S','R','C'};
+
+// The surface source file version
+static const uint32_t s_surface_source_file_version = 1u;
+
+// Create a file header
+auto SurfaceSourceFile::createHeader( const uint64_t number_of_histories )
+  -> Header
+{
+  Header header;
+
+  std::memcpy( header.identifier,
+               s_surface_source_file_identifier,
+               sizeof(header.identifier) );
+
+  header.version = s_surface_source_file_version;
+  header.record_size = sizeof(Record);
+  header.number_of_histories = number_of_histories;
+
+  return header;
+}
+
+// Create a record from a particle state
+void SurfaceSourceFile::createRecord( const ParticleState& particle,
+                                      const Geometry::Model::EntityId surface,
+                                      Record& record )
+{
+  record.history_number = particle.getHistoryNumber();
+  record.surface = surface;
+  record.particle_type = particle.getParticleType();
+  record.generation_number = particle.getGenerationNumber();
+  record.collision_number = particle.getCollisionNumber();
+  record.padding = 0;
+  record.position[0] = particle.getXPosition();
+  record.position[1] = particle.getYPosition();
+  record.position[2] = particle.getZPosition();
+  record.direction[0] = particle.getXDirection();
+  record.direction[1] = particle.getYDirection();
+  record.direction[2] = particle.getZDirection();
+  record.energy = particle.getEnergy();
+  record.time = particle.getTime();
+  record.weight = particle.getWeight();
+}
+
+// Create a (new history) particle state from a record
+/*! \details The generation and collision numbers of the particle state will
+ * not be restored (the particle starts a new history).
+ */
+std::shared_ptr<ParticleState> SurfaceSourceFile::createParticleState(
+                               const Record& record,
+                               const ParticleState::historyNumberType history )
+{
+  std::shared_ptr<ParticleState> particle;
+
+  ParticleStateFactory::createState( particle,
+                                     static_cast<ParticleType>( record.particle_type ),
+                                     history );
+
+  particle->setPosition( record.position );
+  particle->setDirection( record.direction );
+  particle->setEnergy( record.energy );
+  particle->setTime( record.time );
+  particle->setWeight( record.weight );
+
+  return particle;
+}
+
+// Write the file header (the records will not be modified)
+/*! \details If the file does not exist it will be created.
+ */
+void SurfaceSourceFile::writeHeader( const boost::filesystem::path& file_name,
+                                     const Header& header )
+{
+  std::fstream file;
+
+  if( boost::filesystem::exists( file_name ) )
+  {
+    file.open( file_name.string().c_str(),
+               std::fstream::binary | std::fstream::in | std::fstream::out );
+  }
+  else
+  {
+    file.open( file_name.string().c_str(),
+               std::fstream::binary | std::fstream::out );
+  }
+
+  TEST_FOR_EXCEPTION( !file.is_open(),
+                      std::runtime_error,
+                      "Could not open surface source file "
+                      << file_name.string() << "!" );
+
+  file.seekp( 0 );
+  file.write( reinterpret_cast<const char*>( &header ), sizeof(header) );
+  file.flush();
+
+  TEST_FOR_EXCEPTION( !file.good(),
+                      std::runtime_error,
+                      "Could not write the header of surface source file "
+                      << file_name.string() << "!" );
+}
+
+// Read the file header
+auto SurfaceSourceFile::readHeader( const boost::filesystem::path& file_name )
+  -> Header
+{
+  std::ifstream file( file_name.string().c_str(), std::ifstream::binary );
+
+  TEST_FOR_EXCEPTION( !file.is_open(),
+                      std::runtime_error,
+                      "Could not open surface source file "
+                      << file_name.string() << "!" );
+
+  Header header;
+
+  file.read( reinterpret_cast<char*>( &header ), sizeof(header) );
+
+  TEST_FOR_EXCEPTION( !file.good() ||
+                      std::memcmp( header.identifier,
+                                   s_surface_source_file_identifier,
+                                   sizeof(header.identifier) ) != 0,
+                      std::runtime_error,
+                      "File " << file_name.string() << " is not a valid "
+                      "surface source file!" );
+
+  TEST_FOR_EXCEPTION( header.version != s_surface_source_file_version ||
+                      header.record_size != sizeof(Record),
+                      std::runtime_error,
+                      "Surface source file " << file_name.string() <<
+                      " has an unsupported version (" << header.version <<
+                      ") or record size (" << header.record_size << ")!" );
+
+  return header;
+}
+
+// Read the records
+/*! \details The records will be appended to the records array.
+ */
+void SurfaceSourceFile::readRecords( const boost::filesystem::path& file_name,
+                                     std::vector<Record>& records,
+                                     uint64_t& number_of_histories )
+{
+  Header header = SurfaceSourceFile::readHeader( file_name );
+
+  number_of_histories = header.number_of_histories;
+
+  const uintmax_t file_size = boost::filesystem::file_size( file_name );
+
+  TEST_FOR_EXCEPTION( (file_size - sizeof(Header))%sizeof(Record) != 0,
+                      std::runtime_error,
+                      "Surface source file " << file_name.string() <<
+                      " is truncated!" );
+
+  const size_t number_of_records = (file_size - sizeof(Header))/sizeof(Record);
+
+  if( number_of_records > 0 )
+  {
+    std::ifstream file( file_name.string().c_str(), std::ifstream::binary );
+
+    file.seekg( sizeof(Header) );
+
+    const size_t first_record = records.size();
+
+    records.resize( first_record + number_of_records );
+
+    file.read( reinterpret_cast<char*>( &records[first_record] ),
+               number_of_records*sizeof(Record) );
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Could not read the records of surface source file "
+                        << file_name.string() << "!" );
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFile.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFile.hpp
+//! \author Alex Robinson
+//! \brief  Surface source file class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_FILE_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_FILE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_Model.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source file class
+ * \details A surface source file stores the states of the particles that
+ * crossed a set of surfaces during a simulation so that the transport can
+ * later be restarted from those surfaces (see
+ * MonteCarlo::SurfaceSourceRecorder and MonteCarlo::SurfaceSourceComponent).
+ * The file consists of a header followed by fixed size records that are
+ * written in native byte order. The header stores the number of source
+ * histories that were simulated to generate the records, which is required
+ * to normalize the source when it is replayed.
+ */
+class SurfaceSourceFile
+{
+
+public:
+
+  //! The surface source record
+  struct Record
+  {
+    //! The history number
+    uint64_t history_number;
+
+    //! The surface that was crossed
+    uint64_t surface;
+
+    //! The particle type
+    uint32_t particle_type;
+
+    //! The generation number
+    uint32_t generation_number;
+
+    //! The collision number
+    uint32_t collision_number;
+
+    //! Unused (keeps the record layout explicit)
+    uint32_t padding;
+
+    //! The position
+    double position[3];
+
+    //! The direction
+    double direction[3];
+
+    //! The energy
+    double energy;
+
+    //! The time
+    double time;
+
+    //! The weight
+    double weight;
+  };
+
+  //! The surface source file header
+  struct Header
+  {
+    //! The file type identifier
+    char identifier[8];
+
+    //! The file format version
+    uint32_t version;
+
+    //! The size of each record in bytes
+    uint32_t record_size;
+
+    //! The number of source histories used to generate the records
+    uint64_t number_of_histories;
+  };
+
+  //! Create a file header
+  static Header createHeader( const uint64_t number_of_histories );
+
+  //! Create a record from a particle state
+  static void createRecord( const ParticleState& particle,
+                            const Geometry::Model::EntityId surface,
+                            Record& record );
+
+  //! Create a (new history) particle state from a record
+  static std::shared_ptr<ParticleState> createParticleState(
+                         const Record& record,
+                         const ParticleState::historyNumberType history );
+
+  //! Write the file header (the records will not be modified)
+  static void writeHeader( const boost::filesystem::path& file_name,
+                           const Header& header );
+
+  //! Read the file header
+  static Header readHeader( const boost::filesystem::path& file_name );
+
+  //! Read the records
+  static void readRecords( const boost::filesystem::path& file_name,
+                           std::vector<Record>& records,
+                           uint64_t& number_of_histories );
+
+private:
+
+  // Constructor
+  SurfaceSourceFile();
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFile.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,74 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstAdjointPhotonProbeRayTracingBank.cpp
+//! \author Alex Robinson
+//! \brief  Adjoint photon probe ray tracing bank unit test
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_AdjointPhotonProbeRayTracingBank.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that adjoint photon probe rays are traced instead of banked
+FRENSIE_UNIT_TEST( AdjointPhotonProbeRayTracingBank, push_probe_ray )
+{
+  std::vector<double> traced_energies, traced_weights;
+
+  MonteCarlo::AdjointPhotonProbeRayTracingBank bank(
+          [&traced_energies, &traced_weights](
+                          const MonteCarlo::AdjointPhotonState&,
+                          const MonteCarlo::AdjointPhotonProbeRay& probe_ray )
+          {
+            traced_energies.push_back( probe_ray.getEnergy() );
+            traced_weights.push_back( probe_ray.getWeight() );
+          } );
+
+  MonteCarlo::AdjointPhotonState adjoint_photon( 1ull );
+  adjoint_photon.setDirection( 0.0, 0.0, 1.0 );
+  adjoint_photon.setEnergy( 0.1 );
+  adjoint_photon.setWeight( 0.5 );
+
+  MonteCarlo::ParticleBank& base_bank = bank;
+
+  base_bank.push( adjoint_photon,
+                  MonteCarlo::AdjointPhotonProbeRay( adjoint_photon,
+                                                     1.0, 0.0, 0.0, 0.5 ) );
+  base_bank.push( adjoint_photon,
+                  MonteCarlo::AdjointPhotonProbeRay( adjoint_photon,
+                                                     2.0, 1.0, 0.0, 2.0 ) );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( traced_energies, std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( traced_weights, std::vector<double>( {0.25, 1.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that other particles are still banked
+FRENSIE_UNIT_TEST( AdjointPhotonProbeRayTracingBank, push )
+{
+  MonteCarlo::AdjointPhotonProbeRayTracingBank bank(
+                        []( const MonteCarlo::AdjointPhotonState&,
+                            const MonteCarlo::AdjointPhotonProbeRay& ){} );
+
+  MonteCarlo::ParticleBank& base_bank = bank;
+
+  MonteCarlo::PhotonState photon( 1ull );
+
+  base_bank.push( photon );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+}
+
+//---------------------------------------------------------------------------//
+// end tstAdjointPhotonProbeRayTracingBank.cpp
+//---------------------------------------------------------------------------//
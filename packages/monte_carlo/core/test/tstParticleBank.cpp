@@ -16,6 +16,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "MonteCarlo_PositronState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeState.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 
@@ -151,6 +152,39 @@ FRENSIE_UNIT_TEST( ParticleBank, push_smart_ptr )
   FRENSIE_CHECK_EQUAL( bank.size(), 5 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that adjoint photon probe rays can be pushed to the particle bank
+FRENSIE_UNIT_TEST( ParticleBank, push_probe_ray )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::AdjointPhotonState adjoint_photon( 1ull );
+  adjoint_photon.setPosition( 1.0, 2.0, 3.0 );
+  adjoint_photon.setDirection( 0.0, 0.0, 1.0 );
+  adjoint_photon.setEnergy( 0.1 );
+  adjoint_photon.setWeight( 0.5 );
+
+  MonteCarlo::AdjointPhotonProbeRay probe_ray( adjoint_photon,
+                                               1.0, 0.0, 0.0, 0.5 );
+
+  bank.push( adjoint_photon, probe_ray );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(),
+                       MonteCarlo::ADJOINT_PHOTON );
+  FRENSIE_CHECK( dynamic_cast<MonteCarlo::AdjointPhotonProbeState&>( bank.top() ).isProbe() );
+  FRENSIE_CHECK( dynamic_cast<MonteCarlo::AdjointPhotonProbeState&>( bank.top() ).isActive() );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getXPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getYPosition(), 2.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getZPosition(), 3.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getXDirection(), 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( bank.top().getYDirection(), 1e-15 );
+  FRENSIE_CHECK_SMALL( bank.top().getZDirection(), 1e-15 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 0.25 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that that the top element of the bank can be accessed
 FRENSIE_UNIT_TEST( ParticleBank, top )
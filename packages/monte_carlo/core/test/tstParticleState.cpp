@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_ParticleState.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_StructuredHexMesh.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "TestParticleState.hpp"
@@ -513,6 +514,7 @@ FRENSIE_UNIT_TEST( ParticleState, embedInModel )
 
   // Verify that the particle is in the correct cell in the new model
   FRENSIE_CHECK_EQUAL( particle.getCell(), 2 );
+  FRENSIE_CHECK_EQUAL( particle.getCellIndex(), 0 );
 
   // Extract the particle from the model
   particle.extractFromModel();
@@ -520,6 +522,7 @@ FRENSIE_UNIT_TEST( ParticleState, embedInModel )
   FRENSIE_CHECK( !particle.isEmbeddedInModel( *model ) );
 
   FRENSIE_CHECK_EQUAL( particle.getCell(), 0 );
+  FRENSIE_CHECK_EQUAL( particle.getCellIndex(), 0 );
 
   // Embed the particle in a model with the cell specified
   model.reset( new Geometry::InfiniteMediumModel( 3 ) );
@@ -581,6 +584,60 @@ FRENSIE_UNIT_TEST( ParticleState, embedInModel )
   FRENSIE_CHECK_EQUAL( particle.getCell(), 5 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the mesh element containing the particle can be returned
+FRENSIE_UNIT_TEST( ParticleState, getMeshElementIndex )
+{
+  Utility::StructuredHexMesh mesh( {0.0, 1.0, 2.0, 3.0},
+                                   {0.0, 1.0},
+                                   {0.0, 1.0} );
+
+  const double point_a[3] = {0.5, 0.5, 0.5};
+  const double point_b[3] = {2.5, 0.5, 0.5};
+  const double point_c[3] = {1.5, 0.5, 0.5};
+
+  TestParticleState particle( 1ull );
+  particle.setPosition( point_a );
+  particle.setDirection( -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( particle.isInMesh( mesh ) );
+  FRENSIE_CHECK_EQUAL( particle.getMeshElementIndex( mesh ),
+                       mesh.whichElementIndexIsPointIn( point_a ) );
+
+  // The cached element is inherited by the progeny
+  TestParticleState progeny( particle, true );
+
+  FRENSIE_CHECK( progeny.isInMesh( mesh ) );
+  FRENSIE_CHECK_EQUAL( progeny.getMeshElementIndex( mesh ),
+                       mesh.whichElementIndexIsPointIn( point_a ) );
+
+  // The element is located again after the particle has moved
+  particle.setPosition( point_b );
+
+  FRENSIE_CHECK( particle.isInMesh( mesh ) );
+  FRENSIE_CHECK_EQUAL( particle.getMeshElementIndex( mesh ),
+                       mesh.whichElementIndexIsPointIn( point_b ) );
+
+  particle.advance( 1.0 );
+
+  FRENSIE_CHECK_EQUAL( particle.getMeshElementIndex( mesh ),
+                       mesh.whichElementIndexIsPointIn( point_c ) );
+  FRENSIE_CHECK_EQUAL( progeny.getMeshElementIndex( mesh ),
+                       mesh.whichElementIndexIsPointIn( point_a ) );
+
+  // The element is located again when a different mesh is queried
+  Utility::StructuredHexMesh other_mesh( {1.0, 4.0}, {0.0, 1.0}, {0.0, 1.0} );
+
+  FRENSIE_CHECK( particle.isInMesh( other_mesh ) );
+  FRENSIE_CHECK_EQUAL( particle.getMeshElementIndex( other_mesh ), 0 );
+  FRENSIE_CHECK( !progeny.isInMesh( other_mesh ) );
+
+  particle.setPosition( 3.5, 0.5, 0.5 );
+
+  FRENSIE_CHECK( !particle.isInMesh( mesh ) );
+  FRENSIE_CHECK( particle.isInMesh( other_mesh ) );
+}
+
 //---------------------------------------------------------------------------//
 // Create new particles
 FRENSIE_UNIT_TEST( ParticleState, copy_constructor )
@@ -41,6 +41,7 @@ FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK( !properties.isAdjointPhotonProbeRayTracingModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -154,6 +155,22 @@ FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the probe ray tracing mode can be set
+FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties,
+                   setAdjointPhotonProbeRayTracingModeOn )
+{
+  MonteCarlo::SimulationAdjointPhotonProperties properties;
+
+  properties.setAdjointPhotonProbeRayTracingModeOn();
+
+  FRENSIE_CHECK( properties.isAdjointPhotonProbeRayTracingModeOn() );
+
+  properties.setAdjointPhotonProbeRayTracingModeOff();
+
+  FRENSIE_CHECK( !properties.isAdjointPhotonProbeRayTracingModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
@@ -187,6 +204,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
     custom_properties.setCriticalAdjointPhotonLineEnergies( std::vector<double>({1.0, 10.0}) );
     custom_properties.setAdjointPhotonRouletteThresholdWeight( 1e-15 );
     custom_properties.setAdjointPhotonRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setAdjointPhotonProbeRayTracingModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -217,6 +235,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
   FRENSIE_CHECK_SMALL( default_properties.getAdjointPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK( !default_properties.isAdjointPhotonProbeRayTracingModeOn() );
 
   MonteCarlo::SimulationAdjointPhotonProperties custom_properties;
 
@@ -236,6 +255,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
                        std::vector<double>({1.0, 10.0}) );
   FRENSIE_CHECK_EQUAL( custom_properties.getAdjointPhotonRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK( custom_properties.isAdjointPhotonProbeRayTracingModeOn() );
 }
 
 //---------------------------------------------------------------------------//
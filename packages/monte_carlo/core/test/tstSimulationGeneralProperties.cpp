@@ -40,7 +40,11 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getMaxBatchSize(), 1000000000 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
+  FRENSIE_CHECK( !properties.isAdaptiveBatchingModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfProcessesPerWorkGroup(), 0 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxNumberOfPendingRendezvousArchives(), 0 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isInterleavedEstimatorMomentsModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +197,61 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that adaptive batching mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setAdaptiveBatchingModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setAdaptiveBatchingModeOn();
+
+  FRENSIE_CHECK( properties.isAdaptiveBatchingModeOn() );
+
+  properties.setAdaptiveBatchingModeOff();
+
+  FRENSIE_CHECK( !properties.isAdaptiveBatchingModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the number of processes per work group can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setNumberOfProcessesPerWorkGroup )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setNumberOfProcessesPerWorkGroup( 16 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfProcessesPerWorkGroup(), 16 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the max number of pending rendezvous archives can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setMaxNumberOfPendingRendezvousArchives )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setMaxNumberOfPendingRendezvousArchives( 2 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMaxNumberOfPendingRendezvousArchives(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that interleaved estimator moments mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setInterleavedEstimatorMomentsModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setInterleavedEstimatorMomentsModeOn();
+
+  FRENSIE_CHECK( properties.isInterleavedEstimatorMomentsModeOn() );
+
+  properties.setInterleavedEstimatorMomentsModeOff();
+
+  FRENSIE_CHECK( !properties.isInterleavedEstimatorMomentsModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -225,7 +284,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setMaxBatchSize( 100000000 );
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
+    custom_properties.setAdaptiveBatchingModeOn();
+    custom_properties.setNumberOfProcessesPerWorkGroup( 16 );
+    custom_properties.setMaxNumberOfPendingRendezvousArchives( 2 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setInterleavedEstimatorMomentsModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -256,7 +319,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getMaxBatchSize(), 1000000000 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
+  FRENSIE_CHECK( !default_properties.isAdaptiveBatchingModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfProcessesPerWorkGroup(), 0 );
+  FRENSIE_CHECK_EQUAL( default_properties.getMaxNumberOfPendingRendezvousArchives(), 0 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isInterleavedEstimatorMomentsModeOn() );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -274,7 +341,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getMaxBatchSize(), 100000000 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
+  FRENSIE_CHECK( custom_properties.isAdaptiveBatchingModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfProcessesPerWorkGroup(), 16 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getMaxNumberOfPendingRendezvousArchives(), 2 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isInterleavedEstimatorMomentsModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSurfaceSourceFile.cpp
+//! \author Alex Robinson
+//! \brief  Surface source file unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <fstream>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceFile.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+// Append a record to a file
+void appendRecord( const std::string& file_name,
+                   const MonteCarlo::SurfaceSourceFile::Record& record )
+{
+  std::ofstream file( file_name.c_str(),
+                      std::ofstream::binary | std::ofstream::app );
+
+  file.write( reinterpret_cast<const char*>( &record ), sizeof(record) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a header can be created
+FRENSIE_UNIT_TEST( SurfaceSourceFile, createHeader )
+{
+  MonteCarlo::SurfaceSourceFile::Header header =
+    MonteCarlo::SurfaceSourceFile::createHeader( 10 );
+
+  FRENSIE_CHECK_EQUAL( std::string( header.identifier, 8 ), "FRNSSSRC" );
+  FRENSIE_CHECK_EQUAL( header.version, 1 );
+  FRENSIE_CHECK_EQUAL( header.record_size,
+                       sizeof(MonteCarlo::SurfaceSourceFile::Record) );
+  FRENSIE_CHECK_EQUAL( header.number_of_histories, 10 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a record can be created from a particle state and that a
+// particle state can be created from a record
+FRENSIE_UNIT_TEST( SurfaceSourceFile, createRecord_createParticleState )
+{
+  MonteCarlo::PhotonState photon( 5 );
+  photon.setPosition( 1.0, 2.0, 3.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setEnergy( 2.0 );
+  photon.setTime( 0.5 );
+  photon.setWeight( 0.25 );
+  photon.incrementCollisionNumber();
+
+  MonteCarlo::SurfaceSourceFile::Record record;
+
+  MonteCarlo::SurfaceSourceFile::createRecord( photon, 7, record );
+
+  FRENSIE_CHECK_EQUAL( record.history_number, 5 );
+  FRENSIE_CHECK_EQUAL( record.surface, 7 );
+  FRENSIE_CHECK_EQUAL( record.particle_type, MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( record.generation_number, 0 );
+  FRENSIE_CHECK_EQUAL( record.collision_number, 1 );
+  FRENSIE_CHECK_EQUAL( record.position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( record.position[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( record.position[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( record.direction[2], 1.0 );
+  FRENSIE_CHECK_EQUAL( record.energy, 2.0 );
+  FRENSIE_CHECK_EQUAL( record.time, 0.5 );
+  FRENSIE_CHECK_EQUAL( record.weight, 0.25 );
+
+  std::shared_ptr<MonteCarlo::ParticleState> particle =
+    MonteCarlo::SurfaceSourceFile::createParticleState( record, 12 );
+
+  FRENSIE_REQUIRE( particle.get() );
+  FRENSIE_CHECK_EQUAL( particle->getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( particle->getHistoryNumber(), 12 );
+  FRENSIE_CHECK_EQUAL( particle->getCollisionNumber(), 0 );
+  FRENSIE_CHECK_EQUAL( particle->getXPosition(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle->getYPosition(), 2.0 );
+  FRENSIE_CHECK_EQUAL( particle->getZPosition(), 3.0 );
+  FRENSIE_CHECK_EQUAL( particle->getZDirection(), 1.0 );
+  FRENSIE_CHECK_EQUAL( particle->getEnergy(), 2.0 );
+  FRENSIE_CHECK_EQUAL( particle->getTime(), 0.5 );
+  FRENSIE_CHECK_EQUAL( particle->getWeight(), 0.25 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a surface source file can be written and read
+FRENSIE_UNIT_TEST( SurfaceSourceFile, write_read )
+{
+  const std::string file_name( "test_surface_source_file.ssrc" );
+
+  boost::filesystem::remove( file_name );
+
+  MonteCarlo::SurfaceSourceFile::writeHeader(
+                      file_name, MonteCarlo::SurfaceSourceFile::createHeader( 0 ) );
+
+  MonteCarlo::SurfaceSourceFile::Record record;
+
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setEnergy( 1.0 );
+
+    MonteCarlo::SurfaceSourceFile::createRecord( photon, 1, record );
+
+    appendRecord( file_name, record );
+  }
+
+  {
+    MonteCarlo::NeutronState neutron( 3 );
+    neutron.setEnergy( 2.0 );
+
+    MonteCarlo::SurfaceSourceFile::createRecord( neutron, 2, record );
+
+    appendRecord( file_name, record );
+  }
+
+  // Updating the header must not modify the records
+  MonteCarlo::SurfaceSourceFile::writeHeader(
+                      file_name, MonteCarlo::SurfaceSourceFile::createHeader( 4 ) );
+
+  std::vector<MonteCarlo::SurfaceSourceFile::Record> records;
+  uint64_t number_of_histories = 0;
+
+  FRENSIE_REQUIRE_NO_THROW( MonteCarlo::SurfaceSourceFile::readRecords(
+                                file_name, records, number_of_histories ) );
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, 4 );
+  FRENSIE_REQUIRE_EQUAL( records.size(), 2 );
+  FRENSIE_CHECK_EQUAL( records[0].history_number, 0 );
+  FRENSIE_CHECK_EQUAL( records[0].surface, 1 );
+  FRENSIE_CHECK_EQUAL( records[0].particle_type, MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( records[0].energy, 1.0 );
+  FRENSIE_CHECK_EQUAL( records[1].history_number, 3 );
+  FRENSIE_CHECK_EQUAL( records[1].surface, 2 );
+  FRENSIE_CHECK_EQUAL( records[1].particle_type, MonteCarlo::NEUTRON );
+  FRENSIE_CHECK_EQUAL( records[1].energy, 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an invalid file is rejected
+FRENSIE_UNIT_TEST( SurfaceSourceFile, readHeader_invalid )
+{
+  const std::string file_name( "test_invalid_surface_source_file.ssrc" );
+
+  {
+    std::ofstream file( file_name.c_str() );
+
+    file << "this is not a surface source file";
+  }
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SurfaceSourceFile::readHeader( file_name ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSurfaceSourceFile.cpp
+//---------------------------------------------------------------------------//
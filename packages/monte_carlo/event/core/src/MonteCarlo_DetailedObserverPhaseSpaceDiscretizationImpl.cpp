@@ -41,16 +41,6 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
     // Set the dimension range method
     d_dimension_use_range_map[dimension] = range_dimension;
 
-    d_dimension_range_method_map[dimension].first =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-    
-    d_dimension_range_method_map[dimension].second =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-
     // Calculate the index step size for the new dimension
     size_t dimension_index_step_size = 1;
 
@@ -64,6 +54,8 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
 
     // Add the dimension of the discretization to the dimension ordering array
     d_dimension_ordering.push_back( dimension );
+
+    this->compileDimensionDiscretizations();
   }
   else
   {
@@ -260,10 +252,21 @@ bool DetailedObserverPhaseSpaceDiscretizationImpl::isValueInDimensionDiscretizat
 bool DetailedObserverPhaseSpaceDiscretizationImpl::doesRangeIntersectDiscretization(
              const ObserverParticleStateWrapper& particle_state_wrapper ) const
 {
-  for( auto dimension_range_method : d_dimension_range_method_map )
+  for( size_t i = 0; i < d_compiled_discretizations.size(); ++i )
   {
-    if( !dimension_range_method.second.first( particle_state_wrapper ) )
-      return false;
+    const CompiledDimensionDiscretization& compiled_discretization =
+      d_compiled_discretizations[i];
+
+    if( compiled_discretization.range_dimension )
+    {
+      if( !compiled_discretization.discretization->doesRangeIntersectDiscretization( particle_state_wrapper ) )
+        return false;
+    }
+    else
+    {
+      if( !compiled_discretization.discretization->isValueInDiscretization( particle_state_wrapper ) )
+        return false;
+    }
   }
 
   return true;
@@ -279,21 +282,19 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
-                                  const DimensionValueMap& dimension_values,
-                                  BinIndexArray& local_bin_indices ) const
+               const CompiledDimensionDiscretization& compiled_discretization,
+               const DimensionValueMap& dimension_values,
+               BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  const ObserverPhaseSpaceDimensionDiscretization&
-    dimension_discretization = *d_dimension_discretization_map.find( dimension )->second;
-
   const DimensionValueMap::mapped_type& dimension_value =
-    dimension_values.find( dimension )->second;
+    dimension_values.find( compiled_discretization.dimension )->second;
 
-  dimension_discretization.calculateBinIndicesOfValue( dimension_value,
-                                                       local_bin_indices );
+  compiled_discretization.discretization->calculateBinIndicesOfValue(
+                                                         dimension_value,
+                                                         local_bin_indices );
 }
   
 // Calculate the bin indices of a point
@@ -306,14 +307,16 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
-                   const ObserverParticleStateWrapper& particle_state_wrapper,
-                   BinIndexArray& local_bin_indices ) const
+               const CompiledDimensionDiscretization& compiled_discretization,
+               const ObserverParticleStateWrapper& particle_state_wrapper,
+               BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  d_dimension_discretization_map.find( dimension )->second->calculateBinIndicesOfValue( particle_state_wrapper, local_bin_indices );
+  compiled_discretization.discretization->calculateBinIndicesOfValue(
+                                                       particle_state_wrapper,
+                                                       local_bin_indices );
 }
 
 // Calculate the bin indices and weights of a range
@@ -326,54 +329,55 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesAndWeights
   bin_indices_and_weights[0].first = 0;
   bin_indices_and_weights[0].second = 1.0;
 
-  BinIndexWeightPairArray previous_bin_indices_and_weights,
-    local_bin_indices_and_weights;
+  BinIndexWeightPairArray local_bin_indices_and_weights;
 
-  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
+  for( size_t i = 0; i < d_compiled_discretizations.size(); ++i )
   {
-    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+    const CompiledDimensionDiscretization& compiled_discretization =
+      d_compiled_discretizations[i];
 
-    decltype(d_dimension_range_method_map)::const_iterator
-      dimension_range_method_it = d_dimension_range_method_map.find( dimension );
-    if( i != 0 )
+    if( compiled_discretization.range_dimension )
     {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                local_bin_indices_and_weights );
+      compiled_discretization.discretization->calculateBinIndicesOfRange(
+                                               particle_state_wrapper,
+                                               local_bin_indices_and_weights );
+    }
+    else
+    {
+      compiled_discretization.discretization->calculateBinIndicesOfValue(
+                                               particle_state_wrapper,
+                                               local_bin_indices_and_weights );
+    }
 
-      const size_t dimension_index_step_size =
-        d_dimension_index_step_size_map.find( dimension )->second;
+    // Combine the local bin indices with the bin indices of the previous
+    // dimensions (the previous dimensions vary the fastest). The combinations
+    // are stored in place from the back so that the previous bin indices are
+    // only overwritten once they are no longer needed.
+    const size_t number_of_previous_bins = bin_indices_and_weights.size();
 
-      // Cache the current bin indices
-      previous_bin_indices_and_weights = bin_indices_and_weights;
+    bin_indices_and_weights.resize( number_of_previous_bins*
+                                    local_bin_indices_and_weights.size() );
 
-      // Calculate the number of bins that have been intersected
-      bin_indices_and_weights.resize( previous_bin_indices_and_weights.size()*
-                                      local_bin_indices_and_weights.size() );
+    for( size_t j = local_bin_indices_and_weights.size(); j > 0; --j )
+    {
+      const size_t local_bin_index_offset =
+        local_bin_indices_and_weights[j-1].first*
+        compiled_discretization.index_step_size;
 
-      // Calculate the bin indices that have been intersected
-      for( size_t i = 0; i < local_bin_indices_and_weights.size(); ++i )
+      const double local_bin_weight = local_bin_indices_and_weights[j-1].second;
+
+      for( size_t k = 0; k < number_of_previous_bins; ++k )
       {
-        for( size_t j = 0; j < previous_bin_indices_and_weights.size(); ++j )
-        {
-          BinIndexWeightPairArray::value_type& bin_index_and_weight =
-            bin_indices_and_weights[i*previous_bin_indices_and_weights.size()+j];
-          
-          bin_index_and_weight.first =
-            previous_bin_indices_and_weights[j].first +
-            local_bin_indices_and_weights[i].first*dimension_index_step_size;
-
-          bin_index_and_weight.second =
-            previous_bin_indices_and_weights[j].second*
-            local_bin_indices_and_weights[i].second;
-        }
+        BinIndexWeightPairArray::value_type& bin_index_and_weight =
+          bin_indices_and_weights[(j-1)*number_of_previous_bins+k];
+
+        bin_index_and_weight.first =
+          bin_indices_and_weights[k].first + local_bin_index_offset;
+
+        bin_index_and_weight.second =
+          bin_indices_and_weights[k].second*local_bin_weight;
       }
     }
-    // Initialize the bin indices and weights array
-    else
-    {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                bin_indices_and_weights );
-    }
   }
 
   // Make sure that the bin indices are valid
@@ -422,43 +426,29 @@ size_t DetailedObserverPhaseSpaceDiscretizationImpl::calculateDiscretizationInde
   return discretization_index;
 }
 
-// Create a range intersection method
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> RangeIntersectionMethod
+// Compile the dimension discretizations
+/*! \details The dimension discretizations, index step sizes and range flags
+ * are stored in a flat array (in the dimension ordering) so that the bin
+ * indices can be calculated without any map lookups.
+ */
+void DetailedObserverPhaseSpaceDiscretizationImpl::compileDimensionDiscretizations()
 {
-  if( is_range_dimension )
-  {
-    return std::bind<bool>( &ObserverPhaseSpaceDimensionDiscretization::doesRangeIntersectDiscretization,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-  else
-  {
-    return std::bind<bool>( static_cast<bool(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&)const>(&ObserverPhaseSpaceDimensionDiscretization::isValueInDiscretization),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-}
+  d_compiled_discretizations.resize( d_dimension_ordering.size() );
 
-// Create a calculate range method object
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> CalculateLocalBinIndicesOfRangeMethod
-{
-  if( is_range_dimension )
-  {
-    return std::bind<void>( &ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfRange,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
-  }
-  else
+  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
   {
-    return std::bind<void>( static_cast<void(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)const>(&ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfValue),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
+    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+
+    CompiledDimensionDiscretization& compiled_discretization =
+      d_compiled_discretizations[i];
+
+    compiled_discretization.dimension = dimension;
+    compiled_discretization.discretization =
+      d_dimension_discretization_map.find( dimension )->second.get();
+    compiled_discretization.index_step_size =
+      d_dimension_index_step_size_map.find( dimension )->second;
+    compiled_discretization.range_dimension =
+      d_dimension_use_range_map.find( dimension )->second;
   }
 }
 
@@ -9,9 +9,6 @@
 #ifndef MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 #define MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 
-// Std Lib Includes
-#include <functional>
-
 // FRENSIE Includes
 #include "MonteCarlo_ObserverPhaseSpaceDiscretizationImpl.hpp"
 #include "MonteCarlo_ObserverPhaseSpaceDimensionDiscretization.hpp"
@@ -118,23 +115,26 @@ public:
 
 private:
 
-  // The range intersects discretization method
-  typedef std::function<bool(const ObserverParticleStateWrapper&)> RangeIntersectionMethod;
+  // The compiled dimension discretization
+  struct CompiledDimensionDiscretization
+  {
+    // The dimension
+    ObserverPhaseSpaceDimension dimension;
+
+    // The dimension discretization
+    const ObserverPhaseSpaceDimensionDiscretization* discretization;
 
-  // The calculate indices of range method type
-  typedef std::function<void(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)> CalculateLocalBinIndicesOfRangeMethod;
+    // The dimension index step size
+    size_t index_step_size;
+
+    // Records if the dimension is a range dimension
+    bool range_dimension;
+  };
 
   size_t calculateDiscretizationIndex( const std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>>& dimension_bin_indices) const;
 
-  // Create a range intersection method
-  static RangeIntersectionMethod createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
-  
-  // Create a calculate range method object
-  static CalculateLocalBinIndicesOfRangeMethod createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
+  // Compile the dimension discretizations
+  void compileDimensionDiscretizations();
 
   // Check if the dimension value map is valid
   bool isDimensionValueMapValid(
@@ -170,15 +170,15 @@ private:
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
-                                  const DimensionValueMap& dimension_values,
-                                  BinIndexArray& local_bin_indices ) const;
+               const CompiledDimensionDiscretization& compiled_discretization,
+               const DimensionValueMap& dimension_values,
+               BinIndexArray& local_bin_indices ) const;
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
-                   const ObserverParticleStateWrapper& particle_state_wrapper,
-                   BinIndexArray& local_bin_indices ) const;
+               const CompiledDimensionDiscretization& compiled_discretization,
+               const ObserverParticleStateWrapper& particle_state_wrapper,
+               BinIndexArray& local_bin_indices ) const;
   
   // Save the data to an archive
   template<typename Archive>
@@ -201,16 +201,15 @@ private:
   std::map<ObserverPhaseSpaceDimension,bool>
   d_dimension_use_range_map;
 
-  // The observer phase space dimension range method map
-  std::map<ObserverPhaseSpaceDimension,std::pair<RangeIntersectionMethod,CalculateLocalBinIndicesOfRangeMethod> >
-  d_dimension_range_method_map;
-
   // The observer phase space dimension index step size map
   std::map<ObserverPhaseSpaceDimension,size_t>
   d_dimension_index_step_size_map;
 
   // The observer phase space dimension ordering
   std::vector<ObserverPhaseSpaceDimension> d_dimension_ordering;
+
+  // The compiled dimension discretizations (in the dimension ordering)
+  std::vector<CompiledDimensionDiscretization> d_compiled_discretizations;
 };
 
 } // end MonteCarlo namespace
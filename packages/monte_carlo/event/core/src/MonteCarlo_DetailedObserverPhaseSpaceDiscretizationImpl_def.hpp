@@ -17,9 +17,9 @@ template<typename DimensionValueContainer>
 inline bool DetailedObserverPhaseSpaceDiscretizationImpl::isPointInDiscretizationImpl(
                const DimensionValueContainer& dimension_value_container ) const
 {
-  for( auto dimension : d_dimension_discretization_map )
+  for( size_t i = 0; i < d_compiled_discretizations.size(); ++i )
   {
-    if( !this->isValueInDimensionDiscretization( *dimension.second, dimension_value_container ) )
+    if( !this->isValueInDimensionDiscretization( *d_compiled_discretizations[i].discretization, dimension_value_container ) )
       return false;
   }
 
@@ -27,57 +27,61 @@ inline bool DetailedObserverPhaseSpaceDiscretizationImpl::isPointInDiscretizatio
 }
 
 // Calculate the local bin indices of the point (implementation)
+/*! \details Every combination of the local bin indices will be calculated.
+ * The bin indices of the earlier dimensions in the dimension ordering will
+ * vary the fastest. When each dimension has a single local bin index (e.g.
+ * ordered discretizations) the bin index is simply the sum of the local bin
+ * indices multiplied by the dimension index step sizes.
+ */
 template<typename DimensionValueContainer>
 inline void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPointImpl(
                       const DimensionValueContainer& dimension_value_container,
                       BinIndexArray& bin_indices ) const
 {
+  bin_indices.resize( 1 );
+  bin_indices[0] = 0;
 
-  // BinIndexArray is just a vector of size_t
   BinIndexArray local_bin_indices;
-  std::vector<std::pair<ObserverPhaseSpaceDimension, BinIndexArray>> index_array_of_pairs;
 
-  size_t number_of_indices = 1;
-  for( auto i = d_dimension_ordering.begin(); i < d_dimension_ordering.end(); ++i )
+  for( size_t i = 0; i < d_compiled_discretizations.size(); ++i )
   {
-    // Calculate the local bin indices for a dimension
-    this->calculateLocalBinIndicesOfValue(  *i,
-                                            dimension_value_container,
-                                            local_bin_indices );
-    
-    // Put each vector of indices for a dimension into the index array map
-    index_array_of_pairs.push_back(std::make_pair(*i, local_bin_indices));
-    // Multiply the number of indices by the local bin size such that it grows with the number of combinations of indices given
-    number_of_indices = number_of_indices*local_bin_indices.size();
-  }
+    const CompiledDimensionDiscretization& compiled_discretization =
+      d_compiled_discretizations[i];
 
-  bin_indices.resize(number_of_indices);
+    // Calculate the local bin indices for the dimension
+    this->calculateLocalBinIndicesOfValue( compiled_discretization,
+                                           dimension_value_container,
+                                           local_bin_indices );
 
-  /* Complicated loop that goes through the map created and calculates the index of every combination of bin indices.
-   * Outer loop loops through the bin index vector.
-   */
-  std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>> temp_index_vector;
-  for(auto i = bin_indices.begin(); i < bin_indices.end(); ++i)
-  {
-    bool pop_completed = false;
-    /* Second loop takes the first elements of each vector combined with its respective dimension and places that into the temporary map.
-     * If the size of the vector was greater than zero, the first vector encountered with a size greater than zero is deleted. Each combination of
-     * indices is only needed once, so deleting one of the elements ensures that a new combination is presented every time and that no combination is missed.
-     */
-    for(auto j = index_array_of_pairs.begin(); j != index_array_of_pairs.end(); ++j)
+    if( local_bin_indices.size() == 1 )
+    {
+      const size_t local_bin_index_offset =
+        local_bin_indices[0]*compiled_discretization.index_step_size;
+
+      for( size_t k = 0; k < bin_indices.size(); ++k )
+        bin_indices[k] += local_bin_index_offset;
+    }
+    else
     {
-      temp_index_vector.push_back(std::make_pair(j->first, j->second[0]));
-      if(!pop_completed)
+      // The combinations are stored in place from the back so that the
+      // previous bin indices are only overwritten once they are no longer
+      // needed
+      const size_t number_of_previous_bins = bin_indices.size();
+
+      bin_indices.resize( number_of_previous_bins*local_bin_indices.size() );
+
+      for( size_t j = local_bin_indices.size(); j > 0; --j )
       {
-        if(j->second.size() > 1)
+        const size_t local_bin_index_offset =
+          local_bin_indices[j-1]*compiled_discretization.index_step_size;
+
+        for( size_t k = 0; k < number_of_previous_bins; ++k )
         {
-          j->second.erase(j->second.begin());
-          pop_completed = true;
+          bin_indices[(j-1)*number_of_previous_bins+k] =
+            bin_indices[k] + local_bin_index_offset;
         }
       }
     }
-    *i = this->calculateDiscretizationIndex(temp_index_vector);
-    temp_index_vector.clear();
   }
 
   // Make sure that the bin indices are valid
@@ -111,19 +115,8 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::load( Archive& ar, const unsi
   ar & BOOST_SERIALIZATION_NVP( d_dimension_index_step_size_map );
   ar & BOOST_SERIALIZATION_NVP( d_dimension_ordering );
 
-  // Initialize the dimension range method map
-  for( auto dimension : d_dimension_use_range_map )
-  {
-    d_dimension_range_method_map[dimension.first].first =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-                              *d_dimension_discretization_map[dimension.first],
-                              dimension.second );
-    
-    d_dimension_range_method_map[dimension.first].second =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-                              *d_dimension_discretization_map[dimension.first],
-                              dimension.second );
-  }
+  // Compile the dimension discretizations
+  this->compileDimensionDiscretizations();
 }
   
 } // end MonteCarlo namespace
@@ -393,6 +393,14 @@ public:
     d_rhs->clearCache();
   }
 
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t histories,
+                     const double time ) final override
+  {
+    d_lhs->takeSnapshot( histories, time );
+    d_rhs->takeSnapshot( histories, time );
+  }
+
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads ) final override
   {
@@ -565,7 +573,8 @@ ParticleHistorySimulationCompletionCriterion::createMixedCriterion(
 }
 
 // Take a snapshot
-/*! \details The state should never need to be cached.
+/*! \details The state of the history count and wall time criteria never
+ * needs to be cached.
  */
 void ParticleHistorySimulationCompletionCriterion::takeSnapshot(
                                                  const uint64_t, const double )
@@ -60,7 +60,7 @@ public:
 
   //! Take a snapshot
   void takeSnapshot( const uint64_t histories,
-                     const double time ) final override;
+                     const double time ) override;
 
   //! Print a summary of the data
   void printSummary( std::ostream& os ) const final override;
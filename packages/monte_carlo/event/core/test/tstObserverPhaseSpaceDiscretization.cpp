@@ -26,6 +26,21 @@
 
 typedef TestArchiveHelper::TestArchives TestArchives;
 
+// An unordered collision number dimension discretization (the default
+// collision number dimension discretization never has overlapping bins)
+class UnorderedCollisionNumberDimensionDiscretization : public MonteCarlo::UnorderedTypedObserverPhaseSpaceDimensionDiscretization<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION>
+{
+  // Typedef for the base type
+  typedef MonteCarlo::UnorderedTypedObserverPhaseSpaceDimensionDiscretization<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION> BaseType;
+
+public:
+
+  // Constructor
+  UnorderedCollisionNumberDimensionDiscretization( const BaseType::BinSetArray& data )
+    : BaseType( data )
+  { /* ... */ }
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -2667,6 +2682,86 @@ FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization, calculateBinIndex )
 
 }
 
+//---------------------------------------------------------------------------//
+// Check that every combination of the local bin indices is calculated when
+// more than one dimension has overlapping bins
+FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
+                   calculateBinIndicesOfPoint_multiple_overlapping_dimensions )
+{
+  typedef MonteCarlo::ObserverPhaseSpaceDimensionTraits<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION> CNDT;
+  typedef MonteCarlo::ObserverPhaseSpaceDimensionTraits<MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION> SIDT;
+
+  UnorderedCollisionNumberDimensionDiscretization::BinSetArray
+    raw_discretization( 3 );
+
+  raw_discretization[0].insert( 0 );
+  raw_discretization[0].insert( 1 );
+
+  raw_discretization[1].insert( 1 );
+  raw_discretization[1].insert( 2 );
+
+  raw_discretization[2].insert( 1 );
+
+  std::shared_ptr<const MonteCarlo::ObserverPhaseSpaceDimensionDiscretization>
+    unordered_collision_number_dimension_discretization(
+     new UnorderedCollisionNumberDimensionDiscretization( raw_discretization ) );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization phase_space_discretization;
+
+  phase_space_discretization.assignDiscretizationToDimension( energy_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( unordered_collision_number_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( source_id_dimension_discretization );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::DimensionValueMap
+    phase_space_point;
+
+  phase_space_point[MonteCarlo::OBSERVER_ENERGY_DIMENSION] =
+    boost::any( 5e-5 );
+  phase_space_point[MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION] =
+    boost::any( (CNDT::dimensionType)1 );
+  phase_space_point[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] =
+    boost::any( (SIDT::dimensionType)1 );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::BinIndexArray bin_indices;
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point,
+                                                         bin_indices );
+
+  // Collision number 1 is in collision number bins 0, 1 and 2, source id 1
+  // is in source id bins 1 and 2 and energy 5e-5 is in energy bin 1
+  std::set<size_t> expected_bin_indices;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    for( size_t j = 1; j < 3; ++j )
+    {
+      std::unordered_map<MonteCarlo::ObserverPhaseSpaceDimension,size_t>
+        index_map;
+
+      index_map[MonteCarlo::OBSERVER_ENERGY_DIMENSION] = 1;
+      index_map[MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION] = i;
+      index_map[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] = j;
+
+      expected_bin_indices.insert( phase_space_discretization.calculateDiscretizationIndex( index_map ) );
+    }
+  }
+
+  FRENSIE_REQUIRE_EQUAL( expected_bin_indices.size(), 6 );
+
+  // Every combination must be present exactly once
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 6 );
+
+  std::set<size_t> unique_bin_indices( bin_indices.begin(),
+                                       bin_indices.end() );
+
+  FRENSIE_CHECK_EQUAL( unique_bin_indices.size(), 6 );
+  FRENSIE_CHECK_EQUAL( unique_bin_indices, expected_bin_indices );
+
+  // The earlier dimensions in the dimension ordering vary the fastest
+  FRENSIE_CHECK_EQUAL( bin_indices,
+                       MonteCarlo::ObserverPhaseSpaceDiscretization::BinIndexArray( {10, 13, 16, 19, 22, 25} ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the phase space discretization can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ObserverPhaseSpaceDiscretization,
@@ -37,7 +37,9 @@ EventHandler::EventHandler()
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_response_function_value_cache( new ResponseFunctionValueCache ),
+    d_interleaved_estimator_moments_mode_on( false )
 { /* ... */ }
 
 // Constructor
@@ -70,7 +72,9 @@ EventHandler::EventHandler(
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_response_function_value_cache( new ResponseFunctionValueCache ),
+    d_interleaved_estimator_moments_mode_on( properties.isInterleavedEstimatorMomentsModeOn() )
 {
   if( model )
   {
@@ -145,6 +149,9 @@ EventHandler::EventHandler(
         }
       }
     }
+
+    // Estimators added later will be indexed when they are registered
+    this->indexObserverDispatchers( model );
   }
 }
 
@@ -403,6 +410,31 @@ bool EventHandler::isSimulationComplete() const
   return d_simulation_completion_criterion->isSimulationComplete();
 }
 
+// Index the observer dispatchers by the dense model entity indices
+/*! \details The cell dispatchers will be indexed by the dense model cell
+ * indices and the surface dispatcher will be indexed by the dense model surface
+ * indices (advanced models only). Particles that are embedded in the model can
+ * then be dispatched using their cached cell index. The indexing is not
+ * archived so it must be redone after the handler has been loaded.
+ */
+void EventHandler::indexObserverDispatchers(
+                          const std::shared_ptr<const Geometry::Model>& model )
+{
+  // Make sure that the model is valid
+  testPrecondition( model.get() );
+
+  this->getParticleCollidingInCellEventDispatcher().indexLocalDispatchersByCell( model );
+  this->getParticleEnteringCellEventDispatcher().indexLocalDispatchersByCell( model );
+  this->getParticleLeavingCellEventDispatcher().indexLocalDispatchersByCell( model );
+  this->getParticleSubtrackEndingInCellEventDispatcher().indexLocalDispatchersByCell( model );
+
+  if( model->isAdvanced() )
+  {
+    this->getParticleCrossingSurfaceEventDispatcher().indexLocalDispatchersBySurface(
+           std::dynamic_pointer_cast<const Geometry::AdvancedModel>( model ) );
+  }
+}
+
 // Add a particle tracker to the handler
 void EventHandler::addParticleTracker(
                      const std::shared_ptr<ParticleTracker>& particle_tracker )
@@ -427,6 +459,57 @@ void EventHandler::addParticleTracker(
   }
 }
 
+// Add a surface source recorder to the handler
+/*! \details The recorder will be registered with the particle crossing
+ * surface event dispatchers of the recorded surfaces.
+ */
+void EventHandler::addSurfaceSourceRecorder(
+                       const std::shared_ptr<SurfaceSourceRecorder>& recorder )
+{
+  // Make sure the observer is valid
+  testPrecondition( recorder.get() );
+
+  ParticleHistoryObservers::iterator observer_it =
+    std::find( d_particle_history_observers.begin(),
+               d_particle_history_observers.end(),
+               recorder );
+
+  if( observer_it == d_particle_history_observers.end() )
+  {
+    if( d_model )
+    {
+      TEST_FOR_EXCEPTION( !d_model->isAdvanced(),
+                          std::runtime_error,
+                          "Surface source recorders cannot be assigned "
+                          "because the model does not contain surface data!" );
+
+      const Geometry::AdvancedModel& advanced_model =
+        dynamic_cast<const Geometry::AdvancedModel&>( *d_model );
+
+      for( auto&& surface_id : recorder->getSurfaces() )
+      {
+        TEST_FOR_EXCEPTION( !advanced_model.doesSurfaceExist( surface_id ),
+                            std::runtime_error,
+                            "Surface source recorder " << recorder->getId() <<
+                            " has a surface id assigned (" << surface_id <<
+                            ") that does not exist in the model!" );
+      }
+    }
+
+    if( recorder->getParticleTypes().empty() )
+      this->registerObserver( recorder, recorder->getSurfaces() );
+    else
+    {
+      this->registerObserver( recorder,
+                              recorder->getSurfaces(),
+                              recorder->getParticleTypes() );
+    }
+
+    // Add the observer to the set
+    d_particle_history_observers.push_back( recorder );
+  }
+}
+
 // Return the number of estimators that have been added
 size_t EventHandler::getNumberOfEstimators() const
 {
@@ -515,6 +598,8 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
     ++it;
   }
 
+  d_response_function_value_cache->enableThreadSupport( num_threads );
+
   d_number_of_committed_histories.resize( num_threads, 0 );
   d_number_of_committed_histories_from_last_snapshot.resize( num_threads, 0 );
 }
@@ -538,6 +623,27 @@ void EventHandler::updateObserversFromParticleSimulationStoppedEvent()
   ParticleHistoryObserver::setNumberOfHistories( this->getNumberOfCommittedHistories() );
 }
 
+// Update observers from particle simulation batch started event
+/*! \details This must be called by the master thread before the histories
+ * of a batch are simulated.
+ */
+void EventHandler::updateObserversFromParticleSimulationBatchStartedEvent()
+{
+  for( auto&& estimator_data : d_estimators )
+    estimator_data.second->startBatch();
+}
+
+// Update observers from particle simulation batch stopped event
+/*! \details This must be called by the master thread after the histories
+ * of a batch have been simulated (the estimator data can only be read
+ * between batches).
+ */
+void EventHandler::updateObserversFromParticleSimulationBatchStoppedEvent()
+{
+  for( auto&& estimator_data : d_estimators )
+    estimator_data.second->stopBatch();
+}
+
 // Commit the estimator history contributions
 void EventHandler::commitObserverHistoryContributions()
 {
@@ -695,10 +801,14 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
 
     comm.barrier();
 
-    // Reduce the observers
+    // Reduce the observers - the simulation completion criterion (the first
+    // observer) is reduced last so that it can check the reduced data of
+    // the other observers (e.g. the estimator moments)
     ParticleHistoryObservers::iterator it =
       d_particle_history_observers.begin();
 
+    ++it;
+
     while( it != d_particle_history_observers.end() )
     {
       (*it)->reduceData( comm, root_process );
@@ -708,6 +818,10 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
       ++it;
     }
 
+    d_particle_history_observers.front()->reduceData( comm, root_process );
+
+    comm.barrier();
+
     // Reset the snapshot timer (no need to include reduction time)
     this->resetElapsedTimeSinceLastSnapshot();
 
@@ -801,6 +915,49 @@ void EventHandler::verifyValidEstimatorSurfaceIds(
   }
 }
 
+// Update the response function value cache
+/*! \details Only the response functions that are used by more than one
+ * estimator will be cached (e.g. the same material reaction rate response
+ * function assigned to a cell estimator and a mesh estimator). Each of these
+ * response functions will be evaluated once for each particle state instead
+ * of once for each estimator. Response functions are compared by address.
+ */
+void EventHandler::updateResponseFunctionValueCache()
+{
+  // Count the number of estimators that use each response function
+  std::unordered_map<const ParticleResponse*,size_t> response_function_counts;
+
+  std::vector<std::shared_ptr<const ParticleResponse> > shared_response_functions;
+
+  for( auto&& estimator_data : d_estimators )
+  {
+    const Estimator& estimator = *estimator_data.second;
+
+    for( size_t i = 0; i < estimator.getNumberOfResponseFunctions(); ++i )
+    {
+      const std::shared_ptr<const ParticleResponse>& response_function =
+        estimator.getResponseFunction( i );
+
+      size_t& count = response_function_counts[response_function.get()];
+
+      ++count;
+
+      if( count == 2 )
+        shared_response_functions.push_back( response_function );
+    }
+  }
+
+  d_response_function_value_cache->setResponseFunctions(
+                                                   shared_response_functions );
+
+  // The cache indices of every estimator must be updated
+  for( auto&& estimator_data : d_estimators )
+  {
+    estimator_data.second->setResponseFunctionValueCache(
+                                             d_response_function_value_cache );
+  }
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::EventHandler );
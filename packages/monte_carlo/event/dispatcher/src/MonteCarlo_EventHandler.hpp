@@ -24,6 +24,7 @@
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_ParticleState.hpp"
@@ -87,6 +88,10 @@ public:
   //! Check if the simulation is complete
   bool isSimulationComplete() const;
 
+  //! Index the observer dispatchers by the dense model entity indices
+  void indexObserverDispatchers(
+                         const std::shared_ptr<const Geometry::Model>& model );
+
   //! Add an estimator to the handler
   template<typename EstimatorType>
   void addEstimator( const std::shared_ptr<EstimatorType>& estimator );
@@ -94,6 +99,9 @@ public:
   //! Add a particle tracker to the handler
   void addParticleTracker( const std::shared_ptr<ParticleTracker>& particle_tracker );
 
+  //! Add a surface source recorder to the handler
+  void addSurfaceSourceRecorder( const std::shared_ptr<SurfaceSourceRecorder>& recorder );
+
   //! Return the number of estimators that have been added
   size_t getNumberOfEstimators() const;
 
@@ -127,6 +135,12 @@ public:
   //! Update observers from particle simulation stopped event
   void updateObserversFromParticleSimulationStoppedEvent();
 
+  //! Update observers from particle simulation batch started event
+  void updateObserversFromParticleSimulationBatchStartedEvent();
+
+  //! Update observers from particle simulation batch stopped event
+  void updateObserversFromParticleSimulationBatchStoppedEvent();
+
   //! Commit the history contributions to the observers
   void commitObserverHistoryContributions();
 
@@ -173,6 +187,9 @@ private:
   // Reset the elapsed time since the last snapshot
   void resetElapsedTimeSinceLastSnapshot();
 
+  // Update the response function value cache
+  void updateResponseFunctionValueCache();
+
   // Struct for registering estimator
   template<typename EstimatorType>
   struct EstimatorRegistrationHelper
@@ -378,11 +395,17 @@ private:
 
   // The observers
   ParticleHistoryObservers d_particle_history_observers;
+
+  // The response function value cache (shared with the estimators)
+  std::shared_ptr<ResponseFunctionValueCache> d_response_function_value_cache;
+
+  // Bool that records if the moments of added estimators are interleaved
+  bool d_interleaved_estimator_moments_mode_on;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes
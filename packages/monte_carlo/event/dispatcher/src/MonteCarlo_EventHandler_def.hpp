@@ -48,11 +48,17 @@ void EventHandler::addEstimator( const std::shared_ptr<EstimatorType>& estimator
     
     EstimatorRegistrationHelper<EstimatorType>::registerEstimator( *this, estimator );
 
+    if( d_interleaved_estimator_moments_mode_on )
+      estimator->enableInterleavedMoments();
+
     // Add the estimator to the map
     d_estimators[estimator->getId()] = estimator;
     
     // Add the observer to the set
     d_particle_history_observers.push_back( estimator );
+
+    // Cache the response functions shared with other estimators
+    this->updateResponseFunctionValueCache();
   }
 }
 
@@ -297,6 +303,7 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
   ar & BOOST_SERIALIZATION_NVP( d_particle_history_observers );
+  ar & BOOST_SERIALIZATION_NVP( d_interleaved_estimator_moments_mode_on );
 }
 
 // Load the data to an archive
@@ -341,6 +348,16 @@ void EventHandler::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
   ar & BOOST_SERIALIZATION_NVP( d_particle_history_observers );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_interleaved_estimator_moments_mode_on );
+  else
+    d_interleaved_estimator_moments_mode_on = false;
+
+  // The response function value cache is not archived - rebuild it
+  d_response_function_value_cache.reset( new ResponseFunctionValueCache );
+
+  this->updateResponseFunctionValueCache();
 }
 
 } // end MonteCarlo namespace
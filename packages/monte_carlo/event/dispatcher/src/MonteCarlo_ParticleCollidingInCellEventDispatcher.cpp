@@ -19,12 +19,12 @@ void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEven
                              const Geometry::Model::EntityId cell_of_collision,
                              const double inverse_total_cross_section )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_collision );
+  ParticleCollidingInCellEventLocalDispatcher* local_dispatcher =
+    this->findLocalCellDispatcher( particle, cell_of_collision );
 
-  if( it != this->getDispatcherMap().end() )
+  if( local_dispatcher )
   {
-    it->second->dispatchParticleCollidingInCellEvent(
+    local_dispatcher->dispatchParticleCollidingInCellEvent(
 						 particle,
 						 cell_of_collision,
 						 inverse_total_cross_section );
@@ -18,10 +18,11 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_entering )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+  ParticleEnteringCellEventLocalDispatcher* local_dispatcher =
+    this->findLocalCellDispatcher( particle, cell_entering );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+  if( local_dispatcher )
+    local_dispatcher->dispatchParticleEnteringCellEvent( particle, cell_entering );
 }
   
 } // end MonteCarlo namespace
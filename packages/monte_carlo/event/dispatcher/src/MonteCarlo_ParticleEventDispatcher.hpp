@@ -11,6 +11,9 @@
 
 // Std Lib Includes
 #include <memory>
+#include <functional>
+#include <algorithm>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -22,6 +25,8 @@
 // FRENSIE Includes
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_AdvancedModel.hpp"
 #include "Utility_Map.hpp"
 
 namespace MonteCarlo{
@@ -64,6 +69,17 @@ public:
   //! Detach all observers
   void detachAllObservers();
 
+  //! Index the local dispatchers by the dense model cell indices
+  void indexLocalDispatchersByCell(
+                         const std::shared_ptr<const Geometry::Model>& model );
+
+  //! Index the local dispatchers by the dense model surface indices
+  void indexLocalDispatchersBySurface(
+                 const std::shared_ptr<const Geometry::AdvancedModel>& model );
+
+  //! Check if the local dispatchers have been indexed
+  bool areLocalDispatchersIndexed() const;
+
 protected:
 
   // Typedef for the dispatcher map
@@ -73,8 +89,26 @@ protected:
   //! Get the dispatcher map
   DispatcherMap& getDispatcherMap();
 
+  //! Find the local dispatcher for the given entity id (null if none)
+  Dispatcher* findLocalDispatcher( const uint64_t entity_id ) const;
+
+  //! Find the local dispatcher for the given cell (null if none)
+  Dispatcher* findLocalCellDispatcher( const ParticleState& particle,
+                                       const uint64_t cell_id ) const;
+
 private:
 
+  // Index the local dispatchers
+  void indexLocalDispatchers(
+     const std::shared_ptr<const Geometry::Model>& model,
+     const size_t number_of_entities,
+     const std::function<Geometry::Model::EntityIndex(const uint64_t)>&
+     entity_index_function );
+
+  // Index a local dispatcher
+  void indexLocalDispatcher( const uint64_t entity_id,
+                             Dispatcher* dispatcher );
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -82,7 +116,18 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The local dispatchers (owned)
   DispatcherMap d_dispatcher_map;
+
+  // The model used to index the local dispatchers (not archived)
+  std::shared_ptr<const Geometry::Model> d_indexed_model;
+
+  // The dense entity index function (not archived)
+  std::function<Geometry::Model::EntityIndex(const uint64_t)>
+  d_entity_index_function;
+
+  // The local dispatchers stored by dense entity index (not archived)
+  std::vector<Dispatcher*> d_indexed_dispatchers;
 };
 
 } // end MonteCarlo namespace
@@ -9,12 +9,18 @@
 #ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 #define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
 namespace MonteCarlo{
 
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_indexed_model(),
+    d_entity_index_function(),
+    d_indexed_dispatchers()
 { /* ... */ }
 
 // Get the appropriate local dispatcher for the given entity id
@@ -33,6 +39,9 @@ inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
 
     new_dispatcher.reset( new Dispatcher( entity_id ) );
 
+    if( d_indexed_model )
+      this->indexLocalDispatcher( entity_id, new_dispatcher.get() );
+
     return *new_dispatcher;
   }
 }
@@ -86,6 +95,96 @@ template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
   d_dispatcher_map.clear();
+
+  std::fill( d_indexed_dispatchers.begin(),
+             d_indexed_dispatchers.end(),
+             (Dispatcher*)NULL );
+}
+
+// Index the local dispatchers by the dense model cell indices
+/*! \details Once indexed, the local dispatcher for a cell will be found
+ * using the particle's cached dense cell index when the particle is embedded
+ * in the indexed model. Local dispatchers created after indexing will also be
+ * indexed. The dispatcher map remains the owner of the local dispatchers.
+ */
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::indexLocalDispatchersByCell(
+                          const std::shared_ptr<const Geometry::Model>& model )
+{
+  // Make sure that the model is valid
+  testPrecondition( model.get() );
+
+  const Geometry::Model* raw_model = model.get();
+
+  this->indexLocalDispatchers(
+                   model,
+                   model->getNumberOfCells(),
+                   [raw_model]( const uint64_t cell_id )
+                   { return raw_model->getCellIndex( cell_id ); } );
+}
+
+// Index the local dispatchers by the dense model surface indices
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::indexLocalDispatchersBySurface(
+                  const std::shared_ptr<const Geometry::AdvancedModel>& model )
+{
+  // Make sure that the model is valid
+  testPrecondition( model.get() );
+
+  const Geometry::AdvancedModel* raw_model = model.get();
+
+  this->indexLocalDispatchers(
+                   model,
+                   model->getNumberOfSurfaces(),
+                   [raw_model]( const uint64_t surface_id )
+                   { return raw_model->getSurfaceIndex( surface_id ); } );
+}
+
+// Check if the local dispatchers have been indexed
+template<typename Dispatcher>
+inline bool ParticleEventDispatcher<Dispatcher>::areLocalDispatchersIndexed() const
+{
+  return d_indexed_model.get() != NULL;
+}
+
+// Index the local dispatchers
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::indexLocalDispatchers(
+     const std::shared_ptr<const Geometry::Model>& model,
+     const size_t number_of_entities,
+     const std::function<Geometry::Model::EntityIndex(const uint64_t)>&
+     entity_index_function )
+{
+  d_indexed_model = model;
+  d_entity_index_function = entity_index_function;
+
+  d_indexed_dispatchers.clear();
+  d_indexed_dispatchers.resize( number_of_entities, NULL );
+
+  typename DispatcherMap::iterator it = d_dispatcher_map.begin();
+
+  while( it != d_dispatcher_map.end() )
+  {
+    this->indexLocalDispatcher( it->first, it->second.get() );
+
+    ++it;
+  }
+}
+
+// Index a local dispatcher
+/*! \details Entities that are not in the indexed model can only be found
+ * through the dispatcher map.
+ */
+template<typename Dispatcher>
+inline void ParticleEventDispatcher<Dispatcher>::indexLocalDispatcher(
+                                                     const uint64_t entity_id,
+                                                     Dispatcher* dispatcher )
+{
+  Geometry::Model::EntityIndex entity_index =
+    d_entity_index_function( entity_id );
+
+  if( entity_index < d_indexed_dispatchers.size() )
+    d_indexed_dispatchers[entity_index] = dispatcher;
 }
 
 // Get the dispatcher map
@@ -95,6 +194,53 @@ inline auto ParticleEventDispatcher<Dispatcher>::getDispatcherMap() -> Dispatche
   return d_dispatcher_map;
 }
 
+// Find the local dispatcher for the given entity id (null if none)
+template<typename Dispatcher>
+inline Dispatcher* ParticleEventDispatcher<Dispatcher>::findLocalDispatcher(
+                                               const uint64_t entity_id ) const
+{
+  if( d_indexed_model )
+  {
+    Geometry::Model::EntityIndex entity_index =
+      d_entity_index_function( entity_id );
+
+    if( entity_index < d_indexed_dispatchers.size() )
+      return d_indexed_dispatchers[entity_index];
+  }
+
+  typename DispatcherMap::const_iterator it = d_dispatcher_map.find( entity_id );
+
+  if( it != d_dispatcher_map.end() )
+    return it->second.get();
+  else
+    return NULL;
+}
+
+// Find the local dispatcher for the given cell (null if none)
+/*! \details If the particle is embedded in the indexed model and is in the
+ * requested cell its cached dense cell index will be used, which avoids any
+ * id lookups. Otherwise this will fall back to the id lookup.
+ */
+template<typename Dispatcher>
+inline Dispatcher* ParticleEventDispatcher<Dispatcher>::findLocalCellDispatcher(
+                                                 const ParticleState& particle,
+                                                 const uint64_t cell_id ) const
+{
+  if( d_indexed_model )
+  {
+    if( particle.isEmbeddedInModel( *d_indexed_model ) &&
+        particle.getCell() == cell_id )
+    {
+      Geometry::Model::EntityIndex cell_index = particle.getCellIndex();
+
+      if( cell_index < d_indexed_dispatchers.size() )
+        return d_indexed_dispatchers[cell_index];
+    }
+  }
+
+  return this->findLocalDispatcher( cell_id );
+}
+
 // Serialize the observer
 template<typename Dispatcher>
 template<typename Archive>
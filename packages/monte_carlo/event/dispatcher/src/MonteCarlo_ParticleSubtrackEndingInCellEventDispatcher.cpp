@@ -19,14 +19,15 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double track_length )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_subtrack );
+  ParticleSubtrackEndingInCellEventLocalDispatcher* local_dispatcher =
+    this->findLocalCellDispatcher( particle, cell_of_subtrack );
 
-  if( it != this->getDispatcherMap().end() )
+  if( local_dispatcher )
   {
-    it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
-							   cell_of_subtrack,
-							   track_length );
+    local_dispatcher->dispatchParticleSubtrackEndingInCellEvent(
+                                                            particle,
+                                                            cell_of_subtrack,
+                                                            track_length );
   }
 }
 
@@ -337,6 +337,34 @@ FRENSIE_UNIT_TEST( EventHandler, addEstimator )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the moments of added estimators can be interleaved
+FRENSIE_UNIT_TEST( EventHandler, addEstimator_interleaved_moments )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+  properties.setInterleavedEstimatorMomentsModeOn();
+
+  MonteCarlo::EventHandler event_handler( properties );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      100, 1.0, {1}, {1.0} ) );
+  local_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  FRENSIE_CHECK( !local_estimator->areInterleavedMomentsEnabled() );
+
+  event_handler.addEstimator( local_estimator );
+
+  FRENSIE_CHECK( local_estimator->areInterleavedMomentsEnabled() );
+
+  // The moments are deinterleaved when the batch is stopped
+  event_handler.updateObserversFromParticleSimulationBatchStartedEvent();
+  event_handler.updateObserversFromParticleSimulationBatchStoppedEvent();
+
+  FRENSIE_CHECK_EQUAL( local_estimator->getTotalBinDataFirstMoments().size(),
+                       1 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that estimators can be added when a model has been assigned
 FRENSIE_UNIT_TEST( EventHandler, addEstimator_model_set )
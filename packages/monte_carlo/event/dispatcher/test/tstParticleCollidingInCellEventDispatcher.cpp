@@ -16,6 +16,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "Geometry_Model.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 
@@ -299,6 +300,71 @@ FRENSIE_UNIT_TEST( ParticleCollidingInCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a collision event can be dispatched once the local dispatchers
+// have been indexed by the model cells
+FRENSIE_UNIT_TEST( ParticleCollidingInCellEventDispatcher,
+                   dispatchParticleCollidingInCellEvent_indexed )
+{
+  std::shared_ptr<const Geometry::Model>
+    model( new Geometry::InfiniteMediumModel( 1 ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                      3,
+                                      1.0,
+                                      std::vector<Geometry::Model::EntityId>( {0, 1} ),
+                                      std::vector<double>( {1.0, 2.0} ) ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  std::shared_ptr<MonteCarlo::ParticleCollidingInCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleCollidingInCellEventDispatcher );
+
+  // Cell 0 is not in the model
+  dispatcher->attachObserver( 0, estimator->getParticleTypes(), estimator );
+
+  FRENSIE_CHECK( !dispatcher->areLocalDispatchersIndexed() );
+
+  dispatcher->indexLocalDispatchersByCell( model );
+
+  FRENSIE_CHECK( dispatcher->areLocalDispatchersIndexed() );
+
+  // Local dispatchers created after indexing must also be indexed
+  dispatcher->attachObserver( 1, estimator->getParticleTypes(), estimator );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+  photon.embedInModel( model );
+
+  FRENSIE_REQUIRE_EQUAL( photon.getCell(), 1 );
+  FRENSIE_REQUIRE_EQUAL( photon.getCellIndex(), 0 );
+
+  // The cached cell index will be used
+  dispatcher->dispatchParticleCollidingInCellEvent( photon, 1, 1.0 );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+
+  // The cell id lookup will be used
+  dispatcher->dispatchParticleCollidingInCellEvent( photon, 0, 1.0 );
+
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       std::vector<double>( {1.0} ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       std::vector<double>( {1.0} ) );
+
+  // The indexed local dispatchers must be removed with the observers
+  dispatcher->detachAllObservers();
+
+  dispatcher->dispatchParticleCollidingInCellEvent( photon, 1, 1.0 );
+  dispatcher->dispatchParticleCollidingInCellEvent( photon, 0, 1.0 );
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an event dispatcher can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleCollidingInCellEventDispatcher,
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -28,6 +31,11 @@ EntityEstimator::EntityEstimator( const Id id,
     d_supplied_norm_constants( false ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_interleaved_moments_enabled( false ),
+    d_moments_interleaved( false ),
+    d_estimator_total_bin_data_interleaved(),
+    d_entity_estimator_moments_interleaved_map(),
+    d_interleaved_moments_mutex(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -71,6 +79,9 @@ double EntityEstimator::getTotalNormConstant() const
 // Get the total estimator bin data first moments
 Utility::ArrayView<const double> EntityEstimator::getTotalBinDataFirstMoments() const
 {
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return Utility::ArrayView<const double>(
                     Utility::getCurrentScores<1>( d_estimator_total_bin_data ),
                     d_estimator_total_bin_data.size() );
@@ -79,6 +90,9 @@ Utility::ArrayView<const double> EntityEstimator::getTotalBinDataFirstMoments()
 // Get the total estimator bin data second moments
 Utility::ArrayView<const double> EntityEstimator::getTotalBinDataSecondMoments() const
 {
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return Utility::ArrayView<const double>(
                     Utility::getCurrentScores<2>( d_estimator_total_bin_data ),
                     d_estimator_total_bin_data.size() );
@@ -87,6 +101,9 @@ Utility::ArrayView<const double> EntityEstimator::getTotalBinDataSecondMoments()
 // Get the total estimator bin data third moments
 Utility::ArrayView<const double> EntityEstimator::getTotalBinDataThirdMoments() const
 {
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return Utility::ArrayView<const double>(
                     Utility::getCurrentScores<3>( d_estimator_total_bin_data ),
                     d_estimator_total_bin_data.size() );
@@ -95,6 +112,9 @@ Utility::ArrayView<const double> EntityEstimator::getTotalBinDataThirdMoments()
 // Get the total estimator bin data fourth moments
 Utility::ArrayView<const double> EntityEstimator::getTotalBinDataFourthMoments() const
 {
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return Utility::ArrayView<const double>(
                     Utility::getCurrentScores<4>( d_estimator_total_bin_data ),
                     d_estimator_total_bin_data.size() );
@@ -109,6 +129,9 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataFirstMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   const FourEstimatorMomentsCollection& entity_collection =
     d_entity_estimator_moments_map.find( entity_id )->second;
 
@@ -126,6 +149,9 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataSecondMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   const FourEstimatorMomentsCollection& entity_collection =
     d_entity_estimator_moments_map.find( entity_id )->second;
 
@@ -143,6 +169,9 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataThirdMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   const FourEstimatorMomentsCollection& entity_collection =
     d_entity_estimator_moments_map.find( entity_id )->second;
 
@@ -160,6 +189,9 @@ Utility::ArrayView<const double> EntityEstimator::getEntityBinDataFourthMoments(
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
 
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   const FourEstimatorMomentsCollection& entity_collection =
     d_entity_estimator_moments_map.find( entity_id )->second;
 
@@ -183,6 +215,54 @@ bool EntityEstimator::areSnapshotsOnEntityBinsEnabled() const
   return d_entity_bin_snapshots_enabled;
 }
 
+// Enable interleaved moments
+/*! \details When interleaved moments are enabled the moments will be moved
+ * into collections that store all of the moments of a bin contiguously (see
+ * Utility::InterleavedSampleMomentCollection) at the start of each batch so
+ * that committing a history contribution to a bin only touches a single
+ * cache line. This can significantly reduce the memory traffic of estimators
+ * with many bins (e.g. mesh estimators). The moments are moved back at the
+ * end of each batch (see stopBatch), which is when they can be read. Only
+ * one layout of the moments is stored at any time and enabling interleaved
+ * moments has no effect on the estimator results or the archived estimator
+ * moments.
+ */
+void EntityEstimator::enableInterleavedMoments()
+{
+  d_interleaved_moments_enabled = true;
+}
+
+// Check if interleaved moments have been enabled
+bool EntityEstimator::areInterleavedMomentsEnabled() const
+{
+  return d_interleaved_moments_enabled;
+}
+
+// Prepare the estimator for a batch of histories
+/*! \details The moments will be interleaved if interleaved moments have
+ * been enabled.
+ */
+void EntityEstimator::startBatch()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_interleaved_moments_enabled && !d_moments_interleaved )
+    this->interleaveMoments();
+}
+
+// Finish the batch of histories
+/*! \details The moments will be deinterleaved so that they can be read.
+ */
+void EntityEstimator::stopBatch()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_moments_interleaved )
+    this->deinterleaveMoments();
+}
+
 // Take a snapshot (of the moments)
 void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snapshot,
                                     const double time_since_last_snapshot )
@@ -192,6 +272,12 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
   
   if( d_entity_bin_snapshots_enabled )
   {
+    // Snapshots can only be taken of the deinterleaved moments
+    const bool moments_interleaved = d_moments_interleaved;
+
+    if( moments_interleaved )
+      this->deinterleaveMoments();
+
     d_estimator_total_bin_data_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                        time_since_last_snapshot,
                                                        d_estimator_total_bin_data );
@@ -202,6 +288,9 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
                                        time_since_last_snapshot,
                                        d_entity_estimator_moments_map[entity_data.first] );
     }
+
+    if( moments_interleaved )
+      this->interleaveMoments();
   }
 }
 
@@ -539,6 +628,12 @@ void EntityEstimator::resetData()
   for( auto&& entity_data : d_entity_estimator_moments_map )
     entity_data.second.reset();
 
+  // Reset the interleaved moments
+  d_estimator_total_bin_data_interleaved.reset();
+
+  for( auto&& entity_data : d_entity_estimator_moments_interleaved_map )
+    entity_data.second.reset();
+
   if( d_entity_bin_snapshots_enabled )
   {
     // Reset the total snapshot data
@@ -574,25 +669,22 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
-    // Reduce the entity bin data
-    try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_estimator_moments_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in entity bin "
-                             "estimator " << this->getId() << " for entity "
-                             "bin data!" );
+    // The moments are reduced in the deinterleaved layout (they will be
+    // interleaved again when the next batch is started)
+    if( d_moments_interleaved )
+      this->deinterleaveMoments();
 
-    comm.barrier();
-
-    // Reduce bin data of total
+    // Reduce the entity bin data and the bin data of the total
     try{
-      this->reduceCollection( comm, root_process, d_estimator_total_bin_data );
+      this->reduceEntityCollectionMapAndTotal( comm,
+                                               root_process,
+                                               d_entity_estimator_moments_map,
+                                               d_estimator_total_bin_data );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in entity "
-                             "estimator " << this->getId() << " for total bin "
-                             "data!" );
+                             "estimator " << this->getId() << " for entity "
+                             "and total bin data!" );
 
     if( d_entity_bin_snapshots_enabled )
     {
@@ -640,77 +732,37 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   Estimator::reduceData( comm, root_process );
 }
 
-// Reduce the entity collection maps
-void EntityEstimator::reduceEntityCollectionMaps(
-                    const Utility::Communicator& comm,
-                    const int root_process,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
+// Reduce an entity collection map and the corresponding total collection
+/*! \details The moments of every entity (in entity id order) and of the
+ * total are reduced with a single dense reduction (see
+ * MonteCarlo::Estimator::reduceCollections). Only the root process will
+ * have the reduced moments.
+ */
+void EntityEstimator::reduceEntityCollectionMapAndTotal(
+                  const Utility::Communicator& comm,
+                  const int root_process,
+                  EntityEstimatorMomentsCollectionMap& collection_map,
+                  Estimator::FourEstimatorMomentsCollection& total_collection ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<EntityEstimatorMomentsCollectionMap>
-      gathered_entity_data( comm.size() );
-
-    std::vector<Utility::Communicator::Request> gathered_requests;
-
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
-
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-    
-    Utility::wait( gathered_requests, gathered_statuses );
-    
-    this->reduceEntityCollections( gathered_entity_data,
-                                   root_process,
-                                   collection_map );
-  }
-  else
-    Utility::send( comm, root_process, 0, collection_map );
-}
+  // The unordered map iteration order can differ between processes - the
+  // collections must be packed in entity id order
+  std::vector<EntityId> entity_ids;
+  entity_ids.reserve( collection_map.size() );
 
-// Reduce the entity moments
-void EntityEstimator::reduceEntityCollections(
-                    const std::vector<EntityEstimatorMomentsCollectionMap>&
-                    other_entity_estimator_moments_maps,
-                    const size_t root_index,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
-{
-  // Reduce the data that was on each process
   for( auto&& entity_data : collection_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_moments_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionMap::value_type&
-          other_entity_data = *other_entity_estimator_moments_maps[j].find( entity_data.first );
+    entity_ids.push_back( entity_data.first );
 
-        for( size_t i = 0; i < entity_data.second.size(); ++i )
-        {
-          Utility::getCurrentScore<1>( entity_data.second, i ) +=
-            Utility::getCurrentScore<1>( other_entity_data.second, i );
+  std::sort( entity_ids.begin(), entity_ids.end() );
 
-          Utility::getCurrentScore<2>( entity_data.second, i ) +=
-            Utility::getCurrentScore<2>( other_entity_data.second, i );
+  std::vector<Estimator::FourEstimatorMomentsCollection*> collections;
+  collections.reserve( entity_ids.size() + 1 );
 
-          Utility::getCurrentScore<3>( entity_data.second, i ) +=
-            Utility::getCurrentScore<3>( other_entity_data.second, i );
+  for( size_t i = 0; i < entity_ids.size(); ++i )
+    collections.push_back( &collection_map.find( entity_ids[i] )->second );
 
-          Utility::getCurrentScore<4>( entity_data.second, i ) +=
-            Utility::getCurrentScore<4>( other_entity_data.second, i );
-        }
-      }
-    }
-  }
+  collections.push_back( &total_collection );
+
+  this->reduceCollections( comm, root_process, collections );
 }
 
 // Reduce the entity snapshot maps
@@ -909,6 +961,10 @@ void EntityEstimator::assignEntities(
   // Make sure there is at least one entity
   testPrecondition( entity_norm_data.size() > 0 );
 
+  // The entity data can only be reset in the deinterleaved layout
+  if( d_moments_interleaved )
+    this->deinterleaveMoments();
+
   // Reset the estimator data
   d_total_norm_constant = 1.0;
   d_supplied_norm_constants = true;
@@ -1032,14 +1088,26 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
-    d_entity_estimator_moments_map.find( entity_id )->second;
-
   // Update the moments
-  #pragma omp critical
+  if( d_moments_interleaved )
   {
+    FourEstimatorInterleavedMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_interleaved_map.find( entity_id )->second;
+
+    std::lock_guard<std::mutex> lock( d_interleaved_moments_mutex );
+
     entity_estimator_moments.addRawScore( bin_index, contribution );
   }
+  else
+  {
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_map.find( entity_id )->second;
+
+    #pragma omp critical
+    {
+      entity_estimator_moments.addRawScore( bin_index, contribution );
+    }
+  }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id,
                                                     bin_index,
@@ -1083,14 +1151,120 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
                     this->getNumberOfResponseFunctions() );
 
   // Update the moments
-  #pragma omp critical
+  if( d_moments_interleaved )
   {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    std::lock_guard<std::mutex> lock( d_interleaved_moments_mutex );
+
+    d_estimator_total_bin_data_interleaved.addRawScore( bin_index,
+                                                        contribution );
+  }
+  else
+  {
+    #pragma omp critical
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
 }
 
+// Commit history contributions to bins of an entity
+/*! \details The moments of every bin will be updated in a single critical
+ * section. While the moments are interleaved the moment updates of each bin
+ * are vectorized.
+ */
+void EntityEstimator::commitHistoryContributionsToBinsOfEntity(
+                                     const EntityId entity_id,
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions )
+{
+  // Make sure the entity is assigned to this estimator
+  testPrecondition( this->isEntityAssigned( entity_id ) );
+  // Make sure every bin has a contribution
+  testPrecondition( bin_indices.size() == contributions.size() );
+
+  if( bin_indices.empty() )
+    return;
+
+  // Update the moments
+  if( d_moments_interleaved )
+  {
+    FourEstimatorInterleavedMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_interleaved_map.find( entity_id )->second;
+
+    std::lock_guard<std::mutex> lock( d_interleaved_moments_mutex );
+
+    entity_estimator_moments.addRawScores( bin_indices.data(),
+                                           contributions.data(),
+                                           bin_indices.size() );
+  }
+  else
+  {
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_map.find( entity_id )->second;
+
+    #pragma omp critical
+    {
+      for( size_t i = 0; i < bin_indices.size(); ++i )
+      {
+        entity_estimator_moments.addRawScore( bin_indices[i],
+                                              contributions[i] );
+      }
+    }
+  }
+
+  for( size_t i = 0; i < bin_indices.size(); ++i )
+  {
+    this->addHistoryContributionToEntityBinHistogram( entity_id,
+                                                      bin_indices[i],
+                                                      contributions[i] );
+  }
+}
+
+// Commit history contributions to bins of the total
+/*! \details The moments of every bin will be updated in a single critical
+ * section. While the moments are interleaved the moment updates of each bin
+ * are vectorized.
+ */
+void EntityEstimator::commitHistoryContributionsToBinsOfTotal(
+                                     const std::vector<size_t>& bin_indices,
+                                     const std::vector<double>& contributions )
+{
+  // Make sure every bin has a contribution
+  testPrecondition( bin_indices.size() == contributions.size() );
+
+  if( bin_indices.empty() )
+    return;
+
+  // Update the moments
+  if( d_moments_interleaved )
+  {
+    std::lock_guard<std::mutex> lock( d_interleaved_moments_mutex );
+
+    d_estimator_total_bin_data_interleaved.addRawScores( bin_indices.data(),
+                                                         contributions.data(),
+                                                         bin_indices.size() );
+  }
+  else
+  {
+    #pragma omp critical
+    {
+      for( size_t i = 0; i < bin_indices.size(); ++i )
+      {
+        d_estimator_total_bin_data.addRawScore( bin_indices[i],
+                                                contributions[i] );
+      }
+    }
+  }
+
+  for( size_t i = 0; i < bin_indices.size(); ++i )
+  {
+    this->addHistoryContributionToTotalBinHistogram( bin_indices[i],
+                                                     contributions[i] );
+  }
+}
+
 // Add contribution to total bin histogram
 void EntityEstimator::addHistoryContributionToTotalBinHistogram(
                                                     const size_t bin_index,
@@ -1202,6 +1376,9 @@ void EntityEstimator::printEntityNormConstants(
 const Estimator::FourEstimatorMomentsCollection&
 EntityEstimator::getTotalBinData() const
 {
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return d_estimator_total_bin_data;
 }
 
@@ -1216,6 +1393,9 @@ EntityEstimator::getEntityBinData( const EntityId entity_id ) const
   testPrecondition( d_entity_estimator_moments_map.find( entity_id ) !=
 		    d_entity_estimator_moments_map.end() );
 
+  // Make sure that the moments are not interleaved
+  testPrecondition( !d_moments_interleaved );
+
   return d_entity_estimator_moments_map.find( entity_id )->second;
 }
 
@@ -1272,6 +1452,10 @@ void EntityEstimator::initializeEntityEstimatorHistogramsMap()
 // Resize the entity estimator moments map collections
 void EntityEstimator::resizeEntityEstimatorMapCollections()
 {
+  // The collections can only be resized in the deinterleaved layout
+  if( d_moments_interleaved )
+    this->deinterleaveMoments();
+
   size_t size = this->getNumberOfBins()*this->getNumberOfResponseFunctions();
   
   for( auto&& entity_data : d_entity_estimator_moments_map )
@@ -1281,10 +1465,68 @@ void EntityEstimator::resizeEntityEstimatorMapCollections()
 // Resize the estimator total collection
 void EntityEstimator::resizeEstimatorTotalCollection()
 {
+  // The collection can only be resized in the deinterleaved layout
+  if( d_moments_interleaved )
+    this->deinterleaveMoments();
+
   d_estimator_total_bin_data.resize(
                 this->getNumberOfBins()*this->getNumberOfResponseFunctions() );
 }
 
+// Interleave the moments
+/*! \details The moments of each collection are moved into an interleaved
+ * collection one collection at a time, so at most one extra collection is
+ * stored during the move.
+ */
+void EntityEstimator::interleaveMoments()
+{
+  d_estimator_total_bin_data_interleaved.takeCurrentScores(
+                                                  d_estimator_total_bin_data );
+
+  for( auto&& entity_data : d_entity_estimator_moments_map )
+  {
+    d_entity_estimator_moments_interleaved_map[entity_data.first].takeCurrentScores(
+                                                         entity_data.second );
+  }
+
+  d_moments_interleaved = true;
+}
+
+// Deinterleave the moments
+/*! \details The moments of each interleaved collection are moved back into
+ * the estimator moment collections one collection at a time.
+ */
+void EntityEstimator::deinterleaveMoments()
+{
+  d_estimator_total_bin_data_interleaved.releaseCurrentScores(
+                                                  d_estimator_total_bin_data );
+
+  for( auto&& entity_data : d_entity_estimator_moments_interleaved_map )
+  {
+    entity_data.second.releaseCurrentScores(
+                    d_entity_estimator_moments_map.find( entity_data.first )->second );
+  }
+
+  d_entity_estimator_moments_interleaved_map.clear();
+
+  d_moments_interleaved = false;
+}
+
+// Copy the interleaved moments
+void EntityEstimator::copyInterleavedMoments(
+       FourEstimatorMomentsCollection& estimator_total_bin_data,
+       EntityEstimatorMomentsCollectionMap& entity_estimator_moments_map ) const
+{
+  d_estimator_total_bin_data_interleaved.copyCurrentScores(
+                                                    estimator_total_bin_data );
+
+  for( auto&& entity_data : d_entity_estimator_moments_interleaved_map )
+  {
+    entity_data.second.copyCurrentScores(
+                             entity_estimator_moments_map[entity_data.first] );
+  }
+}
+
 // Resize the entity estimator snapshots
 void EntityEstimator::resizeEntityEstimatorMapSnapshots()
 {
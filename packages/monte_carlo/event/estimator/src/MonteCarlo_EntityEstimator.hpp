@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_ENTITY_ESTIMATOR_HPP
 #define MONTE_CARLO_ENTITY_ESTIMATOR_HPP
 
+// Std Lib Includes
+#include <mutex>
+
 // FRENSIE Includes
 #include "MonteCarlo_Estimator.hpp"
 #include "Utility_Map.hpp"
@@ -26,6 +29,10 @@ protected:
   typedef std::unordered_map<EntityId,Estimator::FourEstimatorMomentsCollection>
   EntityEstimatorMomentsCollectionMap;
 
+  //! Typedef for the map of entity ids and interleaved estimator moments
+  typedef std::unordered_map<EntityId,Estimator::FourEstimatorInterleavedMomentsCollection>
+  EntityEstimatorInterleavedMomentsCollectionMap;
+
   //! Typedef for the map of entity ids and the estimator moments snapshots
   typedef std::unordered_map<EntityId,Estimator::FourEstimatorMomentsCollectionSnapshots>
   EntityEstimatorMomentsCollectionSnapshotsMap;
@@ -101,6 +108,18 @@ public:
   //! Check if snapshots have been enabled on entity bins
   bool areSnapshotsOnEntityBinsEnabled() const final override;
 
+  //! Enable interleaved moments
+  void enableInterleavedMoments();
+
+  //! Check if interleaved moments have been enabled
+  bool areInterleavedMomentsEnabled() const;
+
+  //! Prepare the estimator for a batch of histories
+  void startBatch() override;
+
+  //! Finish the batch of histories
+  void stopBatch() override;
+
   //! Take a snapshot (of the moments)
   void takeSnapshot( const uint64_t num_histories_since_last_snapshot,
                      const double time_since_last_snapshot ) override;
@@ -222,6 +241,17 @@ protected:
   void commitHistoryContributionToBinOfTotal( const size_t bin_index,
 					      const double contribution );
 
+  //! Commit history contributions to bins of an entity
+  void commitHistoryContributionsToBinsOfEntity(
+                                    const EntityId entity_id,
+                                    const std::vector<size_t>& bin_indices,
+                                    const std::vector<double>& contributions );
+
+  //! Commit history contributions to bins of total
+  void commitHistoryContributionsToBinsOfTotal(
+                                    const std::vector<size_t>& bin_indices,
+                                    const std::vector<double>& contributions );
+
   //! Print the estimator data
   virtual void printImplementation( std::ostream& os,
 				    const std::string& entity_type ) const;
@@ -232,11 +262,12 @@ protected:
   //! Get the bin data for an entity
   const Estimator::FourEstimatorMomentsCollection& getEntityBinData( const EntityId entity_id ) const;
 
-  //! Reduce the entity collection maps
-  void reduceEntityCollectionMaps(
-                   const Utility::Communicator& comm,
-                   const int root_process,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
+  //! Reduce an entity collection map and the corresponding total collection
+  void reduceEntityCollectionMapAndTotal(
+                 const Utility::Communicator& comm,
+                 const int root_process,
+                 EntityEstimatorMomentsCollectionMap& collection_map,
+                 Estimator::FourEstimatorMomentsCollection& total_collection ) const;
 
   //! Reduce the entity snapshot maps
   void reduceEntitySnapshotMaps(
@@ -302,6 +333,17 @@ private:
   // Resize the estimator total histograms
   void resizeEstimatorTotalHistograms();
 
+  // Interleave the moments
+  void interleaveMoments();
+
+  // Deinterleave the moments
+  void deinterleaveMoments();
+
+  // Copy the interleaved moments
+  void copyInterleavedMoments(
+      FourEstimatorMomentsCollection& estimator_total_bin_data,
+      EntityEstimatorMomentsCollectionMap& entity_estimator_moments_map ) const;
+
   // Add contribution to entity bin histogram
   void addHistoryContributionToEntityBinHistogram( const EntityId entity_id,
                                                    const size_t bin_index,
@@ -311,13 +353,6 @@ private:
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
 
-  // Reduce the entity collections
-  void reduceEntityCollections(
-                   const std::vector<EntityEstimatorMomentsCollectionMap>&
-                   other_entity_estimator_moments_maps,
-                   const size_t root_index,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
-
   // Reduce the entity snapshots
   void reduceEntitySnapshots(
            const std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>&
@@ -361,11 +396,30 @@ private:
   bool d_supplied_norm_constants;
 
   // The estimator moments (1st,2nd,3rd,4th) for each bin of the total
+  // (empty while the moments are interleaved)
   FourEstimatorMomentsCollection d_estimator_total_bin_data;
 
   // The estimator moments (1st,2nd,3rd,4th) for each bin and each entity
+  // (empty while the moments are interleaved)
   EntityEstimatorMomentsCollectionMap d_entity_estimator_moments_map;
 
+  // Bool that records if interleaved moments have been enabled
+  bool d_interleaved_moments_enabled;
+
+  // Bool that records if the moments are currently interleaved
+  bool d_moments_interleaved;
+
+  // The interleaved estimator moments for each bin of the total (only
+  // used while a batch is simulated)
+  FourEstimatorInterleavedMomentsCollection d_estimator_total_bin_data_interleaved;
+
+  // The interleaved estimator moments for each bin and each entity (only
+  // used while a batch is simulated)
+  EntityEstimatorInterleavedMomentsCollectionMap d_entity_estimator_moments_interleaved_map;
+
+  // The interleaved moments mutex
+  std::mutex d_interleaved_moments_mutex;
+
   // Bool that record if entity bin moment snapshots have been enabled
   bool d_entity_bin_snapshots_enabled;
 
@@ -393,7 +447,7 @@ private:
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes.
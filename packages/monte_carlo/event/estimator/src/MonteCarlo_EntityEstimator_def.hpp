@@ -30,6 +30,11 @@ EntityEstimator::EntityEstimator(
     d_supplied_norm_constants( true ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_interleaved_moments_enabled( false ),
+    d_moments_interleaved( false ),
+    d_estimator_total_bin_data_interleaved(),
+    d_entity_estimator_moments_interleaved_map(),
+    d_interleaved_moments_mutex(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -70,6 +75,11 @@ EntityEstimator::EntityEstimator( const Id id,
     d_supplied_norm_constants( false ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_interleaved_moments_enabled( false ),
+    d_moments_interleaved( false ),
+    d_estimator_total_bin_data_interleaved(),
+    d_entity_estimator_moments_interleaved_map(),
+    d_interleaved_moments_mutex(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -165,8 +175,27 @@ void EntityEstimator::serialize( Archive& ar, const unsigned version )
   // Serialize the local data
   ar & BOOST_SERIALIZATION_NVP( d_total_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_supplied_norm_constants );
-  ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_moments_map );
+
+  // The archived moments do not depend on the moment layout (a
+  // deinterleaved copy is saved while the moments are interleaved)
+  if( Archive::is_saving::value && d_moments_interleaved )
+  {
+    FourEstimatorMomentsCollection estimator_total_bin_data;
+    EntityEstimatorMomentsCollectionMap entity_estimator_moments_map;
+
+    this->copyInterleavedMoments( estimator_total_bin_data,
+                                  entity_estimator_moments_map );
+
+    ar & boost::serialization::make_nvp( "d_estimator_total_bin_data",
+                                         estimator_total_bin_data );
+    ar & boost::serialization::make_nvp( "d_entity_estimator_moments_map",
+                                         entity_estimator_moments_map );
+  }
+  else
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data );
+    ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_moments_map );
+  }
   ar & BOOST_SERIALIZATION_NVP( d_entity_bin_snapshots_enabled );
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data_snapshots );
   ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_moments_snapshots_map );
@@ -174,6 +203,20 @@ void EntityEstimator::serialize( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
   ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_histograms_map );
   ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_interleaved_moments_enabled );
+  else
+    d_interleaved_moments_enabled = false;
+
+  // The loaded moments are not interleaved (see startBatch)
+  if( Archive::is_loading::value )
+  {
+    d_moments_interleaved = false;
+
+    d_estimator_total_bin_data_interleaved.clear();
+    d_entity_estimator_moments_interleaved_map.clear();
+  }
 }
 
 } // end MonteCarlo namespace
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <limits>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -68,6 +69,8 @@ void Estimator::addResponseFunction(
   testPrecondition( response_function.get() );
 
   this->assignResponseFunction( response_function );
+
+  this->updateResponseFunctionValueCacheIndices();
 }
 
 // Set the response functions
@@ -94,6 +97,8 @@ void Estimator::setResponseFunctions(
   // rejected add the default.
   if( d_response_functions.empty() )
     d_response_functions.push_back( ParticleResponse::getDefault() );
+
+  this->updateResponseFunctionValueCacheIndices();
 }
 
 // Return the number of response functions
@@ -102,6 +107,53 @@ size_t Estimator::getNumberOfResponseFunctions() const
   return d_response_functions.size();
 }
 
+// Return a response function
+const std::shared_ptr<const ParticleResponse>& Estimator::getResponseFunction(
+                                   const size_t response_function_index ) const
+{
+  // Make sure the response function index is valid
+  testPrecondition( response_function_index <
+                    this->getNumberOfResponseFunctions() );
+
+  return d_response_functions[response_function_index];
+}
+
+// Set the response function value cache
+/*! \details Response functions that are stored in the cache will be
+ * evaluated through the cache (see
+ * MonteCarlo::ResponseFunctionValueCache). The remaining response functions
+ * will be evaluated directly. A null pointer will remove the cache.
+ */
+void Estimator::setResponseFunctionValueCache(
+                     const std::shared_ptr<ResponseFunctionValueCache>& cache )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_response_function_value_cache = cache;
+
+  this->updateResponseFunctionValueCacheIndices();
+}
+
+// Update the response function value cache indices
+void Estimator::updateResponseFunctionValueCacheIndices()
+{
+  d_response_function_value_cache_indices.clear();
+
+  if( d_response_function_value_cache )
+  {
+    d_response_function_value_cache_indices.resize(
+                                                d_response_functions.size() );
+
+    for( size_t i = 0; i < d_response_functions.size(); ++i )
+    {
+      d_response_function_value_cache_indices[i] =
+        d_response_function_value_cache->getResponseFunctionIndex(
+                                                     d_response_functions[i] );
+    }
+  }
+}
+
 // Set the particle types that can contribute to the estimator
 /*! \details Before each particle type is assigned the object will check
  * if the particle type is compatible with the estimator type (e.g. cell
@@ -230,6 +282,22 @@ void Estimator::enableThreadSupport( const unsigned num_threads )
   d_has_uncommitted_history_contribution.resize( num_threads, false );
 }
 
+// Prepare the estimator for a batch of histories
+/*! \details This will be called before the histories of a batch are
+ * simulated. The estimator data can only be read between batches. Estimators
+ * that score the history contributions into a different data layout can
+ * switch layouts here (the default implementation does nothing).
+ */
+void Estimator::startBatch()
+{ /* ... */ }
+
+// Finish the batch of histories
+/*! \details This will be called after the histories of a batch have been
+ * simulated (the default implementation does nothing).
+ */
+void Estimator::stopBatch()
+{ /* ... */ }
+
 // Reduce estimator data on all processes and collect on the root process
 void Estimator::reduceData( const Utility::Communicator& comm,
                             const int root_process )
@@ -1034,38 +1102,9 @@ void Estimator::reduceCollection(
                               const int root_process,
                               TwoEstimatorMomentsCollection& collection ) const
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
-
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-    }
-  }
-
-  comm.barrier();
+  this->reduceCollectionsImpl( comm,
+                               root_process,
+                               std::vector<TwoEstimatorMomentsCollection*>( 1, &collection ) );
 }
 
 // Reduce a single collection
@@ -1074,59 +1113,82 @@ void Estimator::reduceCollection(
                              const int root_process,
                              FourEstimatorMomentsCollection& collection ) const
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
+  this->reduceCollectionsImpl( comm,
+                               root_process,
+                               std::vector<FourEstimatorMomentsCollection*>( 1, &collection ) );
+}
 
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
+// Reduce a set of collections
+/*! \details All of the collections will be reduced using a single reduction
+ * (see MonteCarlo::Estimator::reduceCollectionsImpl). Every process must
+ * pass the collections in the same order.
+ */
+void Estimator::reduceCollections(
+           const Utility::Communicator& comm,
+           const int root_process,
+           const std::vector<FourEstimatorMomentsCollection*>& collections ) const
+{
+  this->reduceCollectionsImpl( comm, root_process, collections );
+}
 
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
+// Pack the moments of a collection into a reduction buffer
+void Estimator::packCollection(
+                           const TwoEstimatorMomentsCollection& collection,
+                           std::vector<double>& buffer )
+{
+  const double* first_moments = Utility::getCurrentScores<1>( collection );
+  const double* second_moments = Utility::getCurrentScores<2>( collection );
 
-  comm.barrier();
+  buffer.insert( buffer.end(), first_moments, first_moments+collection.size() );
+  buffer.insert( buffer.end(), second_moments, second_moments+collection.size() );
+}
 
-  // Reduce the third moments
-  std::vector<double> reduced_third_moments;
+// Pack the moments of a collection into a reduction buffer
+void Estimator::packCollection(
+                          const FourEstimatorMomentsCollection& collection,
+                          std::vector<double>& buffer )
+{
+  const double* first_moments = Utility::getCurrentScores<1>( collection );
+  const double* second_moments = Utility::getCurrentScores<2>( collection );
+  const double* third_moments = Utility::getCurrentScores<3>( collection );
+  const double* fourth_moments = Utility::getCurrentScores<4>( collection );
 
-  this->reduceCollectionAndReturnReducedMoments<3>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_third_moments );
+  buffer.insert( buffer.end(), first_moments, first_moments+collection.size() );
+  buffer.insert( buffer.end(), second_moments, second_moments+collection.size() );
+  buffer.insert( buffer.end(), third_moments, third_moments+collection.size() );
+  buffer.insert( buffer.end(), fourth_moments, fourth_moments+collection.size() );
+}
 
-  comm.barrier();
+// Unpack the moments of a collection from a reduction buffer
+/*! \details A pointer to the first unused buffer element will be returned.
+ */
+const double* Estimator::unpackCollection(
+                                   const double* buffer,
+                                   TwoEstimatorMomentsCollection& collection )
+{
+  const size_t size = collection.size();
 
-  // Reduce the fourth moments
-  std::vector<double> reduced_fourth_moments;
+  std::copy( buffer, buffer+size, Utility::getCurrentScores<1>( collection ) );
+  std::copy( buffer+size, buffer+2*size, Utility::getCurrentScores<2>( collection ) );
 
-  this->reduceCollectionAndReturnReducedMoments<4>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_fourth_moments );
+  return buffer+2*size;
+}
 
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-      Utility::getCurrentScore<3>( collection, i ) = reduced_third_moments[i];
-      Utility::getCurrentScore<4>( collection, i ) = reduced_fourth_moments[i];
-    }
-  }
+// Unpack the moments of a collection from a reduction buffer
+/*! \details A pointer to the first unused buffer element will be returned.
+ */
+const double* Estimator::unpackCollection(
+                                  const double* buffer,
+                                  FourEstimatorMomentsCollection& collection )
+{
+  const size_t size = collection.size();
+
+  std::copy( buffer, buffer+size, Utility::getCurrentScores<1>( collection ) );
+  std::copy( buffer+size, buffer+2*size, Utility::getCurrentScores<2>( collection ) );
+  std::copy( buffer+2*size, buffer+3*size, Utility::getCurrentScores<3>( collection ) );
+  std::copy( buffer+3*size, buffer+4*size, Utility::getCurrentScores<4>( collection ) );
 
-  comm.barrier();
+  return buffer+4*size;
 }
 
 // Reduce snapshots
@@ -1201,6 +1263,20 @@ double Estimator::evaluateResponseFunction(
   // Make sure the response function index is valid
   testPrecondition( response_function_index < this->getNumberOfResponseFunctions() );
 
+  if( !d_response_function_value_cache_indices.empty() )
+  {
+    const size_t cache_index =
+      d_response_function_value_cache_indices[response_function_index];
+
+    if( cache_index <
+        d_response_function_value_cache->getNumberOfResponseFunctions() )
+    {
+      return d_response_function_value_cache->evaluateResponseFunction(
+                                                                particle,
+                                                                cache_index );
+    }
+  }
+
   return d_response_functions[response_function_index]->evaluate( particle );
 }
 
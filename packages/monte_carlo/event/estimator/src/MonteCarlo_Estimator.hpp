@@ -25,10 +25,12 @@
 #include "MonteCarlo_ParticleType.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
 #include "MonteCarlo_ParticleResponse.hpp"
+#include "MonteCarlo_ResponseFunctionValueCache.hpp"
 #include "MonteCarlo_UniqueIdManager.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_SampleMomentCollection.hpp"
+#include "Utility_InterleavedSampleMomentCollection.hpp"
 #include "Utility_SampleMomentCollectionSnapshots.hpp"
 #include "Utility_SampleMomentHistogram.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -56,6 +58,9 @@ protected:
   //! Typedef for the collection of estimator moments
   typedef Utility::SampleMomentCollection<double,4,3,2,1> FourEstimatorMomentsCollection;
 
+  //! Typedef for the interleaved collection of estimator moments
+  typedef Utility::InterleavedSampleMomentCollection<double,4,3,2,1> FourEstimatorInterleavedMomentsCollection;
+
   //! Typedef for the estimator moments snapshots
   typedef Utility::SampleMomentCollectionSnapshots<double,std::list,4,3,2,1> FourEstimatorMomentsCollectionSnapshots;
 
@@ -98,6 +103,13 @@ public:
   //! Return the number of response functions
   size_t getNumberOfResponseFunctions() const;
 
+  //! Return a response function
+  const std::shared_ptr<const ParticleResponse>& getResponseFunction(
+                                  const size_t response_function_index ) const;
+
+  //! Set the response function value cache
+  void setResponseFunctionValueCache( const std::shared_ptr<ResponseFunctionValueCache>& cache );
+
   //! Set the particle types that can contribute to the estimator
   void setParticleTypes( const std::set<ParticleType>& particle_types );
 
@@ -446,6 +458,12 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads ) override;
 
+  //! Prepare the estimator for a batch of histories
+  virtual void startBatch();
+
+  //! Finish the batch of histories
+  virtual void stopBatch();
+
   //! Reduce estimator data on all processes and collect on the root process
   void reduceData( const Utility::Communicator& comm,
                    const int root_process ) override;
@@ -491,6 +509,12 @@ protected:
                       const int root_process,
                       FourEstimatorMomentsCollection& collection ) const;
 
+  //! Reduce a set of collections
+  void reduceCollections(
+          const Utility::Communicator& comm,
+          const int root_process,
+          const std::vector<FourEstimatorMomentsCollection*>& collections ) const;
+
   //! Reduce snapshots
   void reduceSnapshots(
                     const Utility::Communicator& comm,
@@ -563,6 +587,9 @@ private:
   // Get the default sample moment histogram bins
   static const std::shared_ptr<const std::vector<double> >& getDefaultSampleMomentHistogramBins();
 
+  // Update the response function value cache indices
+  void updateResponseFunctionValueCacheIndices();
+
   // Convert first and second moments to mean and relative error
   void processMoments( const Utility::SampleMoment<1,double>& first_moment,
                        const Utility::SampleMoment<2,double>& second_moment,
@@ -605,13 +632,29 @@ private:
                        double& variance_of_variance,
                        double& figure_of_merit ) const;
 
-  // Reduce a single collection and return the reduced moments
-  template<size_t N, typename Collection>
-  void reduceCollectionAndReturnReducedMoments(
-                                  const Utility::Communicator& comm,
-                                  const int root_process,
-                                  const Collection& collection,
-                                  std::vector<double>& reduced_moments ) const;
+  // Reduce a set of collections using a single dense moment buffer
+  template<typename Collection>
+  void reduceCollectionsImpl( const Utility::Communicator& comm,
+                              const int root_process,
+                              const std::vector<Collection*>& collections ) const;
+
+  // Pack the moments of a collection into a reduction buffer
+  static void packCollection( const TwoEstimatorMomentsCollection& collection,
+                              std::vector<double>& buffer );
+
+  // Pack the moments of a collection into a reduction buffer
+  static void packCollection( const FourEstimatorMomentsCollection& collection,
+                              std::vector<double>& buffer );
+
+  // Unpack the moments of a collection from a reduction buffer
+  static const double* unpackCollection(
+                                  const double* buffer,
+                                  TwoEstimatorMomentsCollection& collection );
+
+  // Unpack the moments of a collection from a reduction buffer
+  static const double* unpackCollection(
+                                 const double* buffer,
+                                 FourEstimatorMomentsCollection& collection );
 
   // Save the data to an archive
   template<typename Archive>
@@ -641,6 +684,12 @@ private:
   // The response functions
   std::vector<std::shared_ptr<const ParticleResponse> > d_response_functions;
 
+  // The response function value cache (shared with other estimators)
+  std::shared_ptr<ResponseFunctionValueCache> d_response_function_value_cache;
+
+  // The response function value cache index of each response function
+  std::vector<size_t> d_response_function_value_cache_indices;
+
   // The sample moment histogram bins
   std::shared_ptr<const std::vector<double> > d_sample_moment_histogram_bins;
 
@@ -39,30 +39,53 @@ void Estimator::calculateBinIndicesOfPoint(
     bin_indices[i] += response_function_index*this->getNumberOfBins();
 }
 
-// Reduce a single collection and return the reduced moments
-template<size_t N, typename Collection>
-void Estimator::reduceCollectionAndReturnReducedMoments(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             const Collection& collection,
-                             std::vector<double>& reduced_moments ) const
+// Reduce a set of collections using a single dense moment buffer
+/*! \details The moments of every collection are packed into one contiguous
+ * buffer, which is reduced with a single sum reduction (MPI_Reduce with
+ * MPI_SUM). The MPI implementation is free to use a tree-based algorithm so
+ * the cost on the root process no longer grows linearly with the number of
+ * processes. Every process must pass the collections in the same order.
+ */
+template<typename Collection>
+void Estimator::reduceCollectionsImpl(
+                          const Utility::Communicator& comm,
+                          const int root_process,
+                          const std::vector<Collection*>& collections ) const
 {
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Resize the reduced moments array
-  reduced_moments.resize( collection.size() );
+  // Pack the local moments
+  std::vector<double> local_moments;
+
+  for( size_t i = 0; i < collections.size(); ++i )
+    Estimator::packCollection( *collections[i], local_moments );
+
+  // Reduce the moments
+  std::vector<double> reduced_moments( local_moments.size() );
 
   try{
     Utility::reduce( comm,
-                     Utility::ArrayView<const double>( Utility::getCurrentScores<N>( collection ), collection.size() ),
+                     Utility::arrayViewOfConst( local_moments ),
                      Utility::arrayView( reduced_moments ),
                      std::plus<double>(),
                      root_process );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                           "Unable to perform mpi reduction over moments of "
-                           "order " << N << " for estimator " << d_id << "!" );
+                           "Unable to perform mpi reduction over the moments "
+                           "of estimator " << d_id << "!" );
+
+  // The root process will store the reduced moments
+  if( comm.rank() == root_process )
+  {
+    const double* reduced_moments_it = reduced_moments.data();
+
+    for( size_t i = 0; i < collections.size(); ++i )
+    {
+      reduced_moments_it =
+        Estimator::unpackCollection( reduced_moments_it, *collections[i] );
+    }
+  }
 }
 
 // Save the data to an archive
@@ -0,0 +1,587 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  The relative error particle history simulation completion
+//!         criterion class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <functional>
+#include <numeric>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.hpp"
+#include "Utility_SampleMoment.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+RelativeErrorParticleHistorySimulationCompletionCriterion::RelativeErrorParticleHistorySimulationCompletionCriterion()
+  : d_max_relative_error( 0.0 ),
+    d_max_relative_vov( Utility::QuantityTraits<double>::inf() ),
+    d_ignore_unscored_bins( true ),
+    d_estimator_bins(),
+    d_num_completed_histories( 1, 0 ),
+    d_sampling_time( 0.0 ),
+    d_count_histories( false ),
+    d_use_root_process_decision( false ),
+    d_check_required( true ),
+    d_converged( false ),
+    d_largest_relative_error( Utility::QuantityTraits<double>::inf() ),
+    d_largest_relative_vov( Utility::QuantityTraits<double>::inf() )
+{ /* ... */ }
+
+// Constructor
+RelativeErrorParticleHistorySimulationCompletionCriterion::RelativeErrorParticleHistorySimulationCompletionCriterion(
+                                               const double max_relative_error,
+                                               const double max_relative_vov )
+  : d_max_relative_error( max_relative_error ),
+    d_max_relative_vov( max_relative_vov ),
+    d_ignore_unscored_bins( true ),
+    d_estimator_bins(),
+    d_num_completed_histories( 1, 0 ),
+    d_sampling_time( 0.0 ),
+    d_count_histories( false ),
+    d_use_root_process_decision( false ),
+    d_check_required( true ),
+    d_converged( false ),
+    d_largest_relative_error( Utility::QuantityTraits<double>::inf() ),
+    d_largest_relative_vov( Utility::QuantityTraits<double>::inf() )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than 0.0!" );
+
+  TEST_FOR_EXCEPTION( max_relative_vov <= 0.0,
+                      std::runtime_error,
+                      "The max relative variance of the variance must be "
+                      "greater than 0.0!" );
+}
+
+// Add estimator total bins to the criterion (all bins by default)
+/*! \details If no bin indices are given all of the bins that the estimator
+ * currently has will be checked. The estimator discretization and response
+ * functions should therefore be set before the bins are added.
+ */
+void RelativeErrorParticleHistorySimulationCompletionCriterion::addEstimatorTotalBins(
+                            const std::shared_ptr<const Estimator>& estimator,
+                            const std::vector<size_t>& bin_indices )
+{
+  this->addEstimatorBins( estimator, false, 0, bin_indices );
+}
+
+// Add estimator entity bins to the criterion (all bins by default)
+/*! \details If no bin indices are given all of the bins that the estimator
+ * currently has will be checked. The estimator discretization and response
+ * functions should therefore be set before the bins are added.
+ */
+void RelativeErrorParticleHistorySimulationCompletionCriterion::addEstimatorEntityBins(
+                            const std::shared_ptr<const Estimator>& estimator,
+                            const EntityId entity_id,
+                            const std::vector<size_t>& bin_indices )
+{
+  TEST_FOR_EXCEPTION( estimator.get() &&
+                      !estimator->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << estimator->getId() << "!" );
+
+  this->addEstimatorBins( estimator, true, entity_id, bin_indices );
+}
+
+// Add estimator bins to the criterion
+void RelativeErrorParticleHistorySimulationCompletionCriterion::addEstimatorBins(
+                            const std::shared_ptr<const Estimator>& estimator,
+                            const bool use_entity_bins,
+                            const EntityId entity_id,
+                            const std::vector<size_t>& bin_indices )
+{
+  TEST_FOR_EXCEPTION( !estimator,
+                      std::runtime_error,
+                      "Cannot add the bins of a null estimator to the "
+                      "relative error completion criterion!" );
+
+  const size_t number_of_bins = estimator->getNumberOfBins()*
+    estimator->getNumberOfResponseFunctions();
+
+  EstimatorBins estimator_bins;
+  estimator_bins.estimator = estimator;
+  estimator_bins.use_entity_bins = use_entity_bins;
+  estimator_bins.entity_id = entity_id;
+
+  if( bin_indices.empty() )
+  {
+    estimator_bins.bin_indices.resize( number_of_bins );
+
+    std::iota( estimator_bins.bin_indices.begin(),
+               estimator_bins.bin_indices.end(),
+               0 );
+  }
+  else
+  {
+    for( size_t i = 0; i < bin_indices.size(); ++i )
+    {
+      TEST_FOR_EXCEPTION( bin_indices[i] >= number_of_bins,
+                          std::runtime_error,
+                          "Bin " << bin_indices[i] << " does not exist in "
+                          "estimator " << estimator->getId() << " (it only "
+                          "has " << number_of_bins << " bins)!" );
+    }
+
+    estimator_bins.bin_indices = bin_indices;
+  }
+
+  d_estimator_bins.push_back( estimator_bins );
+
+  d_check_required = true;
+}
+
+// Get the number of bins that are checked
+size_t RelativeErrorParticleHistorySimulationCompletionCriterion::getNumberOfBins() const
+{
+  size_t number_of_bins = 0;
+
+  for( size_t i = 0; i < d_estimator_bins.size(); ++i )
+    number_of_bins += d_estimator_bins[i].bin_indices.size();
+
+  return number_of_bins;
+}
+
+// Get the max relative error
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Get the max relative variance of the variance
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getMaxRelativeVOV() const
+{
+  return d_max_relative_vov;
+}
+
+// Set if the selected bins that have not been scored in are ignored
+/*! \details By default the selected bins that have not been scored in
+ * (i.e. the first moment is zero) are ignored so that a bin that can never
+ * be scored in (e.g. an energy bin below the source energy) will not prevent
+ * the simulation from completing. At least one of the selected bins must
+ * have been scored in before the simulation can be complete. If unscored
+ * bins are not ignored, every selected bin must have been scored in before
+ * the simulation can be complete.
+ */
+void RelativeErrorParticleHistorySimulationCompletionCriterion::ignoreUnscoredBins(
+                                              const bool ignore_unscored_bins )
+{
+  d_ignore_unscored_bins = ignore_unscored_bins;
+
+  d_check_required = true;
+}
+
+// Check if the selected bins that have not been scored in are ignored
+bool RelativeErrorParticleHistorySimulationCompletionCriterion::areUnscoredBinsIgnored() const
+{
+  return d_ignore_unscored_bins;
+}
+
+// Get the number of completed histories
+uint64_t RelativeErrorParticleHistorySimulationCompletionCriterion::getNumberOfCompletedHistories() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  return std::accumulate( d_num_completed_histories.begin(),
+                          d_num_completed_histories.end(),
+                          (uint64_t)0 );
+}
+
+// Get the largest relative error of the checked bins
+/*! \details A bin that has not been scored in yet has an infinite relative
+ * error (unless unscored bins are ignored). If no bins have been scored in
+ * the largest relative error will be infinite.
+ */
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getLargestRelativeError() const
+{
+  if( this->isCheckRequired() )
+    this->checkEstimatorBins();
+
+  return d_largest_relative_error;
+}
+
+// Get the largest relative variance of the variance of the checked bins
+/*! \details The relative variance of the variance will only be calculated
+ * if a max relative variance of the variance has been set (the largest
+ * value will be zero otherwise).
+ */
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getLargestRelativeVOV() const
+{
+  if( this->isCheckRequired() )
+    this->checkEstimatorBins();
+
+  return d_largest_relative_vov;
+}
+
+// Get the sampling time (the sum of the times between snapshots)
+/*! \details Only the snapshots that are taken while the criterion is
+ * active are included. The sampling time of the root process is kept when
+ * the data is reduced (the processes sample concurrently).
+ */
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getSamplingTime() const
+{
+  return d_sampling_time;
+}
+
+// Get the figure of merit of the checked bin with the largest rel. error
+/*! \details The figure of merit is calculated from the largest relative
+ * error and the sampling time (see
+ * MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion::getSamplingTime).
+ * If the largest relative error is infinite or no time has been sampled the
+ * figure of merit will be zero.
+ */
+double RelativeErrorParticleHistorySimulationCompletionCriterion::getFigureOfMerit() const
+{
+  const double largest_relative_error = this->getLargestRelativeError();
+
+  if( d_sampling_time > 0.0 &&
+      largest_relative_error < Utility::QuantityTraits<double>::inf() )
+    return Utility::calculateFOM( largest_relative_error, d_sampling_time );
+  else
+    return 0.0;
+}
+
+// Check if the simulation is complete
+bool RelativeErrorParticleHistorySimulationCompletionCriterion::isSimulationComplete() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->isCheckRequired() )
+    this->checkEstimatorBins();
+
+  return d_converged;
+}
+
+// Check if the selected estimator bins must be checked again
+/*! \details The non-root processes of a distributed simulation use the
+ * decision that was broadcast by the root process when the data was last
+ * reduced instead of checking their (partial) estimator moments.
+ */
+bool RelativeErrorParticleHistorySimulationCompletionCriterion::isCheckRequired() const
+{
+  return d_check_required && !d_use_root_process_decision;
+}
+
+// Check the selected estimator bins
+void RelativeErrorParticleHistorySimulationCompletionCriterion::checkEstimatorBins() const
+{
+  const uint64_t number_of_histories = this->getNumberOfCompletedHistories();
+
+  const bool check_vov =
+    d_max_relative_vov < Utility::QuantityTraits<double>::inf();
+
+  double largest_relative_error = 0.0;
+  double largest_relative_vov = 0.0;
+
+  // The number of checked bins that have been scored in
+  size_t number_of_scored_bins = 0;
+
+  if( number_of_histories < 2 || d_estimator_bins.empty() )
+  {
+    largest_relative_error = Utility::QuantityTraits<double>::inf();
+
+    if( check_vov )
+      largest_relative_vov = Utility::QuantityTraits<double>::inf();
+  }
+  else
+  {
+    for( size_t i = 0; i < d_estimator_bins.size(); ++i )
+    {
+      const EstimatorBins& estimator_bins = d_estimator_bins[i];
+
+      Utility::ArrayView<const double> first_moments, second_moments,
+        third_moments, fourth_moments;
+
+      if( estimator_bins.use_entity_bins )
+      {
+        first_moments = estimator_bins.estimator->getEntityBinDataFirstMoments( estimator_bins.entity_id );
+        second_moments = estimator_bins.estimator->getEntityBinDataSecondMoments( estimator_bins.entity_id );
+
+        if( check_vov )
+        {
+          third_moments = estimator_bins.estimator->getEntityBinDataThirdMoments( estimator_bins.entity_id );
+          fourth_moments = estimator_bins.estimator->getEntityBinDataFourthMoments( estimator_bins.entity_id );
+        }
+      }
+      else
+      {
+        first_moments = estimator_bins.estimator->getTotalBinDataFirstMoments();
+        second_moments = estimator_bins.estimator->getTotalBinDataSecondMoments();
+
+        if( check_vov )
+        {
+          third_moments = estimator_bins.estimator->getTotalBinDataThirdMoments();
+          fourth_moments = estimator_bins.estimator->getTotalBinDataFourthMoments();
+        }
+      }
+
+      for( size_t j = 0; j < estimator_bins.bin_indices.size(); ++j )
+      {
+        const size_t bin_index = estimator_bins.bin_indices[j];
+
+        // A bin that has not been scored in has not converged (unless
+        // unscored bins are ignored)
+        if( first_moments[bin_index] == 0.0 )
+        {
+          if( !d_ignore_unscored_bins )
+          {
+            largest_relative_error = Utility::QuantityTraits<double>::inf();
+
+            if( check_vov )
+              largest_relative_vov = Utility::QuantityTraits<double>::inf();
+          }
+
+          continue;
+        }
+
+        ++number_of_scored_bins;
+
+        // The statistics of a bin with a negative first moment are
+        // calculated from the magnitude of the scores (the odd moments
+        // change sign)
+        const double sign = (first_moments[bin_index] < 0.0 ? -1.0 : 1.0);
+
+        const Utility::SampleMoment<1,double>
+          first_moment( sign*first_moments[bin_index] );
+        const Utility::SampleMoment<2,double>
+          second_moment( second_moments[bin_index] );
+
+        largest_relative_error =
+          std::max( largest_relative_error,
+                    Utility::calculateRelativeError( first_moment,
+                                                     second_moment,
+                                                     number_of_histories ) );
+
+        if( check_vov )
+        {
+          largest_relative_vov =
+            std::max( largest_relative_vov,
+                      Utility::calculateRelativeVOV(
+                        first_moment,
+                        second_moment,
+                        Utility::SampleMoment<3,double>( sign*third_moments[bin_index] ),
+                        Utility::SampleMoment<4,double>( fourth_moments[bin_index] ),
+                        number_of_histories ) );
+        }
+      }
+    }
+
+    // At least one bin must have been scored in
+    if( number_of_scored_bins == 0 )
+    {
+      largest_relative_error = Utility::QuantityTraits<double>::inf();
+
+      if( check_vov )
+        largest_relative_vov = Utility::QuantityTraits<double>::inf();
+    }
+  }
+
+  d_largest_relative_error = largest_relative_error;
+  d_largest_relative_vov = largest_relative_vov;
+
+  d_converged = (largest_relative_error <= d_max_relative_error) &&
+    (largest_relative_vov <= d_max_relative_vov);
+
+  d_check_required = false;
+}
+
+// Start the criterion
+void RelativeErrorParticleHistorySimulationCompletionCriterion::start()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_count_histories = true;
+}
+
+// Stop the criterion
+void RelativeErrorParticleHistorySimulationCompletionCriterion::stop()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_count_histories = false;
+}
+
+// Clear cached criterion data
+void RelativeErrorParticleHistorySimulationCompletionCriterion::clearCache()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_num_completed_histories.size(); ++i )
+    d_num_completed_histories[i] = 0;
+
+  d_sampling_time = 0.0;
+  d_use_root_process_decision = false;
+  d_check_required = true;
+}
+
+// Take a snapshot
+/*! \details The estimator bins will be checked the next time that the
+ * criterion is queried.
+ */
+void RelativeErrorParticleHistorySimulationCompletionCriterion::takeSnapshot(
+                                const uint64_t,
+                                const double time_since_last_snapshot )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_count_histories )
+    d_sampling_time += time_since_last_snapshot;
+
+  d_check_required = true;
+}
+
+// Enable support for multiple threads
+void RelativeErrorParticleHistorySimulationCompletionCriterion::enableThreadSupport(
+                                                        const unsigned threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_num_completed_histories.resize( threads, 0 );
+}
+
+// Check if the observer has uncommitted history contributions
+bool RelativeErrorParticleHistorySimulationCompletionCriterion::hasUncommittedHistoryContribution() const
+{
+  return true;
+}
+
+// Commit the contribution from the current history to the observer
+void RelativeErrorParticleHistorySimulationCompletionCriterion::commitHistoryContribution()
+{
+  // Make sure that the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_num_completed_histories.size() );
+
+  if( d_count_histories )
+    ++d_num_completed_histories[Utility::OpenMPProperties::getThreadId()];
+}
+
+// Reset the observer data
+void RelativeErrorParticleHistorySimulationCompletionCriterion::resetData()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->clearCache();
+}
+
+// Reduce the object data on all processes in comm and collect on root
+/*! \details Only the number of completed histories needs to be reduced. The
+ * estimator moments of the selected bins will be reduced by the estimators,
+ * which must be done before the criterion is reduced (see
+ * MonteCarlo::EventHandler::reduceObserverData). The root process will then
+ * check the combined moments of the selected bins and broadcast its decision
+ * to the other processes. The other processes will use this decision until
+ * their data is reset so that every process will stop consistently.
+ */
+void RelativeErrorParticleHistorySimulationCompletionCriterion::reduceData(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  if( comm.size() > 1 )
+  {
+    comm.barrier();
+
+    try{
+      if( comm.rank() == root_process )
+      {
+        uint64_t reduced_num_completed_histories;
+
+        Utility::reduce( comm,
+                         this->getNumberOfCompletedHistories(),
+                         reduced_num_completed_histories,
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        // The processes sample concurrently - keep the root sampling time
+        const double sampling_time = d_sampling_time;
+
+        this->resetData();
+
+        d_num_completed_histories.front() = reduced_num_completed_histories;
+        d_sampling_time = sampling_time;
+
+        // Check the combined moments of the selected bins
+        this->checkEstimatorBins();
+      }
+      else
+      {
+        Utility::reduce( comm,
+                         this->getNumberOfCompletedHistories(),
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        this->resetData();
+      }
+
+      // Broadcast the decision of the root process
+      int converged = (d_converged ? 1 : 0);
+
+      Utility::broadcast( comm, converged, root_process );
+      Utility::broadcast( comm, d_largest_relative_error, root_process );
+      Utility::broadcast( comm, d_largest_relative_vov, root_process );
+
+      if( comm.rank() != root_process )
+      {
+        d_converged = (converged == 1);
+        d_use_root_process_decision = true;
+      }
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in "
+                             "relative error particle history simulation "
+                             "completion criterion!" );
+
+    comm.barrier();
+  }
+}
+
+// Get a description of the criterion
+std::string RelativeErrorParticleHistorySimulationCompletionCriterion::description() const
+{
+  std::string criterion_description( "largest relative error (" );
+  criterion_description +=
+    Utility::toString( this->getLargestRelativeError() ) + ") <= " +
+    Utility::toString( d_max_relative_error );
+
+  if( d_max_relative_vov < Utility::QuantityTraits<double>::inf() )
+  {
+    criterion_description += " && largest relative vov (" +
+      Utility::toString( this->getLargestRelativeVOV() ) + ") <= " +
+      Utility::toString( d_max_relative_vov );
+  }
+
+  criterion_description += " [" + Utility::toString( this->getNumberOfBins() )
+    + " bins, fom " + Utility::toString( this->getFigureOfMerit() ) + "]";
+
+  return criterion_description;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( RelativeErrorParticleHistorySimulationCompletionCriterion, MonteCarlo );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,340 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.hpp
+//! \author Alex Robinson
+//! \brief  The relative error particle history simulation completion
+//!         criterion class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_RELATIVE_ERROR_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+#define MONTE_CARLO_RELATIVE_ERROR_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_QuantityTraits.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The relative error particle history simulation completion criterion
+ *
+ * \details The simulation will be complete once the relative error (and
+ * optionally the relative variance of the variance) of every selected
+ * estimator bin is at or below the requested value. By default a bin that
+ * has not been scored in (i.e. its first moment is zero) is skipped, but at
+ * least one selected bin must have been scored in (see
+ * MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion::ignoreUnscoredBins).
+ * The relative error of a bin with a negative first moment is calculated
+ * from the magnitude of the scores. The selected bins are only
+ * checked once after every snapshot (see
+ * MonteCarlo::EventHandler::takeSnapshotOfObserverStates) or reduction, so
+ * the cost of checking the criterion is proportional to the number of
+ * selected bins per snapshot and independent of how often the simulation
+ * manager asks if the simulation is complete. The moments that are checked
+ * are the current estimator moments, which are the moments that are recorded
+ * by the estimator snapshots. In a distributed simulation the estimator
+ * moments and the number of completed histories are combined on the root
+ * process when the observer data is reduced (at every rendezvous). The root
+ * process checks the combined moments of the selected bins and broadcasts
+ * its decision so that every process will stop consistently. The figure of
+ * merit of the bin with the largest relative error is reported with the
+ * criterion description. This criterion can be combined with the other
+ * criteria (e.g. a wall time criterion) using the || and && operators.
+ */
+class RelativeErrorParticleHistorySimulationCompletionCriterion : public ParticleHistorySimulationCompletionCriterion
+{
+
+public:
+
+  //! The entity id type
+  typedef Estimator::EntityId EntityId;
+
+  //! Constructor
+  RelativeErrorParticleHistorySimulationCompletionCriterion(
+                const double max_relative_error,
+                const double max_relative_vov =
+                Utility::QuantityTraits<double>::inf() );
+
+  //! Destructor
+  ~RelativeErrorParticleHistorySimulationCompletionCriterion()
+  { /* ... */ }
+
+  //! Add estimator total bins to the criterion (all bins by default)
+  void addEstimatorTotalBins(
+                  const std::shared_ptr<const Estimator>& estimator,
+                  const std::vector<size_t>& bin_indices = std::vector<size_t>() );
+
+  //! Add estimator entity bins to the criterion (all bins by default)
+  void addEstimatorEntityBins(
+                  const std::shared_ptr<const Estimator>& estimator,
+                  const EntityId entity_id,
+                  const std::vector<size_t>& bin_indices = std::vector<size_t>() );
+
+  //! Get the number of bins that are checked
+  size_t getNumberOfBins() const;
+
+  //! Get the max relative error
+  double getMaxRelativeError() const;
+
+  //! Get the max relative variance of the variance
+  double getMaxRelativeVOV() const;
+
+  //! Set if the selected bins that have not been scored in are ignored
+  void ignoreUnscoredBins( const bool ignore_unscored_bins );
+
+  //! Check if the selected bins that have not been scored in are ignored
+  bool areUnscoredBinsIgnored() const;
+
+  //! Get the number of completed histories
+  uint64_t getNumberOfCompletedHistories() const;
+
+  //! Get the largest relative error of the checked bins
+  double getLargestRelativeError() const;
+
+  //! Get the largest relative variance of the variance of the checked bins
+  double getLargestRelativeVOV() const;
+
+  //! Get the sampling time (the sum of the times between snapshots)
+  double getSamplingTime() const;
+
+  //! Get the figure of merit of the checked bin with the largest rel. error
+  double getFigureOfMerit() const;
+
+  //! Check if the simulation is complete
+  bool isSimulationComplete() const final override;
+
+  //! Start the criterion
+  void start() final override;
+
+  //! Stop the criterion
+  void stop() final override;
+
+  //! Clear cached criterion data
+  void clearCache() final override;
+
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t histories,
+                     const double time ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit the contribution from the current history to the observer
+  void commitHistoryContribution() final override;
+
+  //! Reset the observer data
+  void resetData() final override;
+
+  //! Reduce the object data on all processes in comm and collect on root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Get a description of the criterion
+  std::string description() const final override;
+
+private:
+
+  //! The estimator bins that are checked
+  struct EstimatorBins
+  {
+    //! The estimator
+    std::shared_ptr<const Estimator> estimator;
+
+    //! Records if the entity bins should be checked (instead of total bins)
+    bool use_entity_bins;
+
+    //! The entity id (only used with the entity bins)
+    EntityId entity_id;
+
+    //! The bin indices
+    std::vector<size_t> bin_indices;
+
+    //! Serialize the estimator bins
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( estimator );
+      ar & BOOST_SERIALIZATION_NVP( use_entity_bins );
+      ar & BOOST_SERIALIZATION_NVP( entity_id );
+      ar & BOOST_SERIALIZATION_NVP( bin_indices );
+    }
+  };
+
+  // Default constructor
+  RelativeErrorParticleHistorySimulationCompletionCriterion();
+
+  // Add estimator bins to the criterion
+  void addEstimatorBins( const std::shared_ptr<const Estimator>& estimator,
+                         const bool use_entity_bins,
+                         const EntityId entity_id,
+                         const std::vector<size_t>& bin_indices );
+
+  // Check the selected estimator bins
+  void checkEstimatorBins() const;
+
+  // Check if the selected estimator bins must be checked again
+  bool isCheckRequired() const;
+
+  // Save the completion criterion
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the completion criterion
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The max relative error
+  double d_max_relative_error;
+
+  // The max relative variance of the variance
+  double d_max_relative_vov;
+
+  // Records if the selected bins that have not been scored in are ignored
+  bool d_ignore_unscored_bins;
+
+  // The estimator bins that are checked
+  std::vector<EstimatorBins> d_estimator_bins;
+
+  // The number of completed histories
+  std::vector<uint64_t> d_num_completed_histories;
+
+  // The sampling time
+  double d_sampling_time;
+
+  // Active flag
+  bool d_count_histories;
+
+  // Records if the decision of the root process is used (non-root processes
+  // of a distributed simulation only)
+  bool d_use_root_process_decision;
+
+  // Records if the estimator bins must be checked again
+  mutable bool d_check_required;
+
+  // Records if every estimator bin has converged (at the last check)
+  mutable bool d_converged;
+
+  // The largest relative error (at the last check)
+  mutable double d_largest_relative_error;
+
+  // The largest relative variance of the variance (at the last check)
+  mutable double d_largest_relative_vov;
+};
+
+// Save the completion criterion
+template<typename Archive>
+void RelativeErrorParticleHistorySimulationCompletionCriterion::save(
+                                  Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Save the local member data
+  uint64_t num_completed_histories = this->getNumberOfCompletedHistories();
+
+  ar & BOOST_SERIALIZATION_NVP( num_completed_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+
+  // We cannot safely serialize inf to all archive types - create a flag that
+  // records if the max relative vov is inf
+  const bool __inf_max_relative_vov__ =
+    (d_max_relative_vov == Utility::QuantityTraits<double>::inf());
+
+  ar & BOOST_SERIALIZATION_NVP( __inf_max_relative_vov__ );
+
+  if( __inf_max_relative_vov__ )
+  {
+    double tmp_max_relative_vov = Utility::QuantityTraits<double>::max();
+
+    ar & boost::serialization::make_nvp( "d_max_relative_vov",
+                                         tmp_max_relative_vov );
+  }
+  else
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_max_relative_vov );
+  }
+
+  ar & BOOST_SERIALIZATION_NVP( d_estimator_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_ignore_unscored_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_sampling_time );
+
+  // Don't save the count histories flag - this must be reactivated
+  // manually by calling start
+}
+
+// Load the completion criterion
+template<typename Archive>
+void RelativeErrorParticleHistorySimulationCompletionCriterion::load(
+                                        Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Load the local member data
+  uint64_t num_completed_histories;
+
+  ar & BOOST_SERIALIZATION_NVP( num_completed_histories );
+
+  d_num_completed_histories.resize( 1 );
+  d_num_completed_histories.front() = num_completed_histories;
+
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+
+  bool __inf_max_relative_vov__;
+
+  ar & BOOST_SERIALIZATION_NVP( __inf_max_relative_vov__ );
+  ar & BOOST_SERIALIZATION_NVP( d_max_relative_vov );
+
+  if( __inf_max_relative_vov__ )
+    d_max_relative_vov = Utility::QuantityTraits<double>::inf();
+
+  ar & BOOST_SERIALIZATION_NVP( d_estimator_bins );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_ignore_unscored_bins );
+    ar & BOOST_SERIALIZATION_NVP( d_sampling_time );
+  }
+  else
+  {
+    // Unscored bins were never considered converged
+    d_ignore_unscored_bins = false;
+    d_sampling_time = 0.0;
+  }
+
+  d_count_histories = false;
+  d_use_root_process_decision = false;
+  d_check_required = true;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( RelativeErrorParticleHistorySimulationCompletionCriterion, MonteCarlo, 1 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( RelativeErrorParticleHistorySimulationCompletionCriterion, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, RelativeErrorParticleHistorySimulationCompletionCriterion );
+
+#endif // end MONTE_CARLO_RELATIVE_ERROR_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,149 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ResponseFunctionValueCache.cpp
+//! \author Alex Robinson
+//! \brief  Response function value cache class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ResponseFunctionValueCache.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ResponseFunctionValueCache::ResponseFunctionValueCache()
+  : d_response_functions(),
+    d_response_function_indices(),
+    d_thread_data( 1 )
+{
+  this->resetThreadData( d_thread_data.front() );
+}
+
+// Set the response functions that will be cached
+/*! \details Any previously cached response functions will be removed. A
+ * response function that appears more than once will only be cached once.
+ */
+void ResponseFunctionValueCache::setResponseFunctions(
+                   const std::vector<std::shared_ptr<const ParticleResponse> >&
+                   response_functions )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_response_functions.clear();
+  d_response_function_indices.clear();
+
+  for( auto&& response_function : response_functions )
+  {
+    // Make sure that the response function pointer is valid
+    testPrecondition( response_function.get() );
+
+    if( d_response_function_indices.find( response_function.get() ) ==
+        d_response_function_indices.end() )
+    {
+      d_response_function_indices[response_function.get()] =
+        d_response_functions.size();
+
+      d_response_functions.push_back( response_function );
+    }
+  }
+
+  for( auto&& thread_data : d_thread_data )
+    this->resetThreadData( thread_data );
+}
+
+// Check if a response function is cached
+bool ResponseFunctionValueCache::isResponseFunctionCached(
+     const std::shared_ptr<const ParticleResponse>& response_function ) const
+{
+  return d_response_function_indices.find( response_function.get() ) !=
+    d_response_function_indices.end();
+}
+
+// Return the index of a cached response function
+/*! \details If the response function is not cached the number of cached
+ * response functions will be returned.
+ */
+size_t ResponseFunctionValueCache::getResponseFunctionIndex(
+     const std::shared_ptr<const ParticleResponse>& response_function ) const
+{
+  std::unordered_map<const ParticleResponse*,size_t>::const_iterator
+    index_it = d_response_function_indices.find( response_function.get() );
+
+  if( index_it != d_response_function_indices.end() )
+    return index_it->second;
+  else
+    return d_response_functions.size();
+}
+
+// Enable support for multiple threads
+void ResponseFunctionValueCache::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_thread_data.resize( num_threads );
+
+  for( auto&& thread_data : d_thread_data )
+    this->resetThreadData( thread_data );
+}
+
+// Reset the thread data
+void ResponseFunctionValueCache::resetThreadData(
+                                                ThreadData& thread_data ) const
+{
+  thread_data.particle_state.address = NULL;
+  thread_data.stamp = 1;
+  thread_data.value_stamps.assign( d_response_functions.size(), 0 );
+  thread_data.values.assign( d_response_functions.size(), 0.0 );
+}
+
+// Check if the cached state is equal to a particle state
+bool ResponseFunctionValueCache::CachedParticleState::isEqualTo(
+                                          const ParticleState& particle ) const
+{
+  return address == &particle &&
+    type == particle.getParticleType() &&
+    history_number == particle.getHistoryNumber() &&
+    generation_number == particle.getGenerationNumber() &&
+    collision_number == particle.getCollisionNumber() &&
+    cell == particle.getCell() &&
+    energy == particle.getEnergy() &&
+    time == particle.getTime() &&
+    weight == particle.getWeight() &&
+    position[0] == particle.getXPosition() &&
+    position[1] == particle.getYPosition() &&
+    position[2] == particle.getZPosition() &&
+    direction[0] == particle.getXDirection() &&
+    direction[1] == particle.getYDirection() &&
+    direction[2] == particle.getZDirection();
+}
+
+// Set the cached state
+void ResponseFunctionValueCache::CachedParticleState::set(
+                                                const ParticleState& particle )
+{
+  address = &particle;
+  type = particle.getParticleType();
+  history_number = particle.getHistoryNumber();
+  generation_number = particle.getGenerationNumber();
+  collision_number = particle.getCollisionNumber();
+  cell = particle.getCell();
+  energy = particle.getEnergy();
+  time = particle.getTime();
+  weight = particle.getWeight();
+  position[0] = particle.getXPosition();
+  position[1] = particle.getYPosition();
+  position[2] = particle.getZPosition();
+  direction[0] = particle.getXDirection();
+  direction[1] = particle.getYDirection();
+  direction[2] = particle.getZDirection();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ResponseFunctionValueCache.cpp
+//---------------------------------------------------------------------------//
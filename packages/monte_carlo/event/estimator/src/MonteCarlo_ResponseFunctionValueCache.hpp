@@ -0,0 +1,189 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ResponseFunctionValueCache.hpp
+//! \author Alex Robinson
+//! \brief  Response function value cache class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_RESPONSE_FUNCTION_VALUE_CACHE_HPP
+#define MONTE_CARLO_RESPONSE_FUNCTION_VALUE_CACHE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleResponse.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+/*! The response function value cache class
+ * \details When several estimators share a response function (e.g. a cell
+ * flux estimator and a mesh flux estimator that both use the same material
+ * reaction rate response) the response function will usually be evaluated
+ * several times with the same particle state. This cache stores the value of
+ * each cached response function for the particle state that is currently
+ * being observed by a thread so that each response function only needs to be
+ * evaluated once for each particle state. The cached values are discarded as
+ * soon as a response function is evaluated with a different particle state.
+ */
+class ResponseFunctionValueCache
+{
+
+public:
+
+  //! Constructor
+  ResponseFunctionValueCache();
+
+  //! Destructor
+  ~ResponseFunctionValueCache()
+  { /* ... */ }
+
+  //! Set the response functions that will be cached
+  void setResponseFunctions( const std::vector<std::shared_ptr<const ParticleResponse> >& response_functions );
+
+  //! Return the number of cached response functions
+  size_t getNumberOfResponseFunctions() const;
+
+  //! Check if a response function is cached
+  bool isResponseFunctionCached( const std::shared_ptr<const ParticleResponse>& response_function ) const;
+
+  //! Return the index of a cached response function
+  size_t getResponseFunctionIndex( const std::shared_ptr<const ParticleResponse>& response_function ) const;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads );
+
+  //! Evaluate a cached response function
+  double evaluateResponseFunction( const ParticleState& particle,
+                                   const size_t response_function_index );
+
+private:
+
+  // The particle state that the cached values correspond to
+  struct CachedParticleState
+  {
+    //! Check if the cached state is equal to a particle state
+    bool isEqualTo( const ParticleState& particle ) const;
+
+    //! Set the cached state
+    void set( const ParticleState& particle );
+
+    // The particle state address
+    const ParticleState* address;
+
+    // The particle type
+    ParticleType type;
+
+    // The history number
+    ParticleState::historyNumberType history_number;
+
+    // The generation number
+    ParticleState::generationNumberType generation_number;
+
+    // The collision number
+    ParticleState::collisionNumberType collision_number;
+
+    // The cell
+    Geometry::Model::EntityId cell;
+
+    // The position
+    double position[3];
+
+    // The direction
+    double direction[3];
+
+    // The energy
+    ParticleState::energyType energy;
+
+    // The time
+    ParticleState::timeType time;
+
+    // The weight
+    ParticleState::weightType weight;
+  };
+
+  // The thread data
+  struct ThreadData
+  {
+    // The particle state that the cached values correspond to
+    CachedParticleState particle_state;
+
+    // The current particle state stamp
+    uint64_t stamp;
+
+    // The particle state stamp of each cached value
+    std::vector<uint64_t> value_stamps;
+
+    // The cached values
+    std::vector<double> values;
+  };
+
+  // Reset the thread data
+  void resetThreadData( ThreadData& thread_data ) const;
+
+  // The cached response functions
+  std::vector<std::shared_ptr<const ParticleResponse> > d_response_functions;
+
+  // The response function indices
+  std::unordered_map<const ParticleResponse*,size_t> d_response_function_indices;
+
+  // The thread data
+  std::vector<ThreadData> d_thread_data;
+};
+
+// Return the number of cached response functions
+inline size_t ResponseFunctionValueCache::getNumberOfResponseFunctions() const
+{
+  return d_response_functions.size();
+}
+
+// Evaluate a cached response function
+/*! \details The cached value will be returned if the response function has
+ * already been evaluated with this particle state by the calling thread.
+ */
+inline double ResponseFunctionValueCache::evaluateResponseFunction(
+                                        const ParticleState& particle,
+                                        const size_t response_function_index )
+{
+  // Make sure the response function index is valid
+  testPrecondition( response_function_index <
+                    this->getNumberOfResponseFunctions() );
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_data.size() );
+
+  ThreadData& thread_data =
+    d_thread_data[Utility::OpenMPProperties::getThreadId()];
+
+  // Discard all cached values if the particle state has changed
+  if( !thread_data.particle_state.isEqualTo( particle ) )
+  {
+    thread_data.particle_state.set( particle );
+
+    ++thread_data.stamp;
+  }
+
+  if( thread_data.value_stamps[response_function_index] != thread_data.stamp )
+  {
+    thread_data.values[response_function_index] =
+      d_response_functions[response_function_index]->evaluate( particle );
+
+    thread_data.value_stamps[response_function_index] = thread_data.stamp;
+  }
+
+  return thread_data.values[response_function_index];
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_RESPONSE_FUNCTION_VALUE_CACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ResponseFunctionValueCache.hpp
+//---------------------------------------------------------------------------//
@@ -30,7 +30,8 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1 ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_commit_scratch_buffers( 1 )
 { /* ... */ }
 
 // Check if total data is available
@@ -434,14 +435,18 @@ void StandardEntityEstimator::commitHistoryContribution()
   // Number of response functions
   size_t num_response_funcs = this->getNumberOfResponseFunctions();
 
-  // The entity totals
-  std::vector<double> entity_totals( num_response_funcs, 0.0 );
+  // The scratch buffers of this thread (the updated bins of an entity and
+  // the bin contributions are committed together)
+  CommitScratchBuffers& scratch_buffers = d_commit_scratch_buffers[thread_id];
 
-  // The totals over all entities
-  std::vector<double> totals( num_response_funcs, 0.0 );
+  std::vector<double>& entity_totals = scratch_buffers.entity_totals;
+  std::vector<double>& totals = scratch_buffers.totals;
+  BinContributionMap& bin_totals = scratch_buffers.bin_totals;
+  std::vector<size_t>& bin_indices = scratch_buffers.bin_indices;
+  std::vector<double>& bin_contributions = scratch_buffers.bin_contributions;
 
-  // The bin totals over all entities
-  BinContributionMap bin_totals;
+  entity_totals.assign( num_response_funcs, 0.0 );
+  totals.assign( num_response_funcs, 0.0 );
 
   // Get the entities with updated data
   typename SerialUpdateTracker::const_iterator entity, end_entity;
@@ -474,13 +479,19 @@ void StandardEntityEstimator::commitHistoryContribution()
       else
 	bin_totals[bin_data->first] = bin_contribution;
 
-      this->commitHistoryContributionToBinOfEntity( entity->first,
-						    bin_data->first,
-						    bin_contribution );
+      bin_indices.push_back( bin_data->first );
+      bin_contributions.push_back( bin_contribution );
 
       ++bin_data;
     }
 
+    this->commitHistoryContributionsToBinsOfEntity( entity->first,
+                                                    bin_indices,
+                                                    bin_contributions );
+
+    bin_indices.clear();
+    bin_contributions.clear();
+
     // Commit the entity totals
     for( size_t i = 0; i < num_response_funcs; ++i )
     {
@@ -506,11 +517,20 @@ void StandardEntityEstimator::commitHistoryContribution()
 
   while( bin_data != end_bin_data )
   {
-    this->commitHistoryContributionToBinOfTotal( bin_data->first,
-						 bin_data->second );
+    bin_indices.push_back( bin_data->first );
+    bin_contributions.push_back( bin_data->second );
+
     ++bin_data;
   }
 
+  this->commitHistoryContributionsToBinsOfTotal( bin_indices,
+                                                 bin_contributions );
+
+  // Clear the scratch buffers (the capacity is kept for the next history)
+  bin_totals.clear();
+  bin_indices.clear();
+  bin_contributions.clear();
+
   // Reset the update tracker
   this->resetUpdateTracker( thread_id );
 
@@ -528,6 +548,9 @@ void StandardEntityEstimator::enableThreadSupport( const unsigned num_threads )
 
   // Add thread support to update tracker
   d_update_tracker.resize( num_threads );
+
+  // Add thread support to the commit scratch buffers
+  d_commit_scratch_buffers.resize( num_threads );
 }
 
 // Reset the estimator data
@@ -584,25 +607,17 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
-    // Reduce the entity data
+    // Reduce the entity total data and the total data
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_total_estimator_moments_map );
+      this->reduceEntityCollectionMapAndTotal( comm,
+                                               root_process,
+                                               d_entity_total_estimator_moments_map,
+                                               d_total_estimator_moments );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
                              "standard entity estimator " << this->getId() <<
-                             " for entity total data!" );
-
-    comm.barrier();
-
-    // Reduce the total data
-    try{
-      this->reduceCollection( comm, root_process, d_total_estimator_moments );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for total data!" );
+                             " for entity total and total data!" );
 
     // Reduce the entity snapshot data
     try{
@@ -846,12 +861,15 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
     {
       const size_t bin_index_shift = r*this->getNumberOfBins();
 
+      const double response_function_value =
+        this->evaluateResponseFunction(
+                                particle_state_wrapper.getParticleState(), r );
+
       for( size_t i = 0; i < bin_indices_and_weights.size(); ++i )
       {
         const double processed_contribution = contribution*
           Utility::get<1>( bin_indices_and_weights[i] )*
-          this->evaluateResponseFunction(
-                                particle_state_wrapper.getParticleState(), r );
+          response_function_value;
 
         const size_t complete_bin_index =
           Utility::get<0>( bin_indices_and_weights[i] ) + bin_index_shift;
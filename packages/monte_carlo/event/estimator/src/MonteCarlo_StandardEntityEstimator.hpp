@@ -35,6 +35,28 @@ class StandardEntityEstimator : public EntityEstimator
   // Typedef for parallel update tracker
   typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
 
+  // The history commit scratch buffers of a thread (reused every history)
+  struct CommitScratchBuffers
+  {
+    // The entity totals
+    std::vector<double> entity_totals;
+
+    // The totals over all entities
+    std::vector<double> totals;
+
+    // The bin totals over all entities
+    BinContributionMap bin_totals;
+
+    // The updated bins of an entity (or of the total)
+    std::vector<size_t> bin_indices;
+
+    // The updated bin contributions of an entity (or of the total)
+    std::vector<double> bin_contributions;
+
+    // Padding (prevents false sharing between threads)
+    char padding[64];
+  };
+
 protected:
 
   //! Typedef for the map of entity ids and estimator moments array
@@ -315,6 +337,9 @@ private:
 
   // The entities/bins that have been updated
   ParallelUpdateTracker d_update_tracker;
+
+  // The history commit scratch buffers of each thread
+  std::vector<CommitScratchBuffers> d_commit_scratch_buffers;
 };
 
 } // end MonteCarlo namespace
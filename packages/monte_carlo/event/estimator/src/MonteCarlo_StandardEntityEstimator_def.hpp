@@ -25,7 +25,8 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_commit_scratch_buffers( 1 )
 {
   this->initializeMomentsMaps( entity_ids );
 }
@@ -43,7 +44,8 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_commit_scratch_buffers( 1 )
 {
   this->initializeMomentsMaps( entity_ids );
 }
@@ -109,6 +111,7 @@ void StandardEntityEstimator::load( Archive& ar, const unsigned version )
 
   // Initialize the thread data
   d_update_tracker.resize( 1 );
+  d_commit_scratch_buffers.resize( 1 );
 }
 
 } // end MonteCarlo namespace
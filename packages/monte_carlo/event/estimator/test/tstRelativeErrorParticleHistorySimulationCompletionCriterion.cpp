@@ -0,0 +1,351 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstRelativeErrorParticleHistorySimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  Relative error particle history simulation completion criterion
+//!         unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_RelativeErrorParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+typedef MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier>
+TestEstimator;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test estimator
+std::shared_ptr<TestEstimator> createTestEstimator()
+{
+  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>
+    cell_ids( {0, 1} );
+
+  std::vector<double> cell_norm_consts( {1.0, 1.0} );
+
+  std::shared_ptr<TestEstimator> estimator(
+                   new TestEstimator( 0u, 1.0, cell_ids, cell_norm_consts ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  return estimator;
+}
+
+// Simulate the test histories (repeating scores of 1, 1 and 4 in cell 0)
+void simulateTestHistories(
+   TestEstimator& estimator,
+   MonteCarlo::ParticleHistorySimulationCompletionCriterion& criterion,
+   const uint64_t number_of_histories )
+{
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setEnergy( 1.0 );
+  particle.setTime( 0.0 );
+
+  for( uint64_t i = 0; i < number_of_histories; ++i )
+  {
+    particle.setWeight( (i % 3 == 2 ? 4.0 : 1.0) );
+
+    estimator.updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+    estimator.commitHistoryContribution();
+
+    criterion.commitHistoryContribution();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the criterion can be constructed
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   constructor )
+{
+  std::unique_ptr<MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion> criterion;
+
+  FRENSIE_CHECK_NO_THROW( criterion.reset( new MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.05 ) ) );
+  FRENSIE_CHECK_EQUAL( criterion->getMaxRelativeError(), 0.05 );
+  FRENSIE_CHECK_EQUAL( criterion->getMaxRelativeVOV(),
+                       Utility::QuantityTraits<double>::inf() );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfBins(), 0 );
+  FRENSIE_CHECK( criterion->areUnscoredBinsIgnored() );
+  FRENSIE_CHECK_EQUAL( criterion->getSamplingTime(), 0.0 );
+  FRENSIE_CHECK_EQUAL( criterion->getFigureOfMerit(), 0.0 );
+  FRENSIE_CHECK( !criterion->isSimulationComplete() );
+
+  FRENSIE_CHECK_NO_THROW( criterion.reset( new MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.05, 0.1 ) ) );
+  FRENSIE_CHECK_EQUAL( criterion->getMaxRelativeVOV(), 0.1 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.05, 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that estimator bins can be added to the criterion
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   addEstimatorBins )
+{
+  std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+  MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion
+    criterion( 0.05 );
+
+  criterion.addEstimatorTotalBins( estimator );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfBins(), 1 );
+
+  criterion.addEstimatorEntityBins( estimator, 0, std::vector<size_t>( {0} ) );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfBins(), 2 );
+
+  FRENSIE_CHECK_THROW( criterion.addEstimatorEntityBins( estimator, 2 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( criterion.addEstimatorTotalBins( estimator, std::vector<size_t>( {1} ) ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( criterion.addEstimatorTotalBins( std::shared_ptr<TestEstimator>() ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfBins(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the simulation is complete once the relative error target is met
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete )
+{
+  std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+  MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion
+    criterion( 0.05 );
+
+  criterion.addEstimatorTotalBins( estimator );
+  criterion.addEstimatorEntityBins( estimator, 0 );
+  criterion.start();
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  FRENSIE_CHECK_EQUAL( criterion.getLargestRelativeError(),
+                       Utility::QuantityTraits<double>::inf() );
+
+  // The relative error of the scores is approximately sqrt(2/N)/2
+  simulateTestHistories( *estimator, criterion, 30 );
+
+  // The bins are only checked after a snapshot
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  criterion.takeSnapshot( 30, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfCompletedHistories(), 30 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( criterion.getLargestRelativeError(),
+                                   0.13130643285972254,
+                                   1e-12 );
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  simulateTestHistories( *estimator, criterion, 270 );
+
+  criterion.takeSnapshot( 270, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfCompletedHistories(), 300 );
+  FRENSIE_CHECK( criterion.getLargestRelativeError() <= 0.05 );
+  FRENSIE_CHECK( criterion.isSimulationComplete() );
+
+  // The figure of merit uses the sum of the snapshot times
+  FRENSIE_CHECK_EQUAL( criterion.getSamplingTime(), 2.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( criterion.getFigureOfMerit(),
+                                   1.0/(criterion.getLargestRelativeError()*
+                                        criterion.getLargestRelativeError()*
+                                        2.0),
+                                   1e-12 );
+  FRENSIE_CHECK( criterion.description().find( "fom" ) != std::string::npos );
+
+  // A bin that has no scores is ignored by default
+  criterion.addEstimatorEntityBins( estimator, 1 );
+
+  FRENSIE_CHECK( criterion.isSimulationComplete() );
+
+  // A bin that has no scores has not converged if unscored bins are not
+  // ignored
+  criterion.ignoreUnscoredBins( false );
+
+  FRENSIE_CHECK( !criterion.areUnscoredBinsIgnored() );
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  FRENSIE_CHECK_EQUAL( criterion.getLargestRelativeError(),
+                       Utility::QuantityTraits<double>::inf() );
+  FRENSIE_CHECK_EQUAL( criterion.getFigureOfMerit(), 0.0 );
+
+  // Histories are only counted after the criterion has been started
+  criterion.resetData();
+  criterion.stop();
+
+  simulateTestHistories( *estimator, criterion, 10 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfCompletedHistories(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that at least one bin must have been scored in
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_no_scored_bins )
+{
+  std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+  MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion
+    criterion( 0.05 );
+
+  criterion.addEstimatorEntityBins( estimator, 1 );
+  criterion.start();
+
+  simulateTestHistories( *estimator, criterion, 300 );
+
+  criterion.takeSnapshot( 300, 1.0 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  FRENSIE_CHECK_EQUAL( criterion.getLargestRelativeError(),
+                       Utility::QuantityTraits<double>::inf() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the relative vov target can be checked
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_vov )
+{
+  std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+  MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion
+    criterion( 0.05, 1e-6 );
+
+  criterion.addEstimatorTotalBins( estimator );
+  criterion.start();
+
+  simulateTestHistories( *estimator, criterion, 300 );
+
+  criterion.takeSnapshot( 300, 1.0 );
+
+  FRENSIE_CHECK( criterion.getLargestRelativeError() <= 0.05 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( criterion.getLargestRelativeVOV(),
+                                   600.0/360000.0,
+                                   1e-12 );
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a combined criterion forwards snapshots to the criterion
+FRENSIE_UNIT_TEST( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_combined )
+{
+  std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+  std::shared_ptr<MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion>
+    re_criterion( new MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.05 ) );
+
+  re_criterion->addEstimatorTotalBins( estimator );
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    history_criterion = MonteCarlo::ParticleHistorySimulationCompletionCriterion::createHistoryCountCriterion( 1000 );
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    or_criterion = re_criterion || history_criterion;
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    and_criterion = re_criterion && history_criterion;
+
+  or_criterion->start();
+
+  simulateTestHistories( *estimator, *or_criterion, 300 );
+
+  // The bins are only checked after a snapshot
+  FRENSIE_CHECK( !or_criterion->isSimulationComplete() );
+
+  or_criterion->takeSnapshot( 300, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( re_criterion->getNumberOfCompletedHistories(), 300 );
+  FRENSIE_CHECK( re_criterion->getLargestRelativeError() <= 0.05 );
+  FRENSIE_CHECK( or_criterion->isSimulationComplete() );
+  FRENSIE_CHECK( !and_criterion->isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the criterion can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( RelativeErrorParticleHistorySimulationCompletionCriterion,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_relative_error_completion_criterion" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<TestEstimator> estimator = createTestEstimator();
+
+    std::shared_ptr<MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion>
+      criterion( new MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion( 0.05 ) );
+
+    criterion->addEstimatorTotalBins( estimator );
+    criterion->ignoreUnscoredBins( false );
+    criterion->start();
+
+    simulateTestHistories( *estimator, *criterion, 300 );
+
+    criterion->takeSnapshot( 300, 2.0 );
+
+    std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+      base_criterion = criterion;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( base_criterion ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived criterion
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    base_criterion;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( base_criterion ) );
+
+  iarchive.reset();
+
+  std::shared_ptr<MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion>
+    criterion = std::dynamic_pointer_cast<MonteCarlo::RelativeErrorParticleHistorySimulationCompletionCriterion>( base_criterion );
+
+  FRENSIE_REQUIRE( criterion.get() != NULL );
+  FRENSIE_CHECK_EQUAL( criterion->getMaxRelativeError(), 0.05 );
+  FRENSIE_CHECK_EQUAL( criterion->getMaxRelativeVOV(),
+                       Utility::QuantityTraits<double>::inf() );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfBins(), 1 );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfCompletedHistories(), 300 );
+  FRENSIE_CHECK( !criterion->areUnscoredBinsIgnored() );
+  FRENSIE_CHECK_EQUAL( criterion->getSamplingTime(), 2.0 );
+  FRENSIE_CHECK( criterion->isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstRelativeErrorParticleHistorySimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstResponseFunctionValueCache.cpp
+//! \author Alex Robinson
+//! \brief  Response function value cache unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ResponseFunctionValueCache.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Structs
+//---------------------------------------------------------------------------//
+// A response that records the number of times that it has been evaluated
+class CountingParticleResponse : public MonteCarlo::ParticleResponse
+{
+
+public:
+
+  CountingParticleResponse()
+    : MonteCarlo::ParticleResponse( "f(particle) = E" ),
+      d_number_of_evaluations( 0 )
+  { /* ... */ }
+
+  ~CountingParticleResponse()
+  { /* ... */ }
+
+  double evaluate( const MonteCarlo::ParticleState& particle ) const final override
+  {
+    ++d_number_of_evaluations;
+
+    return particle.getEnergy();
+  }
+
+  bool isSpatiallyUniform() const final override
+  { return true; }
+
+  size_t getNumberOfEvaluations() const
+  { return d_number_of_evaluations; }
+
+private:
+
+  mutable size_t d_number_of_evaluations;
+};
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the response functions can be set
+FRENSIE_UNIT_TEST( ResponseFunctionValueCache, setResponseFunctions )
+{
+  MonteCarlo::ResponseFunctionValueCache cache;
+
+  FRENSIE_CHECK_EQUAL( cache.getNumberOfResponseFunctions(), 0 );
+
+  std::shared_ptr<const MonteCarlo::ParticleResponse>
+    response_a( new CountingParticleResponse );
+
+  std::shared_ptr<const MonteCarlo::ParticleResponse>
+    response_b( new CountingParticleResponse );
+
+  std::shared_ptr<const MonteCarlo::ParticleResponse>
+    response_c( new CountingParticleResponse );
+
+  cache.setResponseFunctions( {response_a, response_b, response_a} );
+
+  FRENSIE_CHECK_EQUAL( cache.getNumberOfResponseFunctions(), 2 );
+  FRENSIE_CHECK( cache.isResponseFunctionCached( response_a ) );
+  FRENSIE_CHECK( cache.isResponseFunctionCached( response_b ) );
+  FRENSIE_CHECK( !cache.isResponseFunctionCached( response_c ) );
+  FRENSIE_CHECK_EQUAL( cache.getResponseFunctionIndex( response_a ), 0 );
+  FRENSIE_CHECK_EQUAL( cache.getResponseFunctionIndex( response_b ), 1 );
+  FRENSIE_CHECK_EQUAL( cache.getResponseFunctionIndex( response_c ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a response function is only evaluated once per particle state
+FRENSIE_UNIT_TEST( ResponseFunctionValueCache, evaluateResponseFunction )
+{
+  std::shared_ptr<CountingParticleResponse>
+    response( new CountingParticleResponse );
+
+  MonteCarlo::ResponseFunctionValueCache cache;
+  cache.setResponseFunctions( {response} );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( photon, 0 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( photon, 0 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( response->getNumberOfEvaluations(), 1 );
+
+  // Changing the particle state must discard the cached value
+  photon.setEnergy( 2.0 );
+
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( photon, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( response->getNumberOfEvaluations(), 2 );
+
+  photon.setPosition( 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( photon, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( response->getNumberOfEvaluations(), 3 );
+
+  // A different particle state must not use the cached value
+  MonteCarlo::PhotonState other_photon( photon, false, false );
+
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( other_photon, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( response->getNumberOfEvaluations(), 4 );
+
+  // Resetting the response functions must discard the cached values
+  cache.setResponseFunctions( {response} );
+
+  FRENSIE_CHECK_EQUAL( cache.evaluateResponseFunction( other_photon, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( response->getNumberOfEvaluations(), 5 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstResponseFunctionValueCache.cpp
+//---------------------------------------------------------------------------//
@@ -5728,6 +5728,123 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator, reduceData_with_additional_bin_stats
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that interleaved moments do not change the estimator moments
+FRENSIE_UNIT_TEST( StandardEntityEstimator, interleaved_moments )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  std::shared_ptr<TestStandardEntityEstimator> interleaved_estimator;
+  initializeStandardEntityEstimator( interleaved_estimator );
+
+  FRENSIE_CHECK( !interleaved_estimator->areInterleavedMomentsEnabled() );
+
+  interleaved_estimator->enableInterleavedMoments();
+
+  FRENSIE_CHECK( interleaved_estimator->areInterleavedMomentsEnabled() );
+
+  estimator->enableSnapshotsOnEntityBins();
+  interleaved_estimator->enableSnapshotsOnEntityBins();
+
+  // The moments are only interleaved while a batch is simulated
+  estimator->startBatch();
+  interleaved_estimator->startBatch();
+
+  MonteCarlo::PhotonState particle( 0ull );
+  MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+  particle.setTime( 5e-6 );
+
+  for( size_t i = 0; i < 10; ++i )
+  {
+    particle.setEnergy( (i % 2 == 0 ? 1e-2 : 0.11) );
+    particle_wrapper.setAngleCosine( (i % 3 == 0 ? -0.5 : 0.5) );
+
+    estimator->addPartialHistoryPointContribution( i % 2, particle_wrapper, i + 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 0.5 );
+    estimator->commitHistoryContribution();
+
+    interleaved_estimator->addPartialHistoryPointContribution( i % 2, particle_wrapper, i + 1.0 );
+    interleaved_estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 0.5 );
+    interleaved_estimator->commitHistoryContribution();
+
+    // Snapshots can be taken while the moments are interleaved
+    if( i == 4 )
+    {
+      estimator->takeSnapshot( 5, 1.0 );
+      interleaved_estimator->takeSnapshot( 5, 1.0 );
+    }
+  }
+
+  estimator->stopBatch();
+  interleaved_estimator->stopBatch();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getTotalBinDataFirstMoments(),
+                                   estimator->getTotalBinDataFirstMoments(),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getTotalBinDataSecondMoments(),
+                                   estimator->getTotalBinDataSecondMoments(),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getTotalBinDataThirdMoments(),
+                                   estimator->getTotalBinDataThirdMoments(),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getTotalBinDataFourthMoments(),
+                                   estimator->getTotalBinDataFourthMoments(),
+                                   1e-15 );
+
+  for( uint64_t entity_id = 0; entity_id < 2; ++entity_id )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getEntityBinDataFirstMoments( entity_id ),
+                                     estimator->getEntityBinDataFirstMoments( entity_id ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getEntityBinDataSecondMoments( entity_id ),
+                                     estimator->getEntityBinDataSecondMoments( entity_id ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getEntityBinDataThirdMoments( entity_id ),
+                                     estimator->getEntityBinDataThirdMoments( entity_id ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( interleaved_estimator->getEntityBinDataFourthMoments( entity_id ),
+                                     estimator->getEntityBinDataFourthMoments( entity_id ),
+                                     1e-15 );
+  }
+
+  const size_t number_of_bins = estimator->getNumberOfBins()*
+    estimator->getNumberOfResponseFunctions();
+
+  for( size_t j = 0; j < number_of_bins; ++j )
+  {
+    std::vector<double> first_moments, expected_first_moments;
+
+    interleaved_estimator->getTotalBinFirstMomentSnapshots( j, first_moments );
+    estimator->getTotalBinFirstMomentSnapshots( j, expected_first_moments );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( first_moments,
+                                     expected_first_moments,
+                                     1e-15 );
+
+    interleaved_estimator->getEntityBinFirstMomentSnapshots( 1, j, first_moments );
+    estimator->getEntityBinFirstMomentSnapshots( 1, j, expected_first_moments );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( first_moments,
+                                     expected_first_moments,
+                                     1e-15 );
+  }
+
+  // The interleaved moments must also be reset
+  interleaved_estimator->startBatch();
+  interleaved_estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+  interleaved_estimator->commitHistoryContribution();
+  interleaved_estimator->resetData();
+  interleaved_estimator->stopBatch();
+
+  Utility::ArrayView<const double> first_moments =
+    interleaved_estimator->getTotalBinDataFirstMoments();
+
+  FRENSIE_CHECK_EQUAL( first_moments,
+                       std::vector<double>( first_moments.size(), 0.0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an estimator can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StandardEntityEstimator,
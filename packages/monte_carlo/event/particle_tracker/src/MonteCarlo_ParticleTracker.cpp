@@ -6,20 +6,94 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_ObserverParticleStateWrapper.hpp"
 #include "MonteCarlo_ParticleType.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// The track records are written to (and read from) file as raw bytes
+static_assert( std::is_trivially_copyable<ParticleTracker::TrackRecord>::value &&
+               sizeof(ParticleTracker::TrackRecord) == 112,
+               "The track record layout is not fixed!" );
+static_assert( std::is_trivially_copyable<ParticleTracker::TrackRecordIndexEntry>::value &&
+               sizeof(ParticleTracker::TrackRecordIndexEntry) == 24,
+               "The track record index entry layout is not fixed!" );
+
+// The track record file header
+static const ParticleTracker::TrackRecordFileHeader s_track_record_file_header =
+  {{'F','R','N','S','T','R','A','K'}, 1u, sizeof(ParticleTracker::TrackRecord)};
+
+// The track record index file header
+static const ParticleTracker::TrackRecordFileHeader s_track_record_index_file_header =
+  {{'F','R','N','S','T','I','D','X'}, 1u, sizeof(ParticleTracker::TrackRecordIndexEntry)};
+
+// Read and check a track record file header
+static void readTrackRecordFileHeader(
+                  std::ifstream& file,
+                  const boost::filesystem::path& file_name,
+                  const ParticleTracker::TrackRecordFileHeader& expected_header )
+{
+  ParticleTracker::TrackRecordFileHeader header;
+
+  file.read( reinterpret_cast<char*>( &header ), sizeof(header) );
+
+  TEST_FOR_EXCEPTION( !file.good() ||
+                      std::memcmp( header.identifier,
+                                   expected_header.identifier,
+                                   sizeof(header.identifier) ) != 0,
+                      std::runtime_error,
+                      "File " << file_name.string() << " is not a valid "
+                      "particle tracker file!" );
+
+  TEST_FOR_EXCEPTION( header.version != expected_header.version ||
+                      header.record_size != expected_header.record_size,
+                      std::runtime_error,
+                      "File " << file_name.string() << " has an unsupported "
+                      "version (" << header.version << ") or record size ("
+                      << header.record_size << ")!" );
+}
+
+// Compare track record index entries (by history number and first record)
+static bool compareTrackRecordIndexEntries(
+                        const ParticleTracker::TrackRecordIndexEntry& entry_a,
+                        const ParticleTracker::TrackRecordIndexEntry& entry_b )
+{
+  if( entry_a.history_number != entry_b.history_number )
+    return entry_a.history_number < entry_b.history_number;
+  else
+    return entry_a.first_record < entry_b.first_record;
+}
+
 // Default constructor
 ParticleTracker::ParticleTracker()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_track_record_file_name(),
+    d_track_record_buffer_size( 0 ),
+    d_track_record_thread_data( 1 ),
+    d_track_record_index(),
+    d_number_of_submitted_track_records( 0 ),
+    d_number_of_indexed_track_records( 0 ),
+    d_number_of_submitted_track_record_index_entries( 0 ),
+    d_track_record_file_started( false ),
+    d_track_record_writer()
 { /* ... */ }
 
 // Constructor
@@ -28,7 +102,16 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track(),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map(),
+    d_track_record_file_name(),
+    d_track_record_buffer_size( 0 ),
+    d_track_record_thread_data( 1 ),
+    d_track_record_index(),
+    d_number_of_submitted_track_records( 0 ),
+    d_number_of_indexed_track_records( 0 ),
+    d_number_of_submitted_track_record_index_entries( 0 ),
+    d_track_record_file_started( false ),
+    d_track_record_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( number_of_histories >= 0 );
@@ -43,7 +126,16 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track( history_numbers ),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map(),
+    d_track_record_file_name(),
+    d_track_record_buffer_size( 0 ),
+    d_track_record_thread_data( 1 ),
+    d_track_record_index(),
+    d_number_of_submitted_track_records( 0 ),
+    d_number_of_indexed_track_records( 0 ),
+    d_number_of_submitted_track_record_index_entries( 0 ),
+    d_track_record_file_started( false ),
+    d_track_record_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( history_numbers.size() > 0 )
@@ -67,9 +159,15 @@ void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
 						 const double start_point[3],
 						 const double end_point[3] )
 {
+  if( this->isStreamingOutputSet() )
+  {
+    this->updateStreamingOutputFromParticleSubtrackEndingEvent( particle,
+                                                                start_point,
+                                                                end_point );
+  }
   // Check if we still need to be tracking particles
-  if( d_histories_to_track.find( particle.getHistoryNumber() ) !=
-      d_histories_to_track.end() )
+  else if( d_histories_to_track.find( particle.getHistoryNumber() ) !=
+           d_histories_to_track.end() )
   {
     unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
@@ -121,8 +219,10 @@ void ParticleTracker::updateFromGlobalParticleGoneEvent(
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  if( d_partial_history_map[thread_id].find( &particle ) !=
-      d_partial_history_map[thread_id].end() )
+  if( this->isStreamingOutputSet() )
+    this->updateStreamingOutputFromParticleGoneEvent( particle );
+  else if( d_partial_history_map[thread_id].find( &particle ) !=
+           d_partial_history_map[thread_id].end() )
   {
     #pragma omp critical
     {
@@ -148,7 +248,15 @@ void ParticleTracker::updateFromGlobalParticleGoneEvent(
 void ParticleTracker::takeSnapshot(
                               const uint64_t num_histories_since_last_snapshot,
                               const double time_since_last_snapshot )
-{ /* ... */ }
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Hand the buffered track records to the background writer so that the
+  // track record file and index are up-to-date after every batch
+  if( this->isStreamingOutputSet() )
+    this->submitTrackRecords();
+}
 
 // Reset data
 void ParticleTracker::resetData()
@@ -161,6 +269,9 @@ void ParticleTracker::resetData()
 
   // Clear the history number map
   d_history_number_map.clear();
+
+  // Restart the track record file
+  this->resetTrackRecordData();
 }
 
 // Enable support for multiple threads
@@ -169,6 +280,28 @@ void ParticleTracker::enableThreadSupport( const unsigned num_threads )
   testPrecondition( num_threads > 0 );
   
   d_partial_history_map.resize( num_threads );
+
+  // Submit the records buffered by the threads that will be removed
+  if( this->isStreamingOutputSet() )
+  {
+    for( size_t i = num_threads; i < d_track_record_thread_data.size(); ++i )
+      this->flushTrackRecordBuffer( d_track_record_thread_data[i] );
+  }
+
+  d_track_record_thread_data.resize( num_threads );
+
+  for( size_t i = 0; i < d_track_record_thread_data.size(); ++i )
+  {
+    if( !d_track_record_thread_data[i].buffer )
+    {
+      d_track_record_thread_data[i].history_number =
+        std::numeric_limits<uint64_t>::max();
+      d_track_record_thread_data[i].next_particle_index = 0;
+      d_track_record_thread_data[i].buffer.reset( new std::string );
+      d_track_record_thread_data[i].buffer->reserve(
+                             d_track_record_buffer_size*sizeof(TrackRecord) );
+    }
+  }
 }
 
 // Has Uncommited History Contribution
@@ -190,8 +323,12 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Each process streams its track records to its own file - only the
+  // records that are still buffered need to be written
+  if( this->isStreamingOutputSet() )
+    this->flushTrackRecords();
   // Only do the reduction if there is more than one process
-  if( comm.size() > 1 )
+  else if( comm.size() > 1 )
   {
     // Handle the master
     if( comm.rank() == root_process )
@@ -279,6 +416,648 @@ void ParticleTracker::getHistoryData( OverallHistoryMap& history_map ) const
   history_map = d_history_number_map;
 }
 
+
+// Set the streaming output (the track records will be written to file)
+/*! \details Once the streaming output has been set the tracked histories
+ * will no longer be stored in memory (see
+ * MonteCarlo::ParticleTracker::getHistoryData). Instead, each thread will
+ * buffer up to buffer_size track records (see
+ * MonteCarlo::ParticleTracker::TrackRecord) before handing them to a
+ * background thread that appends them to the track record file. The index of
+ * the records of each history is written to a separate file (see
+ * MonteCarlo::ParticleTracker::getTrackRecordIndexFileName). When there is
+ * more than one process the rank of the process will be appended to the file
+ * name. Any existing file will be replaced. A tracker that is loaded from an
+ * archive will continue the track record file that it was writing (see
+ * MonteCarlo::ParticleTracker::resumeTrackRecordFile).
+ */
+void ParticleTracker::setStreamingOutput(
+                                      const boost::filesystem::path& file_name,
+                                      const size_t buffer_size )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the file name is valid
+  testPrecondition( !file_name.empty() );
+  // Make sure the buffer size is valid
+  testPrecondition( buffer_size > 0 );
+
+  // Submit the records that were buffered for the previous file
+  if( this->isStreamingOutputSet() )
+    this->flushTrackRecords();
+
+  d_track_record_file_name = file_name;
+
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    d_track_record_file_name = file_name.parent_path();
+    d_track_record_file_name /= file_name.stem().string() + "_" +
+      std::to_string( Utility::GlobalMPISession::rank() ) +
+      file_name.extension().string();
+  }
+
+  d_track_record_buffer_size = buffer_size;
+
+  this->resetTrackRecordData();
+}
+
+// Check if the streaming output has been set
+bool ParticleTracker::isStreamingOutputSet() const
+{
+  return !d_track_record_file_name.empty();
+}
+
+// Get the track record file name
+const boost::filesystem::path& ParticleTracker::getTrackRecordFileName() const
+{
+  return d_track_record_file_name;
+}
+
+// Get the track record buffer size (number of records per thread)
+size_t ParticleTracker::getTrackRecordBufferSize() const
+{
+  return d_track_record_buffer_size;
+}
+
+// Flush the buffered track records and the track record index
+/*! \details This method will block until the track record file and the
+ * track record index file have been written.
+ */
+void ParticleTracker::flushTrackRecords()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->isStreamingOutputSet() )
+  {
+    this->submitTrackRecords();
+
+    d_track_record_writer->waitForPendingWrites();
+  }
+}
+
+// Get the track record index file name
+boost::filesystem::path ParticleTracker::getTrackRecordIndexFileName(
+                                     const boost::filesystem::path& file_name )
+{
+  boost::filesystem::path index_file_name( file_name );
+
+  index_file_name += ".index";
+
+  return index_file_name;
+}
+
+// Read the track record index (sorted by history number)
+/*! \details The index entries are appended to the index file in record order
+ * as the records are submitted, so the entries of a history can be spread
+ * over the entire file. The returned index is sorted by history number (and
+ * by record within each history) so that it only needs to be read once when
+ * the records of many histories will be read (see
+ * MonteCarlo::ParticleTracker::readTrackRecords).
+ */
+void ParticleTracker::readTrackRecordIndex(
+                             const boost::filesystem::path& file_name,
+                             std::vector<TrackRecordIndexEntry>& index )
+{
+  index.clear();
+
+  const boost::filesystem::path index_file_name =
+    ParticleTracker::getTrackRecordIndexFileName( file_name );
+
+  std::ifstream index_file( index_file_name.string().c_str(),
+                            std::ifstream::binary );
+
+  TEST_FOR_EXCEPTION( !index_file.is_open(),
+                      std::runtime_error,
+                      "Could not open file " << index_file_name.string()
+                      << "!" );
+
+  readTrackRecordFileHeader( index_file,
+                             index_file_name,
+                             s_track_record_index_file_header );
+
+  // Size the index using the file size
+  index_file.seekg( 0, std::ifstream::end );
+
+  const uint64_t number_of_entries =
+    ((uint64_t)index_file.tellg() - sizeof(TrackRecordFileHeader))/
+    sizeof(TrackRecordIndexEntry);
+
+  index_file.seekg( sizeof(TrackRecordFileHeader) );
+
+  index.resize( number_of_entries );
+
+  index_file.read( reinterpret_cast<char*>( index.data() ),
+                   number_of_entries*sizeof(TrackRecordIndexEntry) );
+
+  TEST_FOR_EXCEPTION( !index_file.good(),
+                      std::runtime_error,
+                      "Could not read the track record index from file "
+                      << index_file_name.string() << "!" );
+
+  std::sort( index.begin(), index.end(), &compareTrackRecordIndexEntries );
+}
+
+// Read the track records of a history from a track record file
+/*! \details The track records of the history will be returned in the order
+ * that they were created. The entire index will be read and sorted. When the
+ * records of many histories will be read the index should be read once
+ * (see MonteCarlo::ParticleTracker::readTrackRecordIndex) and passed to
+ * the overload that takes the index.
+ */
+void ParticleTracker::readTrackRecords(
+                                 const boost::filesystem::path& file_name,
+                                 const uint64_t history_number,
+                                 std::vector<TrackRecord>& records )
+{
+  std::vector<TrackRecordIndexEntry> index;
+
+  ParticleTracker::readTrackRecordIndex( file_name, index );
+
+  ParticleTracker::readTrackRecords( file_name, index, history_number, records );
+}
+
+// Read the track records of a history using a sorted track record index
+/*! \details The index must be sorted by history number (see
+ * MonteCarlo::ParticleTracker::readTrackRecordIndex). The entries of the
+ * history are found with a binary search. The track records of the history
+ * will be returned in the order that they were created.
+ */
+void ParticleTracker::readTrackRecords(
+                          const boost::filesystem::path& file_name,
+                          const std::vector<TrackRecordIndexEntry>& index,
+                          const uint64_t history_number,
+                          std::vector<TrackRecord>& records )
+{
+  // Make sure that the index is sorted
+  testPrecondition( std::is_sorted( index.begin(), index.end(),
+                                    &compareTrackRecordIndexEntries ) );
+
+  records.clear();
+
+  TrackRecordIndexEntry history_entry;
+  history_entry.history_number = history_number;
+  history_entry.first_record = 0;
+  history_entry.number_of_records = 0;
+
+  std::vector<TrackRecordIndexEntry>::const_iterator entry_it =
+    std::lower_bound( index.begin(),
+                      index.end(),
+                      history_entry,
+                      &compareTrackRecordIndexEntries );
+
+  if( entry_it == index.end() || entry_it->history_number != history_number )
+    return;
+
+  // Read the records
+  std::ifstream file( file_name.string().c_str(), std::ifstream::binary );
+
+  TEST_FOR_EXCEPTION( !file.is_open(),
+                      std::runtime_error,
+                      "Could not open file " << file_name.string() << "!" );
+
+  readTrackRecordFileHeader( file, file_name, s_track_record_file_header );
+
+  while( entry_it != index.end() &&
+         entry_it->history_number == history_number )
+  {
+    const size_t first_record = records.size();
+
+    records.resize( first_record + entry_it->number_of_records );
+
+    file.seekg( sizeof(TrackRecordFileHeader) +
+                entry_it->first_record*sizeof(TrackRecord) );
+    file.read( reinterpret_cast<char*>( &records[first_record] ),
+               entry_it->number_of_records*sizeof(TrackRecord) );
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Could not read the track records of history "
+                        << history_number << " from file "
+                        << file_name.string() << "!" );
+
+    ++entry_it;
+  }
+}
+
+// Update the streaming output from a particle subtrack ending event
+void ParticleTracker::updateStreamingOutputFromParticleSubtrackEndingEvent(
+                                                 const ParticleState& particle,
+                                                 const double start_point[3],
+                                                 const double end_point[3] )
+{
+  // Check if we still need to be tracking particles
+  if( d_histories_to_track.find( particle.getHistoryNumber() ) ==
+      d_histories_to_track.end() )
+    return;
+
+  TrackRecordThreadData& thread_data =
+    d_track_record_thread_data[Utility::OpenMPProperties::getThreadId()];
+
+  std::unordered_map<const ParticleState*,uint32_t>::iterator particle_it =
+    thread_data.particle_indices.find( &particle );
+
+  // The start of the particle track must also be recorded
+  if( particle_it == thread_data.particle_indices.end() )
+  {
+    // Each history is simulated by a single thread
+    if( particle.getHistoryNumber() != thread_data.history_number )
+    {
+      thread_data.history_number = particle.getHistoryNumber();
+      thread_data.next_particle_index = 0;
+    }
+
+    particle_it = thread_data.particle_indices.emplace(
+                     &particle, thread_data.next_particle_index++ ).first;
+
+    ObserverParticleStateWrapper particle_wrapper( particle );
+
+    const double track_length =
+      std::sqrt( (end_point[0] - start_point[0])*(end_point[0] - start_point[0]) +
+                 (end_point[1] - start_point[1])*(end_point[1] - start_point[1]) +
+                 (end_point[2] - start_point[2])*(end_point[2] - start_point[2]) );
+
+    particle_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( track_length );
+
+    this->appendTrackRecord( thread_data,
+                             particle,
+                             particle_it->second,
+                             PARTICLE_TRACK_START_EVENT,
+                             start_point,
+                             particle_wrapper.getStartTime() );
+  }
+
+  this->appendTrackRecord( thread_data,
+                           particle,
+                           particle_it->second,
+                           PARTICLE_SUBTRACK_ENDING_EVENT,
+                           end_point,
+                           particle.getTime() );
+}
+
+// Update the streaming output from a particle gone event
+void ParticleTracker::updateStreamingOutputFromParticleGoneEvent(
+                                                const ParticleState& particle )
+{
+  TrackRecordThreadData& thread_data =
+    d_track_record_thread_data[Utility::OpenMPProperties::getThreadId()];
+
+  std::unordered_map<const ParticleState*,uint32_t>::iterator particle_it =
+    thread_data.particle_indices.find( &particle );
+
+  if( particle_it != thread_data.particle_indices.end() )
+  {
+    this->appendTrackRecord( thread_data,
+                             particle,
+                             particle_it->second,
+                             PARTICLE_GONE_EVENT,
+                             particle.getPosition(),
+                             particle.getTime() );
+
+    thread_data.particle_indices.erase( particle_it );
+  }
+}
+
+// Append a track record to a thread buffer
+/*! \details The buffer will be flushed once it is full.
+ */
+void ParticleTracker::appendTrackRecord( TrackRecordThreadData& thread_data,
+                                         const ParticleState& particle,
+                                         const uint32_t particle_index,
+                                         const TrackRecordEventType event_type,
+                                         const double position[3],
+                                         const double time )
+{
+  TrackRecord record;
+  record.history_number = particle.getHistoryNumber();
+  record.particle_type = particle.getParticleType();
+  record.generation_number = particle.getGenerationNumber();
+  record.particle_index = particle_index;
+  record.event_type = event_type;
+  record.collision_number = particle.getCollisionNumber();
+  record.padding = 0;
+  record.cell = particle.getCell();
+  record.position[0] = position[0];
+  record.position[1] = position[1];
+  record.position[2] = position[2];
+  record.direction[0] = particle.getXDirection();
+  record.direction[1] = particle.getYDirection();
+  record.direction[2] = particle.getZDirection();
+  record.energy = particle.getEnergy();
+  record.time = time;
+  record.weight = particle.getWeight();
+
+  // Update the buffer index
+  const uint64_t buffer_record = thread_data.buffer->size()/sizeof(TrackRecord);
+
+  if( thread_data.index.empty() ||
+      thread_data.index.back().history_number != record.history_number )
+  {
+    TrackRecordIndexEntry entry = {record.history_number, buffer_record, 0};
+
+    thread_data.index.push_back( entry );
+  }
+
+  ++thread_data.index.back().number_of_records;
+
+  thread_data.buffer->append( reinterpret_cast<const char*>( &record ),
+                              sizeof(record) );
+
+  if( thread_data.buffer->size() >=
+      d_track_record_buffer_size*sizeof(TrackRecord) )
+    this->flushTrackRecordBuffer( thread_data );
+}
+
+// Flush a thread buffer
+/*! \details The buffer is handed to the background writer so the calling
+ * thread will only block if the maximum number of writes are pending.
+ */
+void ParticleTracker::flushTrackRecordBuffer(
+                                             TrackRecordThreadData& thread_data )
+{
+  if( thread_data.buffer->empty() )
+    return;
+
+  const uint64_t number_of_records =
+    thread_data.buffer->size()/sizeof(TrackRecord);
+
+  // The buffers from all threads are appended to the same file
+  #pragma omp critical( particle_tracker_track_record_file )
+  {
+    this->startTrackRecordFile();
+
+    for( size_t i = 0; i < thread_data.index.size(); ++i )
+    {
+      TrackRecordIndexEntry entry = thread_data.index[i];
+      entry.first_record += d_number_of_submitted_track_records;
+
+      // Merge the entry with the previous entry if they are contiguous
+      if( !d_track_record_index.empty() &&
+          d_track_record_index.back().history_number == entry.history_number &&
+          d_track_record_index.back().first_record +
+          d_track_record_index.back().number_of_records == entry.first_record )
+      {
+        d_track_record_index.back().number_of_records +=
+          entry.number_of_records;
+      }
+      else
+        d_track_record_index.push_back( entry );
+    }
+
+    d_track_record_writer->append( d_track_record_file_name,
+                                   thread_data.buffer );
+
+    d_number_of_submitted_track_records += number_of_records;
+  }
+
+  // The submitted buffer cannot be reused until it has been written
+  thread_data.buffer.reset( new std::string );
+  thread_data.buffer->reserve( d_track_record_buffer_size*sizeof(TrackRecord) );
+  thread_data.index.clear();
+}
+
+// Start the track record file (the critical section must be entered)
+void ParticleTracker::startTrackRecordFile()
+{
+  if( !d_track_record_writer )
+  {
+    d_track_record_writer.reset( new Utility::BackgroundFileWriter(
+                                       2*d_track_record_thread_data.size() ) );
+  }
+
+  // The headers replace any existing files - the background writer
+  // completes the writes in order so the headers will be written before the
+  // records and index entries are appended
+  if( !d_track_record_file_started )
+  {
+    d_track_record_writer->write( d_track_record_file_name,
+                                  std::make_shared<const std::string>(
+                       reinterpret_cast<const char*>( &s_track_record_file_header ),
+                       sizeof(s_track_record_file_header) ) );
+
+    d_track_record_writer->write(
+                 ParticleTracker::getTrackRecordIndexFileName( d_track_record_file_name ),
+                 std::make_shared<const std::string>(
+                 reinterpret_cast<const char*>( &s_track_record_index_file_header ),
+                 sizeof(s_track_record_index_file_header) ) );
+
+    d_track_record_file_started = true;
+  }
+}
+
+// Submit the buffered track records and the track record index
+void ParticleTracker::submitTrackRecords()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_track_record_thread_data.size(); ++i )
+    this->flushTrackRecordBuffer( d_track_record_thread_data[i] );
+
+  this->writeTrackRecordIndex();
+}
+
+// Write the track record index entries that have not been written
+/*! \details Only the new index entries are appended to the index file. The
+ * entries are not sorted (see
+ * MonteCarlo::ParticleTracker::readTrackRecordIndex).
+ */
+void ParticleTracker::writeTrackRecordIndex()
+{
+  this->startTrackRecordFile();
+
+  if( !d_track_record_index.empty() )
+  {
+    std::shared_ptr<std::string> buffer( new std::string(
+              reinterpret_cast<const char*>( d_track_record_index.data() ),
+              d_track_record_index.size()*sizeof(TrackRecordIndexEntry) ) );
+
+    d_track_record_writer->append(
+                 ParticleTracker::getTrackRecordIndexFileName( d_track_record_file_name ),
+                 buffer );
+
+    d_number_of_submitted_track_record_index_entries +=
+      d_track_record_index.size();
+
+    d_track_record_index.clear();
+  }
+
+  // All of the submitted records are now indexed
+  d_number_of_indexed_track_records = d_number_of_submitted_track_records;
+}
+
+// Reset the track record data
+/*! \details The buffered track records will be discarded and the track
+ * record file will be replaced when the next records are flushed.
+ */
+void ParticleTracker::resetTrackRecordData()
+{
+  for( size_t i = 0; i < d_track_record_thread_data.size(); ++i )
+  {
+    TrackRecordThreadData& thread_data = d_track_record_thread_data[i];
+
+    thread_data.particle_indices.clear();
+    thread_data.history_number = std::numeric_limits<uint64_t>::max();
+    thread_data.next_particle_index = 0;
+    thread_data.buffer.reset( new std::string );
+    thread_data.buffer->reserve( d_track_record_buffer_size*sizeof(TrackRecord) );
+    thread_data.index.clear();
+  }
+
+  d_track_record_index.clear();
+  d_number_of_submitted_track_records = 0;
+  d_number_of_indexed_track_records = 0;
+  d_number_of_submitted_track_record_index_entries = 0;
+  d_track_record_file_started = false;
+}
+
+// Resume an existing track record file
+/*! \details The track record file and the track record index file will be
+ * truncated to the records and index entries that had been indexed when the
+ * tracker was archived. Any records that were written after that belong to
+ * histories that will be simulated again. If the index file is missing or
+ * incomplete it will be rebuilt from the track record file. A
+ * std::runtime_error will be thrown if the track record file is missing or
+ * incomplete.
+ */
+void ParticleTracker::resumeTrackRecordFile(
+                                       const uint64_t number_of_records,
+                                       const uint64_t number_of_index_entries )
+{
+  const uint64_t file_size = sizeof(TrackRecordFileHeader) +
+    number_of_records*sizeof(TrackRecord);
+
+  {
+    std::ifstream file( d_track_record_file_name.string().c_str(),
+                        std::ifstream::binary );
+
+    TEST_FOR_EXCEPTION( !file.is_open(),
+                        std::runtime_error,
+                        "The track record file "
+                        << d_track_record_file_name.string() << " cannot be "
+                        "continued because it does not exist!" );
+
+    readTrackRecordFileHeader( file,
+                               d_track_record_file_name,
+                               s_track_record_file_header );
+  }
+
+  TEST_FOR_EXCEPTION( boost::filesystem::file_size( d_track_record_file_name ) <
+                      file_size,
+                      std::runtime_error,
+                      "The track record file "
+                      << d_track_record_file_name.string() << " cannot be "
+                      "continued because it has fewer than the "
+                      << number_of_records << " expected records!" );
+
+  boost::filesystem::resize_file( d_track_record_file_name, file_size );
+
+  // Check the index file
+  const boost::filesystem::path index_file_name =
+    ParticleTracker::getTrackRecordIndexFileName( d_track_record_file_name );
+
+  const uint64_t index_file_size = sizeof(TrackRecordFileHeader) +
+    number_of_index_entries*sizeof(TrackRecordIndexEntry);
+
+  bool valid_index_file = false;
+
+  {
+    std::ifstream index_file( index_file_name.string().c_str(),
+                              std::ifstream::binary );
+
+    if( index_file.is_open() )
+    {
+      TrackRecordFileHeader header;
+
+      index_file.read( reinterpret_cast<char*>( &header ), sizeof(header) );
+
+      valid_index_file = index_file.good() &&
+        std::memcmp( &header,
+                     &s_track_record_index_file_header,
+                     sizeof(header) ) == 0;
+    }
+  }
+
+  if( valid_index_file &&
+      boost::filesystem::file_size( index_file_name ) >= index_file_size )
+  {
+    boost::filesystem::resize_file( index_file_name, index_file_size );
+
+    d_number_of_submitted_track_record_index_entries = number_of_index_entries;
+  }
+  else
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "ParticleTracker",
+                                "The track record index file "
+                                << index_file_name.string() << " is missing "
+                                "or incomplete - it will be rebuilt!" );
+
+    // Rebuild the index from the track records
+    std::vector<TrackRecordIndexEntry> index;
+
+    std::ifstream file( d_track_record_file_name.string().c_str(),
+                        std::ifstream::binary );
+
+    file.seekg( sizeof(TrackRecordFileHeader) );
+
+    std::vector<TrackRecord> records( 4096 );
+    uint64_t record = 0;
+
+    while( record < number_of_records )
+    {
+      const uint64_t number_of_block_records =
+        std::min<uint64_t>( records.size(), number_of_records - record );
+
+      file.read( reinterpret_cast<char*>( records.data() ),
+                 number_of_block_records*sizeof(TrackRecord) );
+
+      TEST_FOR_EXCEPTION( !file.good(),
+                          std::runtime_error,
+                          "Could not read the track records from file "
+                          << d_track_record_file_name.string() << "!" );
+
+      for( uint64_t i = 0; i < number_of_block_records; ++i, ++record )
+      {
+        if( index.empty() ||
+            index.back().history_number != records[i].history_number )
+        {
+          TrackRecordIndexEntry entry =
+            {records[i].history_number, record, 0};
+
+          index.push_back( entry );
+        }
+
+        ++index.back().number_of_records;
+      }
+    }
+
+    std::ofstream index_file( index_file_name.string().c_str(),
+                              std::ofstream::binary | std::ofstream::trunc );
+
+    index_file.write( reinterpret_cast<const char*>( &s_track_record_index_file_header ),
+                      sizeof(s_track_record_index_file_header) );
+
+    if( !index.empty() )
+    {
+      index_file.write( reinterpret_cast<const char*>( index.data() ),
+                        index.size()*sizeof(TrackRecordIndexEntry) );
+    }
+
+    TEST_FOR_EXCEPTION( !index_file.good(),
+                        std::runtime_error,
+                        "Could not write the track record index file "
+                        << index_file_name.string() << "!" );
+
+    d_number_of_submitted_track_record_index_entries = index.size();
+  }
+
+  d_number_of_submitted_track_records = number_of_records;
+  d_number_of_indexed_track_records = number_of_records;
+
+  // The headers have already been written
+  d_track_record_file_started = true;
+}
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::ParticleTracker );
@@ -9,7 +9,12 @@
 #ifndef MONTE_CARLO_PARTICLE_TRACKER_HPP
 #define MONTE_CARLO_PARTICLE_TRACKER_HPP
 
+// Std Lib Includes
+#include <memory>
+#include <string>
+
 // Boost Includes
+#include <boost/filesystem/path.hpp>
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/version.hpp>
 #include <boost/serialization/assume_abstract.hpp>
@@ -22,6 +27,7 @@
 #include "MonteCarlo_ParticleGoneGlobalEventObserver.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
 #include "MonteCarlo_UniqueIdManager.hpp"
+#include "Utility_BackgroundFileWriter.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Array.hpp"
@@ -32,6 +38,15 @@
 namespace MonteCarlo{
 
 /*! The particle tracking class, similar to the PTRAC function in MCNP
+ * \details By default the tracked histories are stored in memory (see
+ * MonteCarlo::ParticleTracker::getHistoryData). When the streaming output
+ * has been set (see MonteCarlo::ParticleTracker::setStreamingOutput) each
+ * thread will instead append fixed size binary track records to its own
+ * buffer. Full buffers are appended to the track record file by a background
+ * thread and an index of the records of each history is written to a
+ * separate file every time that a snapshot is taken. The memory used by the
+ * tracker is therefore bounded by the buffer size and the index size, which
+ * allows millions of histories to be tracked.
  */
 class ParticleTracker : public ParticleSubtrackEndingGlobalEventObserver,
                         public ParticleGoneGlobalEventObserver,
@@ -69,6 +84,83 @@ public:
   typedef std::unordered_map<ParticleState::historyNumberType,ParticleTypeSubmap>
     OverallHistoryMap;
 
+  //! The track record event types
+  enum TrackRecordEventType : uint32_t
+  {
+    PARTICLE_TRACK_START_EVENT = 0,
+    PARTICLE_SUBTRACK_ENDING_EVENT = 1,
+    PARTICLE_GONE_EVENT = 2
+  };
+
+  //! The fixed size binary track record (written in native byte order)
+  struct TrackRecord
+  {
+    //! The history number
+    uint64_t history_number;
+
+    //! The particle type
+    uint32_t particle_type;
+
+    //! The generation number
+    uint32_t generation_number;
+
+    //! The index of the particle in the history (order of first track)
+    uint32_t particle_index;
+
+    //! The event type
+    uint32_t event_type;
+
+    //! The collision number
+    uint32_t collision_number;
+
+    //! Unused (keeps the record layout explicit)
+    uint32_t padding;
+
+    //! The cell
+    uint64_t cell;
+
+    //! The position
+    double position[3];
+
+    //! The direction
+    double direction[3];
+
+    //! The energy
+    double energy;
+
+    //! The time
+    double time;
+
+    //! The weight
+    double weight;
+  };
+
+  //! The track record index entry (a contiguous range of history records)
+  struct TrackRecordIndexEntry
+  {
+    //! The history number
+    uint64_t history_number;
+
+    //! The first record in the range
+    uint64_t first_record;
+
+    //! The number of records in the range
+    uint64_t number_of_records;
+  };
+
+  //! The track record file header (also used by the index file)
+  struct TrackRecordFileHeader
+  {
+    //! The file type identifier
+    char identifier[8];
+
+    //! The file format version
+    uint32_t version;
+
+    //! The size of each record (or index entry) in bytes
+    uint32_t record_size;
+  };
+
   //! Typedef for event tags used for quick dispatcher registering
   typedef boost::mpl::vector<ParticleSubtrackEndingGlobalEventObserver::EventTag,ParticleGoneGlobalEventObserver::EventTag>
   EventTags;
@@ -128,11 +220,104 @@ public:
   //! Get the data map
   void getHistoryData( OverallHistoryMap& history_map ) const;
 
+  //! Set the streaming output (the track records will be written to file)
+  void setStreamingOutput( const boost::filesystem::path& file_name,
+                           const size_t buffer_size = 8192 );
+
+  //! Check if the streaming output has been set
+  bool isStreamingOutputSet() const;
+
+  //! Get the track record file name
+  const boost::filesystem::path& getTrackRecordFileName() const;
+
+  //! Get the track record buffer size (number of records per thread)
+  size_t getTrackRecordBufferSize() const;
+
+  //! Flush the buffered track records and the track record index
+  void flushTrackRecords();
+
+  //! Get the track record index file name
+  static boost::filesystem::path getTrackRecordIndexFileName(
+                                    const boost::filesystem::path& file_name );
+
+  //! Read the track record index (sorted by history number)
+  static void readTrackRecordIndex(
+                             const boost::filesystem::path& file_name,
+                             std::vector<TrackRecordIndexEntry>& index );
+
+  //! Read the track records of a history from a track record file
+  static void readTrackRecords( const boost::filesystem::path& file_name,
+                                const uint64_t history_number,
+                                std::vector<TrackRecord>& records );
+
+  //! Read the track records of a history using a sorted track record index
+  static void readTrackRecords(
+                          const boost::filesystem::path& file_name,
+                          const std::vector<TrackRecordIndexEntry>& index,
+                          const uint64_t history_number,
+                          std::vector<TrackRecord>& records );
+
 private:
 
+  // The track record thread data
+  struct TrackRecordThreadData
+  {
+    // The index of each particle that is being tracked
+    std::unordered_map<const ParticleState*,uint32_t> particle_indices;
+
+    // The history number of the particles that are being tracked
+    uint64_t history_number;
+
+    // The index of the next particle in the history
+    uint32_t next_particle_index;
+
+    // The buffered records
+    std::shared_ptr<std::string> buffer;
+
+    // The index of the buffered records (relative to the buffer start)
+    std::vector<TrackRecordIndexEntry> index;
+  };
+
   // Default constructor
   ParticleTracker();
 
+  // Update the streaming output from a particle subtrack ending event
+  void updateStreamingOutputFromParticleSubtrackEndingEvent(
+                                              const ParticleState& particle,
+                                              const double start_point[3],
+                                              const double end_point[3] );
+
+  // Update the streaming output from a particle gone event
+  void updateStreamingOutputFromParticleGoneEvent(
+                                               const ParticleState& particle );
+
+  // Append a track record to a thread buffer
+  void appendTrackRecord( TrackRecordThreadData& thread_data,
+                          const ParticleState& particle,
+                          const uint32_t particle_index,
+                          const TrackRecordEventType event_type,
+                          const double position[3],
+                          const double time );
+
+  // Flush a thread buffer
+  void flushTrackRecordBuffer( TrackRecordThreadData& thread_data );
+
+  // Start the track record file (the critical section must be entered)
+  void startTrackRecordFile();
+
+  // Submit the buffered track records and the track record index
+  void submitTrackRecords();
+
+  // Write the track record index entries that have not been written
+  void writeTrackRecordIndex();
+
+  // Reset the track record data
+  void resetTrackRecordData();
+
+  // Resume an existing track record file
+  void resumeTrackRecordFile( const uint64_t number_of_records,
+                              const uint64_t number_of_index_entries );
+
   // Save the data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -158,6 +343,33 @@ private:
 
   // The tracked history info
   OverallHistoryMap d_history_number_map;
+
+  // The track record file name (empty if the records are stored in memory)
+  boost::filesystem::path d_track_record_file_name;
+
+  // The track record buffer size (number of records per thread)
+  size_t d_track_record_buffer_size;
+
+  // The track record thread data
+  std::vector<TrackRecordThreadData> d_track_record_thread_data;
+
+  // The track record index entries that have not been submitted to the writer
+  std::vector<TrackRecordIndexEntry> d_track_record_index;
+
+  // The number of track records that have been submitted to the writer
+  uint64_t d_number_of_submitted_track_records;
+
+  // The number of track records covered by the submitted index entries
+  uint64_t d_number_of_indexed_track_records;
+
+  // The number of track record index entries that have been submitted
+  uint64_t d_number_of_submitted_track_record_index_entries;
+
+  // Records if the track record file header has been submitted
+  bool d_track_record_file_started;
+
+  // The track record file writer
+  std::unique_ptr<Utility::BackgroundFileWriter> d_track_record_writer;
 };
 
 // Save the estimator data
@@ -173,6 +385,13 @@ void ParticleTracker::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+
+  std::string track_record_file_name = d_track_record_file_name.string();
+
+  ar & BOOST_SERIALIZATION_NVP( track_record_file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_track_record_buffer_size );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_indexed_track_records );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_submitted_track_record_index_entries );
 }
 
 // Load the estimator data
@@ -189,12 +408,43 @@ void ParticleTracker::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
 
+  // The track records are not archived - a loaded tracker will continue
+  // the track record file (only the number of records that had been indexed
+  // is archived)
+  uint64_t number_of_indexed_track_records = 0;
+  uint64_t number_of_submitted_track_record_index_entries = 0;
+  
+  if( version > 0 )
+  {
+    std::string track_record_file_name;
+
+    ar & BOOST_SERIALIZATION_NVP( track_record_file_name );
+    ar & BOOST_SERIALIZATION_NVP( d_track_record_buffer_size );
+
+    d_track_record_file_name = track_record_file_name;
+  }
+
+  if( version > 1 )
+  {
+    ar & boost::serialization::make_nvp( "d_number_of_indexed_track_records", number_of_indexed_track_records );
+    ar & boost::serialization::make_nvp( "d_number_of_submitted_track_record_index_entries", number_of_submitted_track_record_index_entries );
+  }
+
   d_partial_history_map.resize( 1 );
+  d_track_record_thread_data.resize( 1 );
+
+  this->resetTrackRecordData();
+
+  if( this->isStreamingOutputSet() && number_of_indexed_track_records > 0 )
+  {
+    this->resumeTrackRecordFile( number_of_indexed_track_records,
+                                 number_of_submitted_track_record_index_entries );
+  }
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 2 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ParticleTracker, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ParticleTracker );
 
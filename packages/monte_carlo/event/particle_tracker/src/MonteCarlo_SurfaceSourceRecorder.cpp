@@ -0,0 +1,382 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceRecorder.cpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+SurfaceSourceRecorder::SurfaceSourceRecorder()
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_surfaces(),
+    d_particle_types(),
+    d_file_name(),
+    d_buffer_size( 0 ),
+    d_thread_buffers( 1 ),
+    d_number_of_recorded_histories( 0 ),
+    d_number_of_submitted_records( 0 ),
+    d_number_of_flushed_records( 0 ),
+    d_file_started( false ),
+    d_writer()
+{ /* ... */ }
+
+// Constructor
+/*! \details When there is more than one process the rank of the process will
+ * be appended to the file name. Any existing file will be replaced. A
+ * recorder that is loaded from an archive will continue the file that it was
+ * writing when it was archived.
+ */
+SurfaceSourceRecorder::SurfaceSourceRecorder(
+                                      const Id id,
+                                      const std::set<EntityId>& surfaces,
+                                      const boost::filesystem::path& file_name,
+                                      const size_t buffer_size )
+  : d_id( id ),
+    d_surfaces( surfaces ),
+    d_particle_types(),
+    d_file_name( file_name ),
+    d_buffer_size( buffer_size ),
+    d_thread_buffers( 1 ),
+    d_number_of_recorded_histories( 0 ),
+    d_number_of_submitted_records( 0 ),
+    d_number_of_flushed_records( 0 ),
+    d_file_started( false ),
+    d_writer()
+{
+  // Make sure that some surfaces will be recorded
+  testPrecondition( surfaces.size() > 0 );
+  // Make sure the file name is valid
+  testPrecondition( !file_name.empty() );
+  // Make sure the buffer size is valid
+  testPrecondition( buffer_size > 0 );
+
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    d_file_name = file_name.parent_path();
+    d_file_name /= file_name.stem().string() + "_" +
+      std::to_string( Utility::GlobalMPISession::rank() ) +
+      file_name.extension().string();
+  }
+
+  this->resetRecordData();
+}
+
+// Return the recorder id
+auto SurfaceSourceRecorder::getId() const -> Id
+{
+  return d_id;
+}
+
+// Return the recorded surfaces
+auto SurfaceSourceRecorder::getSurfaces() const -> const std::set<EntityId>&
+{
+  return d_surfaces;
+}
+
+// Set the particle types that will be recorded
+/*! \details This must be done before the recorder is added to the event
+ * handler. By default all particle types will be recorded.
+ */
+void SurfaceSourceRecorder::setParticleTypes(
+                                 const std::set<ParticleType>& particle_types )
+{
+  d_particle_types = particle_types;
+}
+
+// Return the particle types that will be recorded (empty if all)
+const std::set<ParticleType>& SurfaceSourceRecorder::getParticleTypes() const
+{
+  return d_particle_types;
+}
+
+// Return the surface source file name
+const boost::filesystem::path& SurfaceSourceRecorder::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the record buffer size (number of records per thread)
+size_t SurfaceSourceRecorder::getBufferSize() const
+{
+  return d_buffer_size;
+}
+
+// Return the number of source histories that have been recorded
+uint64_t SurfaceSourceRecorder::getNumberOfRecordedHistories() const
+{
+  return d_number_of_recorded_histories;
+}
+
+// Update the observer
+/*! \details Every crossing of a recorded surface will be recorded,
+ * regardless of the crossing direction.
+ */
+void SurfaceSourceRecorder::updateFromParticleCrossingSurfaceEvent(
+                            const ParticleState& particle,
+                            const Geometry::Model::EntityId surface_crossing,
+                            const double angle_cosine )
+{
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_buffers.size() );
+
+  std::shared_ptr<std::string>& buffer =
+    d_thread_buffers[Utility::OpenMPProperties::getThreadId()];
+
+  SurfaceSourceFile::Record record;
+
+  SurfaceSourceFile::createRecord( particle, surface_crossing, record );
+
+  buffer->append( reinterpret_cast<const char*>( &record ), sizeof(record) );
+
+  if( buffer->size() >= d_buffer_size*sizeof(SurfaceSourceFile::Record) )
+    this->flushRecordBuffer( buffer );
+}
+
+// Enable support for multiple threads
+void SurfaceSourceRecorder::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  // Submit the records buffered by the threads that will be removed
+  for( size_t i = num_threads; i < d_thread_buffers.size(); ++i )
+    this->flushRecordBuffer( d_thread_buffers[i] );
+
+  d_thread_buffers.resize( num_threads );
+
+  for( size_t i = 0; i < d_thread_buffers.size(); ++i )
+  {
+    if( !d_thread_buffers[i] )
+    {
+      d_thread_buffers[i].reset( new std::string );
+      d_thread_buffers[i]->reserve(
+                             d_buffer_size*sizeof(SurfaceSourceFile::Record) );
+    }
+  }
+}
+
+// Check if the observer has uncommitted history contributions
+bool SurfaceSourceRecorder::hasUncommittedHistoryContribution() const
+{
+  return false;
+}
+
+// Commit History Contribution
+void SurfaceSourceRecorder::commitHistoryContribution()
+{ /* ... */ }
+
+// Take a snapshot
+/*! \details The buffered records will be written and the number of source
+ * histories in the file header will be updated so that the file can be
+ * replayed after every batch.
+ */
+void SurfaceSourceRecorder::takeSnapshot(
+                              const uint64_t num_histories_since_last_snapshot,
+                              const double time_since_last_snapshot )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_number_of_recorded_histories += num_histories_since_last_snapshot;
+
+  this->flushRecords();
+}
+
+// Reset data
+void SurfaceSourceRecorder::resetData()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Restart the surface source file
+  this->resetRecordData();
+}
+
+// Reduce data in multiple nodes
+/*! \details Each process records to its own file - only the records that are
+ * still buffered need to be written.
+ */
+void SurfaceSourceRecorder::reduceData( const Utility::Communicator& comm,
+                                        const int root_process )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  this->flushRecords();
+
+  comm.barrier();
+}
+
+// Print a summary of the data
+void SurfaceSourceRecorder::printSummary( std::ostream& os ) const
+{
+  os << "Surface source recorder " << this->getId() << ": "
+     << d_number_of_submitted_records << " records from "
+     << d_number_of_recorded_histories << " histories written to "
+     << d_file_name.string() << std::endl;
+}
+
+// Flush the buffered records and update the file header
+/*! \details This method will block until the surface source file has been
+ * written.
+ */
+void SurfaceSourceRecorder::flushRecords()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_thread_buffers.size(); ++i )
+    this->flushRecordBuffer( d_thread_buffers[i] );
+
+  this->startFile();
+
+  d_writer->waitForPendingWrites();
+
+  // The writer is idle so the header can be updated in place
+  SurfaceSourceFile::writeHeader( d_file_name,
+                                  SurfaceSourceFile::createHeader(
+                                            d_number_of_recorded_histories ) );
+
+  d_number_of_flushed_records = d_number_of_submitted_records;
+}
+
+// Flush a thread buffer
+/*! \details The buffer is handed to the background writer so the calling
+ * thread will only block if the maximum number of writes are pending.
+ */
+void SurfaceSourceRecorder::flushRecordBuffer(
+                                        std::shared_ptr<std::string>& buffer )
+{
+  if( buffer->empty() )
+    return;
+
+  // The buffers from all threads are appended to the same file
+  #pragma omp critical( surface_source_recorder_file )
+  {
+    this->startFile();
+
+    d_writer->append( d_file_name, buffer );
+
+    d_number_of_submitted_records +=
+      buffer->size()/sizeof(SurfaceSourceFile::Record);
+  }
+
+  // The submitted buffer cannot be reused until it has been written
+  buffer.reset( new std::string );
+  buffer->reserve( d_buffer_size*sizeof(SurfaceSourceFile::Record) );
+}
+
+// Start the surface source file (the critical section must be entered)
+void SurfaceSourceRecorder::startFile()
+{
+  if( !d_writer )
+  {
+    d_writer.reset( new Utility::BackgroundFileWriter(
+                                               2*d_thread_buffers.size() ) );
+  }
+
+  // The header replaces any existing file - the background writer completes
+  // the writes in order so the header will be written before the records are
+  // appended
+  if( !d_file_started )
+  {
+    const SurfaceSourceFile::Header header =
+      SurfaceSourceFile::createHeader( d_number_of_recorded_histories );
+
+    d_writer->write( d_file_name,
+                     std::make_shared<const std::string>(
+                               reinterpret_cast<const char*>( &header ),
+                               sizeof(header) ) );
+
+    d_file_started = true;
+  }
+}
+
+// Reset the record data
+/*! \details The buffered records will be discarded and the surface source
+ * file will be replaced when the next records are flushed.
+ */
+void SurfaceSourceRecorder::resetRecordData()
+{
+  for( size_t i = 0; i < d_thread_buffers.size(); ++i )
+  {
+    d_thread_buffers[i].reset( new std::string );
+    d_thread_buffers[i]->reserve(
+                             d_buffer_size*sizeof(SurfaceSourceFile::Record) );
+  }
+
+  d_number_of_recorded_histories = 0;
+  d_number_of_submitted_records = 0;
+  d_number_of_flushed_records = 0;
+  d_file_started = false;
+}
+
+// Continue an existing surface source file
+/*! \details The records that were appended to the file after the header was
+ * last updated (e.g. the records of the histories that were in progress when
+ * the recorder was archived) will be removed and new records will be
+ * appended to the file. An exception will be thrown if the file does not
+ * exist or if it has fewer records than expected.
+ */
+void SurfaceSourceRecorder::resumeFile( const uint64_t number_of_histories,
+                                        const uint64_t number_of_records )
+{
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( d_file_name ),
+                      std::runtime_error,
+                      "The surface source file " << d_file_name.string() <<
+                      " cannot be continued because it does not exist!" );
+
+  // Check that the file is a valid surface source file
+  SurfaceSourceFile::readHeader( d_file_name );
+
+  const uintmax_t file_size = sizeof(SurfaceSourceFile::Header) +
+    number_of_records*sizeof(SurfaceSourceFile::Record);
+
+  TEST_FOR_EXCEPTION( boost::filesystem::file_size( d_file_name ) < file_size,
+                      std::runtime_error,
+                      "The surface source file " << d_file_name.string() <<
+                      " cannot be continued because it has fewer than the "
+                      << number_of_records << " expected records!" );
+
+  boost::filesystem::resize_file( d_file_name, file_size );
+
+  SurfaceSourceFile::writeHeader( d_file_name,
+                                  SurfaceSourceFile::createHeader(
+                                                       number_of_histories ) );
+
+  d_number_of_recorded_histories = number_of_histories;
+  d_number_of_submitted_records = number_of_records;
+  d_number_of_flushed_records = number_of_records;
+  d_file_started = true;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::SurfaceSourceRecorder );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::SurfaceSourceRecorder );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceRecorder.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,266 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceRecorder.hpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <string>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/mpl/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleCrossingSurfaceEventObserver.hpp"
+#include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "MonteCarlo_SurfaceSourceFile.hpp"
+#include "MonteCarlo_UniqueIdManager.hpp"
+#include "Utility_BackgroundFileWriter.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source recorder class
+ * \details The surface source recorder writes the state of every particle
+ * that crosses one of the recorded surfaces to a surface source file (see
+ * MonteCarlo::SurfaceSourceFile). Each thread appends the records to its own
+ * buffer. Full buffers are appended to the file by a background thread and
+ * the number of source histories stored in the file header is updated every
+ * time that a snapshot is taken. The file can be replayed with a
+ * MonteCarlo::SurfaceSourceComponent. When there is more than one process
+ * the rank of the process will be appended to the file name.
+ */
+class SurfaceSourceRecorder : public ParticleCrossingSurfaceEventObserver,
+                              public ParticleHistoryObserver
+{
+
+public:
+
+  //! Typedef for the id type
+  typedef uint32_t Id;
+
+  //! Typedef for the entity id type
+  typedef Geometry::Model::EntityId EntityId;
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleCrossingSurfaceEventObserver::EventTag>
+  EventTags;
+
+  //! Constructor
+  SurfaceSourceRecorder( const Id id,
+                         const std::set<EntityId>& surfaces,
+                         const boost::filesystem::path& file_name,
+                         const size_t buffer_size = 8192 );
+
+  //! Destructor
+  ~SurfaceSourceRecorder()
+  { /* ... */ }
+
+  //! Return the recorder id
+  Id getId() const;
+
+  //! Return the recorded surfaces
+  const std::set<EntityId>& getSurfaces() const;
+
+  //! Set the particle types that will be recorded
+  void setParticleTypes( const std::set<ParticleType>& particle_types );
+
+  //! Return the particle types that will be recorded (empty if all)
+  const std::set<ParticleType>& getParticleTypes() const;
+
+  //! Return the surface source file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the record buffer size (number of records per thread)
+  size_t getBufferSize() const;
+
+  //! Return the number of source histories that have been recorded
+  uint64_t getNumberOfRecordedHistories() const;
+
+  //! Update the observer
+  void updateFromParticleCrossingSurfaceEvent(
+                            const ParticleState& particle,
+                            const Geometry::Model::EntityId surface_crossing,
+                            const double angle_cosine ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit History Contribution
+  void commitHistoryContribution() final override;
+
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t num_histories_since_last_snapshot,
+                     const double time_since_last_snapshot ) final override;
+
+  //! Reset data
+  void resetData() final override;
+
+  //! Reduce data in multiple nodes
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Print a summary of the data
+  void printSummary( std::ostream& os ) const final override;
+
+  //! Flush the buffered records and update the file header
+  void flushRecords();
+
+private:
+
+  // Default constructor
+  SurfaceSourceRecorder();
+
+  // Flush a thread buffer
+  void flushRecordBuffer( std::shared_ptr<std::string>& buffer );
+
+  // Start the surface source file (the critical section must be entered)
+  void startFile();
+
+  // Reset the record data
+  void resetRecordData();
+
+  // Continue an existing surface source file
+  void resumeFile( const uint64_t number_of_histories,
+                   const uint64_t number_of_records );
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The recorder id
+  UniqueIdManager<SurfaceSourceRecorder,Id> d_id;
+
+  // The recorded surfaces
+  std::set<EntityId> d_surfaces;
+
+  // The recorded particle types
+  std::set<ParticleType> d_particle_types;
+
+  // The surface source file name
+  boost::filesystem::path d_file_name;
+
+  // The record buffer size (number of records per thread)
+  size_t d_buffer_size;
+
+  // The record buffer of each thread
+  std::vector<std::shared_ptr<std::string> > d_thread_buffers;
+
+  // The number of source histories that have been recorded
+  uint64_t d_number_of_recorded_histories;
+
+  // The number of records that have been submitted to the writer
+  uint64_t d_number_of_submitted_records;
+
+  // The number of records in the file when the header was last updated
+  uint64_t d_number_of_flushed_records;
+
+  // Records if the surface source file header has been submitted
+  bool d_file_started;
+
+  // The surface source file writer
+  std::unique_ptr<Utility::BackgroundFileWriter> d_writer;
+};
+
+// Save the recorder data
+template<typename Archive>
+void SurfaceSourceRecorder::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCrossingSurfaceEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistoryObserver );
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+
+  std::string file_name = d_file_name.string();
+
+  ar & BOOST_SERIALIZATION_NVP( file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_buffer_size );
+
+  // The archive is created after a snapshot so only the records that were
+  // in the file when the header was last updated belong to the recorded
+  // histories
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_recorded_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_flushed_records );
+}
+
+// Load the recorder data
+template<typename Archive>
+void SurfaceSourceRecorder::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCrossingSurfaceEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistoryObserver );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+
+  std::string file_name;
+
+  ar & BOOST_SERIALIZATION_NVP( file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_buffer_size );
+
+  uint64_t number_of_recorded_histories = 0;
+  uint64_t number_of_flushed_records = 0;
+
+  if( version > 0 )
+  {
+    ar & boost::serialization::make_nvp( "d_number_of_recorded_histories",
+                                         number_of_recorded_histories );
+    ar & boost::serialization::make_nvp( "d_number_of_flushed_records",
+                                         number_of_flushed_records );
+  }
+
+  d_file_name = file_name;
+
+  d_thread_buffers.resize( 1 );
+
+  this->resetRecordData();
+
+  // The records are not archived - a loaded recorder will continue the
+  // surface source file that it was writing when it was archived
+  if( number_of_recorded_histories > 0 || number_of_flushed_records > 0 )
+    this->resumeFile( number_of_recorded_histories, number_of_flushed_records );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( SurfaceSourceRecorder, MonteCarlo, 1 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( SurfaceSourceRecorder, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, SurfaceSourceRecorder );
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceRecorder.hpp
+//---------------------------------------------------------------------------//
@@ -10,6 +10,9 @@
 #include <iostream>
 #include <memory>
 
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
 // FRENSIE Includes
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_PhotonState.hpp"
@@ -24,6 +27,31 @@
 
 typedef TestArchiveHelper::TestArchives TestArchives;
 
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the track records of a single photon history
+void trackPhotonHistory( MonteCarlo::ParticleTracker& particle_tracker,
+                         const uint64_t history )
+{
+  MonteCarlo::PhotonState photon( history );
+  photon.setPosition( 2.0, 1.0, 1.0 );
+  photon.setDirection( 1.0, 0.0, 0.0 );
+  photon.setEnergy( 2.5 );
+  photon.setTime( 5e-11 );
+  photon.setWeight( 1.0 );
+
+  double start_point[3] = { 1.0, 1.0, 1.0 };
+  double end_point[3] = { 2.0, 1.0, 1.0 };
+
+  particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                start_point,
+                                                                end_point );
+  photon.setAsGone();
+
+  particle_tracker.updateFromGlobalParticleGoneEvent( photon );
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -178,6 +206,321 @@ FRENSIE_UNIT_TEST( ParticleTracker, update_from_events )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the track records can be streamed to a file
+FRENSIE_UNIT_TEST( ParticleTracker, streaming_output )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 100 );
+
+  FRENSIE_CHECK( !particle_tracker.isStreamingOutputSet() );
+
+  particle_tracker.setStreamingOutput( "test_particle_tracker_records.bin", 3 );
+
+  FRENSIE_CHECK( particle_tracker.isStreamingOutputSet() );
+  FRENSIE_CHECK_EQUAL( particle_tracker.getTrackRecordBufferSize(), 3 );
+
+  unsigned threads = Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  particle_tracker.enableThreadSupport( threads );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    const uint64_t history = Utility::OpenMPProperties::getThreadId();
+
+    // Tracked history
+    MonteCarlo::PhotonState photon( history );
+    photon.setPosition( 2.0, 1.0, 1.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+    photon.setEnergy( 2.5 );
+    photon.setTime( 5e-11 );
+    photon.setWeight( 1.0 );
+
+    double start_point[3] = { 1.0, 1.0, 1.0 };
+    double end_point[3] = { 2.0, 1.0, 1.0 };
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  start_point,
+                                                                  end_point );
+
+    MonteCarlo::ElectronState electron( photon, true, true );
+    electron.setEnergy( 1.0 );
+
+    photon.setPosition( 3.0, 1.0, 1.0 );
+    photon.setTime( 1e-10 );
+
+    start_point[0] = 2.0;
+    end_point[0] = 3.0;
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  start_point,
+                                                                  end_point );
+
+    photon.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( photon );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( electron,
+                                                                  start_point,
+                                                                  end_point );
+    electron.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( electron );
+
+    // Untracked history
+    MonteCarlo::PhotonState untracked_photon( 100+history );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( untracked_photon,
+                                                                  start_point,
+                                                                  end_point );
+    untracked_photon.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( untracked_photon );
+  }
+
+  particle_tracker.flushTrackRecords();
+
+  // The history data is not stored in memory
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_CHECK( history_map.empty() );
+
+  std::vector<MonteCarlo::ParticleTracker::TrackRecord> records;
+
+  for( uint64_t i = 0; i < threads; ++i )
+  {
+    MonteCarlo::ParticleTracker::readTrackRecords(
+                    particle_tracker.getTrackRecordFileName(), i, records );
+
+    FRENSIE_REQUIRE_EQUAL( records.size(), 7 );
+
+    // Photon track start
+    FRENSIE_CHECK_EQUAL( records[0].history_number, i );
+    FRENSIE_CHECK_EQUAL( records[0].particle_type, MonteCarlo::PHOTON );
+    FRENSIE_CHECK_EQUAL( records[0].particle_index, 0 );
+    FRENSIE_CHECK_EQUAL( records[0].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_TRACK_START_EVENT );
+    FRENSIE_CHECK_EQUAL( records[0].position[0], 1.0 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( records[0].time,
+                                     1.664359048018479962e-11,
+                                     1e-15 );
+
+    // Photon subtrack ending events
+    FRENSIE_CHECK_EQUAL( records[1].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_SUBTRACK_ENDING_EVENT );
+    FRENSIE_CHECK_EQUAL( records[1].position[0], 2.0 );
+    FRENSIE_CHECK_EQUAL( records[1].direction[0], 1.0 );
+    FRENSIE_CHECK_EQUAL( records[1].energy, 2.5 );
+    FRENSIE_CHECK_EQUAL( records[1].time, 5e-11 );
+    FRENSIE_CHECK_EQUAL( records[1].weight, 1.0 );
+
+    FRENSIE_CHECK_EQUAL( records[2].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_SUBTRACK_ENDING_EVENT );
+    FRENSIE_CHECK_EQUAL( records[2].position[0], 3.0 );
+    FRENSIE_CHECK_EQUAL( records[2].time, 1e-10 );
+
+    // Photon gone
+    FRENSIE_CHECK_EQUAL( records[3].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_GONE_EVENT );
+    FRENSIE_CHECK_EQUAL( records[3].particle_index, 0 );
+
+    // Electron track
+    FRENSIE_CHECK_EQUAL( records[4].particle_type, MonteCarlo::ELECTRON );
+    FRENSIE_CHECK_EQUAL( records[4].generation_number, 1 );
+    FRENSIE_CHECK_EQUAL( records[4].particle_index, 1 );
+    FRENSIE_CHECK_EQUAL( records[4].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_TRACK_START_EVENT );
+    FRENSIE_CHECK_EQUAL( records[5].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_SUBTRACK_ENDING_EVENT );
+    FRENSIE_CHECK_EQUAL( records[5].energy, 1.0 );
+    FRENSIE_CHECK_EQUAL( records[6].event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_GONE_EVENT );
+    FRENSIE_CHECK_EQUAL( records[6].particle_index, 1 );
+
+    // Untracked history
+    MonteCarlo::ParticleTracker::readTrackRecords(
+                particle_tracker.getTrackRecordFileName(), 100+i, records );
+
+    FRENSIE_CHECK( records.empty() );
+  }
+
+  // Read the index once - the entries will be sorted by history
+  std::vector<MonteCarlo::ParticleTracker::TrackRecordIndexEntry> index;
+
+  MonteCarlo::ParticleTracker::readTrackRecordIndex(
+                           particle_tracker.getTrackRecordFileName(), index );
+
+  FRENSIE_REQUIRE( !index.empty() );
+
+  for( size_t i = 1; i < index.size(); ++i )
+  {
+    FRENSIE_CHECK( index[i-1].history_number <= index[i].history_number );
+  }
+
+  for( uint64_t i = 0; i < threads; ++i )
+  {
+    MonteCarlo::ParticleTracker::readTrackRecords(
+             particle_tracker.getTrackRecordFileName(), index, i, records );
+
+    FRENSIE_REQUIRE_EQUAL( records.size(), 7 );
+    FRENSIE_CHECK_EQUAL( records.front().history_number, i );
+    FRENSIE_CHECK_EQUAL( records.front().event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_TRACK_START_EVENT );
+    FRENSIE_CHECK_EQUAL( records.back().history_number, i );
+    FRENSIE_CHECK_EQUAL( records.back().particle_index, 1 );
+  }
+
+  MonteCarlo::ParticleTracker::readTrackRecords(
+         particle_tracker.getTrackRecordFileName(), index, threads, records );
+
+  FRENSIE_CHECK( records.empty() );
+
+  // Reset the data - the track record file will be restarted
+  particle_tracker.resetData();
+  particle_tracker.flushTrackRecords();
+
+  MonteCarlo::ParticleTracker::readTrackRecords(
+                    particle_tracker.getTrackRecordFileName(), 0, records );
+
+  FRENSIE_CHECK( records.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a loaded particle tracker will continue its track record file
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleTracker,
+                                   streaming_output_restart,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_particle_tracker_restart" );
+  std::ostringstream archive_ostream;
+
+  boost::filesystem::path file_name( "test_particle_tracker_restart_records.bin" );
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::ParticleTracker>
+      particle_tracker( new MonteCarlo::ParticleTracker( 0, 100 ) );
+
+    particle_tracker->setStreamingOutput( file_name, 2 );
+
+    file_name = particle_tracker->getTrackRecordFileName();
+
+    trackPhotonHistory( *particle_tracker, 0 );
+
+    particle_tracker->takeSnapshot( 1, 1.0 );
+    particle_tracker->flushTrackRecords();
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( particle_tracker ) );
+
+    // This history will be simulated again after the restart
+    trackPhotonHistory( *particle_tracker, 1 );
+
+    particle_tracker->flushTrackRecords();
+  }
+
+  std::vector<MonteCarlo::ParticleTracker::TrackRecord> records;
+
+  MonteCarlo::ParticleTracker::readTrackRecords( file_name, 1, records );
+
+  FRENSIE_REQUIRE_EQUAL( records.size(), 3 );
+
+  // Load the tracker - the records written after the archive was created
+  // will be discarded
+  std::shared_ptr<MonteCarlo::ParticleTracker> particle_tracker;
+
+  {
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( particle_tracker ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( particle_tracker->getTrackRecordFileName().string(),
+                       file_name.string() );
+
+  MonteCarlo::ParticleTracker::readTrackRecords( file_name, 0, records );
+
+  FRENSIE_CHECK_EQUAL( records.size(), 3 );
+
+  MonteCarlo::ParticleTracker::readTrackRecords( file_name, 1, records );
+
+  FRENSIE_CHECK( records.empty() );
+
+  // Continue the simulation
+  particle_tracker->enableThreadSupport( 1 );
+
+  trackPhotonHistory( *particle_tracker, 1 );
+  trackPhotonHistory( *particle_tracker, 2 );
+
+  particle_tracker->takeSnapshot( 2, 1.0 );
+  particle_tracker->flushTrackRecords();
+
+  for( uint64_t i = 0; i < 3; ++i )
+  {
+    MonteCarlo::ParticleTracker::readTrackRecords( file_name, i, records );
+
+    FRENSIE_REQUIRE_EQUAL( records.size(), 3 );
+    FRENSIE_CHECK_EQUAL( records.front().history_number, i );
+    FRENSIE_CHECK_EQUAL( records.front().event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_TRACK_START_EVENT );
+    FRENSIE_CHECK_EQUAL( records.back().event_type,
+                         MonteCarlo::ParticleTracker::PARTICLE_GONE_EVENT );
+  }
+
+  particle_tracker.reset();
+
+  // Load the tracker again without an index file - the index will be rebuilt
+  boost::filesystem::remove(
+      MonteCarlo::ParticleTracker::getTrackRecordIndexFileName( file_name ) );
+
+  {
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( particle_tracker ) );
+  }
+
+  MonteCarlo::ParticleTracker::readTrackRecords( file_name, 0, records );
+
+  FRENSIE_CHECK_EQUAL( records.size(), 3 );
+
+  MonteCarlo::ParticleTracker::readTrackRecords( file_name, 1, records );
+
+  FRENSIE_CHECK( records.empty() );
+
+  // A missing track record file cannot be continued
+  particle_tracker.reset();
+
+  boost::filesystem::remove( file_name );
+
+  {
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    FRENSIE_CHECK_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( particle_tracker ),
+                         std::exception );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that particle tracker data can be reset
 FRENSIE_UNIT_TEST( ParticleTracker, resetData )
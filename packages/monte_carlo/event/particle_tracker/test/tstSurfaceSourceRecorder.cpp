@@ -0,0 +1,349 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSurfaceSourceRecorder.cpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the recorder settings can be returned
+FRENSIE_UNIT_TEST( SurfaceSourceRecorder, constructor )
+{
+  MonteCarlo::SurfaceSourceRecorder recorder( 2, {1, 3}, "test_recorder.ssrc", 4 );
+
+  FRENSIE_CHECK_EQUAL( recorder.getId(), 2 );
+  FRENSIE_CHECK_EQUAL( recorder.getSurfaces(),
+                       std::set<MonteCarlo::SurfaceSourceRecorder::EntityId>( {1, 3} ) );
+  FRENSIE_CHECK( recorder.getParticleTypes().empty() );
+  FRENSIE_CHECK_EQUAL( recorder.getFileName().string(), "test_recorder.ssrc" );
+  FRENSIE_CHECK_EQUAL( recorder.getBufferSize(), 4 );
+  FRENSIE_CHECK_EQUAL( recorder.getNumberOfRecordedHistories(), 0 );
+
+  recorder.setParticleTypes( {MonteCarlo::NEUTRON} );
+
+  FRENSIE_CHECK_EQUAL( recorder.getParticleTypes(),
+                       std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface crossings can be recorded
+FRENSIE_UNIT_TEST( SurfaceSourceRecorder, record )
+{
+  const std::string file_name( "test_surface_source_recorder.ssrc" );
+
+  MonteCarlo::SurfaceSourceRecorder recorder( 0, {1, 2}, file_name, 3 );
+
+  unsigned threads = Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  recorder.enableThreadSupport( threads );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    const uint64_t history = Utility::OpenMPProperties::getThreadId();
+
+    for( size_t i = 0; i < 5; ++i )
+    {
+      MonteCarlo::NeutronState neutron( history );
+      neutron.setPosition( (double)i, 1.0, 1.0 );
+      neutron.setDirection( 1.0, 0.0, 0.0 );
+      neutron.setEnergy( 2.0 );
+      neutron.setWeight( 0.5 );
+
+      recorder.updateFromParticleCrossingSurfaceEvent( neutron, 1+i%2, 1.0 );
+    }
+  }
+
+  recorder.takeSnapshot( threads, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( recorder.getNumberOfRecordedHistories(), threads );
+
+  std::vector<MonteCarlo::SurfaceSourceFile::Record> records;
+  uint64_t number_of_histories;
+
+  MonteCarlo::SurfaceSourceFile::readRecords( recorder.getFileName(),
+                                              records,
+                                              number_of_histories );
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, threads );
+  FRENSIE_REQUIRE_EQUAL( records.size(), 5*threads );
+
+  std::vector<size_t> records_per_history( threads, 0 );
+
+  for( auto&& record : records )
+  {
+    FRENSIE_REQUIRE( record.history_number < threads );
+    FRENSIE_CHECK_EQUAL( record.particle_type, MonteCarlo::NEUTRON );
+    FRENSIE_CHECK_EQUAL( record.surface, 1+((size_t)record.position[0])%2 );
+    FRENSIE_CHECK_EQUAL( record.energy, 2.0 );
+    FRENSIE_CHECK_EQUAL( record.weight, 0.5 );
+
+    ++records_per_history[record.history_number];
+  }
+
+  for( size_t i = 0; i < threads; ++i )
+    FRENSIE_CHECK_EQUAL( records_per_history[i], 5 );
+
+  // A reset restarts the file
+  recorder.resetData();
+  recorder.flushRecords();
+
+  records.clear();
+
+  MonteCarlo::SurfaceSourceFile::readRecords( recorder.getFileName(),
+                                              records,
+                                              number_of_histories );
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, 0 );
+  FRENSIE_CHECK_EQUAL( records.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a recorder can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceSourceRecorder,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_surface_source_recorder" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceRecorder>
+      recorder( new MonteCarlo::SurfaceSourceRecorder( 0, {1, 2}, "test_archived_recorder.ssrc", 10 ) );
+
+    recorder->setParticleTypes( {MonteCarlo::PHOTON} );
+
+    std::shared_ptr<const MonteCarlo::ParticleCrossingSurfaceEventObserver>
+      event_observer = recorder;
+
+    std::shared_ptr<const MonteCarlo::ParticleHistoryObserver>
+      history_observer = recorder;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( recorder ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( event_observer ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( history_observer ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distributions
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::SurfaceSourceRecorder> recorder;
+
+  std::shared_ptr<const MonteCarlo::ParticleCrossingSurfaceEventObserver>
+    event_observer;
+
+  std::shared_ptr<const MonteCarlo::ParticleHistoryObserver>
+    history_observer;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( recorder ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( event_observer ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( history_observer ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( recorder->getId(), 0 );
+  FRENSIE_CHECK_EQUAL( recorder->getSurfaces(),
+                       std::set<MonteCarlo::SurfaceSourceRecorder::EntityId>( {1, 2} ) );
+  FRENSIE_CHECK_EQUAL( recorder->getParticleTypes(),
+                       std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+  FRENSIE_CHECK_EQUAL( recorder->getFileName().string(),
+                       "test_archived_recorder.ssrc" );
+  FRENSIE_CHECK_EQUAL( recorder->getBufferSize(), 10 );
+  FRENSIE_CHECK_EQUAL( recorder->getNumberOfRecordedHistories(), 0 );
+  FRENSIE_CHECK( event_observer.get() == recorder.get() );
+  FRENSIE_CHECK( history_observer.get() == recorder.get() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a loaded recorder will continue the surface source file
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceSourceRecorder,
+                                   archive_continue_file,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  const std::string file_name( "test_continued_recorder.ssrc" );
+
+  std::string archive_base_name( "test_continued_surface_source_recorder" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceRecorder>
+      recorder( new MonteCarlo::SurfaceSourceRecorder( 0, {1}, file_name, 2 ) );
+
+    // History 0 is completed before the recorder is archived
+    for( size_t i = 0; i < 2; ++i )
+    {
+      MonteCarlo::PhotonState photon( 0 );
+      photon.setPosition( (double)i, 0.0, 0.0 );
+      photon.setEnergy( 1.0 );
+
+      recorder->updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+    }
+
+    recorder->takeSnapshot( 1, 1.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( recorder ) );
+
+    // History 1 is in progress when the simulation stops
+    for( size_t i = 0; i < 3; ++i )
+    {
+      MonteCarlo::PhotonState photon( 1 );
+      photon.setPosition( 10.0+i, 0.0, 0.0 );
+      photon.setEnergy( 1.0 );
+
+      recorder->updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+    }
+
+    recorder->flushRecords();
+  }
+
+  std::vector<MonteCarlo::SurfaceSourceFile::Record> records;
+  uint64_t number_of_histories;
+
+  MonteCarlo::SurfaceSourceFile::readRecords( file_name,
+                                              records,
+                                              number_of_histories );
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, 1 );
+  FRENSIE_REQUIRE_EQUAL( records.size(), 5 );
+
+  {
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceRecorder> recorder;
+
+    FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( recorder ) );
+
+    FRENSIE_CHECK_EQUAL( recorder->getNumberOfRecordedHistories(), 1 );
+
+    // The records of the incomplete history must be removed
+    records.clear();
+
+    MonteCarlo::SurfaceSourceFile::readRecords( file_name,
+                                                records,
+                                                number_of_histories );
+
+    FRENSIE_CHECK_EQUAL( number_of_histories, 1 );
+    FRENSIE_REQUIRE_EQUAL( records.size(), 2 );
+
+    // History 1 is simulated again
+    MonteCarlo::PhotonState photon( 1 );
+    photon.setPosition( 20.0, 0.0, 0.0 );
+    photon.setEnergy( 1.0 );
+
+    recorder->updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+
+    recorder->takeSnapshot( 1, 1.0 );
+
+    FRENSIE_CHECK_EQUAL( recorder->getNumberOfRecordedHistories(), 2 );
+  }
+
+  records.clear();
+
+  MonteCarlo::SurfaceSourceFile::readRecords( file_name,
+                                              records,
+                                              number_of_histories );
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, 2 );
+  FRENSIE_REQUIRE_EQUAL( records.size(), 3 );
+  FRENSIE_CHECK_EQUAL( records[0].history_number, 0 );
+  FRENSIE_CHECK_EQUAL( records[0].position[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( records[1].history_number, 0 );
+  FRENSIE_CHECK_EQUAL( records[1].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( records[2].history_number, 1 );
+  FRENSIE_CHECK_EQUAL( records[2].position[0], 20.0 );
+
+  // A recorder cannot be loaded if the file has been removed
+  boost::filesystem::remove( file_name );
+
+  {
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceRecorder> recorder;
+
+    FRENSIE_CHECK_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( recorder ),
+                         std::exception );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSurfaceSourceRecorder.cpp
+//---------------------------------------------------------------------------//
@@ -19,15 +19,26 @@ ImportanceMesh::ImportanceMesh()
 { /* ... */ }
 
 // Set the mesh for a particle
+/*! \details Any importances that have already been set will be assigned
+ * to the elements of the new mesh that have the same handles.
+ */
 void ImportanceMesh::setMesh(const std::shared_ptr<const Utility::Mesh> mesh)
 {
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> importance_map = this->getImportanceMap();
+
   d_mesh = mesh;
+
+  if( d_mesh )
+    d_importances.initialize( *d_mesh, importance_map );
+  else
+    d_importances.clear();
 }
 
 void ImportanceMesh::setImportanceMap( std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>>& importance_map )
 {
   testPrecondition(d_mesh);
-  d_importance_map = importance_map;
+
+  d_importances.initialize( *d_mesh, importance_map );
 }
 
 double ImportanceMesh::getImportance( ParticleState& particle) const
@@ -35,14 +46,14 @@ double ImportanceMesh::getImportance( ParticleState& particle) const
   ObserverParticleStateWrapper observer_particle(particle);
   ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
   this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
-  return d_importance_map.at(d_mesh->whichElementIsPointIn(particle.getPosition()))[discretization_index[0]];
+  return d_importances.getElementDataAtIndex(particle.getMeshElementIndex(*d_mesh), discretization_index[0]);
 }
 
 bool ImportanceMesh::isParticleInImportanceDiscretization( ParticleState& particle ) const
 {
   ObserverParticleStateWrapper observer_particle(particle);
 
-  return(d_mesh->isPointInMesh(particle.getPosition()) && this->isPointInObserverPhaseSpace(observer_particle));
+  return(particle.isInMesh(*d_mesh) && this->isPointInObserverPhaseSpace(observer_particle));
 
 }
 
@@ -51,9 +62,16 @@ std::shared_ptr<const Utility::Mesh> ImportanceMesh::getMesh() const
   return d_mesh;
 }
 
-const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>>& ImportanceMesh::getImportanceMap() const
+/*! \details The map is not stored - it is rebuilt from the importance array.
+ */
+std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> ImportanceMesh::getImportanceMap() const
 {
-  return d_importance_map;
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> importance_map;
+
+  if( d_mesh )
+    d_importances.exportElementData( *d_mesh, importance_map );
+
+  return importance_map;
 }
 
 } // end MonteCarlo namespace
@@ -14,6 +14,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_Importance.hpp"
+#include "MonteCarlo_MeshElementDataArray.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
@@ -44,7 +45,7 @@ public:
 
   std::shared_ptr<const Utility::Mesh> getMesh() const;
 
-  const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>>& getImportanceMap() const;
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> getImportanceMap() const;
 
 private:
 
@@ -53,8 +54,8 @@ private:
 
   std::shared_ptr<const Utility::Mesh > d_mesh;
 
-  //! Map that contains importance windows. First key is the index of the mesh element, second key is the index of the discretization
-  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> d_importance_map;
+  // The importances (energy bin major, indexed by mesh element)
+  MeshElementDataArray<double> d_importances;
 
   // Serialize the data
   template<typename Archive>
@@ -64,7 +65,23 @@ private:
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Importance );
     // Serialize the member data
     ar & BOOST_SERIALIZATION_NVP( d_mesh );
-    ar & BOOST_SERIALIZATION_NVP( d_importance_map );
+
+    // The importance array is archived as an importance map (the map is
+    // only rebuilt for archiving)
+    std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> importance_map;
+
+    if( Archive::is_saving::value )
+      importance_map = this->getImportanceMap();
+
+    ar & boost::serialization::make_nvp( "d_importance_map", importance_map );
+
+    if( Archive::is_loading::value )
+    {
+      if( d_mesh )
+        d_importances.initialize( *d_mesh, importance_map );
+      else
+        d_importances.clear();
+    }
   }
 
 };
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MeshElementDataArray.hpp
+//! \author Philip Britt
+//! \brief  Mesh element data array class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_HPP
+#define MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Utility_Mesh.hpp"
+
+namespace MonteCarlo{
+
+/*! The mesh element data array class
+ * \details This class stores the discretized data of each element of a mesh
+ * (e.g. the weight windows of a weight window mesh) in a single dense array.
+ * The data is stored discretization bin major (all elements of the first
+ * bin, followed by all elements of the second bin, etc.) so that the data
+ * of neighboring elements in the same bin (e.g. energy bin) are contiguous.
+ * The data is accessed with the dense element index provided by the mesh
+ * (see Utility::Mesh::whichElementIndexIsPointIn) so that no handle lookups
+ * are required, regardless of the mesh type.
+ */
+template<typename T>
+class MeshElementDataArray
+{
+
+public:
+
+  //! The element handle type
+  typedef Utility::Mesh::ElementHandle ElementHandle;
+
+  //! The element data map type (vector index is the discretization index)
+  typedef std::unordered_map<ElementHandle,std::vector<T> > ElementDataMap;
+
+  //! Constructor
+  MeshElementDataArray();
+
+  //! Destructor
+  ~MeshElementDataArray()
+  { /* ... */ }
+
+  //! Initialize the array
+  void initialize( const Utility::Mesh& mesh,
+                   const ElementDataMap& element_data_map );
+
+  //! Export the data of the elements that have data
+  void exportElementData( const Utility::Mesh& mesh,
+                          ElementDataMap& element_data_map ) const;
+
+  //! Clear the array
+  void clear();
+
+  //! Get the number of discretization bins
+  size_t getNumberOfDiscretizationBins() const;
+
+  //! Check if there is data for an element
+  bool hasElementDataAtIndex( const size_t element_index ) const;
+
+  //! Get the data of an element
+  const T& getElementDataAtIndex( const size_t element_index,
+                                  const size_t discretization_index ) const;
+
+private:
+
+  // The number of mesh elements
+  size_t d_number_of_elements;
+
+  // The number of discretization bins
+  size_t d_number_of_bins;
+
+  // Check if there is data for each element
+  std::vector<unsigned char> d_element_has_data;
+
+  // The element data (discretization bin major)
+  std::vector<T> d_data;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_MeshElementDataArray_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MeshElementDataArray.hpp
+//---------------------------------------------------------------------------//
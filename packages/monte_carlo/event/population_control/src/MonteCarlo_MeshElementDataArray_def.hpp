@@ -0,0 +1,177 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MeshElementDataArray_def.hpp
+//! \author Philip Britt
+//! \brief  Mesh element data array class template definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_DEF_HPP
+#define MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_DEF_HPP
+
+// Std Lib Includes
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<typename T>
+MeshElementDataArray<T>::MeshElementDataArray()
+  : d_number_of_elements( 0 ),
+    d_number_of_bins( 0 ),
+    d_element_has_data(),
+    d_data()
+{ /* ... */ }
+
+// Initialize the array
+/*! \details Every element in the map must have the same number of
+ * discretization bins and must be an element of the mesh. Mesh elements that
+ * are not in the map will not have any data.
+ */
+template<typename T>
+void MeshElementDataArray<T>::initialize(
+                                       const Utility::Mesh& mesh,
+                                       const ElementDataMap& element_data_map )
+{
+  this->clear();
+
+  d_number_of_elements = mesh.getNumberOfElements();
+
+  // Determine the number of discretization bins
+  if( !element_data_map.empty() )
+    d_number_of_bins = element_data_map.begin()->second.size();
+
+  d_element_has_data.resize( d_number_of_elements, 0 );
+  d_data.resize( d_number_of_elements*d_number_of_bins );
+
+  typename ElementDataMap::const_iterator element_data_it =
+    element_data_map.begin();
+
+  while( element_data_it != element_data_map.end() )
+  {
+    const size_t element_index =
+      mesh.getElementIndex( element_data_it->first );
+
+    TEST_FOR_EXCEPTION( element_index >= d_number_of_elements,
+                        std::runtime_error,
+                        "Mesh element " << element_data_it->first <<
+                        " does not exist!" );
+
+    TEST_FOR_EXCEPTION( element_data_it->second.size() != d_number_of_bins,
+                        std::runtime_error,
+                        "Mesh element " << element_data_it->first <<
+                        " has " << element_data_it->second.size() <<
+                        " discretization bins but " << d_number_of_bins <<
+                        " bins were expected!" );
+
+    for( size_t j = 0; j < d_number_of_bins; ++j )
+    {
+      d_data[j*d_number_of_elements + element_index] =
+        element_data_it->second[j];
+    }
+
+    d_element_has_data[element_index] = 1;
+
+    ++element_data_it;
+  }
+}
+
+// Export the data of the elements that have data
+/*! \details The mesh must be the mesh that the array was initialized with.
+ * This is the inverse of the initialize method (e.g. it can be used to
+ * archive the data without storing the element data map).
+ */
+template<typename T>
+void MeshElementDataArray<T>::exportElementData(
+                                      const Utility::Mesh& mesh,
+                                      ElementDataMap& element_data_map ) const
+{
+  // Make sure the mesh is valid
+  testPrecondition( d_number_of_elements == 0 ||
+                    mesh.getNumberOfElements() == d_number_of_elements );
+
+  element_data_map.clear();
+
+  Utility::Mesh::ElementHandleIterator element_handle_it =
+    mesh.getStartElementHandleIterator();
+
+  while( element_handle_it != mesh.getEndElementHandleIterator() )
+  {
+    const size_t element_index = mesh.getElementIndex( *element_handle_it );
+
+    if( this->hasElementDataAtIndex( element_index ) )
+    {
+      std::vector<T>& element_data = element_data_map[*element_handle_it];
+
+      element_data.resize( d_number_of_bins );
+
+      for( size_t j = 0; j < d_number_of_bins; ++j )
+        element_data[j] = d_data[j*d_number_of_elements + element_index];
+    }
+
+    ++element_handle_it;
+  }
+}
+
+// Clear the array
+template<typename T>
+void MeshElementDataArray<T>::clear()
+{
+  d_number_of_elements = 0;
+  d_number_of_bins = 0;
+  d_element_has_data.clear();
+  d_data.clear();
+}
+
+// Get the number of discretization bins
+template<typename T>
+inline size_t MeshElementDataArray<T>::getNumberOfDiscretizationBins() const
+{
+  return d_number_of_bins;
+}
+
+// Check if there is data for an element
+template<typename T>
+inline bool MeshElementDataArray<T>::hasElementDataAtIndex(
+                                           const size_t element_index ) const
+{
+  if( element_index < d_number_of_elements )
+    return d_element_has_data[element_index];
+  else
+    return false;
+}
+
+// Get the data of an element
+/*! \details A std::out_of_range exception will be thrown if there is no
+ * data for the element (e.g. the element index is the number of elements,
+ * which is returned by Utility::Mesh::whichElementIndexIsPointIn when the
+ * element containing a point cannot be found).
+ */
+template<typename T>
+inline const T& MeshElementDataArray<T>::getElementDataAtIndex(
+                                   const size_t element_index,
+                                   const size_t discretization_index ) const
+{
+  // Make sure the discretization index is valid
+  testPrecondition( discretization_index < d_number_of_bins );
+
+  TEST_FOR_EXCEPTION( element_index >= d_number_of_elements ||
+                      !d_element_has_data[element_index],
+                      std::out_of_range,
+                      "There is no data for mesh element index "
+                      << element_index << "!" );
+
+  return d_data[discretization_index*d_number_of_elements + element_index];
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_MESH_ELEMENT_DATA_ARRAY_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MeshElementDataArray_def.hpp
+//---------------------------------------------------------------------------//
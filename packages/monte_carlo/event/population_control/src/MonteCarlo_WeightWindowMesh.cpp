@@ -19,16 +19,27 @@ WeightWindowMesh::WeightWindowMesh()
 { /* ... */ }
 
 // Set the mesh for a particle
+/*! \details Any weight windows that have already been set will be assigned
+ * to the elements of the new mesh that have the same handles.
+ */
 void WeightWindowMesh::setMesh(const std::shared_ptr<const Utility::Mesh> mesh)
 {
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> weight_window_map = this->getWeightWindowMap();
+
   d_mesh = mesh;
+
+  if( d_mesh )
+    d_weight_windows.initialize( *d_mesh, weight_window_map );
+  else
+    d_weight_windows.clear();
 }
 
 // Set the weight windows
 void WeightWindowMesh::setWeightWindowMap( std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& weight_window_map )
 {
   testPrecondition(d_mesh);
-  d_weight_window_map = weight_window_map;
+
+  d_weight_windows.initialize( *d_mesh, weight_window_map );
 }
 
 // Get a specific weight window
@@ -38,7 +49,7 @@ const WeightWindow& WeightWindowMesh::getWeightWindow( const ParticleState& part
   ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
   this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
 
-  return d_weight_window_map.at(d_mesh->whichElementIsPointIn(particle.getPosition()))[discretization_index[0]];
+  return d_weight_windows.getElementDataAtIndex(particle.getMeshElementIndex(*d_mesh), discretization_index[0]);
 }
 
 // Check if a particle is under the weight window phase space
@@ -46,7 +57,7 @@ bool WeightWindowMesh::isParticleInWeightWindowDiscretization( const ParticleSta
 {
   ObserverParticleStateWrapper observer_particle(particle);
 
-  if(d_mesh->isPointInMesh(particle.getPosition()) && this->isPointInObserverPhaseSpace(observer_particle))
+  if(particle.isInMesh(*d_mesh) && this->isPointInObserverPhaseSpace(observer_particle))
   {
     return true;
   }else
@@ -62,9 +73,17 @@ std::shared_ptr<const Utility::Mesh> WeightWindowMesh::getMesh() const
 }
 
 // Return the weight window map
-const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& WeightWindowMesh::getWeightWindowMap() const
+/*! \details The map is not stored - it is rebuilt from the weight window
+ * array.
+ */
+std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> WeightWindowMesh::getWeightWindowMap() const
 {
-  return d_weight_window_map;
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> weight_window_map;
+
+  if( d_mesh )
+    d_weight_windows.exportElementData( *d_mesh, weight_window_map );
+
+  return weight_window_map;
 }
 
 } // end MonteCarlo namespace
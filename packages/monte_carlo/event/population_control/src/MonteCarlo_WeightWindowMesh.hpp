@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
+#include "MonteCarlo_MeshElementDataArray.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
@@ -47,7 +48,7 @@ public:
   std::shared_ptr<const Utility::Mesh> getMesh() const;
 
   //! Get the weight window map (for viewing purposes only)
-  const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& getWeightWindowMap() const;
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> getWeightWindowMap() const;
 
 private:
 
@@ -56,8 +57,8 @@ private:
 
   std::shared_ptr<const Utility::Mesh > d_mesh;
 
-  //! Map that contains weight windows. First key is the index of the mesh element, second key is the index of the discretization
-  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> d_weight_window_map;
+  // The weight windows (energy bin major, indexed by mesh element)
+  MeshElementDataArray<WeightWindow> d_weight_windows;
 
   // Serialize the data
   template<typename Archive>
@@ -67,7 +68,24 @@ private:
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindowBase );
     // Serialize the member data
     ar & BOOST_SERIALIZATION_NVP( d_mesh );
-    ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+
+    // The weight window array is archived as a weight window map (the map is
+    // only rebuilt for archiving)
+    std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> weight_window_map;
+
+    if( Archive::is_saving::value )
+      weight_window_map = this->getWeightWindowMap();
+
+    ar & boost::serialization::make_nvp( "d_weight_window_map",
+                                         weight_window_map );
+
+    if( Archive::is_loading::value )
+    {
+      if( d_mesh )
+        d_weight_windows.initialize( *d_mesh, weight_window_map );
+      else
+        d_weight_windows.clear();
+    }
   }
 
 };
@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstMeshElementDataArray.cpp
+//! \author Philip Britt
+//! \brief  Mesh element data array unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <memory>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "MonteCarlo_MeshElementDataArray.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<Utility::StructuredHexMesh> mesh;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the array can be initialized
+FRENSIE_UNIT_TEST( MeshElementDataArray, initialize )
+{
+  MonteCarlo::MeshElementDataArray<double> data_array;
+
+  FRENSIE_CHECK_EQUAL( data_array.getNumberOfDiscretizationBins(), 0 );
+  FRENSIE_CHECK( !data_array.hasElementDataAtIndex( 0 ) );
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap element_data_map;
+  element_data_map[0] = {1.0, 2.0};
+  element_data_map[2] = {3.0, 4.0};
+
+  data_array.initialize( *mesh, element_data_map );
+
+  FRENSIE_CHECK_EQUAL( data_array.getNumberOfDiscretizationBins(), 2 );
+  FRENSIE_CHECK( data_array.hasElementDataAtIndex( 0 ) );
+  FRENSIE_CHECK( !data_array.hasElementDataAtIndex( 1 ) );
+  FRENSIE_CHECK( data_array.hasElementDataAtIndex( 2 ) );
+  FRENSIE_CHECK( !data_array.hasElementDataAtIndex( 3 ) );
+
+  data_array.clear();
+
+  FRENSIE_CHECK_EQUAL( data_array.getNumberOfDiscretizationBins(), 0 );
+  FRENSIE_CHECK( !data_array.hasElementDataAtIndex( 0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid element data will be rejected
+FRENSIE_UNIT_TEST( MeshElementDataArray, initialize_invalid )
+{
+  MonteCarlo::MeshElementDataArray<double> data_array;
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap element_data_map;
+  element_data_map[0] = {1.0, 2.0};
+  element_data_map[1] = {3.0};
+
+  FRENSIE_CHECK_THROW( data_array.initialize( *mesh, element_data_map ),
+                       std::runtime_error );
+
+  element_data_map[1] = {3.0, 4.0};
+  element_data_map[3] = {5.0, 6.0};
+
+  FRENSIE_CHECK_THROW( data_array.initialize( *mesh, element_data_map ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the data of an element can be returned
+FRENSIE_UNIT_TEST( MeshElementDataArray, getElementDataAtIndex )
+{
+  MonteCarlo::MeshElementDataArray<double> data_array;
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap element_data_map;
+  element_data_map[0] = {1.0, 2.0};
+  element_data_map[2] = {3.0, 4.0};
+
+  data_array.initialize( *mesh, element_data_map );
+
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( 0, 0 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( 0, 1 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( 2, 0 ), 3.0 );
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( 2, 1 ), 4.0 );
+
+  // The data of each bin must be contiguous
+  FRENSIE_CHECK_EQUAL( &data_array.getElementDataAtIndex( 2, 0 ) -
+                       &data_array.getElementDataAtIndex( 0, 0 ), 2 );
+
+  FRENSIE_CHECK_THROW( data_array.getElementDataAtIndex( 1, 0 ), std::out_of_range );
+  FRENSIE_CHECK_THROW( data_array.getElementDataAtIndex( 3, 0 ), std::out_of_range );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element data can be exported
+FRENSIE_UNIT_TEST( MeshElementDataArray, exportElementData )
+{
+  MonteCarlo::MeshElementDataArray<double> data_array;
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap element_data_map;
+
+  data_array.exportElementData( *mesh, element_data_map );
+
+  FRENSIE_CHECK( element_data_map.empty() );
+
+  element_data_map[0] = {1.0, 2.0};
+  element_data_map[2] = {3.0, 4.0};
+
+  data_array.initialize( *mesh, element_data_map );
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap
+    exported_element_data_map;
+
+  exported_element_data_map[1] = {5.0, 6.0};
+
+  data_array.exportElementData( *mesh, exported_element_data_map );
+
+  FRENSIE_REQUIRE_EQUAL( exported_element_data_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( exported_element_data_map[0],
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( exported_element_data_map[2],
+                       std::vector<double>( {3.0, 4.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the data of the element containing a point can be returned
+FRENSIE_UNIT_TEST( MeshElementDataArray, getElementDataAtIndex_point )
+{
+  MonteCarlo::MeshElementDataArray<double> data_array;
+
+  MonteCarlo::MeshElementDataArray<double>::ElementDataMap element_data_map;
+  element_data_map[0] = {1.0, 2.0};
+  element_data_map[1] = {3.0, 4.0};
+  element_data_map[2] = {5.0, 6.0};
+
+  data_array.initialize( *mesh, element_data_map );
+
+  double point[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( mesh->whichElementIndexIsPointIn( point ), 0 ), 1.0 );
+
+  point[0] = 1.5;
+
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( mesh->whichElementIndexIsPointIn( point ), 1 ), 4.0 );
+
+  point[0] = 2.5;
+
+  FRENSIE_CHECK_EQUAL( data_array.getElementDataAtIndex( mesh->whichElementIndexIsPointIn( point ), 0 ), 5.0 );
+
+  // The index past the last element indicates that no element was found
+  FRENSIE_CHECK_THROW( data_array.getElementDataAtIndex( mesh->getNumberOfElements(), 0 ),
+                       std::out_of_range );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> x_planes = {0.0, 1.0, 2.0, 3.0};
+  std::vector<double> y_planes = {0.0, 1.0};
+  std::vector<double> z_planes = {0.0, 1.0};
+
+  mesh = std::make_shared<Utility::StructuredHexMesh>( x_planes,
+                                                       y_planes,
+                                                       z_planes );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstMeshElementDataArray.cpp
+//---------------------------------------------------------------------------//
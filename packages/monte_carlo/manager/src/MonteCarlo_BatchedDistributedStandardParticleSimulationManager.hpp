@@ -9,13 +9,30 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 
+// Std Lib Includes
+#include <deque>
+#include <unordered_map>
+
 // FRENSIE Includes
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
 #include "Utility_Communicator.hpp"
+#include "Utility_Timer.hpp"
 
 namespace MonteCarlo{
 
-//! The batched distributed standard particle simulation manager
+/*! The batched distributed standard particle simulation manager
+ *
+ * \details By default the root process only coordinates the worker processes.
+ * Every worker must request a batch from the root process and then wait for
+ * the reply before it can start simulating. When adaptive batching mode is on
+ * (see MonteCarlo::SimulationGeneralProperties::setAdaptiveBatchingModeOn)
+ * every process simulates histories, every process requests its next batch
+ * before it starts simulating the current one and batch sizes are based on
+ * the measured history rates of the processes. The processes can also be
+ * split into work groups. The lowest rank in each work group requests
+ * work from the root process for the entire group and distributes it to the
+ * other processes in the group.
+ */
 template<ParticleModeType mode>
 class BatchedDistributedStandardParticleSimulationManager : public StandardParticleSimulationManager<mode>
 {
@@ -81,11 +98,103 @@ private:
   // Complete assigned work
   void work();
 
+  // The adaptive work message tags
+  enum AdaptiveWorkMessageTag{
+    ADAPTIVE_WORK_REQUEST_TAG = 1,
+    ADAPTIVE_WORK_TASK_TAG = 2
+  };
+
+  // The adaptive work node (a process and the processes that it distributes
+  // work to)
+  struct AdaptiveWorkNode
+  {
+    // The parent process (-1 if this is the root process)
+    int parent;
+
+    // The child processes
+    std::vector<int> children;
+
+    // The child process index map
+    std::unordered_map<int,size_t> child_indices;
+
+    // The number of processes that each child distributes work to (including
+    // the child)
+    std::vector<uint64_t> child_process_counts;
+
+    // The last history rate reported by each child (histories/s)
+    std::vector<double> child_history_rates;
+
+    // The size of the last task that was assigned to each child
+    std::vector<uint64_t> child_task_sizes;
+
+    // The histories that have not been simulated or assigned (start, end+1)
+    std::deque<std::pair<uint64_t,uint64_t> > task_queue;
+
+    // The number of histories that this process has simulated
+    uint64_t simulated_histories;
+
+    // The simulation timer
+    std::shared_ptr<Utility::Timer> timer;
+  };
+
+  // Coordinate the adaptive work (root process only)
+  void coordinateAdaptiveWork();
+
+  // Complete the adaptive work (non-root processes only)
+  void completeAdaptiveWork();
+
+  // Initialize the adaptive work node of this process
+  void initializeAdaptiveWorkNode( AdaptiveWorkNode& node ) const;
+
+  // Assign adaptive tasks to idle children
+  void assignAdaptiveTasksToIdleChildren( AdaptiveWorkNode& node );
+
+  // Tell the children to stop working
+  void stopAdaptiveChildren( AdaptiveWorkNode& node,
+                             const uint64_t stop_code );
+
+  // Simulate an adaptive task
+  void simulateAdaptiveTask( AdaptiveWorkNode& node,
+                             const std::pair<uint64_t,uint64_t>& task );
+
+  // Take a task from the front of the task queue
+  static std::pair<uint64_t,uint64_t> takeAdaptiveTask(
+                                                  AdaptiveWorkNode& node,
+                                                  const uint64_t task_size );
+
+  // Get the number of histories in the task queue
+  static uint64_t getNumberOfQueuedHistories( const AdaptiveWorkNode& node );
+
+  // Get the history rate of this process (histories/s)
+  static double getOwnHistoryRate( const AdaptiveWorkNode& node );
+
+  // Get the history rate of this process and its children (histories/s)
+  static double getTotalHistoryRate( const AdaptiveWorkNode& node );
+
+  // Calculate the size of the next task that will be assigned to a child
+  uint64_t calculateChildTaskSize( const AdaptiveWorkNode& node,
+                                   const size_t child_index ) const;
+
+  // Calculate the size of the next task that this process will simulate
+  uint64_t calculateOwnTaskSize( const AdaptiveWorkNode& node ) const;
+
+  // Calculate the number of queued histories that triggers a work request
+  uint64_t calculateWorkRequestThreshold( const AdaptiveWorkNode& node ) const;
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // Records if adaptive batching should be used
+  bool d_adaptive_batching;
+
+  // The number of processes per work group (adaptive batching only)
+  uint64_t d_processes_per_work_group;
+
+  // The minimum task size (adaptive batching only)
+  uint64_t d_min_task_size;
 };
   
 } // end MonteCarlo namespace
@@ -9,6 +9,11 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
 
@@ -41,16 +46,28 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_batches_per_rendezvous( 0 ),
+  d_adaptive_batching( properties->isAdaptiveBatchingModeOn() ),
+  d_processes_per_work_group( properties->getNumberOfProcessesPerWorkGroup() ),
+  d_min_task_size( 1 )
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
-  // Calculate the batch size
-  d_batches_per_rendezvous =
-    properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  // Calculate the batch size (the root process only simulates histories
+  // when adaptive batching is used)
+  if( d_adaptive_batching )
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*comm->size();
+  }
+  else
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  }
 
   // Calculate the batch size
   uint64_t batch_size =
@@ -63,6 +80,9 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                       "least 1 is calculated." );
 
   this->setBatchSize( batch_size );
+
+  // Adaptive tasks will not be smaller than a quarter of the initial batch
+  d_min_task_size = std::max( batch_size/4, (uint64_t)1 );
 }
 
 // Run the simulation set up by the user with the ability to interrupt
@@ -114,10 +134,20 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
   // The simulation has started
   this->registerSimulationStartedEvent();
 
-  if( d_comm->rank() == 0 )
-    this->coordinateWorkers();
+  if( d_adaptive_batching )
+  {
+    if( d_comm->rank() == 0 )
+      this->coordinateAdaptiveWork();
+    else
+      this->completeAdaptiveWork();
+  }
   else
-    this->work();
+  {
+    if( d_comm->rank() == 0 )
+      this->coordinateWorkers();
+    else
+      this->work();
+  }
 
   d_comm->barrier();
 
@@ -352,6 +382,591 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
   }
 }
 
+// Coordinate the adaptive work (root process only)
+/*! \details The root process hands out the histories in the current
+ * rendezvous batch to its children (the workers in its work group and the
+ * other work group heads) and simulates a small task of its own in between
+ * the requests. A child always sends its next request before it starts
+ * simulating its current task so the reply is usually waiting for it by the
+ * time that it needs it.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateAdaptiveWork()
+{
+  AdaptiveWorkNode node;
+
+  this->initializeAdaptiveWorkNode( node );
+
+  bool rendezvous_required = false;
+
+  while( true )
+  {
+    // Queue the histories in the rendezvous batch
+    node.task_queue.clear();
+    node.task_queue.push_back(
+         std::make_pair( this->getNextHistory(),
+                         this->getNextHistory() + this->getRendezvousBatchSize() ) );
+
+    // The stop message (0 = rendezvous batch complete - rendezvous,
+    //                   1 = simulation complete - rendezvous,
+    //                   2 = simulation complete - no rendezvous)
+    uint64_t stop_code = 0;
+
+    while( true )
+    {
+      if( this->isSimulationComplete() )
+      {
+        stop_code = (rendezvous_required ? 1 : 2);
+
+        break;
+      }
+      else if( node.task_queue.empty() )
+        break;
+
+      // A rendezvous is required
+      rendezvous_required = true;
+
+      this->assignAdaptiveTasksToIdleChildren( node );
+
+      if( !node.task_queue.empty() )
+      {
+        this->simulateAdaptiveTask(
+                 node,
+                 this->takeAdaptiveTask( node, this->calculateOwnTaskSize( node ) ) );
+      }
+    }
+
+    // Children will finish the tasks that they have already been assigned
+    // before they stop
+    this->stopAdaptiveChildren( node, stop_code );
+
+    // Increment the next history
+    this->incrementNextHistory( this->getRendezvousBatchSize() -
+                                this->getNumberOfQueuedHistories( node ) );
+
+    if( stop_code < 2 )
+      this->rendezvous();
+
+    if( stop_code > 0 )
+      break;
+
+    // The rendezvous is complete
+    rendezvous_required = false;
+  }
+}
+
+// Complete the adaptive work (non-root processes only)
+/*! \details A work group head requests work from the root process once the
+ * number of histories that it has queued is less than the number that is
+ * needed to give every process in its group another task. Every other
+ * process requests its next task as soon as it has taken its current task
+ * from its queue.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::completeAdaptiveWork()
+{
+  AdaptiveWorkNode node;
+
+  this->initializeAdaptiveWorkNode( node );
+
+  // The work request message (the history rate of this process and its
+  // children)
+  double work_request_message = 0.0;
+
+  Utility::Communicator::Request work_request;
+
+  bool work_request_outstanding = false;
+
+  // The task (or stop message) from the parent process
+  std::pair<uint64_t,uint64_t> task;
+
+  // The stop message from the parent process (-1 = no stop message)
+  int64_t stop_code = -1;
+
+  while( true )
+  {
+    if( node.task_queue.empty() )
+    {
+      if( stop_code < 0 )
+      {
+        if( !work_request_outstanding )
+        {
+          work_request_message = this->getTotalHistoryRate( node );
+
+          try{
+            work_request = Utility::isend( *d_comm,
+                                           node.parent,
+                                           ADAPTIVE_WORK_REQUEST_TAG,
+                                           work_request_message );
+          }
+          EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                                   "Process " << d_comm->rank() <<
+                                   " unable to request work from process "
+                                   << node.parent << "!" );
+
+          work_request_outstanding = true;
+        }
+      }
+      else
+      {
+        // Pass the stop message on to the children
+        this->stopAdaptiveChildren( node, stop_code );
+
+        // Rendezvous with the root process
+        if( stop_code < 2 )
+          this->rendezvous();
+
+        // The simulation is complete
+        if( stop_code > 0 )
+          break;
+
+        stop_code = -1;
+
+        continue;
+      }
+    }
+    else
+    {
+      this->assignAdaptiveTasksToIdleChildren( node );
+
+      if( !node.task_queue.empty() )
+      {
+        std::pair<uint64_t,uint64_t> own_task =
+          this->takeAdaptiveTask( node, this->calculateOwnTaskSize( node ) );
+
+        // Request the next task before simulating this one
+        if( stop_code < 0 && !work_request_outstanding &&
+            this->getNumberOfQueuedHistories( node ) <=
+            this->calculateWorkRequestThreshold( node ) )
+        {
+          work_request_message = this->getTotalHistoryRate( node );
+
+          try{
+            work_request = Utility::isend( *d_comm,
+                                           node.parent,
+                                           ADAPTIVE_WORK_REQUEST_TAG,
+                                           work_request_message );
+          }
+          EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                                   "Process " << d_comm->rank() <<
+                                   " unable to request work from process "
+                                   << node.parent << "!" );
+
+          work_request_outstanding = true;
+        }
+
+        this->simulateAdaptiveTask( node, own_task );
+      }
+
+      // Only wait for the reply if there is nothing left to do
+      if( work_request_outstanding && !node.task_queue.empty() )
+      {
+        Utility::Communicator::Status reply_info;
+
+        try{
+          reply_info = Utility::iprobe<std::pair<uint64_t,uint64_t> >(
+                                                   *d_comm,
+                                                   node.parent,
+                                                   ADAPTIVE_WORK_TASK_TAG );
+        }
+        EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                                 "Unable to probe for work on process "
+                                 << d_comm->rank() << "!" );
+
+        if( !reply_info.hasMessageDetails() )
+          continue;
+      }
+      else if( !work_request_outstanding )
+        continue;
+    }
+
+    // Get the reply to the outstanding work request
+    try{
+      Utility::receive( *d_comm, node.parent, ADAPTIVE_WORK_TASK_TAG, task );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "receive work from process " << node.parent <<
+                             "!" );
+
+    work_request.wait();
+
+    work_request_outstanding = false;
+
+    if( task.first != task.second )
+      node.task_queue.push_back( task );
+    else
+      stop_code = task.first;
+  }
+}
+
+// Initialize the adaptive work node of this process
+/*! \details The processes are split into work groups of consecutive ranks.
+ * The lowest rank in each group is the head of the group. The root process
+ * is the head of the first group and the parent of every other group head.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::initializeAdaptiveWorkNode( AdaptiveWorkNode& node ) const
+{
+  const int size = d_comm->size();
+  const int rank = d_comm->rank();
+
+  const int group_size =
+    (d_processes_per_work_group > 1 && d_processes_per_work_group < (uint64_t)size ?
+     (int)d_processes_per_work_group : size);
+
+  const int group_head = (rank/group_size)*group_size;
+  const int group_end = std::min( group_head + group_size, size );
+
+  node.children.clear();
+  node.child_process_counts.clear();
+
+  if( rank == group_head )
+  {
+    // The other processes in the group
+    for( int child = group_head+1; child < group_end; ++child )
+    {
+      node.children.push_back( child );
+      node.child_process_counts.push_back( 1 );
+    }
+
+    // The other group heads
+    if( rank == 0 )
+    {
+      for( int child = group_size; child < size; child += group_size )
+      {
+        node.children.push_back( child );
+        node.child_process_counts.push_back(
+                                   std::min( child + group_size, size ) - child );
+      }
+
+      node.parent = -1;
+    }
+    else
+      node.parent = 0;
+  }
+  else
+    node.parent = group_head;
+
+  node.child_indices.clear();
+
+  for( size_t i = 0; i < node.children.size(); ++i )
+    node.child_indices[node.children[i]] = i;
+
+  node.child_history_rates.assign( node.children.size(), 0.0 );
+  node.child_task_sizes.resize( node.children.size() );
+
+  for( size_t i = 0; i < node.children.size(); ++i )
+  {
+    node.child_task_sizes[i] =
+      this->getBatchSize()*node.child_process_counts[i];
+  }
+
+  node.task_queue.clear();
+  node.simulated_histories = 0;
+  node.timer = d_comm->createTimer();
+}
+
+// Assign adaptive tasks to idle children
+/*! \details A child request is only received if a task can be assigned to it.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::assignAdaptiveTasksToIdleChildren(
+                                                      AdaptiveWorkNode& node )
+{
+  Utility::Communicator::Status idle_child_info;
+
+  double child_history_rate;
+
+  while( !node.task_queue.empty() )
+  {
+    // Probe for an idle child
+    try{
+      idle_child_info =
+        Utility::iprobe<double>( *d_comm, ADAPTIVE_WORK_REQUEST_TAG );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to probe for idle child on process "
+                             << d_comm->rank() << "!" );
+
+    if( !idle_child_info.hasMessageDetails() )
+      break;
+
+    const int child = idle_child_info.source();
+
+    try{
+      Utility::receive( *d_comm,
+                        child,
+                        ADAPTIVE_WORK_REQUEST_TAG,
+                        child_history_rate );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to receive work request on process "
+                             << d_comm->rank() << " from process "
+                             << child << "!" );
+
+    const size_t child_index = node.child_indices.find( child )->second;
+
+    // Only the latest rate reported by a child is used
+    if( child_history_rate > 0.0 )
+      node.child_history_rates[child_index] = child_history_rate;
+
+    std::pair<uint64_t,uint64_t> task =
+      this->takeAdaptiveTask( node,
+                              this->calculateChildTaskSize( node, child_index ) );
+
+    node.child_task_sizes[child_index] = task.second - task.first;
+
+    try{
+      Utility::send( *d_comm, child, ADAPTIVE_WORK_TASK_TAG, task );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to send the work task from process "
+                             << d_comm->rank() << " to process "
+                             << child << "!" );
+  }
+}
+
+// Tell the children to stop working
+/*! \details Every child has exactly one outstanding work request (or will
+ * make one once its queue is low enough), which will be answered with the
+ * stop message.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::stopAdaptiveChildren(
+                                                      AdaptiveWorkNode& node,
+                                                      const uint64_t stop_code )
+{
+  // The child work request messages
+  std::vector<double> child_history_rates( node.children.size() );
+
+  // The request for each child
+  std::vector<Utility::Communicator::Request> requests;
+
+  const std::pair<uint64_t,uint64_t> stop_message =
+    std::make_pair( stop_code, stop_code );
+
+  for( size_t i = 0; i < node.children.size(); ++i )
+  {
+    try{
+      Utility::receive( *d_comm,
+                        node.children[i],
+                        ADAPTIVE_WORK_REQUEST_TAG,
+                        child_history_rates[i] );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to receive work request on process "
+                             << d_comm->rank() << " from process "
+                             << node.children[i] << "!" );
+
+    if( child_history_rates[i] > 0.0 )
+      node.child_history_rates[i] = child_history_rates[i];
+
+    try{
+      requests.push_back( Utility::isend( *d_comm,
+                                          node.children[i],
+                                          ADAPTIVE_WORK_TASK_TAG,
+                                          stop_message ) );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to send stop message from process "
+                             << d_comm->rank() << " to process "
+                             << node.children[i] << "!" );
+  }
+
+  // Wait for the stop messages to send
+  std::vector<Utility::Communicator::Status> statuses( requests.size() );
+
+  Utility::wait( requests, statuses );
+}
+
+// Simulate an adaptive task
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::simulateAdaptiveTask(
+                                      AdaptiveWorkNode& node,
+                                      const std::pair<uint64_t,uint64_t>& task )
+{
+  if( node.simulated_histories == 0 )
+    node.timer->start();
+  else
+    node.timer->resume();
+
+  this->runSimulationBatch( task.first, task.second );
+
+  node.timer->stop();
+
+  node.simulated_histories += task.second - task.first;
+}
+
+// Take a task from the front of the task queue
+/*! \details The task will not be larger than the first set of queued
+ * histories.
+ */
+template<ParticleModeType mode>
+std::pair<uint64_t,uint64_t> BatchedDistributedStandardParticleSimulationManager<mode>::takeAdaptiveTask(
+                                                    AdaptiveWorkNode& node,
+                                                    const uint64_t task_size )
+{
+  // Make sure that there are queued histories
+  testPrecondition( !node.task_queue.empty() );
+  // Make sure that the task size is valid
+  testPrecondition( task_size > 0 );
+
+  std::pair<uint64_t,uint64_t>& queued_histories = node.task_queue.front();
+
+  std::pair<uint64_t,uint64_t> task;
+  task.first = queued_histories.first;
+  task.second =
+    std::min( queued_histories.first + task_size, queued_histories.second );
+
+  if( task.second == queued_histories.second )
+    node.task_queue.pop_front();
+  else
+    queued_histories.first = task.second;
+
+  return task;
+}
+
+// Get the number of histories in the task queue
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::getNumberOfQueuedHistories(
+                                                 const AdaptiveWorkNode& node )
+{
+  uint64_t queued_histories = 0;
+
+  for( size_t i = 0; i < node.task_queue.size(); ++i )
+  {
+    queued_histories +=
+      node.task_queue[i].second - node.task_queue[i].first;
+  }
+
+  return queued_histories;
+}
+
+// Get the history rate of this process (histories/s)
+/*! \details A rate of zero will be returned if no histories have been
+ * simulated by this process.
+ */
+template<ParticleModeType mode>
+double BatchedDistributedStandardParticleSimulationManager<mode>::getOwnHistoryRate(
+                                                 const AdaptiveWorkNode& node )
+{
+  if( node.simulated_histories == 0 )
+    return 0.0;
+  else
+  {
+    const double simulation_time = node.timer->elapsed().count();
+
+    if( simulation_time > 0.0 )
+      return node.simulated_histories/simulation_time;
+    else
+      return 0.0;
+  }
+}
+
+// Get the history rate of this process and its children (histories/s)
+template<ParticleModeType mode>
+double BatchedDistributedStandardParticleSimulationManager<mode>::getTotalHistoryRate(
+                                                 const AdaptiveWorkNode& node )
+{
+  double history_rate = getOwnHistoryRate( node );
+
+  for( size_t i = 0; i < node.child_history_rates.size(); ++i )
+    history_rate += node.child_history_rates[i];
+
+  return history_rate;
+}
+
+// Calculate the size of the next task that will be assigned to a child
+/*! \details Once the history rate of a child is known it will be assigned
+ * half of its share of the queued histories (guided self-scheduling weighted
+ * by the measured history rates). The task size will not be smaller than the
+ * minimum task size times the number of processes that the child distributes
+ * work to.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateChildTaskSize(
+                                              const AdaptiveWorkNode& node,
+                                              const size_t child_index ) const
+{
+  const uint64_t min_task_size =
+    d_min_task_size*node.child_process_counts[child_index];
+
+  const double child_history_rate = node.child_history_rates[child_index];
+
+  if( child_history_rate > 0.0 )
+  {
+    const double task_size =
+      std::ceil( 0.5*this->getNumberOfQueuedHistories( node )*
+                 child_history_rate/this->getTotalHistoryRate( node ) );
+
+    return std::max( (uint64_t)task_size, min_task_size );
+  }
+  else
+    return this->getBatchSize()*node.child_process_counts[child_index];
+}
+
+// Calculate the size of the next task that this process will simulate
+/*! \details A process with children must be able to respond to their
+ * requests before they finish their current tasks. Its own tasks will be
+ * sized so that they take a quarter of the time that its fastest child is
+ * expected to need for its current task.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateOwnTaskSize(
+                                           const AdaptiveWorkNode& node ) const
+{
+  // Make sure that there are queued histories
+  testPrecondition( !node.task_queue.empty() );
+
+  if( node.children.empty() )
+  {
+    return node.task_queue.front().second - node.task_queue.front().first;
+  }
+
+  const double own_history_rate = this->getOwnHistoryRate( node );
+
+  double min_child_task_time = std::numeric_limits<double>::max();
+
+  for( size_t i = 0; i < node.children.size(); ++i )
+  {
+    if( node.child_history_rates[i] > 0.0 )
+    {
+      min_child_task_time =
+        std::min( min_child_task_time,
+                  node.child_task_sizes[i]/node.child_history_rates[i] );
+    }
+  }
+
+  if( own_history_rate > 0.0 &&
+      min_child_task_time < std::numeric_limits<double>::max() )
+  {
+    const double task_size = 0.25*own_history_rate*min_child_task_time;
+
+    return std::max( (uint64_t)task_size, (uint64_t)1 );
+  }
+  else
+    return std::max( d_min_task_size/4, (uint64_t)1 );
+}
+
+// Calculate the number of queued histories that triggers a work request
+/*! \details A process with children will request more work once it does not
+ * have enough queued histories to give every child another task of the same
+ * size as its last one. A process without children will request more work
+ * as soon as its queue is empty.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateWorkRequestThreshold(
+                                           const AdaptiveWorkNode& node ) const
+{
+  uint64_t threshold = 0;
+
+  for( size_t i = 0; i < node.child_task_sizes.size(); ++i )
+    threshold += node.child_task_sizes[i];
+
+  return threshold;
+}
+
 // Print the simulation data to the desired stream
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::printSimulationSummary( std::ostream& os ) const
@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryScheduler.cpp
+//! \author Alex Robinson
+//! \brief  The history scheduler class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryScheduler.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The chunk fraction denominator (chunk size = remaining/denominator)
+const uint64_t HistoryScheduler::s_chunk_fraction_denominator = 4;
+
+// Constructor
+HistoryScheduler::HistoryScheduler( const unsigned number_of_threads )
+  : d_number_of_threads( number_of_threads ),
+    d_ranges( new HistoryRange[number_of_threads] )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+
+  for( unsigned i = 0; i < d_number_of_threads; ++i )
+  {
+    d_ranges[i].start_history = 0;
+    d_ranges[i].end_history = 0;
+    d_ranges[i].number_of_steals = 0;
+  }
+}
+
+// Return the number of threads
+unsigned HistoryScheduler::getNumberOfThreads() const
+{
+  return d_number_of_threads;
+}
+
+// Assign the history range (not thread safe)
+/*! \details The history range will be split evenly between the threads.
+ * This method must not be called while other threads are requesting history
+ * chunks (e.g. it should be called inside of an omp single block).
+ */
+void HistoryScheduler::assignHistories( const uint64_t start_history,
+                                        const uint64_t end_history )
+{
+  // Make sure the history range is valid
+  testPrecondition( start_history <= end_history );
+
+  const uint64_t number_of_histories = end_history - start_history;
+
+  uint64_t range_start_history = start_history;
+
+  for( unsigned i = 0; i < d_number_of_threads; ++i )
+  {
+    uint64_t range_size = number_of_histories/d_number_of_threads;
+
+    if( i < number_of_histories % d_number_of_threads )
+      ++range_size;
+
+    d_ranges[i].start_history = range_start_history;
+    d_ranges[i].end_history = range_start_history + range_size;
+
+    range_start_history += range_size;
+  }
+}
+
+// Get the next history chunk for the thread (thread safe)
+/*! \details If false is returned there are no histories remaining in the
+ * history range that was assigned.
+ */
+bool HistoryScheduler::getNextHistoryChunk( const unsigned thread_id,
+                                            uint64_t& chunk_start_history,
+                                            uint64_t& chunk_end_history )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_number_of_threads );
+
+  HistoryRange& range = d_ranges[thread_id];
+
+  // Remove a chunk from the thread's own range
+  {
+    std::lock_guard<std::mutex> lock( range.mutex );
+
+    if( HistoryScheduler::removeChunkFromFront( range,
+                                                chunk_start_history,
+                                                chunk_end_history ) )
+      return true;
+  }
+
+  // Steal histories from another thread and refill the thread's own range
+  uint64_t stolen_start_history, stolen_end_history;
+
+  while( this->stealHistories( thread_id,
+                               stolen_start_history,
+                               stolen_end_history ) )
+  {
+    std::lock_guard<std::mutex> lock( range.mutex );
+
+    range.start_history = stolen_start_history;
+    range.end_history = stolen_end_history;
+
+    ++range.number_of_steals;
+
+    if( HistoryScheduler::removeChunkFromFront( range,
+                                                chunk_start_history,
+                                                chunk_end_history ) )
+      return true;
+  }
+
+  return false;
+}
+
+// Return the number of history chunks that have been stolen by a thread
+uint64_t HistoryScheduler::getNumberOfSteals( const unsigned thread_id ) const
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_number_of_threads );
+
+  std::lock_guard<std::mutex> lock( d_ranges[thread_id].mutex );
+
+  return d_ranges[thread_id].number_of_steals;
+}
+
+// Remove a history chunk from the front of a range
+/*! \details The range mutex must be locked.
+ */
+bool HistoryScheduler::removeChunkFromFront( HistoryRange& range,
+                                             uint64_t& chunk_start_history,
+                                             uint64_t& chunk_end_history )
+{
+  const uint64_t remaining_histories = range.end_history - range.start_history;
+
+  if( remaining_histories == 0 )
+    return false;
+
+  uint64_t chunk_size = remaining_histories/s_chunk_fraction_denominator;
+
+  if( chunk_size == 0 )
+    chunk_size = 1;
+
+  chunk_start_history = range.start_history;
+  chunk_end_history = range.start_history + chunk_size;
+
+  range.start_history = chunk_end_history;
+
+  return true;
+}
+
+// Steal half of the histories from the back of the largest range
+/*! \details Only a single range mutex will be locked at any time. The stolen
+ * histories are not in any range until the thief adds them to its own range
+ * but they will always be completed by the thief.
+ */
+bool HistoryScheduler::stealHistories( const unsigned thread_id,
+                                       uint64_t& stolen_start_history,
+                                       uint64_t& stolen_end_history )
+{
+  while( true )
+  {
+    // Find the largest remaining range
+    unsigned victim_id = thread_id;
+    uint64_t victim_remaining_histories = 0;
+
+    for( unsigned i = 1; i < d_number_of_threads; ++i )
+    {
+      const unsigned candidate_id = (thread_id + i) % d_number_of_threads;
+
+      std::lock_guard<std::mutex> lock( d_ranges[candidate_id].mutex );
+
+      const uint64_t remaining_histories =
+        d_ranges[candidate_id].end_history -
+        d_ranges[candidate_id].start_history;
+
+      if( remaining_histories > victim_remaining_histories )
+      {
+        victim_id = candidate_id;
+        victim_remaining_histories = remaining_histories;
+      }
+    }
+
+    // All ranges are empty
+    if( victim_remaining_histories == 0 )
+      return false;
+
+    HistoryRange& victim_range = d_ranges[victim_id];
+
+    std::lock_guard<std::mutex> lock( victim_range.mutex );
+
+    const uint64_t remaining_histories =
+      victim_range.end_history - victim_range.start_history;
+
+    // The victim range was exhausted before it could be locked - try again
+    if( remaining_histories == 0 )
+      continue;
+
+    // Steal the back half (rounded up so that a single history can be stolen)
+    const uint64_t number_of_stolen_histories = (remaining_histories + 1)/2;
+
+    stolen_end_history = victim_range.end_history;
+    stolen_start_history = stolen_end_history - number_of_stolen_histories;
+
+    victim_range.end_history = stolen_start_history;
+
+    return true;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryScheduler.cpp
+//---------------------------------------------------------------------------//
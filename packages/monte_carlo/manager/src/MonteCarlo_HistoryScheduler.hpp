@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryScheduler.hpp
+//! \author Alex Robinson
+//! \brief  The history scheduler class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_HISTORY_SCHEDULER_HPP
+#define MONTE_CARLO_HISTORY_SCHEDULER_HPP
+
+// Std Lib Includes
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace MonteCarlo{
+
+/*! The history scheduler class
+ * \details This class distributes a range of histories to the threads of a
+ * thread team. Each thread owns a contiguous range of histories that it
+ * removes chunks of histories from (starting at the front of the range). The
+ * size of a chunk is a fraction of the histories remaining in the range so
+ * the chunks become smaller as the range is exhausted. Once the range of a
+ * thread is empty it will steal half of the histories from the back of the
+ * largest remaining range. Because the cost of a history can vary by orders
+ * of magnitude, this keeps the threads busy until the entire history range
+ * has been completed. Ranges that are assigned to threads that do not exist
+ * in the team will simply be stolen by the threads that do exist.
+ */
+class HistoryScheduler
+{
+
+public:
+
+  //! Constructor
+  HistoryScheduler( const unsigned number_of_threads );
+
+  //! Destructor
+  ~HistoryScheduler()
+  { /* ... */ }
+
+  //! Return the number of threads
+  unsigned getNumberOfThreads() const;
+
+  //! Assign the history range (not thread safe)
+  void assignHistories( const uint64_t start_history,
+                        const uint64_t end_history );
+
+  //! Get the next history chunk for the thread (thread safe)
+  bool getNextHistoryChunk( const unsigned thread_id,
+                            uint64_t& chunk_start_history,
+                            uint64_t& chunk_end_history );
+
+  //! Return the number of history chunks that have been stolen by a thread
+  uint64_t getNumberOfSteals( const unsigned thread_id ) const;
+
+private:
+
+  // The history range of a thread
+  struct HistoryRange
+  {
+    // The range mutex
+    mutable std::mutex mutex;
+
+    // The first history in the range
+    uint64_t start_history;
+
+    // The end of the range (exclusive)
+    uint64_t end_history;
+
+    // The number of history chunks that have been stolen by the thread
+    uint64_t number_of_steals;
+
+    // Padding that keeps neighboring ranges off of the same cache line
+    char padding[64];
+  };
+
+  // Remove a history chunk from the front of a range
+  static bool removeChunkFromFront( HistoryRange& range,
+                                    uint64_t& chunk_start_history,
+                                    uint64_t& chunk_end_history );
+
+  // Steal half of the histories from the back of the largest range
+  bool stealHistories( const unsigned thread_id,
+                       uint64_t& stolen_start_history,
+                       uint64_t& stolen_end_history );
+
+  // The chunk fraction denominator (chunk size = remaining/denominator)
+  static const uint64_t s_chunk_fraction_denominator;
+
+  // The number of threads
+  unsigned d_number_of_threads;
+
+  // The history ranges
+  std::unique_ptr<HistoryRange[]> d_ranges;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_HISTORY_SCHEDULER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryScheduler.hpp
+//---------------------------------------------------------------------------//
@@ -8,7 +8,9 @@
 
 // Std Lib Includes
 #include <csignal>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
@@ -109,6 +111,18 @@ ParticleSimulationManager::ParticleSimulationManager(
   if( d_batch_size > d_properties->getMaxBatchSize() )
     d_batch_size = d_properties->getMaxBatchSize();
 
+  // Create the rendezvous archive writer
+  if( d_properties->getMaxNumberOfPendingRendezvousArchives() > 0 )
+  {
+    d_rendezvous_archive_writer.reset( new Utility::BackgroundFileWriter(
+                    d_properties->getMaxNumberOfPendingRendezvousArchives() ) );
+  }
+
+  // Index the observer dispatchers by the dense model entity indices (the
+  // indexing is not archived with the event handler)
+  d_event_handler->indexObserverDispatchers(
+                           (std::shared_ptr<const Geometry::Model>)(*d_model) );
+
   // Set the cutoff weight roulette
   this->setCutoffWeightRoulette();
 }
@@ -480,6 +494,8 @@ void ParticleSimulationManager::resetData()
 {
   d_event_handler->resetObserverData();
   d_source->resetData();
+
+  std::fill( d_thread_idle_times.begin(), d_thread_idle_times.end(), 0.0 );
 }
 
 // Reduce distributed data
@@ -504,6 +520,10 @@ void ParticleSimulationManager::registerSimulationStartedEvent()
 void ParticleSimulationManager::registerSimulationStoppedEvent()
 {
   d_event_handler->updateObserversFromParticleSimulationStoppedEvent();
+
+  // Make sure that every rendezvous archive has been written
+  if( d_rendezvous_archive_writer )
+    d_rendezvous_archive_writer->waitForPendingWrites();
 }
 
 // Check if the simulation is complete
@@ -521,6 +541,16 @@ void ParticleSimulationManager::rendezvous()
 }
 
 // Conduct a basic rendezvous
+/*! \details The state of the simulation will always be saved to a temporary
+ * archive that replaces the previous rendezvous archive once it is complete.
+ * If rendezvous archives can be written in the background (see
+ * MonteCarlo::SimulationGeneralProperties::setMaxNumberOfPendingRendezvousArchives)
+ * the state will be saved to an in-memory archive, which is a snapshot of
+ * the state that the simulation can continue to modify, and only the file
+ * write will be done in the background. The serialization of the state is
+ * not overlapped with the simulation - it is always done on the calling
+ * thread before the simulation continues.
+ */
 void ParticleSimulationManager::basicRendezvous() const
 {
   std::string archive_name( d_simulation_name );
@@ -554,7 +584,28 @@ void ParticleSimulationManager::basicRendezvous() const
                  d_rendezvous_number+1,
                  d_use_single_rendezvous_file );
 
-  tmp_factory.saveToFile( archive_name, true );
+  // The hdf5 archive can only be written directly to a file
+  if( d_rendezvous_archive_writer && d_archive_type != "h5fa" )
+  {
+    // The archive is written directly into the buffer that will be handed
+    // to the writer (no copy of the archive is made)
+    Utility::BackgroundFileWriter::BufferStream archive_stream;
+
+    tmp_factory.saveToStream( archive_stream, "." + d_archive_type );
+
+    d_rendezvous_archive_writer->write( archive_name,
+                                        archive_stream.releaseBuffer() );
+  }
+  else
+  {
+    const boost::filesystem::path tmp_archive_name =
+      Utility::BackgroundFileWriter::getTemporaryFileName( archive_name );
+
+    tmp_factory.saveToFile( tmp_archive_name, true );
+
+    Utility::BackgroundFileWriter::replaceFile( tmp_archive_name,
+                                                archive_name );
+  }
 }
 
 // Print the simulation data to the desired stream
@@ -562,6 +613,7 @@ void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
   d_source->printSummary( os );
   d_event_handler->printObserverSummaries( os );
+  this->printThreadSummary( os );
 }
 
 // Log the simulation data
@@ -569,9 +621,31 @@ void ParticleSimulationManager::logSimulationSummary() const
 {
   d_source->logSummary();
   d_event_handler->logObserverSummaries();
+
+  std::ostringstream oss;
+
+  this->printThreadSummary( oss );
+
+  FRENSIE_LOG_NOTIFICATION( oss.str() );
+}
+
+// Print the thread summary
+void ParticleSimulationManager::printThreadSummary( std::ostream& os ) const
+{
+  os << "Thread idle time (s):\n";
+
+  for( size_t i = 0; i < d_thread_idle_times.size(); ++i )
+    os << "  Thread " << i << ": " << d_thread_idle_times[i] << "\n";
 }
 
 // Run the simulation batch
+/*! \details A single thread team will be created for the entire batch. The
+ * team persists across all of the micro batches - the observer state
+ * snapshots are taken by the master thread of the team between two barriers.
+ * The time that each thread spends waiting at the barriers (idle time) will
+ * be recorded. The time that the master thread spends taking the snapshots
+ * is not idle time.
+ */
 void ParticleSimulationManager::runSimulationBatch(
                                             const uint64_t batch_start_history,
                                             const uint64_t batch_end_history )
@@ -591,53 +665,127 @@ void ParticleSimulationManager::runSimulationBatch(
     micro_batch_size = 1;
   }
 
-  for( uint64_t i = 0; i < number_of_snapshots_per_batch; ++i )
-  {
-    if( d_exit_simulation )
-      continue;
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  if( d_thread_idle_times.size() < number_of_threads )
+    d_thread_idle_times.resize( number_of_threads, 0.0 );
+
+  HistoryScheduler scheduler( number_of_threads );
+
+  // Assign the histories of the micro batch to the scheduler
+  // Note: If the simulation must be exited the micro batch will be empty
+  //       (all threads of the team must encounter the same barriers).
+  bool run_micro_batch;
+
+  auto assign_micro_batch =
+    [&]( const uint64_t i ){
+    run_micro_batch = !d_exit_simulation;
 
     const uint64_t micro_batch_start_history =
       batch_start_history + micro_batch_size*i;
-      
+
+    uint64_t micro_batch_end_history;
+
     if( i < d_properties->getNumberOfSnapshotsPerBatch()-1 )
+      micro_batch_end_history = micro_batch_start_history + micro_batch_size;
+    else
+      micro_batch_end_history = batch_end_history;
+
+    if( run_micro_batch )
     {
-      this->runSimulationMicroBatch( micro_batch_start_history,
-                                     micro_batch_start_history +
-                                     micro_batch_size );
+      scheduler.assignHistories( micro_batch_start_history,
+                                 micro_batch_end_history );
     }
     else
     {
-      this->runSimulationMicroBatch( micro_batch_start_history,
-                                     batch_end_history );
+      scheduler.assignHistories( micro_batch_start_history,
+                                 micro_batch_start_history );
+    }
+  };
+
+  assign_micro_batch( 0 );
+
+  // The estimators can change the layout of their data for the batch
+  d_event_handler->updateObserversFromParticleSimulationBatchStartedEvent();
+
+  #pragma omp parallel num_threads( number_of_threads )
+  {
+    // Create a bank for each thread (reused by every micro batch)
+    ParticleBank source_bank, bank;
+
+    std::shared_ptr<Utility::Timer> idle_timer =
+      Utility::OpenMPProperties::createTimer();
+
+    double idle_time = 0.0;
+
+    for( uint64_t i = 0; i < number_of_snapshots_per_batch; ++i )
+    {
+      this->runSimulationMicroBatch( scheduler, source_bank, bank );
+
+      // Wait for all threads to complete the micro batch
+      idle_timer->start();
+
+      #pragma omp barrier
+
+      idle_timer->stop();
+
+      idle_time += idle_timer->elapsed().count();
+
+      // Note: Only the master thread can take a snapshot of the observer
+      //       states. The master thread is busy (not idle) while it does
+      //       this work, so it is excluded from the timed barrier waits.
+      #pragma omp master
+      {
+        // Micro batch complete - take a snapshot of the observer states
+        if( run_micro_batch )
+          d_event_handler->takeSnapshotOfObserverStates();
+
+        if( i+1 < number_of_snapshots_per_batch )
+          assign_micro_batch( i+1 );
+      }
+
+      // Wait for the snapshot and the next micro batch assignment
+      idle_timer->start();
+
+      #pragma omp barrier
+
+      idle_timer->stop();
+
+      idle_time += idle_timer->elapsed().count();
     }
-    
-    // Micro batch complete - take a snapshot of the observer states
-    d_event_handler->takeSnapshotOfObserverStates();
+
+    d_thread_idle_times[Utility::OpenMPProperties::getThreadId()] +=
+      idle_time;
   }
+
+  // The estimator data can only be read between batches
+  d_event_handler->updateObserversFromParticleSimulationBatchStoppedEvent();
 }
 
 // Run the simulation micro batch
+/*! \details This method must be called by every thread of the team. Each
+ * thread will request history chunks from the scheduler until every history
+ * of the micro batch has been completed.
+ */
 void ParticleSimulationManager::runSimulationMicroBatch(
-                                            const uint64_t batch_start_history,
-                                            const uint64_t batch_end_history )
+                                                 HistoryScheduler& scheduler,
+                                                 ParticleBank& source_bank,
+                                                 ParticleBank& bank )
 {
-  // Make sure the history range is valid
-  testPrecondition( batch_start_history < batch_end_history );
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
-  {
-    // Create a bank for each thread
-    ParticleBank source_bank, bank;
+  uint64_t chunk_start_history, chunk_end_history;
 
-    #pragma omp for
-    for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+  while( scheduler.getNextHistoryChunk( thread_id,
+                                        chunk_start_history,
+                                        chunk_end_history ) )
+  {
+    for( uint64_t history = chunk_start_history; history < chunk_end_history; ++history )
     {
       // End the simulation if requested (by the signal handler)
-      // Note: Conformal OpenMP code cannot have a break statement. Therefore
-      //       we will simply loop through remaining histories without doing
-      //       anything if the simulation needs to be ended.
       if( d_exit_simulation )
-        continue;
+        return;
 
       // Initialize the random number generator for this history
       Utility::RandomNumberGenerator::initialize( history );
@@ -694,6 +842,32 @@ void ParticleSimulationManager::runSimulationMicroBatch(
   }
 }
 
+// Trace an adjoint photon probe ray from a collision site
+/*! \details The probe ray is traced as soon as it is created by the
+ * collision - it is never banked or handed to the population controller.
+ * The probe state only exists while the ray is traced (it is needed by the
+ * observers).
+ */
+void ParticleSimulationManager::traceProbeRay(
+                                      const AdjointPhotonState& adjoint_photon,
+                                      const AdjointPhotonProbeRay& probe_ray,
+                                      ParticleBank& bank )
+{
+  // Make sure the probe ray starts at the adjoint photon position
+  testPrecondition( probe_ray.getPosition()[0] == adjoint_photon.getXPosition() );
+  testPrecondition( probe_ray.getPosition()[1] == adjoint_photon.getYPosition() );
+  testPrecondition( probe_ray.getPosition()[2] == adjoint_photon.getZPosition() );
+
+  AdjointPhotonProbeState probe( adjoint_photon );
+
+  probe.setEnergy( probe_ray.getEnergy() );
+  probe.setDirection( probe_ray.getDirection() );
+  probe.setWeight( probe_ray.getWeight() );
+  probe.activate();
+
+  this->simulateProbeRay<AdjointPhotonState>( probe, bank, false );
+}
+
 // The signal handler
 /*! \details The first signal will cause the simulation to finish. The
  * second signal will cause the simulation to end without caching its state.
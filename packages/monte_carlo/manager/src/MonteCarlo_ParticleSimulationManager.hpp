@@ -17,6 +17,8 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_EventHandler.hpp"
+#include "MonteCarlo_AdjointPhotonProbeState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeRayTracingBank.hpp"
 #include "MonteCarlo_PopulationControl.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
 #include "MonteCarlo_StandardWeightCutoffRoulette.hpp"
@@ -25,7 +27,9 @@
 #include "MonteCarlo_CollisionKernel.hpp"
 #include "MonteCarlo_TransportKernel.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "MonteCarlo_HistoryScheduler.hpp"
 #include "Utility_Communicator.hpp"
+#include "Utility_BackgroundFileWriter.hpp"
 
 extern "C" void __custom_signal_handler__( int signal );
 
@@ -206,9 +210,13 @@ private:
   // Set the adjoint electron cutoff weight roulette
   void setAdjointElectronCutoffWeightRoulette();
 
-  //! Run the simulation batch
-  void runSimulationMicroBatch( const uint64_t batch_start_history,
-                                const uint64_t batch_end_history );
+  // Run the simulation micro batch
+  void runSimulationMicroBatch( HistoryScheduler& scheduler,
+                                ParticleBank& source_bank,
+                                ParticleBank& bank );
+
+  // Print the thread summary
+  void printThreadSummary( std::ostream& os ) const;
 
   // Simulate a resolved particle implementation
   template<typename State, typename SimulateParticleTrackMethod>
@@ -248,6 +256,24 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
+  // Simulate a resolved probe particle by ray tracing it to the boundary
+  template<typename State>
+  void simulateProbeRay( State& particle,
+                         ParticleBank& bank,
+                         const bool starting_from_source );
+
+  // Collide a copy of a ray traced probe at a collision site
+  template<typename State>
+  void collideProbe( const State& particle,
+                     ParticleBank& bank,
+                     const double weight,
+                     const double distance_to_collision );
+
+  // Trace an adjoint photon probe ray from a collision site
+  void traceProbeRay( const AdjointPhotonState& adjoint_photon,
+                      const AdjointPhotonProbeRay& probe_ray,
+                      ParticleBank& bank );
+
   // Advance a particle to the cell boundary
   template<typename State>
   void advanceParticleToCellBoundary(
@@ -269,6 +295,12 @@ private:
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Collide with the cell material and handle the progeny in the local bank
+  template<typename State>
+  void collideWithCellMaterial( State& particle,
+                                ParticleBank& local_bank,
+                                ParticleBank& bank );
+
   // Conduct a basic rendezvous
   void basicRendezvous() const;
 
@@ -323,11 +355,18 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // The rendezvous archive writer (only used if rendezvous archives are
+  // written in the background)
+  std::unique_ptr<Utility::BackgroundFileWriter> d_rendezvous_archive_writer;
+
   // Flag for ending simulation early
   bool d_end_simulation;
 
   // Flag for exiting the simulation immediately
   bool d_exit_simulation;
+
+  // The time that each thread has spent waiting at the micro batch barriers
+  std::vector<double> d_thread_idle_times;
 };
 
 } // end MonteCarlo namespace
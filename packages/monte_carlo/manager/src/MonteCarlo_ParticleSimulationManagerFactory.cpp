@@ -174,6 +174,9 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
  *  <li>MonteCarlo::SimulationGeneralProperties::getMaxBatchSize()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfBatchesPerProcessor()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfSnapshotsPerBatch()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::isAdaptiveBatchingModeOn()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfProcessesPerWorkGroup()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::getMaxNumberOfPendingRendezvousArchives()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getSimulationWallTime()</li>
  * </ul>
  */
@@ -192,6 +195,14 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
   const_cast<SimulationProperties&>( *d_properties ).setMaxBatchSize( updated_general_props.getMaxBatchSize() );
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfBatchesPerProcessor( updated_general_props.getNumberOfBatchesPerProcessor() );
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfSnapshotsPerBatch( updated_general_props.getNumberOfSnapshotsPerBatch() );
+
+  if( updated_general_props.isAdaptiveBatchingModeOn() )
+    const_cast<SimulationProperties&>( *d_properties ).setAdaptiveBatchingModeOn();
+  else
+    const_cast<SimulationProperties&>( *d_properties ).setAdaptiveBatchingModeOff();
+
+  const_cast<SimulationProperties&>( *d_properties ).setNumberOfProcessesPerWorkGroup( updated_general_props.getNumberOfProcessesPerWorkGroup() );
+  const_cast<SimulationProperties&>( *d_properties ).setMaxNumberOfPendingRendezvousArchives( updated_general_props.getMaxNumberOfPendingRendezvousArchives() );
   const_cast<SimulationProperties&>( *d_properties ).setSimulationWallTime( updated_general_props.getSimulationWallTime() );
   Utility::OpenMPProperties::setNumberOfThreads( threads );
 
@@ -238,6 +249,20 @@ void ParticleSimulationManagerFactory::saveToFileImpl(
   this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
 }
 
+// Archive the object to a stream (implementation)
+void ParticleSimulationManagerFactory::saveToStreamImpl(
+                                           std::ostream& os,
+                                           const std::string& extension ) const
+{
+  // The bpos pointer must be NULL (see saveToFileImpl)
+  const boost::archive::detail::basic_pointer_oserializer* zaid_bpos =
+    this->resetBposPointer<Data::ZAID>( extension );
+
+  BaseArchivableObjectType::saveToStreamImpl( os, extension );
+
+  this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
+}
+
 // Set the weight windows that will be used by the manager
 void ParticleSimulationManagerFactory::setPopulationControl(
                     const std::shared_ptr<PopulationControl>& population_controller )
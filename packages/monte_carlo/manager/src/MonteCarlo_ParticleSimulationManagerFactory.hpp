@@ -94,6 +94,10 @@ protected:
   void saveToFileImpl( const boost::filesystem::path& archive_name_with_path,
                        const bool overwrite ) const final override;
 
+  //! Archive the object to a stream (implementation)
+  void saveToStreamImpl( std::ostream& os,
+                         const std::string& extension ) const final override;
+
 private:
 
   //! Archive constructor
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <functional>
+#include <cmath>
 #include <type_traits>
 
 //! Log lost particle details
@@ -126,6 +127,64 @@ struct RaySafetyHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo:
   }
 };
 
+//! \brief The Probe Ray Tracing Helper class
+template<typename State, typename Enabled=void>
+struct ProbeRayTracingHelper
+{
+  //! Check if the probes created in collisions will be ray traced
+  static inline bool isProbeRayTracingModeOn( const SimulationProperties& )
+  {
+    return false;
+  }
+
+  //! Check if the particle will be ray traced instead of transported
+  static inline bool isRayTracedProbe( const State&,
+                                       const SimulationProperties& )
+  {
+    return false;
+  }
+
+  //! Clone the probe (the clone will have the same activation status)
+  static inline State* cloneProbe( const State& particle )
+  {
+    return particle.clone();
+  }
+};
+
+//! \brief The Probe Ray Tracing Helper class
+template<typename State>
+struct ProbeRayTracingHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo::AdjointPhotonState,State>::value>::type>
+{
+  //! Check if the probes created in collisions will be ray traced
+  static inline bool isProbeRayTracingModeOn(
+                                      const SimulationProperties& properties )
+  {
+    return properties.isAdjointPhotonProbeRayTracingModeOn();
+  }
+
+  //! Check if the particle will be ray traced instead of transported
+  static inline bool isRayTracedProbe( const State& particle,
+                                       const SimulationProperties& properties )
+  {
+    return particle.isProbe() &&
+      properties.isAdjointPhotonProbeRayTracingModeOn();
+  }
+
+  //! Clone the probe (the clone will have the same activation status)
+  static inline State* cloneProbe( const State& particle )
+  {
+    State* probe_clone = particle.clone();
+
+    const MonteCarlo::AdjointPhotonProbeState* probe =
+      dynamic_cast<const MonteCarlo::AdjointPhotonProbeState*>( &particle );
+
+    if( probe && probe->isActive() )
+      dynamic_cast<MonteCarlo::AdjointPhotonProbeState*>( probe_clone )->activate();
+
+    return probe_clone;
+  }
+};
+
 } // end Details namespace
 
 // Simulate a resolved particle
@@ -184,6 +243,14 @@ void ParticleSimulationManager::simulateParticleImpl(
   // Resolve the particle state
   State& particle = dynamic_cast<State&>( unresolved_particle );
 
+  // Probes only need to be ray traced (when requested)
+  if( Details::ProbeRayTracingHelper<State>::isRayTracedProbe( particle, *d_properties ) )
+  {
+    this->simulateProbeRay( particle, bank, source_particle );
+
+    return;
+  }
+
   // Simulate a particle subtrack of random optical path length starting from a
   // source point
   if( source_particle )
@@ -304,7 +371,7 @@ void ParticleSimulationManager::simulateParticleTrack(
   while( true )
   {
     // Get the total cross section for the cell
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoid<State>( particle ) )
     {
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
@@ -335,7 +402,7 @@ void ParticleSimulationManager::simulateParticleTrack(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCell( particle ) )
       {
         particle.setAsGone();
 
@@ -454,7 +521,7 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
     // Get the total cross section for the cell and the distance to collision
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoid<State>( particle ) )
     {
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
@@ -520,7 +587,7 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCell( particle ) )
       {
         particle.setAsGone();
 
@@ -568,6 +635,197 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
 }
 
+// Simulate a resolved probe particle by ray tracing it to the boundary
+/*! \details The uncollided probe weight will be attenuated by the total
+ * cross section of each cell that the probe passes through. The observers
+ * will be updated with the expected probe weight over each cell subtrack
+ * (w*(1-exp(-op))/op) and with the transmitted probe weight (w*exp(-op)) at
+ * each surface crossing. A collision site is also sampled along the ray
+ * exactly as it would be for a transported probe. A copy of the probe will
+ * collide at this site and, if it survives (e.g. coherent scattering), it
+ * will be ray traced from the collision site.
+ */
+template<typename State>
+void ParticleSimulationManager::simulateProbeRay(
+                                              State& particle,
+                                              ParticleBank& bank,
+                                              const bool starting_from_source )
+{
+  // The probe weight at the start of the current cell subtrack
+  double cell_entering_weight = particle.getWeight();
+
+  // The weight that the probe would have if it were transported (only the
+  // weight roulette can change it)
+  double analog_weight = particle.getWeight();
+
+  // The optical path to the sampled collision site
+  double remaining_track_op =
+    d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+
+  // Surface information
+  Geometry::Model::EntityId surface_hit;
+  double distance_to_surface_hit;
+  double surface_normal[3];
+
+  // Cell information
+  double cell_total_macro_cross_section;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+  }
+
+  // Ray trace until the particle exits the geometry
+  while( true )
+  {
+    double track_start_point[3] = {particle.getXPosition(),
+                                   particle.getYPosition(),
+                                   particle.getZPosition()};
+
+    // Fire a ray through the cell currently containing the particle
+    try{
+      distance_to_surface_hit =
+        particle.navigator().fireRay( surface_hit ).value();
+    }
+    CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+    // Get the total cross section for the cell
+    if( !d_model->isCellVoid<State>( particle ) )
+    {
+      cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+    }
+    else
+      cell_total_macro_cross_section = 0.0;
+
+    const double op_to_surface_hit =
+      distance_to_surface_hit*cell_total_macro_cross_section;
+
+    // A collision occurs in this cell
+    if( remaining_track_op < op_to_surface_hit )
+    {
+      this->collideProbe( particle,
+                          bank,
+                          analog_weight,
+                          remaining_track_op/cell_total_macro_cross_section );
+
+      remaining_track_op = std::numeric_limits<double>::infinity();
+    }
+    else
+      remaining_track_op -= op_to_surface_hit;
+
+    // Set the expected probe weight over the cell subtrack
+    if( op_to_surface_hit > 0.0 )
+    {
+      particle.setWeight( -cell_entering_weight*
+                          std::expm1( -op_to_surface_hit )/op_to_surface_hit );
+    }
+
+    // Advance the particle to the cell boundary
+    // Note: this will change the particle's cell
+    Geometry::Model::EntityId start_cell = particle.getCell();
+
+    bool reflected;
+
+    try{
+      reflected = particle.navigator().advanceToCellBoundary( surface_normal );
+    }
+    CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+    // Update the observers: particle subtrack ending in cell event
+    d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
+                                                     particle,
+                                                     start_cell,
+                                                     distance_to_surface_hit );
+
+    // Update the observers: particle subtrack ending global event
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+    // Set the probe weight that is transmitted through the cell
+    const double transmitted_weight =
+      cell_entering_weight*std::exp( -op_to_surface_hit );
+
+    particle.setWeight( transmitted_weight );
+
+    // Update the observers: particle leaving cell event
+    d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
+
+    // Update the observers: particle crossing surface event
+    d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+                                                              particle,
+                                                              surface_hit,
+                                                              surface_normal );
+
+    if( reflected )
+    {
+      d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+                                                              particle,
+                                                              surface_hit,
+                                                              surface_normal );
+    }
+
+    // Update the observers: particle entering cell event
+    d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+
+    // The particle has exited the geometry or the probe has been absorbed
+    if( d_model->isTerminationCell( particle ) ||
+        particle.getWeight() == 0.0 )
+    {
+      particle.setAsGone();
+
+      break;
+    }
+
+    // Roulette the particle if it is below the threshold weight
+    d_weight_roulette->rouletteParticleWeight( particle );
+
+    if( !particle )
+      break;
+
+    cell_entering_weight = particle.getWeight();
+
+    // The roulette also changes the weight of the collided probe
+    analog_weight *= cell_entering_weight/transmitted_weight;
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
+// Collide a copy of a ray traced probe at a collision site
+/*! \details The copy will have the weight that the probe would have if it
+ * were transported. If it survives the collision (e.g. coherent scattering)
+ * it will be ray traced from the collision site.
+ */
+template<typename State>
+void ParticleSimulationManager::collideProbe(
+                                         const State& particle,
+                                         ParticleBank& bank,
+                                         const double weight,
+                                         const double distance_to_collision )
+{
+  std::unique_ptr<State> collided_particle(
+              Details::ProbeRayTracingHelper<State>::cloneProbe( particle ) );
+
+  // Advance the copy to the collision site
+  collided_particle->navigator().advanceBySubstep( *Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( &distance_to_collision ) );
+
+  collided_particle->setWeight( weight );
+
+  this->collideWithCellMaterial( *collided_particle, bank );
+
+  if( *collided_particle )
+    this->simulateProbeRay( *collided_particle, bank, false );
+  else
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( *collided_particle );
+}
+
 // Advance a particle to the cell boundary
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
@@ -638,12 +896,37 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
 }
 
 // Collide with the cell material
+/*! \details When the adjoint photon probe ray tracing mode is on, the probe
+ * rays created in the collision will be traced from the collision site
+ * instead of being banked.
+ */
 template<typename State>
 void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                                          ParticleBank& bank )
 {
-  ParticleBank local_bank;
+  if( Details::ProbeRayTracingHelper<State>::isProbeRayTracingModeOn( *d_properties ) )
+  {
+    AdjointPhotonProbeRayTracingBank local_bank(
+                 [this, &bank]( const AdjointPhotonState& adjoint_photon,
+                                const AdjointPhotonProbeRay& probe_ray )
+                 { this->traceProbeRay( adjoint_photon, probe_ray, bank ); } );
+
+    this->collideWithCellMaterial( particle, local_bank, bank );
+  }
+  else
+  {
+    ParticleBank local_bank;
+
+    this->collideWithCellMaterial( particle, local_bank, bank );
+  }
+}
 
+// Collide with the cell material and handle the progeny in the local bank
+template<typename State>
+void ParticleSimulationManager::collideWithCellMaterial( State& particle,
+                                                         ParticleBank& local_bank,
+                                                         ParticleBank& bank )
+{
   // Undergo a collision with the material in the cell
   try{
     d_collision_kernel->collideWithCellMaterial( particle, local_bank );
@@ -757,6 +757,73 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with adaptive batching
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall_adaptive )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 10 );
+    properties->setAdaptiveBatchingModeOn();
+    properties->setNumberOfProcessesPerWorkGroup( 2 );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+  
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+  
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+  
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+  
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  if( Utility::GlobalMPISession::rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 10 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 0 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation summary can be printed
 FRENSIE_UNIT_TEST( ParticleSimulationManager, printSimulationSummary )
@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHistoryScheduler.cpp
+//! \author Alex Robinson
+//! \brief  History scheduler unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryScheduler.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the number of threads can be returned
+FRENSIE_UNIT_TEST( HistoryScheduler, getNumberOfThreads )
+{
+  MonteCarlo::HistoryScheduler scheduler( 3 );
+
+  FRENSIE_CHECK_EQUAL( scheduler.getNumberOfThreads(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that history chunks can be returned
+FRENSIE_UNIT_TEST( HistoryScheduler, getNextHistoryChunk )
+{
+  MonteCarlo::HistoryScheduler scheduler( 2 );
+
+  scheduler.assignHistories( 10, 30 );
+
+  uint64_t chunk_start_history, chunk_end_history;
+
+  // The first chunk is a quarter of the thread's range
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 0, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 10 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 12 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 1, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 20 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 22 );
+
+  // The chunks become smaller as the range is exhausted
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 0, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 12 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 14 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 0, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 14 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 15 );
+
+  FRENSIE_CHECK_EQUAL( scheduler.getNumberOfSteals( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( scheduler.getNumberOfSteals( 1 ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a thread will steal histories once its range is empty
+FRENSIE_UNIT_TEST( HistoryScheduler, getNextHistoryChunk_steal )
+{
+  MonteCarlo::HistoryScheduler scheduler( 2 );
+
+  scheduler.assignHistories( 0, 16 );
+
+  uint64_t chunk_start_history, chunk_end_history;
+
+  // Exhaust the range of thread 0
+  uint64_t number_of_histories = 0;
+
+  while( number_of_histories < 8 )
+  {
+    FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 0, chunk_start_history, chunk_end_history ) );
+
+    number_of_histories += chunk_end_history - chunk_start_history;
+  }
+
+  FRENSIE_CHECK_EQUAL( number_of_histories, 8 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 8 );
+
+  // The back half of the range of thread 1 will be stolen
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 0, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 12 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 13 );
+  FRENSIE_CHECK_EQUAL( scheduler.getNumberOfSteals( 0 ), 1 );
+
+  FRENSIE_REQUIRE( scheduler.getNextHistoryChunk( 1, chunk_start_history, chunk_end_history ) );
+  FRENSIE_CHECK_EQUAL( chunk_start_history, 8 );
+  FRENSIE_CHECK_EQUAL( chunk_end_history, 9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every history will be returned exactly once
+FRENSIE_UNIT_TEST( HistoryScheduler, getNextHistoryChunk_all )
+{
+  MonteCarlo::HistoryScheduler
+    scheduler( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  std::vector<int> history_counts( 1000, 0 );
+
+  for( uint64_t i = 0; i < 4; ++i )
+  {
+    scheduler.assignHistories( 250*i, 250*(i+1) );
+
+    #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+    {
+      uint64_t chunk_start_history, chunk_end_history;
+
+      while( scheduler.getNextHistoryChunk( Utility::OpenMPProperties::getThreadId(),
+                                            chunk_start_history,
+                                            chunk_end_history ) )
+      {
+        // Each history is only returned to a single thread
+        for( uint64_t history = chunk_start_history; history < chunk_end_history; ++history )
+          ++history_counts[history];
+      }
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( history_counts, std::vector<int>( 1000, 1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an empty history range can be assigned
+FRENSIE_UNIT_TEST( HistoryScheduler, assignHistories_empty )
+{
+  MonteCarlo::HistoryScheduler scheduler( 4 );
+
+  scheduler.assignHistories( 5, 5 );
+
+  uint64_t chunk_start_history, chunk_end_history;
+
+  for( unsigned i = 0; i < 4; ++i )
+  {
+    FRENSIE_CHECK( !scheduler.getNextHistoryChunk( i, chunk_start_history, chunk_end_history ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstHistoryScheduler.cpp
+//---------------------------------------------------------------------------//
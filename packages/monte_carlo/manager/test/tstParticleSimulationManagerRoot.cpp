@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParticleSimulationManagerRoot.cpp
+//! \author Alex Robinson
+//! \brief  The particle simulation manager unit tests (Root geometry)
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_RootModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using Utility::Units::MeV;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::string test_root_geom_file_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const Geometry::Model> unfilled_model;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> particle_distribution;
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+// Create the adjoint photon properties
+std::shared_ptr<MonteCarlo::SimulationProperties>
+createAdjointPhotonProperties( const bool ray_trace_probes )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::ADJOINT_PHOTON_MODE );
+  properties->setNumberOfHistories( 10000 );
+
+  if( ray_trace_probes )
+    properties->setAdjointPhotonProbeRayTracingModeOn();
+  else
+    properties->setAdjointPhotonProbeRayTracingModeOff();
+
+  return properties;
+}
+
+// Create the adjoint photon source (one probe at 1 MeV per history)
+std::shared_ptr<MonteCarlo::ParticleSource> createAdjointPhotonSource()
+{
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+    source_component( new MonteCarlo::StandardAdjointPhotonSourceComponent(
+                                                       0,
+                                                       1.0,
+                                                       unfilled_model,
+                                                       particle_distribution,
+                                                       {1.0} ) );
+
+  return std::shared_ptr<MonteCarlo::ParticleSource>(
+                   new MonteCarlo::StandardParticleSource( {source_component} ) );
+}
+
+// Run an adjoint photon simulation and return the sphere flux
+double runAdjointPhotonSimulation( const bool ray_trace_probes,
+                                   const bool uncollided_only )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createAdjointPhotonProperties( ray_trace_probes );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                   new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        true ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                                   0, 1.0, {2}, {1.0} ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ADJOINT_PHOTON} ) );
+
+  if( uncollided_only )
+    estimator->setDiscretization<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION>( std::vector<unsigned>( {0u} ) );
+
+  event_handler->addEstimator( estimator );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory(
+            new MonteCarlo::ParticleSimulationManagerFactory(
+                                                 model,
+                                                 createAdjointPhotonSource(),
+                                                 event_handler,
+                                                 properties,
+                                                 "test_sim",
+                                                 "xml",
+                                                 1 ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory->getManager();
+
+  manager->runSimulation();
+
+  return estimator->getEntityBinDataFirstMoments( 2 )[0];
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that ray traced probes score the same uncollided track-length flux
+// as transported probes
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_adjoint_photon_probe_ray_tracing )
+{
+  double transported_flux = runAdjointPhotonSimulation( false, true );
+  double ray_traced_flux = runAdjointPhotonSimulation( true, true );
+
+  FRENSIE_CHECK( transported_flux > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( ray_traced_flux, transported_flux, 0.02 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that ray traced probes keep the collided (coherent scattering)
+// track-length flux contributions
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_adjoint_photon_probe_ray_tracing_collided )
+{
+  double uncollided_flux = runAdjointPhotonSimulation( true, true );
+  double transported_flux = runAdjointPhotonSimulation( false, false );
+  double ray_traced_flux = runAdjointPhotonSimulation( true, false );
+
+  FRENSIE_CHECK( ray_traced_flux >= uncollided_flux );
+  FRENSIE_CHECK_FLOATING_EQUALITY( ray_traced_flux, transported_flux, 0.02 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_root_file",
+                                        test_root_geom_file_name, "",
+                                        "Test ROOT file name" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& h_properties =
+      database.getAtomProperties( 1001 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& h_definition =
+      scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+    h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointPhotoatomicDataProperties(
+          h_properties.getSharedAdjointPhotoatomicDataProperties(
+                Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    material_definition_database->addDefinition( "H1 @ 293.6K", 1,
+                                                 {"H1 @ 293.6K"}, {1.0} );
+  }
+
+  {
+    Geometry::RootModelProperties local_properties( test_root_geom_file_name );
+    local_properties.setMaterialPropertyName( "mat" );
+
+    std::shared_ptr<Geometry::RootModel> local_model =
+      Geometry::RootModel::getInstance();
+
+    local_model->initialize( local_properties );
+
+    unfilled_model = local_model;
+  }
+
+  {
+    std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+      tmp_particle_distribution( new MonteCarlo::StandardParticleDistribution( "test dist" ) );
+
+    tmp_particle_distribution->constructDimensionDistributionDependencyTree();
+
+    particle_distribution = tmp_particle_distribution;
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstParticleSimulationManagerRoot.cpp
+//---------------------------------------------------------------------------//
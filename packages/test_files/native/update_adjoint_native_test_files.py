@@ -43,6 +43,9 @@ generator_h.setDefaultPhotonGridConvergenceTolerance( 1e-3 )
 generator_h.setDefaultPhotonGridAbsoluteDifferenceTolerance( 1e-42 )
 generator_h.setDefaultPhotonGridDistanceTolerance( 1e-16 )
 
+# Evaluate the grid refinement midpoints concurrently
+generator_h.setParallelGridRefinementModeOn()
+
 generator_h.setPhotonThresholdEnergyNudgeFactor( 1.0001 )
 generator_h.setAdjointPairProductionEnergyDistNormConstantEvaluationTolerance( 1e-3 )
 generator_h.setAdjointPairProductionEnergyDistNormConstantNudgeValue( 1e-6 )
@@ -0,0 +1,26 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ArchiveMutex.cpp
+//! \author Alex Robinson
+//! \brief  Archive mutex definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_ArchiveMutex.hpp"
+
+namespace Utility{
+
+// Return the archive mutex
+std::mutex& getArchiveMutex()
+{
+  static std::mutex archive_mutex;
+
+  return archive_mutex;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_ArchiveMutex.cpp
+//---------------------------------------------------------------------------//
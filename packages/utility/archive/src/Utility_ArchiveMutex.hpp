@@ -0,0 +1,33 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ArchiveMutex.hpp
+//! \author Alex Robinson
+//! \brief  Archive mutex declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_ARCHIVE_MUTEX_HPP
+#define UTILITY_ARCHIVE_MUTEX_HPP
+
+// Std Lib Includes
+#include <mutex>
+
+namespace Utility{
+
+/*! Return the archive mutex
+ *
+ * \details The archivable objects reset and restore the process-global
+ * boost::serialization pointer serializer (bpis/bpos) pointers while they are
+ * loaded from or saved to an archive. This mutex guards the reset and restore
+ * of these pointers only - it is never held while an archive is being read
+ * or written, so objects can be loaded and saved concurrently.
+ */
+std::mutex& getArchiveMutex();
+
+} // end Utility namespace
+
+#endif // end UTILITY_ARCHIVE_MUTEX_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_ArchiveMutex.hpp
+//---------------------------------------------------------------------------//
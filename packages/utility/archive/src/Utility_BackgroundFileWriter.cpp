@@ -0,0 +1,392 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_BackgroundFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Background file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_BackgroundFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+BackgroundFileWriter::BufferStream::BufferStream()
+  : std::ostream( NULL ),
+    d_stream_buffer()
+{
+  this->rdbuf( &d_stream_buffer );
+}
+
+// Release the buffer (the stream will start a new, empty buffer)
+/*! \details The released buffer holds everything that has been written to
+ * the stream since it was constructed (or since the buffer was last
+ * released).
+ */
+std::shared_ptr<const std::string>
+BackgroundFileWriter::BufferStream::releaseBuffer()
+{
+  this->flush();
+
+  return d_stream_buffer.releaseString();
+}
+
+// Constructor
+BackgroundFileWriter::BufferStream::StringStreamBuffer::StringStreamBuffer()
+  : d_string( new std::string )
+{
+  this->setPutArea( 0 );
+}
+
+// Release the string (a new, empty string will be started)
+std::shared_ptr<std::string>
+BackgroundFileWriter::BufferStream::StringStreamBuffer::releaseString()
+{
+  // Remove the unused part of the string
+  d_string->resize( this->pptr() - this->pbase() );
+
+  std::shared_ptr<std::string> released_string( d_string );
+
+  d_string.reset( new std::string );
+
+  this->setPutArea( 0 );
+
+  return released_string;
+}
+
+// Grow the string when the put area is full
+auto BackgroundFileWriter::BufferStream::StringStreamBuffer::overflow(
+                                         int_type character ) -> int_type
+{
+  const size_t number_of_used_characters = this->pptr() - this->pbase();
+
+  // The capacity is doubled so that the amortized cost of writing a
+  // character is constant
+  d_string->resize( std::max( 2*d_string->size(), (size_t)4096 ) );
+
+  this->setPutArea( number_of_used_characters );
+
+  if( !traits_type::eq_int_type( character, traits_type::eof() ) )
+  {
+    *this->pptr() = traits_type::to_char_type( character );
+
+    this->pbump( 1 );
+
+    return character;
+  }
+  else
+    return traits_type::not_eof( character );
+}
+
+// Set the put area to the unused part of the string
+void BackgroundFileWriter::BufferStream::StringStreamBuffer::setPutArea(
+                                     const size_t number_of_used_characters )
+{
+  char* begin = &(*d_string)[0];
+
+  this->setp( begin, begin + d_string->size() );
+
+  // The put pointer can only be advanced by an int at a time
+  size_t remaining_characters = number_of_used_characters;
+
+  while( remaining_characters > 0 )
+  {
+    const int step = (int)std::min( remaining_characters,
+                                    (size_t)std::numeric_limits<int>::max() );
+
+    this->pbump( step );
+
+    remaining_characters -= step;
+  }
+}
+
+// Get the temporary file name that will be used to write a file
+/*! \details The temporary file will be in the same directory as the file
+ * (renaming a file within a file system is atomic) and it will have the
+ * same extension as the file (the extension is used to determine archive
+ * types).
+ */
+boost::filesystem::path BackgroundFileWriter::getTemporaryFileName(
+                                     const boost::filesystem::path& file_name )
+{
+  boost::filesystem::path temporary_file_name( file_name.parent_path() );
+
+  temporary_file_name /= file_name.stem().string() + ".partial" +
+    file_name.extension().string();
+
+  return temporary_file_name;
+}
+
+// Replace a file with a file that has already been written
+/*! \details The file will be replaced with a single rename so it will
+ * always contain either its previous contents or the new contents.
+ */
+void BackgroundFileWriter::replaceFile(
+                            const boost::filesystem::path& written_file_name,
+                            const boost::filesystem::path& file_name )
+{
+  boost::system::error_code error;
+
+  boost::filesystem::rename( written_file_name, file_name, error );
+
+  TEST_FOR_EXCEPTION( error.value() != 0,
+                      std::runtime_error,
+                      "Could not replace file " << file_name.string() <<
+                      " with file " << written_file_name.string() << ": "
+                      << error.message() );
+}
+
+// Constructor
+BackgroundFileWriter::BackgroundFileWriter(
+                                   const size_t max_number_of_pending_writes )
+  : d_max_number_of_pending_writes( max_number_of_pending_writes ),
+    d_pending_writes(),
+    d_mutex(),
+    d_write_submitted(),
+    d_write_completed(),
+    d_error_message(),
+    d_stop( false ),
+    d_thread()
+{
+  // Make sure that at least one write can be pending
+  testPrecondition( max_number_of_pending_writes > 0 );
+}
+
+// Destructor (the pending writes will be completed)
+BackgroundFileWriter::~BackgroundFileWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock( d_mutex );
+
+    d_stop = true;
+  }
+
+  d_write_submitted.notify_all();
+
+  if( d_thread.joinable() )
+    d_thread.join();
+}
+
+// Get the maximum number of pending writes
+size_t BackgroundFileWriter::getMaxNumberOfPendingWrites() const
+{
+  return d_max_number_of_pending_writes;
+}
+
+// Get the number of pending writes
+size_t BackgroundFileWriter::getNumberOfPendingWrites() const
+{
+  std::lock_guard<std::mutex> lock( d_mutex );
+
+  return d_pending_writes.size();
+}
+
+// Write a buffer to a file
+/*! \details The buffer must not be modified until the write has been
+ * completed. If the maximum number of writes are pending this method will
+ * block until the oldest pending write has been completed. An exception will
+ * be thrown if a previous write has failed.
+ */
+void BackgroundFileWriter::write(
+                             const boost::filesystem::path& file_name,
+                             const std::shared_ptr<const std::string>& buffer )
+{
+  // Make sure that the buffer is valid
+  testPrecondition( buffer.get() );
+
+  PendingWrite pending_write = {file_name, buffer, false};
+
+  this->submit( pending_write );
+}
+
+// Append a buffer to a file
+/*! \details The file will be created if it does not exist. Unlike
+ * Utility::BackgroundFileWriter::write, the file is not replaced atomically.
+ * The buffer must not be modified until the write has been completed. If the
+ * maximum number of writes are pending this method will block until the
+ * oldest pending write has been completed. An exception will be thrown if a
+ * previous write has failed.
+ */
+void BackgroundFileWriter::append(
+                             const boost::filesystem::path& file_name,
+                             const std::shared_ptr<const std::string>& buffer )
+{
+  // Make sure that the buffer is valid
+  testPrecondition( buffer.get() );
+
+  PendingWrite pending_write = {file_name, buffer, true};
+
+  this->submit( pending_write );
+}
+
+// Submit a write (blocks if the maximum number of writes are pending)
+void BackgroundFileWriter::submit( const PendingWrite& pending_write )
+{
+  {
+    std::unique_lock<std::mutex> lock( d_mutex );
+
+    this->throwIfWriteFailed();
+
+    while( d_pending_writes.size() >= d_max_number_of_pending_writes )
+    {
+      d_write_completed.wait( lock );
+
+      this->throwIfWriteFailed();
+    }
+
+    d_pending_writes.push_back( pending_write );
+
+    if( !d_thread.joinable() )
+    {
+      d_thread = std::thread( &BackgroundFileWriter::writePendingFiles, this );
+    }
+  }
+
+  d_write_submitted.notify_one();
+}
+
+// Wait for the pending writes to be completed
+/*! \details An exception will be thrown if a write has failed.
+ */
+void BackgroundFileWriter::waitForPendingWrites()
+{
+  std::unique_lock<std::mutex> lock( d_mutex );
+
+  while( !d_pending_writes.empty() )
+    d_write_completed.wait( lock );
+
+  this->throwIfWriteFailed();
+}
+
+// Write a buffer to a file (called by the background thread)
+void BackgroundFileWriter::writeFile( const boost::filesystem::path& file_name,
+                                      const std::string& buffer )
+{
+  const boost::filesystem::path temporary_file_name =
+    BackgroundFileWriter::getTemporaryFileName( file_name );
+
+  {
+    std::ofstream file( temporary_file_name.string().c_str(),
+                        std::ofstream::binary | std::ofstream::trunc );
+
+    TEST_FOR_EXCEPTION( !file.is_open(),
+                        std::runtime_error,
+                        "Could not open file "
+                        << temporary_file_name.string() << "!" );
+
+    file.write( buffer.data(), buffer.size() );
+    file.flush();
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Could not write file "
+                        << temporary_file_name.string() << "!" );
+  }
+
+  BackgroundFileWriter::replaceFile( temporary_file_name, file_name );
+}
+
+// Append a buffer to a file (called by the background thread)
+void BackgroundFileWriter::appendFile(
+                                      const boost::filesystem::path& file_name,
+                                      const std::string& buffer )
+{
+  std::ofstream file( file_name.string().c_str(),
+                      std::ofstream::binary | std::ofstream::app );
+
+  TEST_FOR_EXCEPTION( !file.is_open(),
+                      std::runtime_error,
+                      "Could not open file " << file_name.string() << "!" );
+
+  file.write( buffer.data(), buffer.size() );
+  file.flush();
+
+  TEST_FOR_EXCEPTION( !file.good(),
+                      std::runtime_error,
+                      "Could not append to file " << file_name.string() <<
+                      "!" );
+}
+
+// Write the pending files (background thread loop)
+/*! \details The pending write is only removed from the queue once it has
+ * been completed so that the number of pending writes includes the write
+ * that is in progress.
+ */
+void BackgroundFileWriter::writePendingFiles()
+{
+  std::unique_lock<std::mutex> lock( d_mutex );
+
+  while( true )
+  {
+    while( d_pending_writes.empty() && !d_stop )
+      d_write_submitted.wait( lock );
+
+    if( d_pending_writes.empty() )
+      break;
+
+    const PendingWrite pending_write = d_pending_writes.front();
+
+    lock.unlock();
+
+    // Exceptions cannot propagate out of the background thread
+    std::string error_message;
+
+    try{
+      if( pending_write.append )
+      {
+        BackgroundFileWriter::appendFile( pending_write.file_name,
+                                          *pending_write.buffer );
+      }
+      else
+      {
+        BackgroundFileWriter::writeFile( pending_write.file_name,
+                                         *pending_write.buffer );
+      }
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+
+    lock.lock();
+
+    if( !error_message.empty() && d_error_message.empty() )
+      d_error_message = error_message;
+
+    d_pending_writes.pop_front();
+
+    d_write_completed.notify_all();
+  }
+}
+
+// Throw an exception if a write has failed (the mutex must be locked)
+void BackgroundFileWriter::throwIfWriteFailed()
+{
+  if( !d_error_message.empty() )
+  {
+    std::string error_message;
+    error_message.swap( d_error_message );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "A background file write failed: " << error_message );
+  }
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_BackgroundFileWriter.cpp
+//---------------------------------------------------------------------------//
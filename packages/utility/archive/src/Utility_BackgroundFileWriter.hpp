@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_BackgroundFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  Background file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_BACKGROUND_FILE_WRITER_HPP
+#define UTILITY_BACKGROUND_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <deque>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The background file writer
+ *
+ * \details Buffers that have already been filled (e.g. an archive that was
+ * written to a std::ostringstream) are written to their files by a
+ * background thread so that the thread that filled the buffer can continue
+ * working. Every file is written to a temporary file in the same directory
+ * first (see Utility::BackgroundFileWriter::getTemporaryFileName), which is
+ * then renamed to the requested file name. If a write fails or the program
+ * crashes during a write the previous version of the file will not be
+ * affected. The files are written in the order that they were submitted.
+ * Buffers can also be appended to a file (e.g. a stream of fixed size
+ * records), in which case the file is not replaced. The number of pending
+ * writes is bounded - submitting a write once the
+ * bound has been reached will block until the oldest pending write has been
+ * completed. The background thread is only started when the first write is
+ * submitted. Buffers can be filled without an extra copy using a
+ * Utility::BackgroundFileWriter::BufferStream.
+ */
+class BackgroundFileWriter
+{
+
+public:
+
+  /*! The output stream that fills a buffer for a background write
+   *
+   * \details The stream writes directly into a buffer that can be released
+   * and handed to the writer (see Utility::BackgroundFileWriter::write)
+   * without being copied, unlike a std::ostringstream whose contents can
+   * only be copied out of the stream.
+   */
+  class BufferStream : public std::ostream
+  {
+
+  public:
+
+    //! Constructor
+    BufferStream();
+
+    //! Destructor
+    ~BufferStream()
+    { /* ... */ }
+
+    //! Release the buffer (the stream will start a new, empty buffer)
+    std::shared_ptr<const std::string> releaseBuffer();
+
+  private:
+
+    // The stream buffer that writes into a string
+    class StringStreamBuffer : public std::streambuf
+    {
+
+    public:
+
+      // Constructor
+      StringStreamBuffer();
+
+      // Release the string (a new, empty string will be started)
+      std::shared_ptr<std::string> releaseString();
+
+    protected:
+
+      // Grow the string when the put area is full
+      int_type overflow( int_type character ) override;
+
+    private:
+
+      // Set the put area to the unused part of the string
+      void setPutArea( const size_t number_of_used_characters );
+
+      // The string
+      std::shared_ptr<std::string> d_string;
+    };
+
+    // The stream buffer
+    StringStreamBuffer d_stream_buffer;
+  };
+
+  //! Get the temporary file name that will be used to write a file
+  static boost::filesystem::path getTemporaryFileName(
+                                    const boost::filesystem::path& file_name );
+
+  //! Replace a file with a file that has already been written
+  static void replaceFile( const boost::filesystem::path& written_file_name,
+                           const boost::filesystem::path& file_name );
+
+  //! Constructor
+  BackgroundFileWriter( const size_t max_number_of_pending_writes );
+
+  //! Destructor (the pending writes will be completed)
+  ~BackgroundFileWriter();
+
+  //! Get the maximum number of pending writes
+  size_t getMaxNumberOfPendingWrites() const;
+
+  //! Get the number of pending writes
+  size_t getNumberOfPendingWrites() const;
+
+  //! Write a buffer to a file
+  void write( const boost::filesystem::path& file_name,
+              const std::shared_ptr<const std::string>& buffer );
+
+  //! Append a buffer to a file
+  void append( const boost::filesystem::path& file_name,
+               const std::shared_ptr<const std::string>& buffer );
+
+  //! Wait for the pending writes to be completed
+  void waitForPendingWrites();
+
+private:
+
+  // The pending write
+  struct PendingWrite
+  {
+    // The file name
+    boost::filesystem::path file_name;
+
+    // The buffer
+    std::shared_ptr<const std::string> buffer;
+
+    // Records if the buffer should be appended to the file
+    bool append;
+  };
+
+  // Submit a write (blocks if the maximum number of writes are pending)
+  void submit( const PendingWrite& pending_write );
+
+  // Write a buffer to a file (called by the background thread)
+  static void writeFile( const boost::filesystem::path& file_name,
+                         const std::string& buffer );
+
+  // Append a buffer to a file (called by the background thread)
+  static void appendFile( const boost::filesystem::path& file_name,
+                          const std::string& buffer );
+
+  // Write the pending files (background thread loop)
+  void writePendingFiles();
+
+  // Throw an exception if a write has failed (the mutex must be locked)
+  void throwIfWriteFailed();
+
+  // The maximum number of pending writes
+  size_t d_max_number_of_pending_writes;
+
+  // The pending writes (the front write is the one in progress)
+  std::deque<PendingWrite> d_pending_writes;
+
+  // The pending writes mutex
+  mutable std::mutex d_mutex;
+
+  // The write submitted condition
+  std::condition_variable d_write_submitted;
+
+  // The write completed condition
+  std::condition_variable d_write_completed;
+
+  // The first write error message (empty if no write has failed)
+  std::string d_error_message;
+
+  // Records if the background thread should stop
+  bool d_stop;
+
+  // The background thread
+  std::thread d_thread;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_BACKGROUND_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_BackgroundFileWriter.hpp
+//---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
+#include "Utility_ArchiveMutex.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 
@@ -96,50 +97,88 @@ void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::
   }
 }
 
-// Reset the bpis pointer
-template<typename DerivedType>
-template<typename T>
-const boost::archive::detail::basic_pointer_iserializer* IArchivableObject<DerivedType>::resetBpisPointer( const std::string& extension ) const
+namespace Details{
+
+//! The shared reset state of the bpis pointer of an archive iserializer
+template<typename Archive, typename T>
+struct BpisPointerResetState
 {
-  const boost::archive::detail::basic_pointer_iserializer* bpis;
+  //! The number of objects that currently require a NULL bpis pointer
+  static unsigned reset_count;
 
-  if( extension == ".xml" )
-  {
-    bpis = boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::xml_iarchive, T > >::get_const_instance().get_bpis_ptr();
+  //! The original bpis pointer
+  static const boost::archive::detail::basic_pointer_iserializer* bpis;
+};
 
-    if( bpis != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::xml_iarchive, T > >::get_mutable_instance().set_bpis( NULL );
-    }
-  }
-  else if( extension == ".txt" )
+template<typename Archive, typename T>
+unsigned BpisPointerResetState<Archive,T>::reset_count = 0u;
+
+template<typename Archive, typename T>
+const boost::archive::detail::basic_pointer_iserializer*
+BpisPointerResetState<Archive,T>::bpis = NULL;
+
+//! Reset the bpis pointer of an archive iserializer
+template<typename Archive, typename T>
+const boost::archive::detail::basic_pointer_iserializer* resetBpisPointer()
+{
+  typedef BpisPointerResetState<Archive,T> State;
+  typedef boost::serialization::singleton<boost::archive::detail::iserializer<Archive,T> > IserializerSingleton;
+
+  std::lock_guard<std::mutex> lock( Utility::getArchiveMutex() );
+
+  if( State::reset_count == 0u )
   {
-    bpis = boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::text_iarchive, T > >::get_const_instance().get_bpis_ptr();
+    State::bpis = IserializerSingleton::get_const_instance().get_bpis_ptr();
 
-    if( bpis != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::text_iarchive, T > >::get_mutable_instance().set_bpis( NULL );
-    }
+    if( State::bpis != NULL )
+      IserializerSingleton::get_mutable_instance().set_bpis( NULL );
   }
-  else if( extension == ".bin" )
-  {
-    bpis = boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::binary_iarchive, T > >::get_const_instance().get_bpis_ptr();
 
-    if( bpis != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::binary_iarchive, T > >::get_mutable_instance().set_bpis( NULL );
-    }
+  ++State::reset_count;
+
+  return State::bpis;
+}
+
+//! Restore the bpis pointer of an archive iserializer
+template<typename Archive, typename T>
+void restoreBpisPointer( const boost::archive::detail::basic_pointer_iserializer* bpis )
+{
+  typedef BpisPointerResetState<Archive,T> State;
+  typedef boost::serialization::singleton<boost::archive::detail::iserializer<Archive,T> > IserializerSingleton;
+
+  std::lock_guard<std::mutex> lock( Utility::getArchiveMutex() );
+
+  if( State::reset_count > 0u )
+    --State::reset_count;
+
+  if( State::reset_count == 0u && bpis != NULL )
+  {
+    IserializerSingleton::get_mutable_instance().set_bpis(
+          const_cast<boost::archive::detail::basic_pointer_iserializer*>(bpis) );
   }
+}
+
+} // end Details namespace
+
+// Reset the bpis pointer
+/*! \details The bpis pointer is shared by every object that is loaded from
+ * the same archive type. It will only be reset by the first object that
+ * requires it to be NULL and restored by the last one, which allows objects
+ * to be loaded concurrently.
+ */
+template<typename DerivedType>
+template<typename T>
+const boost::archive::detail::basic_pointer_iserializer* IArchivableObject<DerivedType>::resetBpisPointer( const std::string& extension ) const
+{
+  if( extension == ".xml" )
+    return Details::resetBpisPointer<boost::archive::xml_iarchive,T>();
+  else if( extension == ".txt" )
+    return Details::resetBpisPointer<boost::archive::text_iarchive,T>();
+  else if( extension == ".bin" )
+    return Details::resetBpisPointer<boost::archive::binary_iarchive,T>();
 #ifdef HAVE_FRENSIE_HDF5
   else if( extension == ".h5fa" )
-  {
-    bpis = boost::serialization::singleton<boost::archive::detail::iserializer<Utility::HDF5IArchive, T > >::get_const_instance().get_bpis_ptr();
-
-    if( bpis != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<Utility::HDF5IArchive, T > >::get_mutable_instance().set_bpis( NULL );
-    }
-  }
+    return Details::resetBpisPointer<Utility::HDF5IArchive,T>();
 #endif // end HAVE_FRENSIE_HDF5
   else
   {
@@ -147,8 +186,6 @@ const boost::archive::detail::basic_pointer_iserializer* IArchivableObject<Deriv
                      "Cannot reset the bpis pointer because the extension "
                      "type (" << extension << ") is not supported!" );
   }
-
-  return bpis;
 }
 
 // Restore the bpis pointer
@@ -156,33 +193,22 @@ template<typename DerivedType>
 template<typename T>
 void IArchivableObject<DerivedType>::restoreBpisPointer( const std::string& extension, const boost::archive::detail::basic_pointer_iserializer* bpis ) const
 {
-  if( bpis != NULL )
-  {
-    if( extension == ".xml" )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::xml_iarchive, T > >::get_mutable_instance().set_bpis( const_cast<boost::archive::detail::basic_pointer_iserializer*>(bpis) );
-    }
-    else if( extension == ".txt" )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::text_iarchive, T > >::get_mutable_instance().set_bpis( const_cast<boost::archive::detail::basic_pointer_iserializer*>(bpis) );
-    }
-    else if( extension == ".bin" )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::binary_iarchive, T > >::get_mutable_instance().set_bpis( const_cast<boost::archive::detail::basic_pointer_iserializer*>(bpis) );
-    }
+  if( extension == ".xml" )
+    Details::restoreBpisPointer<boost::archive::xml_iarchive,T>( bpis );
+  else if( extension == ".txt" )
+    Details::restoreBpisPointer<boost::archive::text_iarchive,T>( bpis );
+  else if( extension == ".bin" )
+    Details::restoreBpisPointer<boost::archive::binary_iarchive,T>( bpis );
 #ifdef HAVE_FRENSIE_HDF5
-    else if( extension == ".h5fa" )
-    {
-      boost::serialization::singleton<boost::archive::detail::iserializer<Utility::HDF5IArchive, T > >::get_mutable_instance().set_bpis( const_cast<boost::archive::detail::basic_pointer_iserializer*>(bpis) );
-    }
+  else if( extension == ".h5fa" )
+    Details::restoreBpisPointer<Utility::HDF5IArchive,T>( bpis );
 #endif // end HAVE_FRENSIE_HDF5
-    else
-    {
-      THROW_EXCEPTION( std::runtime_error,
-                       "Cannot restore the bpis pointer because the "
-                       "extension type (" << extension << ") is not "
-                       "supported!" );
-    }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot restore the bpis pointer because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
   }
 }
 
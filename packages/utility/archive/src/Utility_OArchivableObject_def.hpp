@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // Must include first
+#include "Utility_ArchiveMutex.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 
@@ -77,18 +78,7 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
     oarchive_stream.reset(
                         new std::ofstream( archive_name_with_path.string() ) );
 
-    if( extension == ".xml" )
-    {
-      boost::archive::xml_oarchive archive( *oarchive_stream );
-
-      this->saveToArchive( archive );
-    }
-    else
-    {
-      boost::archive::text_oarchive archive( *oarchive_stream );
-
-      this->saveToArchive( archive );
-    }
+    this->saveToStreamImpl( *oarchive_stream, extension );
   }
   else if( extension == ".bin" )
   {
@@ -96,9 +86,7 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
     oarchive_stream.reset( new std::ofstream( archive_name_with_path.string(),
                                               std::ofstream::binary ) );
 
-    boost::archive::binary_oarchive archive( *oarchive_stream );
-
-    this->saveToArchive( archive );
+    this->saveToStreamImpl( *oarchive_stream, extension );
   }
 #ifdef HAVE_FRENSIE_HDF5
   else if( extension == ".h5fa" )
@@ -118,50 +106,135 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
   }
 }
 
-// Reset the bpos pointer
+// Archive the object to a stream
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). Archive types that can only be written to a file
+ * (e.g. .h5fa) are not supported. Binary archives should only be written to
+ * streams that were opened in binary mode.
+ */
 template<typename DerivedType>
-template<typename T>
-const boost::archive::detail::basic_pointer_oserializer* OArchivableObject<DerivedType>::resetBposPointer( const std::string& extension ) const
+void OArchivableObject<DerivedType>::saveToStream(
+                                        std::ostream& os,
+                                        const std::string& extension ) const
+{
+  this->saveToStreamImpl( os, extension );
+}
+
+// Archive the object to a stream (implementation)
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToStreamImpl(
+                                        std::ostream& os,
+                                        const std::string& extension ) const
 {
-  const boost::archive::detail::basic_pointer_oserializer* bpos;
-  
   if( extension == ".xml" )
   {
-    bpos = boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::xml_oarchive, T > >::get_const_instance().get_bpos();
-    
-    if( bpos != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::xml_oarchive, T > >::get_mutable_instance().set_bpos( NULL );
-    }
+    boost::archive::xml_oarchive archive( os );
+
+    this->saveToArchive( archive );
   }
   else if( extension == ".txt" )
   {
-    bpos = boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::text_oarchive, T > >::get_const_instance().get_bpos();
-    
-    if( bpos != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::text_oarchive, T > >::get_mutable_instance().set_bpos( NULL );
-    }
+    boost::archive::text_oarchive archive( os );
+
+    this->saveToArchive( archive );
   }
   else if( extension == ".bin" )
   {
-    bpos = boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::binary_oarchive, T > >::get_const_instance().get_bpos();
-    
-    if( bpos != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::binary_oarchive, T > >::get_mutable_instance().set_bpos( NULL );
-    }
+    boost::archive::binary_oarchive archive( os );
+
+    this->saveToArchive( archive );
   }
-#ifdef HAVE_FRENSIE_HDF5
-  else if( extension == ".h5fa" )
+  else
   {
-    bpos = boost::serialization::singleton<boost::archive::detail::oserializer<Utility::HDF5OArchive, T > >::get_const_instance().get_bpos();
-    
-    if( bpos != NULL )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<Utility::HDF5OArchive, T > >::get_mutable_instance().set_bpos( NULL );
-    }
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot create an output archive stream because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
   }
+}
+
+namespace Details{
+
+//! The shared reset state of the bpos pointer of an archive oserializer
+template<typename Archive, typename T>
+struct BposPointerResetState
+{
+  //! The number of objects that currently require a NULL bpos pointer
+  static unsigned reset_count;
+
+  //! The original bpos pointer
+  static const boost::archive::detail::basic_pointer_oserializer* bpos;
+};
+
+template<typename Archive, typename T>
+unsigned BposPointerResetState<Archive,T>::reset_count = 0u;
+
+template<typename Archive, typename T>
+const boost::archive::detail::basic_pointer_oserializer*
+BposPointerResetState<Archive,T>::bpos = NULL;
+
+//! Reset the bpos pointer of an archive oserializer
+template<typename Archive, typename T>
+const boost::archive::detail::basic_pointer_oserializer* resetBposPointer()
+{
+  typedef BposPointerResetState<Archive,T> State;
+  typedef boost::serialization::singleton<boost::archive::detail::oserializer<Archive,T> > OserializerSingleton;
+
+  std::lock_guard<std::mutex> lock( Utility::getArchiveMutex() );
+
+  if( State::reset_count == 0u )
+  {
+    State::bpos = OserializerSingleton::get_const_instance().get_bpos();
+
+    if( State::bpos != NULL )
+      OserializerSingleton::get_mutable_instance().set_bpos( NULL );
+  }
+
+  ++State::reset_count;
+
+  return State::bpos;
+}
+
+//! Restore the bpos pointer of an archive oserializer
+template<typename Archive, typename T>
+void restoreBposPointer( const boost::archive::detail::basic_pointer_oserializer* bpos )
+{
+  typedef BposPointerResetState<Archive,T> State;
+  typedef boost::serialization::singleton<boost::archive::detail::oserializer<Archive,T> > OserializerSingleton;
+
+  std::lock_guard<std::mutex> lock( Utility::getArchiveMutex() );
+
+  if( State::reset_count > 0u )
+    --State::reset_count;
+
+  if( State::reset_count == 0u && bpos != NULL )
+  {
+    OserializerSingleton::get_mutable_instance().set_bpos(
+          const_cast<boost::archive::detail::basic_pointer_oserializer*>(bpos) );
+  }
+}
+
+} // end Details namespace
+
+// Reset the bpos pointer
+/*! \details The bpos pointer is shared by every object that is saved to
+ * the same archive type. It will only be reset by the first object that
+ * requires it to be NULL and restored by the last one, which allows objects
+ * to be saved concurrently.
+ */
+template<typename DerivedType>
+template<typename T>
+const boost::archive::detail::basic_pointer_oserializer* OArchivableObject<DerivedType>::resetBposPointer( const std::string& extension ) const
+{
+  if( extension == ".xml" )
+    return Details::resetBposPointer<boost::archive::xml_oarchive,T>();
+  else if( extension == ".txt" )
+    return Details::resetBposPointer<boost::archive::text_oarchive,T>();
+  else if( extension == ".bin" )
+    return Details::resetBposPointer<boost::archive::binary_oarchive,T>();
+#ifdef HAVE_FRENSIE_HDF5
+  else if( extension == ".h5fa" )
+    return Details::resetBposPointer<Utility::HDF5OArchive,T>();
 #endif // end HAVE_FRENSIE_HDF5
   else
   {
@@ -169,8 +242,6 @@ const boost::archive::detail::basic_pointer_oserializer* OArchivableObject<Deriv
                      "Cannot reset the bpos pointer because the extension "
                      "type (" << extension << ") is not supported!" );
   }
-
-  return bpos;
 }
 
 // Restore the bpos pointer
@@ -178,33 +249,22 @@ template<typename DerivedType>
 template<typename T>
 void OArchivableObject<DerivedType>::restoreBposPointer( const std::string& extension, const boost::archive::detail::basic_pointer_oserializer* bpos ) const
 {
-  if( bpos != NULL )
-  {
-    if( extension == ".xml" )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::xml_oarchive, T > >::get_mutable_instance().set_bpos( const_cast<boost::archive::detail::basic_pointer_oserializer*>(bpos) );
-    }
-    else if( extension == ".txt" )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::text_oarchive, T > >::get_mutable_instance().set_bpos( const_cast<boost::archive::detail::basic_pointer_oserializer*>(bpos) );
-    }
-    else if( extension == ".bin" )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::binary_oarchive, T > >::get_mutable_instance().set_bpos( const_cast<boost::archive::detail::basic_pointer_oserializer*>(bpos) );
-    }
+  if( extension == ".xml" )
+    Details::restoreBposPointer<boost::archive::xml_oarchive,T>( bpos );
+  else if( extension == ".txt" )
+    Details::restoreBposPointer<boost::archive::text_oarchive,T>( bpos );
+  else if( extension == ".bin" )
+    Details::restoreBposPointer<boost::archive::binary_oarchive,T>( bpos );
 #ifdef HAVE_FRENSIE_HDF5
-    else if( extension == ".h5fa" )
-    {
-      boost::serialization::singleton<boost::archive::detail::oserializer<Utility::HDF5OArchive, T > >::get_mutable_instance().set_bpos( const_cast<boost::archive::detail::basic_pointer_oserializer*>(bpos) );
-    }
+  else if( extension == ".h5fa" )
+    Details::restoreBposPointer<Utility::HDF5OArchive,T>( bpos );
 #endif // end HAVE_FRENSIE_HDF5
-    else
-    {
-      THROW_EXCEPTION( std::runtime_error,
-                       "Cannot restore the bpos pointer because the "
-                       "extension type (" << extension << ") is not "
-                       "supported!" );
-    }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot restore the bpos pointer because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
   }
 }
 
@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstBackgroundFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Background file writer unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <fstream>
+#include <sstream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_BackgroundFileWriter.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Read the contents of a file
+std::string readFile( const std::string& file_name )
+{
+  std::ifstream file( file_name.c_str(), std::ifstream::binary );
+
+  std::ostringstream oss;
+  oss << file.rdbuf();
+
+  return oss.str();
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the temporary file name can be returned
+FRENSIE_UNIT_TEST( BackgroundFileWriter, getTemporaryFileName )
+{
+  FRENSIE_CHECK_EQUAL( Utility::BackgroundFileWriter::getTemporaryFileName( "test_rendezvous.xml" ).string(),
+                       "test_rendezvous.partial.xml" );
+  FRENSIE_CHECK_EQUAL( Utility::BackgroundFileWriter::getTemporaryFileName( "dir/test_rendezvous_1.bin" ).string(),
+                       "dir/test_rendezvous_1.partial.bin" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the maximum number of pending writes can be returned
+FRENSIE_UNIT_TEST( BackgroundFileWriter, getMaxNumberOfPendingWrites )
+{
+  Utility::BackgroundFileWriter writer( 3 );
+
+  FRENSIE_CHECK_EQUAL( writer.getMaxNumberOfPendingWrites(), 3 );
+  FRENSIE_CHECK_EQUAL( writer.getNumberOfPendingWrites(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that buffers can be written to files
+FRENSIE_UNIT_TEST( BackgroundFileWriter, write )
+{
+  const std::string file_name( "test_background_file_writer.txt" );
+
+  boost::filesystem::remove( file_name );
+
+  {
+    Utility::BackgroundFileWriter writer( 1 );
+
+    for( size_t i = 0; i < 10; ++i )
+    {
+      std::shared_ptr<std::string> buffer =
+        std::make_shared<std::string>( "buffer " + std::to_string( i ) );
+
+      writer.write( file_name, buffer );
+
+      FRENSIE_CHECK( writer.getNumberOfPendingWrites() <= 1 );
+    }
+
+    writer.waitForPendingWrites();
+
+    FRENSIE_CHECK_EQUAL( writer.getNumberOfPendingWrites(), 0 );
+    FRENSIE_CHECK_EQUAL( readFile( file_name ), "buffer 9" );
+  }
+
+  FRENSIE_CHECK( !boost::filesystem::exists( Utility::BackgroundFileWriter::getTemporaryFileName( file_name ) ) );
+
+  // The pending writes must be completed by the destructor
+  {
+    Utility::BackgroundFileWriter writer( 2 );
+
+    writer.write( file_name,
+                  std::make_shared<std::string>( std::string( 1000000, 'a' ) ) );
+    writer.write( file_name,
+                  std::make_shared<std::string>( "final buffer" ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( readFile( file_name ), "final buffer" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that buffers can be appended to files
+FRENSIE_UNIT_TEST( BackgroundFileWriter, append )
+{
+  const std::string file_name( "test_background_file_writer_append.txt" );
+
+  boost::filesystem::remove( file_name );
+
+  {
+    Utility::BackgroundFileWriter writer( 2 );
+
+    writer.write( file_name, std::make_shared<std::string>( "header;" ) );
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      writer.append( file_name,
+                     std::make_shared<std::string>( std::to_string( i ) ) );
+    }
+
+    writer.waitForPendingWrites();
+
+    FRENSIE_CHECK_EQUAL( readFile( file_name ), "header;012" );
+
+    // Writing the file again replaces the appended contents
+    writer.write( file_name, std::make_shared<std::string>( "header;" ) );
+    writer.append( file_name, std::make_shared<std::string>( "3" ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( readFile( file_name ), "header;3" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a buffer stream can fill a buffer for a background write
+FRENSIE_UNIT_TEST( BackgroundFileWriter, BufferStream )
+{
+  Utility::BackgroundFileWriter::BufferStream stream;
+
+  FRENSIE_CHECK_EQUAL( *stream.releaseBuffer(), "" );
+
+  // Write enough characters to grow the buffer several times
+  std::ostringstream expected_contents;
+
+  for( size_t i = 0; i < 10000; ++i )
+  {
+    stream << i << " ";
+    expected_contents << i << " ";
+  }
+
+  stream.write( "end", 3 );
+  expected_contents.write( "end", 3 );
+
+  std::shared_ptr<const std::string> buffer = stream.releaseBuffer();
+
+  FRENSIE_CHECK_EQUAL( *buffer, expected_contents.str() );
+
+  // The stream starts a new buffer
+  stream << "new buffer";
+
+  FRENSIE_CHECK_EQUAL( *stream.releaseBuffer(), "new buffer" );
+  FRENSIE_CHECK_EQUAL( *buffer, expected_contents.str() );
+
+  // The released buffer can be written in the background
+  const std::string file_name( "test_background_file_writer_stream.txt" );
+
+  {
+    Utility::BackgroundFileWriter writer( 1 );
+
+    stream << "buffer stream";
+
+    writer.write( file_name, stream.releaseBuffer() );
+  }
+
+  FRENSIE_CHECK_EQUAL( readFile( file_name ), "buffer stream" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that failed writes are reported
+FRENSIE_UNIT_TEST( BackgroundFileWriter, write_failure )
+{
+  const std::string file_name( "missing_test_directory/test_file.txt" );
+
+  Utility::BackgroundFileWriter writer( 1 );
+
+  writer.write( file_name, std::make_shared<std::string>( "buffer" ) );
+
+  FRENSIE_CHECK_THROW( writer.waitForPendingWrites(), std::runtime_error );
+  FRENSIE_CHECK_NO_THROW( writer.waitForPendingWrites() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstBackgroundFileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,9 @@
 
 // Std Lib Includes
 #include <functional>
+#include <algorithm>
+#include <utility>
+#include <cmath>
 
 // FRENSIE Includes
 #include "Utility_SortAlgorithms.hpp"
@@ -1299,6 +1302,102 @@ auto Correlated<_TwoDInterpPolicy>::calculateUpperBound(
 
 namespace Details{
 
+/*! \brief The helper struct used to estimate the correlated CDF
+ *
+ * \details The correlated evaluation methods find the CDF value whose
+ * interpolated secondary independent value matches the requested value.
+ * Every evaluation requires sampling both bin boundary distributions, which
+ * makes the correlated evaluation expensive. Since the interpolated value
+ * increases monotonically with the CDF, the CDF bracket can be narrowed with a
+ * bracketed secant (Illinois) search instead of a bisection, which typically
+ * converges in a handful of evaluations. The residual of the bracket end that
+ * is retained twice in a row is halved so that the search can never stall on
+ * one side of the root.
+ */
+struct CorrelatedCDFSecantHelper
+{
+  //! Calculate the residual of an interpolated value
+  template<typename ValueType>
+  static double calculateResidual( const ValueType& estimated_value,
+                                   const ValueType& value );
+
+  //! Estimate the cdf value from the bracket
+  static double estimateCDF( const double lower_cdf,
+                             const double upper_cdf,
+                             const double lower_residual,
+                             const double upper_residual );
+
+  //! Update the bracket residuals with an evaluated residual
+  static void updateResiduals( const double residual,
+                               double& lower_residual,
+                               double& upper_residual,
+                               int& retained_side );
+};
+
+// Calculate the residual of an interpolated value
+template<typename ValueType>
+inline double CorrelatedCDFSecantHelper::calculateResidual(
+                                               const ValueType& estimated_value,
+                                               const ValueType& value )
+{
+  return (estimated_value - value)/QuantityTraits<ValueType>::one();
+}
+
+// Estimate the cdf value from the bracket
+/*! \details If the residuals do not bracket the root or the secant estimate
+ * is not strictly inside of the bracket (e.g. due to round-off) the midpoint
+ * of the bracket will be returned.
+ */
+inline double CorrelatedCDFSecantHelper::estimateCDF(
+                                                 const double lower_cdf,
+                                                 const double upper_cdf,
+                                                 const double lower_residual,
+                                                 const double upper_residual )
+{
+  const double midpoint = 0.5*( lower_cdf + upper_cdf );
+
+  if( !(lower_residual < 0.0 && upper_residual > 0.0) )
+    return midpoint;
+
+  const double cdf = lower_cdf - lower_residual*
+    (upper_cdf - lower_cdf)/(upper_residual - lower_residual);
+
+  if( cdf > lower_cdf && cdf < upper_cdf )
+    return cdf;
+  else
+    return midpoint;
+}
+
+// Update the bracket residuals with an evaluated residual
+/*! \details The retained side is negative if the upper bracket end was
+ * retained by the previous update and positive if the lower bracket end was
+ * retained. It should be initialized to zero.
+ */
+inline void CorrelatedCDFSecantHelper::updateResiduals(
+                                                   const double residual,
+                                                   double& lower_residual,
+                                                   double& upper_residual,
+                                                   int& retained_side )
+{
+  if( residual < 0.0 )
+  {
+    // Illinois modification: halve the retained residual
+    if( retained_side < 0 )
+      upper_residual *= 0.5;
+
+    lower_residual = residual;
+    retained_side = -1;
+  }
+  else
+  {
+    if( retained_side > 0 )
+      lower_residual *= 0.5;
+
+    upper_residual = residual;
+    retained_side = 1;
+  }
+}
+
 /*! The helper struct used to calculate the secondary independent value
  *
  * Specialization of this class for different UnivariateDistribution classes is
@@ -1414,6 +1513,27 @@ struct CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivar
               const double error_tol = 1e-15,
               unsigned max_number_of_iterations = 500u );
 
+  // Estimate the interpolated CDF and the corresponding lower and upper y
+  // indep values using the interpolated y values at the cdf bounds
+  template<typename TwoDInterpPolicy,
+           typename YIndepType,
+           typename YZIterator,
+           typename T>
+  static double estimateCDF(
+              double& lower_cdf_est,
+              double& upper_cdf_est,
+              const YIndepType& lower_y_estimate,
+              const YIndepType& upper_y_estimate,
+              YIndepType& y_indep_value_0,
+              YIndepType& y_indep_value_1,
+              const T& beta,
+              const YIndepType& y_indep_value,
+              const YZIterator& lower_bin_boundary,
+              const YZIterator& upper_bin_boundary,
+              const double rel_error_tol,
+              const double error_tol,
+              unsigned max_number_of_iterations );
+
   // Evaluate the interpolated y at the CDF value
   template<typename TwoDInterpPolicy,
            typename YIndepType,
@@ -1448,8 +1568,10 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
                                        YIndepType& lower_y_value,
                                        YIndepType& upper_y_value )
 {
-  // Get the lower and upper boundaries of the evaluated cdf
+  // Get the lower and upper boundaries of the evaluated cdf and the
+  // interpolated y values at the boundaries
   double lower_cdf_bound, upper_cdf_bound;
+  YIndepType lower_y_estimate, upper_y_estimate;
   {
     // Evaluate the cdf at the upper and lower bin boundaries
     double bin_eval_0 =
@@ -1470,7 +1592,7 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
 
     // Make sure the estimates are valid
     YIndepType dummy_y0, dummy_y1;
-    YIndepType lower_y_estimate = ThisType::evaluateY<TwoDInterpPolicy>(
+    lower_y_estimate = ThisType::evaluateY<TwoDInterpPolicy>(
                                                       lower_cdf_bound,
                                                       beta,
                                                       lower_bin_boundary,
@@ -1478,7 +1600,7 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
                                                       dummy_y0,
                                                       dummy_y1 );
 
-    YIndepType upper_y_estimate = ThisType::evaluateY<TwoDInterpPolicy>(
+    upper_y_estimate = ThisType::evaluateY<TwoDInterpPolicy>(
                                                       upper_cdf_bound,
                                                       beta,
                                                       lower_bin_boundary,
@@ -1489,10 +1611,9 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
     while( lower_y_estimate > y_indep_value )
     {
       upper_cdf_bound = lower_cdf_bound;
-      lower_cdf_bound *= 0.9;
+      upper_y_estimate = lower_y_estimate;
 
-      if( lower_cdf_bound == 0.0 )
-        break;
+      lower_cdf_bound *= 0.9;
 
       lower_y_estimate =
         ThisType::evaluateY<TwoDInterpPolicy>( lower_cdf_bound,
@@ -1501,18 +1622,20 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
                                                upper_bin_boundary,
                                                dummy_y0,
                                                dummy_y1 );
+
+      if( lower_cdf_bound == 0.0 )
+        break;
     }
 
     while( upper_y_estimate < y_indep_value )
     {
       lower_cdf_bound = upper_cdf_bound;
+      lower_y_estimate = upper_y_estimate;
+
       upper_cdf_bound *= 1.1;
 
       if( upper_cdf_bound >= 1.0 )
-      {
         upper_cdf_bound = 1.0;
-        break;
-      }
 
       upper_y_estimate =
         ThisType::evaluateY<TwoDInterpPolicy>( upper_cdf_bound,
@@ -1521,12 +1644,17 @@ void CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivaria
                                                upper_bin_boundary,
                                                dummy_y0,
                                                dummy_y1 );
+
+      if( upper_cdf_bound == 1.0 )
+        break;
     }
   }
 
   double est_cdf = ThisType::estimateCDF<TwoDInterpPolicy>(
                                                     lower_cdf_bound,
                                                     upper_cdf_bound,
+                                                    lower_y_estimate,
+                                                    upper_y_estimate,
                                                     lower_y_value,
                                                     upper_y_value,
                                                     beta,
@@ -1558,6 +1686,66 @@ double CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivar
                                           const double rel_error_tol,
                                           const double error_tol,
                                           unsigned max_number_of_iterations )
+{
+  // Evaluate the interpolated y values at the cdf bounds
+  YIndepType dummy_y0, dummy_y1;
+
+  const YIndepType lower_y_estimate =
+    ThisType::evaluateY<TwoDInterpPolicy>( lower_cdf_est,
+                                           beta,
+                                           lower_bin_boundary,
+                                           upper_bin_boundary,
+                                           dummy_y0,
+                                           dummy_y1 );
+
+  const YIndepType upper_y_estimate =
+    ThisType::evaluateY<TwoDInterpPolicy>( upper_cdf_est,
+                                           beta,
+                                           lower_bin_boundary,
+                                           upper_bin_boundary,
+                                           dummy_y0,
+                                           dummy_y1 );
+
+  return ThisType::estimateCDF<TwoDInterpPolicy>( lower_cdf_est,
+                                                  upper_cdf_est,
+                                                  lower_y_estimate,
+                                                  upper_y_estimate,
+                                                  y_indep_value_0,
+                                                  y_indep_value_1,
+                                                  beta,
+                                                  y_indep_value,
+                                                  lower_bin_boundary,
+                                                  upper_bin_boundary,
+                                                  rel_error_tol,
+                                                  error_tol,
+                                                  max_number_of_iterations );
+}
+
+// Estimate the interpolated CDF and the corresponding lower and upper y indep
+// values using the interpolated y values at the cdf bounds
+/*! \details The lower and upper y estimates must be the interpolated y values
+ * at the lower and upper cdf estimates. They are used to seed the secant search so
+ * that the bracket is not evaluated a second time.
+ */
+template<typename _T, typename _U>
+template<typename TwoDInterpPolicy,
+         typename YIndepType,
+         typename YZIterator,
+         typename T>
+double CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivariateDistribution<_T,_U> >::estimateCDF(
+                                          double& lower_cdf_est,
+                                          double& upper_cdf_est,
+                                          const YIndepType& lower_y_estimate,
+                                          const YIndepType& upper_y_estimate,
+                                          YIndepType& y_indep_value_0,
+                                          YIndepType& y_indep_value_1,
+                                          const T& beta,
+                                          const YIndepType& y_indep_value,
+                                          const YZIterator& lower_bin_boundary,
+                                          const YZIterator& upper_bin_boundary,
+                                          const double rel_error_tol,
+                                          const double error_tol,
+                                          unsigned max_number_of_iterations )
 {
   unsigned number_of_iterations = 0;
   double rel_error = 1.0;
@@ -1574,12 +1762,25 @@ double CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivar
     tolerance = error_tol;
   }
 
+  // Seed the secant search with the residuals at the cdf bounds
+  double lower_residual =
+    CorrelatedCDFSecantHelper::calculateResidual( lower_y_estimate,
+                                                  y_indep_value );
+  double upper_residual =
+    CorrelatedCDFSecantHelper::calculateResidual( upper_y_estimate,
+                                                  y_indep_value );
+  int retained_side = 0;
+
   // Refine the estimated cdf value until it meet the tolerance
   double estimated_cdf = 0.0;
   while ( rel_error > tolerance )
   {
-    // Estimate the cdf as the midpoint of the lower and upper boundaries
-    estimated_cdf = 0.5*( lower_cdf_est + upper_cdf_est );
+    // Estimate the cdf from the secant of the lower and upper boundaries
+    estimated_cdf =
+      CorrelatedCDFSecantHelper::estimateCDF( lower_cdf_est,
+                                              upper_cdf_est,
+                                              lower_residual,
+                                              upper_residual );
 
     YIndepType est_y_indep_value =
       ThisType::evaluateY<TwoDInterpPolicy>( estimated_cdf,
@@ -1605,6 +1806,14 @@ double CorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivar
     if ( rel_error <= tolerance )
       break;
 
+    // Update the bracket residuals
+    CorrelatedCDFSecantHelper::updateResiduals(
+                CorrelatedCDFSecantHelper::calculateResidual( est_y_indep_value,
+                                                              y_indep_value ),
+                lower_residual,
+                upper_residual,
+                retained_side );
+
     // Update the estimated_cdf estimate
     if ( est_y_indep_value < y_indep_value )
     {
@@ -2882,6 +3091,29 @@ struct UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabul
              const double error_tol = 1e-15,
              unsigned max_number_of_iterations = 500u );
 
+  // Estimate the interpolated CDF and the corresponding lower and upper y
+  // indep values using the interpolated eta values at the cdf bounds
+  template<typename TwoDInterpPolicy,
+           typename YIndepType,
+           typename YZIterator,
+           typename T>
+  static double estimateCDF(
+             double& lower_cdf_est,
+             double& upper_cdf_est,
+             const typename QuantityTraits<YIndepType>::RawType& lower_eta_estimate,
+             const typename QuantityTraits<YIndepType>::RawType& upper_eta_estimate,
+             YIndepType& y_indep_value_0,
+             YIndepType& y_indep_value_1,
+             const T& beta,
+             const typename QuantityTraits<YIndepType>::RawType& grid_length_0,
+             const typename QuantityTraits<YIndepType>::RawType& grid_length_1,
+             const typename QuantityTraits<YIndepType>::RawType& eta,
+             const YZIterator& lower_bin_boundary,
+             const YZIterator& upper_bin_boundary,
+             const double rel_error_tol,
+             const double error_tol,
+             unsigned max_number_of_iterations );
+
   // Evaluate the interpolated eta at the CDF value
   template<typename TwoDInterpPolicy,
            typename YIndepType,
@@ -2923,9 +3155,11 @@ void UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabular
              YIndepType& lower_y_value,
              YIndepType& upper_y_value )
 {
-  // Get the lower and upper boundaries of the evaluated cdf
+  // Get the lower and upper boundaries of the evaluated cdf and the
+  // interpolated eta values at the boundaries
   double lower_cdf_bound, upper_cdf_bound;
   typename QuantityTraits<YIndepType>::RawType eta;
+  typename QuantityTraits<YIndepType>::RawType lower_eta_estimate, upper_eta_estimate;
 
   {
     YIndepType min_y_indep_value_with_tol =
@@ -2979,7 +3213,6 @@ void UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabular
 
     // Make sure the estimates are valid
     YIndepType dummy_y0, dummy_y1;
-    typename QuantityTraits<YIndepType>::RawType lower_eta_estimate, upper_eta_estimate;
 
     lower_eta_estimate =
       ThisType::evaluateEta<TwoDInterpPolicy>(
@@ -3006,10 +3239,9 @@ void UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabular
     while( lower_eta_estimate > eta )
     {
       upper_cdf_bound = lower_cdf_bound;
-      lower_cdf_bound *= 0.99;
+      upper_eta_estimate = lower_eta_estimate;
 
-      if( lower_cdf_bound == 0.0 )
-        break;
+      lower_cdf_bound *= 0.99;
 
       lower_eta_estimate = ThisType::evaluateEta<TwoDInterpPolicy>(
             lower_cdf_bound,
@@ -3020,18 +3252,20 @@ void UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabular
             upper_bin_boundary,
             dummy_y0,
             dummy_y1 );
+
+      if( lower_cdf_bound == 0.0 )
+        break;
     }
 
     while( upper_eta_estimate < eta )
     {
       lower_cdf_bound = upper_cdf_bound;
+      lower_eta_estimate = upper_eta_estimate;
+
       upper_cdf_bound *= 1.01;
 
       if( upper_cdf_bound >= 1.0 )
-      {
         upper_cdf_bound = 1.0;
-        break;
-      }
 
       upper_eta_estimate = ThisType::evaluateEta<TwoDInterpPolicy>(
             upper_cdf_bound,
@@ -3042,11 +3276,16 @@ void UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabular
             upper_bin_boundary,
             dummy_y0,
             dummy_y1 );
+
+      if( upper_cdf_bound == 1.0 )
+        break;
     }
   }
 
   ThisType::estimateCDF<TwoDInterpPolicy>( lower_cdf_bound,
                                            upper_cdf_bound,
+                                           lower_eta_estimate,
+                                           upper_eta_estimate,
                                            lower_y_value,
                                            upper_y_value,
                                            beta,
@@ -3081,6 +3320,74 @@ double UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabul
              const double rel_error_tol,
              const double error_tol,
              unsigned max_number_of_iterations )
+{
+  // Evaluate the interpolated eta values at the cdf bounds
+  YIndepType dummy_y0, dummy_y1;
+
+  const typename QuantityTraits<YIndepType>::RawType lower_eta_estimate =
+    ThisType::evaluateEta<TwoDInterpPolicy>( lower_cdf_est,
+                                             beta,
+                                             grid_length_0,
+                                             grid_length_1,
+                                             lower_bin_boundary,
+                                             upper_bin_boundary,
+                                             dummy_y0,
+                                             dummy_y1 );
+
+  const typename QuantityTraits<YIndepType>::RawType upper_eta_estimate =
+    ThisType::evaluateEta<TwoDInterpPolicy>( upper_cdf_est,
+                                             beta,
+                                             grid_length_0,
+                                             grid_length_1,
+                                             lower_bin_boundary,
+                                             upper_bin_boundary,
+                                             dummy_y0,
+                                             dummy_y1 );
+
+  return ThisType::estimateCDF<TwoDInterpPolicy>( lower_cdf_est,
+                                                  upper_cdf_est,
+                                                  lower_eta_estimate,
+                                                  upper_eta_estimate,
+                                                  y_indep_value_0,
+                                                  y_indep_value_1,
+                                                  beta,
+                                                  grid_length_0,
+                                                  grid_length_1,
+                                                  eta,
+                                                  lower_bin_boundary,
+                                                  upper_bin_boundary,
+                                                  rel_error_tol,
+                                                  error_tol,
+                                                  max_number_of_iterations );
+}
+
+// Estimate the interpolated CDF and the corresponding lower and upper y
+// indep values using the interpolated eta values at the cdf bounds
+/*! \details The lower and upper eta estimates must be the interpolated eta
+ * values at the lower and upper cdf estimates. They are used to seed the
+ * secant search so that the bracket is not evaluated a second time.
+ */
+template<typename _T, typename _U>
+template<typename TwoDInterpPolicy,
+         typename YIndepType,
+         typename YZIterator,
+         typename T>
+double UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabularUnivariateDistribution<_T,_U> >::estimateCDF(
+             double& lower_cdf_est,
+             double& upper_cdf_est,
+             const typename QuantityTraits<YIndepType>::RawType& lower_eta_estimate,
+             const typename QuantityTraits<YIndepType>::RawType& upper_eta_estimate,
+             YIndepType& y_indep_value_0,
+             YIndepType& y_indep_value_1,
+             const T& beta,
+             const typename QuantityTraits<YIndepType>::RawType& grid_length_0,
+             const typename QuantityTraits<YIndepType>::RawType& grid_length_1,
+             const typename QuantityTraits<YIndepType>::RawType& eta,
+             const YZIterator& lower_bin_boundary,
+             const YZIterator& upper_bin_boundary,
+             const double rel_error_tol,
+             const double error_tol,
+             unsigned max_number_of_iterations )
 {
   unsigned number_of_iterations = 0;
   double rel_error = 1.0;
@@ -3097,12 +3404,23 @@ double UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabul
       tolerance = error_tol;
     }
 
+  // Seed the secant search with the residuals at the cdf bounds
+  double lower_residual =
+    CorrelatedCDFSecantHelper::calculateResidual( lower_eta_estimate, eta );
+  double upper_residual =
+    CorrelatedCDFSecantHelper::calculateResidual( upper_eta_estimate, eta );
+  int retained_side = 0;
+
   // Refine the estimated cdf value until it meet the tolerance
   double estimated_cdf = 0.0;
   while ( rel_error > tolerance )
   {
-    // Estimate the cdf as the midpoint of the lower and upper boundaries
-    estimated_cdf = 0.5*( lower_cdf_est + upper_cdf_est );
+    // Estimate the cdf from the secant of the lower and upper boundaries
+    estimated_cdf =
+      CorrelatedCDFSecantHelper::estimateCDF( lower_cdf_est,
+                                              upper_cdf_est,
+                                              lower_residual,
+                                              upper_residual );
 
     auto&& eta_estimate =
         ThisType::evaluateEta<TwoDInterpPolicy>( estimated_cdf,
@@ -3130,6 +3448,13 @@ double UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::UnitAwareTabul
     if ( rel_error <= tolerance )
       break;
 
+    // Update the bracket residuals
+    CorrelatedCDFSecantHelper::updateResiduals(
+                CorrelatedCDFSecantHelper::calculateResidual( eta_estimate, eta ),
+                lower_residual,
+                upper_residual,
+                retained_side );
+
     // Update the estimated_cdf estimate
     if ( eta_estimate < eta )
     {
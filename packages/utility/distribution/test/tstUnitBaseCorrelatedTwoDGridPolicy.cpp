@@ -10,6 +10,8 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <stdexcept>
+#include <cmath>
 
 // Boost Includes
 #include <boost/units/systems/cgs.hpp>
@@ -45,11 +47,16 @@ using ZDepType = Utility::UnitTraits<Barn>::template GetQuantityType<double>::ty
 using DistributionType = std::vector<std::pair<double,std::shared_ptr<const Utility::TabularUnivariateDistribution > > >;
 using UnitAwareDistributionType = std::vector<std::pair<Utility::UnitTraits<MegaElectronVolt>::template GetQuantityType<double>::type,std::shared_ptr<const Utility::UnitAwareTabularUnivariateDistribution<cgs::length,Barn> > > >;
 
+typedef Utility::Details::UnitBaseCorrelatedEvaluatePDFSecondaryIndepHelper<Utility::TabularUnivariateDistribution> SecondaryIndepHelper;
+
+typedef Utility::LinLinLin::ZYInterpPolicy ZYInterpPolicy;
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
 
 std::shared_ptr<DistributionType> distribution;
+std::shared_ptr<DistributionType> flat_cdf_distribution;
 std::shared_ptr<UnitAwareDistributionType> unit_aware_distribution;
 
 std::function<double(const Utility::TabularUnivariateDistribution&)> functor;
@@ -93,6 +100,433 @@ std::function<YIndepType(const Utility::UnitAwareTabularUnivariateDistribution<c
     random_number );
 }
 
+// Estimate the cdf by bisecting the entire cdf range (reference estimate)
+double estimateReferenceCDF( double lower_cdf_est,
+                             double upper_cdf_est,
+                             double& y_indep_value_0,
+                             double& y_indep_value_1,
+                             const double beta,
+                             const double grid_length_0,
+                             const double grid_length_1,
+                             const double eta,
+                             const DistributionType::const_iterator& lower_bin_boundary,
+                             const DistributionType::const_iterator& upper_bin_boundary,
+                             const double rel_error_tol,
+                             const double error_tol,
+                             const unsigned max_number_of_iterations )
+{
+  unsigned number_of_iterations = 0;
+  double rel_error = 1.0;
+  double error_norm_constant = eta;
+  double tolerance = rel_error_tol;
+
+  if( eta == 0.0 )
+  {
+    error_norm_constant = 1.0;
+    tolerance = error_tol;
+  }
+
+  double estimated_cdf = 0.0;
+
+  while( rel_error > tolerance )
+  {
+    estimated_cdf = 0.5*( lower_cdf_est + upper_cdf_est );
+
+    double eta_estimate =
+      SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>( estimated_cdf,
+                                                             beta,
+                                                             grid_length_0,
+                                                             grid_length_1,
+                                                             lower_bin_boundary,
+                                                             upper_bin_boundary,
+                                                             y_indep_value_0,
+                                                             y_indep_value_1 );
+
+    ++number_of_iterations;
+
+    if( eta == eta_estimate )
+      break;
+
+    rel_error = std::fabs( (eta - eta_estimate)/error_norm_constant );
+
+    if( rel_error <= tolerance )
+      break;
+
+    if( eta_estimate < eta )
+      lower_cdf_est = estimated_cdf;
+    else
+      upper_cdf_est = estimated_cdf;
+
+    if( number_of_iterations > max_number_of_iterations )
+    {
+      if( std::fabs( eta - eta_estimate ) < error_tol )
+        break;
+      else
+        throw std::runtime_error( "The max number of iterations was reached!" );
+    }
+  }
+
+  return estimated_cdf;
+}
+
+// Calculate the secondary independent values by bracketing the cdf and then
+// bisecting the bracket (reference values)
+void calculateReferenceSecondaryIndepValues(
+                     const double min_y_indep_value,
+                     const double y_indep_value,
+                     const double beta,
+                     const double grid_length_0,
+                     const double grid_length_1,
+                     const double intermediate_grid_length,
+                     const DistributionType::const_iterator& lower_bin_boundary,
+                     const DistributionType::const_iterator& upper_bin_boundary,
+                     const double fuzzy_boundary_tol,
+                     const double rel_error_tol,
+                     const double error_tol,
+                     const unsigned max_number_of_iterations,
+                     double& lower_y_value,
+                     double& upper_y_value )
+{
+  const double eta =
+    ZYInterpPolicy::calculateUnitBaseIndepVar( y_indep_value,
+                                               min_y_indep_value,
+                                               intermediate_grid_length,
+                                               fuzzy_boundary_tol );
+
+  const double y_indep_value_0 = ZYInterpPolicy::calculateIndepVar(
+                        eta,
+                        lower_bin_boundary->second->getLowerBoundOfIndepVar(),
+                        grid_length_0,
+                        fuzzy_boundary_tol );
+
+  const double y_indep_value_1 = ZYInterpPolicy::calculateIndepVar(
+                        eta,
+                        upper_bin_boundary->second->getLowerBoundOfIndepVar(),
+                        grid_length_1,
+                        fuzzy_boundary_tol );
+
+  double lower_cdf_bound =
+    lower_bin_boundary->second->evaluateCDF( y_indep_value_0 );
+  double upper_cdf_bound =
+    upper_bin_boundary->second->evaluateCDF( y_indep_value_1 );
+
+  if( lower_cdf_bound > upper_cdf_bound )
+    std::swap( lower_cdf_bound, upper_cdf_bound );
+
+  double dummy_y0, dummy_y1;
+
+  double lower_eta_estimate =
+    SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>( lower_cdf_bound,
+                                                           beta,
+                                                           grid_length_0,
+                                                           grid_length_1,
+                                                           lower_bin_boundary,
+                                                           upper_bin_boundary,
+                                                           dummy_y0,
+                                                           dummy_y1 );
+
+  double upper_eta_estimate =
+    SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>( upper_cdf_bound,
+                                                           beta,
+                                                           grid_length_0,
+                                                           grid_length_1,
+                                                           lower_bin_boundary,
+                                                           upper_bin_boundary,
+                                                           dummy_y0,
+                                                           dummy_y1 );
+
+  while( lower_eta_estimate > eta )
+  {
+    upper_cdf_bound = lower_cdf_bound;
+    lower_cdf_bound *= 0.99;
+
+    if( lower_cdf_bound == 0.0 )
+      break;
+
+    lower_eta_estimate =
+      SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>( lower_cdf_bound,
+                                                             beta,
+                                                             grid_length_0,
+                                                             grid_length_1,
+                                                             lower_bin_boundary,
+                                                             upper_bin_boundary,
+                                                             dummy_y0,
+                                                             dummy_y1 );
+  }
+
+  while( upper_eta_estimate < eta )
+  {
+    lower_cdf_bound = upper_cdf_bound;
+    upper_cdf_bound *= 1.01;
+
+    if( upper_cdf_bound >= 1.0 )
+    {
+      upper_cdf_bound = 1.0;
+      break;
+    }
+
+    upper_eta_estimate =
+      SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>( upper_cdf_bound,
+                                                             beta,
+                                                             grid_length_0,
+                                                             grid_length_1,
+                                                             lower_bin_boundary,
+                                                             upper_bin_boundary,
+                                                             dummy_y0,
+                                                             dummy_y1 );
+  }
+
+  estimateReferenceCDF( lower_cdf_bound,
+                        upper_cdf_bound,
+                        lower_y_value,
+                        upper_y_value,
+                        beta,
+                        grid_length_0,
+                        grid_length_1,
+                        eta,
+                        lower_bin_boundary,
+                        upper_bin_boundary,
+                        rel_error_tol,
+                        error_tol,
+                        max_number_of_iterations );
+}
+
+// Check if an estimated value meets the evaluation tolerance
+bool meetsTolerance( const double estimated_value,
+                     const double value,
+                     const double rel_error_tol,
+                     const double error_tol )
+{
+  if( estimated_value == value )
+    return true;
+  else if( value == 0.0 )
+    return std::fabs( estimated_value ) <= error_tol;
+  else
+  {
+    return std::fabs( (value - estimated_value)/value ) <= rel_error_tol ||
+      std::fabs( value - estimated_value ) < error_tol;
+  }
+}
+
+// Count the estimated cdf and secondary indep values that do not meet the
+// evaluation tolerance over the unit base grid of every bin of the
+// distribution (or that could not be estimated although the reference
+// bisection succeeded)
+unsigned countToleranceViolations( const DistributionType& test_distribution )
+{
+  unsigned number_of_violations = 0;
+
+  const std::vector<double> betas( {1e-3, 0.25, 0.5, 0.75, 1.0-1e-3} );
+  const std::vector<double> rel_error_tols( {1e-3, 1e-7, 1e-12} );
+  const unsigned number_of_points = 64;
+  const double fuzzy_boundary_tol = 1e-7;
+
+  DistributionType::const_iterator test_lower_bin = test_distribution.begin();
+  DistributionType::const_iterator test_upper_bin = test_lower_bin;
+  ++test_upper_bin;
+
+  while( test_upper_bin != test_distribution.end() )
+  {
+    const double grid_length_0 = ZYInterpPolicy::calculateUnitBaseGridLength(
+                            test_lower_bin->second->getLowerBoundOfIndepVar(),
+                            test_lower_bin->second->getUpperBoundOfIndepVar() );
+
+    const double grid_length_1 = ZYInterpPolicy::calculateUnitBaseGridLength(
+                            test_upper_bin->second->getLowerBoundOfIndepVar(),
+                            test_upper_bin->second->getUpperBoundOfIndepVar() );
+
+    for( size_t i = 0; i < betas.size(); ++i )
+    {
+      const double beta = betas[i];
+
+      const double min_y_value = Utility::LinLin::interpolate(
+                        beta,
+                        test_lower_bin->second->getLowerBoundOfIndepVar(),
+                        test_upper_bin->second->getLowerBoundOfIndepVar() );
+
+      const double max_y_value = Utility::LinLin::interpolate(
+                        beta,
+                        test_lower_bin->second->getUpperBoundOfIndepVar(),
+                        test_upper_bin->second->getUpperBoundOfIndepVar() );
+
+      const double intermediate_grid_length =
+        ZYInterpPolicy::calculateUnitBaseGridLength( min_y_value,
+                                                     max_y_value );
+
+      for( unsigned j = 0; j <= number_of_points; ++j )
+      {
+        // Include both end points of the unit base grid
+        const double eta = j/(double)number_of_points;
+
+        const double y_value = (j == number_of_points ? max_y_value :
+                                min_y_value + eta*intermediate_grid_length);
+
+        for( size_t k = 0; k < rel_error_tols.size(); ++k )
+        {
+          // Estimate the cdf
+          double lower_cdf_bound = test_lower_bin->second->evaluateCDF(
+                   ZYInterpPolicy::calculateIndepVar(
+                         eta,
+                         test_lower_bin->second->getLowerBoundOfIndepVar(),
+                         grid_length_0 ) );
+          double upper_cdf_bound = test_upper_bin->second->evaluateCDF(
+                   ZYInterpPolicy::calculateIndepVar(
+                         eta,
+                         test_upper_bin->second->getLowerBoundOfIndepVar(),
+                         grid_length_1 ) );
+
+          if( lower_cdf_bound > upper_cdf_bound )
+            std::swap( lower_cdf_bound, upper_cdf_bound );
+
+          double ref_lower_cdf_bound = lower_cdf_bound;
+          double ref_upper_cdf_bound = upper_cdf_bound;
+
+          double y_value_0, y_value_1, ref_y_value_0, ref_y_value_1;
+          double cdf;
+          bool threw = false, ref_threw = false;
+
+          try{
+            cdf = SecondaryIndepHelper::estimateCDF<Utility::LinLinLin>(
+                                                       lower_cdf_bound,
+                                                       upper_cdf_bound,
+                                                       y_value_0,
+                                                       y_value_1,
+                                                       beta,
+                                                       grid_length_0,
+                                                       grid_length_1,
+                                                       eta,
+                                                       test_lower_bin,
+                                                       test_upper_bin,
+                                                       rel_error_tols[k],
+                                                       1e-15,
+                                                       500u );
+          }
+          catch( const std::runtime_error& ){ threw = true; }
+
+          try{
+            estimateReferenceCDF( ref_lower_cdf_bound,
+                                  ref_upper_cdf_bound,
+                                  ref_y_value_0,
+                                  ref_y_value_1,
+                                  beta,
+                                  grid_length_0,
+                                  grid_length_1,
+                                  eta,
+                                  test_lower_bin,
+                                  test_upper_bin,
+                                  rel_error_tols[k],
+                                  1e-15,
+                                  500u );
+          }
+          catch( const std::runtime_error& ){ ref_threw = true; }
+
+          if( threw && !ref_threw )
+            ++number_of_violations;
+          else if( !threw )
+          {
+            double check_y_value_0, check_y_value_1;
+
+            const double estimated_eta =
+              SecondaryIndepHelper::evaluateEta<Utility::LinLinLin>(
+                                                             cdf,
+                                                             beta,
+                                                             grid_length_0,
+                                                             grid_length_1,
+                                                             test_lower_bin,
+                                                             test_upper_bin,
+                                                             check_y_value_0,
+                                                             check_y_value_1 );
+
+            if( !meetsTolerance( estimated_eta, eta, rel_error_tols[k], 1e-15 ) )
+              ++number_of_violations;
+
+            if( y_value_0 != check_y_value_0 || y_value_1 != check_y_value_1 )
+              ++number_of_violations;
+          }
+
+          // Calculate the secondary indep values (the end points are handled
+          // before the secondary indep values are calculated)
+          if( j == 0 || j == number_of_points )
+            continue;
+
+          double lower_y_value, upper_y_value;
+          double ref_lower_y_value, ref_upper_y_value;
+          threw = false;
+          ref_threw = false;
+
+          try{
+            SecondaryIndepHelper::calculateSecondaryIndepValues<Utility::LinLinLin>(
+                                 &Utility::TabularUnivariateDistribution::evaluatePDF,
+                                 min_y_value,
+                                 max_y_value,
+                                 y_value,
+                                 beta,
+                                 grid_length_0,
+                                 grid_length_1,
+                                 intermediate_grid_length,
+                                 test_lower_bin,
+                                 test_upper_bin,
+                                 fuzzy_boundary_tol,
+                                 rel_error_tols[k],
+                                 1e-15,
+                                 500u,
+                                 lower_y_value,
+                                 upper_y_value );
+          }
+          catch( const std::runtime_error& ){ threw = true; }
+
+          try{
+            calculateReferenceSecondaryIndepValues( min_y_value,
+                                                    y_value,
+                                                    beta,
+                                                    grid_length_0,
+                                                    grid_length_1,
+                                                    intermediate_grid_length,
+                                                    test_lower_bin,
+                                                    test_upper_bin,
+                                                    fuzzy_boundary_tol,
+                                                    rel_error_tols[k],
+                                                    1e-15,
+                                                    500u,
+                                                    ref_lower_y_value,
+                                                    ref_upper_y_value );
+          }
+          catch( const std::runtime_error& ){ ref_threw = true; }
+
+          // Both interpolated unit base values meet the tolerance
+          if( threw && !ref_threw )
+            ++number_of_violations;
+          else if( !threw && !ref_threw )
+          {
+            const double lower_min_y_value =
+              test_lower_bin->second->getLowerBoundOfIndepVar();
+            const double upper_min_y_value =
+              test_upper_bin->second->getLowerBoundOfIndepVar();
+
+            const double estimated_eta = Utility::LinLin::interpolate(
+                 beta,
+                 (lower_y_value - lower_min_y_value)/grid_length_0,
+                 (upper_y_value - upper_min_y_value)/grid_length_1 );
+
+            const double ref_eta = Utility::LinLin::interpolate(
+                 beta,
+                 (ref_lower_y_value - lower_min_y_value)/grid_length_0,
+                 (ref_upper_y_value - upper_min_y_value)/grid_length_1 );
+
+            if( !meetsTolerance( estimated_eta, ref_eta, 2*rel_error_tols[k], 2e-15 ) )
+              ++number_of_violations;
+          }
+        }
+      }
+    }
+
+    ++test_lower_bin;
+    ++test_upper_bin;
+  }
+
+  return number_of_violations;
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -393,6 +827,22 @@ FRENSIE_UNIT_TEST( UnitBaseCorrelated, evaluateCDF )
   FRENSIE_CHECK_EQUAL( evaluate( 2.0, 11.0 ), 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the secant search finds cdf values and secondary indep values
+// that meet the evaluation tolerance
+FRENSIE_UNIT_TEST( UnitBaseCorrelated, estimateCDF_tolerance )
+{
+  FRENSIE_CHECK_EQUAL( countToleranceViolations( *distribution ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the secant search finds cdf values and secondary indep values
+// that meet the evaluation tolerance when a bin boundary cdf has flat sections
+FRENSIE_UNIT_TEST( UnitBaseCorrelated, estimateCDF_tolerance_flat_cdf )
+{
+  FRENSIE_CHECK_EQUAL( countToleranceViolations( *flat_cdf_distribution ), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the unit-aware distribution can be evaluated
 FRENSIE_UNIT_TEST( UnitAwareCorrelated, evaluateCDF )
@@ -1082,6 +1532,40 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
     distribution.reset( new DistributionType( distribution_data ) );
   }
 
+  // Create a two-dimensional distribution with flat sections in the cdfs
+  {
+    DistributionType distribution_data( 3 );
+
+    // Create the secondary distribution with a zero pdf section
+    std::vector<double> bin_boundaries( 5 ), values( 5 );
+    bin_boundaries[0] = 0.0; values[0] = 1.0;
+    bin_boundaries[1] = 2.0; values[1] = 0.0;
+    bin_boundaries[2] = 4.0; values[2] = 0.0;
+    bin_boundaries[3] = 6.0; values[3] = 1.0;
+    bin_boundaries[4] = 10.0; values[4] = 1.0;
+
+    Utility::get<0>( distribution_data[0] ) = 0.0;
+    Utility::get<1>( distribution_data[0] ) = std::make_shared<Utility::TabularDistribution<Utility::LinLin> >( bin_boundaries, values );
+
+    Utility::get<0>( distribution_data[1] ) = 1.0;
+    Utility::get<1>( distribution_data[1] ) = std::make_shared<Utility::UniformDistribution>( 1.0, 9.0, 1.0 );
+
+    // Create the secondary distribution with two zero pdf sections
+    bin_boundaries.resize( 6 );
+    values.resize( 6 );
+    bin_boundaries[0] = 2.0; values[0] = 0.0;
+    bin_boundaries[1] = 3.0; values[1] = 0.0;
+    bin_boundaries[2] = 5.0; values[2] = 2.0;
+    bin_boundaries[3] = 6.0; values[3] = 0.0;
+    bin_boundaries[4] = 7.0; values[4] = 0.0;
+    bin_boundaries[5] = 8.0; values[5] = 1.0;
+
+    Utility::get<0>( distribution_data[2] ) = 2.0;
+    Utility::get<1>( distribution_data[2] ) = std::make_shared<Utility::TabularDistribution<Utility::LinLin> >( bin_boundaries, values );
+
+    flat_cdf_distribution.reset( new DistributionType( distribution_data ) );
+  }
+
   // Create the unit-aware two-dimensional distribution
   {
     UnitAwareDistributionType distribution_data( 3 );
@@ -12,6 +12,8 @@
 // Std Lib Includes
 #include <functional>
 #include <iostream>
+#include <string>
+#include <vector>
 
 // Boost Includes
 #include <boost/function.hpp>
@@ -47,6 +49,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Evaluate the refinement midpoints concurrently
+  void enableParallelRefinement();
+
+  //! Evaluate the refinement midpoints sequentially (default)
+  void disableParallelRefinement();
+
+  //! Check if the refinement midpoints will be evaluated concurrently
+  bool isParallelRefinementEnabled() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
@@ -126,6 +137,23 @@ public:
 
 private:
 
+  // Refine the grid between the initial grid points (breadth-first)
+  template<typename STLCompliantContainerA,
+           typename STLCompliantContainerB,
+           typename Functor>
+  void refineAndEvaluateInParallel(
+                                 STLCompliantContainerA& grid,
+                                 STLCompliantContainerB& evaluated_function,
+                                 const std::vector<double>& initial_grid_points,
+                                 const Functor& function,
+                                 double& last_evaluated_function ) const;
+
+  // Evaluate the function at the grid points concurrently
+  template<typename Functor>
+  static void evaluateInParallel( const std::vector<double>& grid_points,
+                                  std::vector<double>& evaluated_function,
+                                  const Functor& function );
+
   // Check for convergence
   bool hasGridConverged( const double lower_grid_point,
                          const double mid_grid_point,
@@ -133,6 +161,15 @@ private:
                          const double y_mid_estimated,
                          const double y_mid_exact ) const;
 
+  // Check for convergence (the dirty convergence messages will be returned)
+  bool hasGridConverged(
+                 const double lower_grid_point,
+                 const double mid_grid_point,
+                 const double upper_grid_point,
+                 const double y_mid_estimated,
+                 const double y_mid_exact,
+                 std::vector<std::string>& dirty_convergence_messages ) const;
+
   // The convergence tolerance
   double d_convergence_tol;
 
@@ -144,6 +181,9 @@ private:
 
   // Throw exception on dirty convergence
   bool d_throw_exceptions;
+
+  // Evaluate the refinement midpoints concurrently
+  bool d_parallel_refinement;
 };
 
 } // end Utility namespace
@@ -11,8 +11,14 @@
 
 // Std Lib Includes
 #include <deque>
+#include <exception>
+#include <limits>
 #include <iterator>
 #include <sstream>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <string>
 
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
@@ -22,6 +28,7 @@
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 
 namespace Utility{
@@ -34,7 +41,8 @@ GridGenerator<InterpPolicy>::GridGenerator( const double convergence_tol,
   : d_convergence_tol( convergence_tol ),
     d_absolute_diff_tol( absolute_diff_tol ),
     d_distance_tol( distance_tol ),
-    d_throw_exceptions( false )
+    d_throw_exceptions( false ),
+    d_parallel_refinement( false )
 {
   // Make sure the convergence tolerance is valid
   testPrecondition( convergence_tol <= 1.0 );
@@ -78,6 +86,37 @@ bool GridGenerator<InterpPolicy>::isExceptionThrownOnDirtyConvergence() const
   return d_throw_exceptions;
 }
 
+// Evaluate the refinement midpoints concurrently
+/*! \details The grid will be refined breadth-first: the midpoints of every
+ * interval that has not converged will be evaluated concurrently (using the
+ * number of threads requested with Utility::OpenMPProperties) and the
+ * convergence of each interval will then be checked in order. Because the
+ * convergence of an interval only depends on the interval end points and
+ * midpoint, the generated grid will be identical to the grid generated by
+ * the sequential (depth-first) algorithm. The function that is passed to the
+ * grid generation methods must be deterministic and safe to call from
+ * multiple threads simultaneously when this mode is enabled.
+ */
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::enableParallelRefinement()
+{
+  d_parallel_refinement = true;
+}
+
+// Evaluate the refinement midpoints sequentially (default)
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::disableParallelRefinement()
+{
+  d_parallel_refinement = false;
+}
+
+// Check if the refinement midpoints will be evaluated concurrently
+template<typename InterpPolicy>
+bool GridGenerator<InterpPolicy>::isParallelRefinementEnabled() const
+{
+  return d_parallel_refinement;
+}
+
 // Set the convergence tolerance
 template<typename InterpPolicy>
 void GridGenerator<InterpPolicy>::setConvergenceTolerance(
@@ -303,7 +342,29 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
 
   // Evaluate the grid point at the min value
   x0 = min_value;
-  y0 = function( x0 );
+
+  // Calculate the grid points concurrently
+  if( d_parallel_refinement )
+  {
+    std::vector<double> initial_grid_points( 1, x0 );
+
+    initial_grid_points.insert( initial_grid_points.end(),
+                                grid_queue.begin(),
+                                grid_queue.end() );
+
+    grid_queue.clear();
+
+    // The last point will be added below
+    this->refineAndEvaluateInParallel( grid,
+                                       evaluated_function,
+                                       initial_grid_points,
+                                       function,
+                                       y0 );
+
+    x0 = initial_grid_points.back();
+  }
+  else
+    y0 = function( x0 );
 
   // Calculate the grid points
   while( !grid_queue.empty() )
@@ -524,6 +585,207 @@ void GridGenerator<InterpPolicy>::generateAndEvaluate(
   this->generateAndEvaluateInPlace( grid, evaluated_function, function );
 }
 
+// Refine the grid between the initial grid points (breadth-first)
+/*! \details The refined grid points and the evaluated function will be
+ * appended to the grid and evaluated_function containers. The last initial
+ * grid point will not be appended - its function value will be returned
+ * instead. The dirty convergence warnings are reported in grid order and
+ * the dirty convergence exception (if requested) is the one that the
+ * sequential algorithm would throw (the lowest interval that cannot
+ * converge).
+ */
+template<typename InterpPolicy>
+template<typename STLCompliantContainerA,
+         typename STLCompliantContainerB,
+         typename Functor>
+void GridGenerator<InterpPolicy>::refineAndEvaluateInParallel(
+                                 STLCompliantContainerA& grid,
+                                 STLCompliantContainerB& evaluated_function,
+                                 const std::vector<double>& initial_grid_points,
+                                 const Functor& function,
+                                 double& last_evaluated_function ) const
+{
+  // Make sure at least 2 initial grid points have been given
+  testPrecondition( initial_grid_points.size() >= 2 );
+
+  std::vector<double> initial_evaluated_function;
+
+  GridGenerator<InterpPolicy>::evaluateInParallel( initial_grid_points,
+                                                   initial_evaluated_function,
+                                                   function );
+
+  // The intervals that have not converged (ordered by the lower grid point)
+  std::vector<std::pair<double,double> > intervals, refined_intervals;
+  std::vector<std::pair<double,double> > interval_values, refined_interval_values;
+
+  for( size_t i = 1; i < initial_grid_points.size(); ++i )
+  {
+    intervals.push_back( std::make_pair( initial_grid_points[i-1],
+                                         initial_grid_points[i] ) );
+
+    interval_values.push_back( std::make_pair( initial_evaluated_function[i-1],
+                                               initial_evaluated_function[i] ) );
+  }
+
+  // The lower grid point of every converged interval
+  std::vector<std::pair<double,double> > converged_grid_points;
+
+  // The dirty convergence messages (keyed by the lower grid point)
+  std::vector<std::pair<double,std::string> > dirty_convergence_messages;
+
+  // The lower grid point of the first interval with an exception
+  double dirty_convergence_exception_grid_point =
+    std::numeric_limits<double>::infinity();
+
+  std::string dirty_convergence_exception_message;
+
+  std::vector<double> mid_grid_points, mid_evaluated_function;
+
+  std::vector<std::string> interval_messages;
+
+  while( !intervals.empty() )
+  {
+    mid_grid_points.resize( intervals.size() );
+
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      mid_grid_points[i] = InterpPolicy::recoverProcessedIndepVar(
+                      0.5*(InterpPolicy::processIndepVar(intervals[i].first) +
+                           InterpPolicy::processIndepVar(intervals[i].second)) );
+    }
+
+    GridGenerator<InterpPolicy>::evaluateInParallel( mid_grid_points,
+                                                     mid_evaluated_function,
+                                                     function );
+
+    refined_intervals.clear();
+    refined_interval_values.clear();
+
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      const double x0 = intervals[i].first;
+      const double x1 = intervals[i].second;
+      const double y0 = interval_values[i].first;
+      const double y1 = interval_values[i].second;
+
+      const double y_mid_estimated =
+        InterpPolicy::interpolate( x0, x1, mid_grid_points[i], y0, y1 );
+
+      interval_messages.clear();
+
+      bool converged = this->hasGridConverged( x0,
+                                               mid_grid_points[i],
+                                               x1,
+                                               y_mid_estimated,
+                                               mid_evaluated_function[i],
+                                               interval_messages );
+
+      // The exception is deferred until all lower intervals have converged
+      if( !interval_messages.empty() && d_throw_exceptions )
+      {
+        if( x0 < dirty_convergence_exception_grid_point )
+        {
+          dirty_convergence_exception_grid_point = x0;
+          dirty_convergence_exception_message = interval_messages.front();
+        }
+      }
+
+      // Keep the grid points
+      else if( converged )
+      {
+        converged_grid_points.push_back( std::make_pair( x0, y0 ) );
+
+        for( size_t j = 0; j < interval_messages.size(); ++j )
+        {
+          dirty_convergence_messages.push_back(
+                               std::make_pair( x0, interval_messages[j] ) );
+        }
+      }
+
+      // The intervals above an exception do not need to be refined
+      else if( x0 < dirty_convergence_exception_grid_point )
+      {
+        refined_intervals.push_back(
+                               std::make_pair( x0, mid_grid_points[i] ) );
+        refined_intervals.push_back(
+                               std::make_pair( mid_grid_points[i], x1 ) );
+
+        refined_interval_values.push_back(
+                               std::make_pair( y0, mid_evaluated_function[i] ) );
+        refined_interval_values.push_back(
+                               std::make_pair( mid_evaluated_function[i], y1 ) );
+      }
+    }
+
+    intervals.swap( refined_intervals );
+    interval_values.swap( refined_interval_values );
+  }
+
+  TEST_FOR_EXCEPTION( !dirty_convergence_exception_message.empty(),
+                      std::runtime_error,
+                      dirty_convergence_exception_message );
+
+  // Report the warnings in the order of the sequential algorithm
+  std::stable_sort( dirty_convergence_messages.begin(),
+                    dirty_convergence_messages.end(),
+                    []( const std::pair<double,std::string>& a,
+                        const std::pair<double,std::string>& b )
+                    { return a.first < b.first; } );
+
+  for( size_t i = 0; i < dirty_convergence_messages.size(); ++i )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Grid Generator",
+                                dirty_convergence_messages[i].second );
+  }
+
+  // The converged intervals partition the initial grid so sorting their lower
+  // grid points recovers the order of the sequential algorithm
+  std::sort( converged_grid_points.begin(), converged_grid_points.end() );
+
+  for( size_t i = 0; i < converged_grid_points.size(); ++i )
+  {
+    grid.push_back( converged_grid_points[i].first );
+    evaluated_function.push_back( converged_grid_points[i].second );
+  }
+
+  last_evaluated_function = initial_evaluated_function.back();
+}
+
+// Evaluate the function at the grid points concurrently
+/*! \details Exceptions cannot propagate out of a parallel block. The first
+ * exception (in grid point order) will be rethrown, with its original type,
+ * once all of the grid points have been evaluated.
+ */
+template<typename InterpPolicy>
+template<typename Functor>
+void GridGenerator<InterpPolicy>::evaluateInParallel(
+                                   const std::vector<double>& grid_points,
+                                   std::vector<double>& evaluated_function,
+                                   const Functor& function )
+{
+  evaluated_function.resize( grid_points.size() );
+
+  std::vector<std::exception_ptr> exceptions( grid_points.size() );
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < grid_points.size(); ++i )
+  {
+    try{
+      evaluated_function[i] = function( grid_points[i] );
+    }
+    catch( ... )
+    {
+      exceptions[i] = std::current_exception();
+    }
+  }
+
+  for( size_t i = 0; i < exceptions.size(); ++i )
+  {
+    if( exceptions[i] )
+      std::rethrow_exception( exceptions[i] );
+  }
+}
+
 // Check for convergence
 template<typename InterpPolicy>
 bool GridGenerator<InterpPolicy>::hasGridConverged(
@@ -533,6 +795,49 @@ bool GridGenerator<InterpPolicy>::hasGridConverged(
                                                const double y_mid_estimated,
                                                const double y_mid_exact ) const
 
+{
+  std::vector<std::string> dirty_convergence_messages;
+
+  bool converged = this->hasGridConverged( lower_grid_point,
+                                           mid_grid_point,
+                                           upper_grid_point,
+                                           y_mid_estimated,
+                                           y_mid_exact,
+                                           dirty_convergence_messages );
+
+  if( !dirty_convergence_messages.empty() )
+  {
+    if( d_throw_exceptions )
+    {
+      THROW_EXCEPTION( std::runtime_error,
+                       dirty_convergence_messages.front() );
+    }
+    else
+    {
+      for( size_t i = 0; i < dirty_convergence_messages.size(); ++i )
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "Grid Generator",
+                                    dirty_convergence_messages[i] );
+      }
+    }
+  }
+
+  return converged;
+}
+
+// Check for convergence (the dirty convergence messages will be returned)
+/*! \details Dirty convergence is reported as convergence. The caller must
+ * decide if the dirty convergence messages should be logged as warnings or
+ * thrown as an exception.
+ */
+template<typename InterpPolicy>
+bool GridGenerator<InterpPolicy>::hasGridConverged(
+                  const double lower_grid_point,
+                  const double mid_grid_point,
+                  const double upper_grid_point,
+                  const double y_mid_estimated,
+                  const double y_mid_exact,
+                  std::vector<std::string>& dirty_convergence_messages ) const
 {
   bool converged = false;
 
@@ -556,16 +861,9 @@ bool GridGenerator<InterpPolicy>::hasGridConverged(
         << ", relError(ym,ym_exact) = relError(" << y_mid_estimated
         << "," << y_mid_exact << ") = " << relative_error;
 
-    if( d_throw_exceptions )
-    {
-      THROW_EXCEPTION( std::runtime_error, oss.str() );
-    }
-    else
-    {
-      converged = true;
+    converged = true;
 
-      FRENSIE_LOG_TAGGED_WARNING( "Grid Generator", oss.str() );
-    }
+    dirty_convergence_messages.push_back( oss.str() );
   }
 
   // Check if the absolute difference tolerance was hit - dirty convergence
@@ -579,16 +877,9 @@ bool GridGenerator<InterpPolicy>::hasGridConverged(
         << y_mid_exact << ", y_mid_estimated="
         << y_mid_estimated << ", abs_diff=" << absolute_difference;
 
-    if( d_throw_exceptions )
-    {
-      THROW_EXCEPTION( std::runtime_error, oss.str() );
-    }
-    else
-    {
-      converged = true;
+    converged = true;
 
-      FRENSIE_LOG_TAGGED_WARNING( "Grid Generator", oss.str() );
-    }
+    dirty_convergence_messages.push_back( oss.str() );
   }
 
   // Check if the convergence tolerance was hit - clean convergence
@@ -59,6 +59,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Refine the primary intervals concurrently
+  void enableParallelRefinement();
+
+  //! Refine the primary intervals sequentially (default)
+  void disableParallelRefinement();
+
+  //! Check if the primary intervals will be refined concurrently
+  bool isParallelRefinementEnabled() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
@@ -139,6 +148,18 @@ protected:
 
 private:
 
+  // Generate the primary grid from the initial primary grid (breadth-first)
+  template<typename STLCompliantContainerA,
+           typename STLCompliantContainerB,
+           typename STLCompliantContainerC,
+           typename Functor>
+  void generateAndEvaluateInParallel(
+                            const std::deque<double>& initial_primary_grid,
+                            STLCompliantContainerA& primary_grid,
+                            STLCompliantContainerB& secondary_grids,
+                            STLCompliantContainerC& evaluated_function,
+                            const Functor& function ) const;
+
   // Check for 2D grid convergence
   template<typename STLCompliantContainerA,
            typename STLCompliantContainerB,
@@ -201,6 +222,9 @@ private:
 
   // Throw exception on dirty convergence
   bool d_throw_exceptions;
+
+  // Refine the primary intervals concurrently
+  bool d_parallel_refinement;
 };
   
 } // end Utility namespace
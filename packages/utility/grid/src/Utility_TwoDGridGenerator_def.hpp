@@ -15,6 +15,8 @@
 #include <algorithm>
 #include <iterator>
 #include <sstream>
+#include <utility>
+#include <string>
 
 // FRENSIE Includes
 #include "Utility_InterpolationPolicy.hpp"
@@ -22,6 +24,8 @@
 #include "Utility_ComparisonPolicy.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_QuantityTraits.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 
@@ -38,6 +42,7 @@ TwoDGridGenerator<TwoDInterpPolicy>::TwoDGridGenerator(
     d_distance_tol( distance_tol ),
     d_verbose_mode_on( false ),
     d_throw_exceptions( false ),
+    d_parallel_refinement( false ),
     d_secondary_grid_generator( convergence_tol,
                                 absolute_diff_tol,
                                 distance_tol )
@@ -109,6 +114,39 @@ bool TwoDGridGenerator<TwoDInterpPolicy>::isExceptionThrownOnDirtyConvergence()
   return d_throw_exceptions;
 }
 
+// Refine the primary intervals concurrently
+/*! \details The primary grid will be refined breadth-first: the convergence
+ * of every primary interval that has not converged will be checked
+ * concurrently and the secondary grids at the new primary grid points will
+ * then be generated concurrently (using the number of threads requested with
+ * Utility::OpenMPProperties). Because the convergence of a primary interval
+ * only depends on the secondary grids at the interval end points and
+ * midpoint, the generated grids will be identical to the grids generated by
+ * the sequential (depth-first) algorithm. The function and the
+ * initializeSecondaryGrid method must be deterministic and safe to call from
+ * multiple threads simultaneously when this mode is enabled. The log
+ * messages that are reported while checking convergence may be interleaved.
+ */
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::enableParallelRefinement()
+{
+  d_parallel_refinement = true;
+}
+
+// Refine the primary intervals sequentially (default)
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::disableParallelRefinement()
+{
+  d_parallel_refinement = false;
+}
+
+// Check if the primary intervals will be refined concurrently
+template<typename TwoDInterpPolicy>
+bool TwoDGridGenerator<TwoDInterpPolicy>::isParallelRefinementEnabled() const
+{
+  return d_parallel_refinement;
+}
+
 // Set the convergence tolerance
 template<typename TwoDInterpPolicy>
 void TwoDGridGenerator<TwoDInterpPolicy>::setConvergenceTolerance(
@@ -245,6 +283,18 @@ void TwoDGridGenerator<TwoDInterpPolicy>::generateAndEvaluateInPlace(
   secondary_grids.clear();
   evaluated_function.clear();
 
+  // Optimize the 2D grid concurrently
+  if( d_parallel_refinement )
+  {
+    this->generateAndEvaluateInParallel( primary_grid_queue,
+                                         primary_grid,
+                                         secondary_grids,
+                                         evaluated_function,
+                                         function );
+
+    return;
+  }
+
   double primary_value_0, primary_value_1;
 
   std::vector<double> secondary_grid_0, secondary_grid_1;
@@ -432,6 +482,189 @@ void TwoDGridGenerator<TwoDInterpPolicy>::generateAndEvaluateSecondaryInPlace(
                                                   secondary_grid_function );
 }
 
+// Generate the primary grid from the initial primary grid (breadth-first)
+/*! \details Exceptions cannot propagate out of a parallel block. The first
+ * exception (in primary interval order) that occurs in a refinement sweep
+ * will be rethrown once the sweep has been completed.
+ */
+template<typename TwoDInterpPolicy>
+template<typename STLCompliantContainerA,
+         typename STLCompliantContainerB,
+         typename STLCompliantContainerC,
+         typename Functor>
+void TwoDGridGenerator<TwoDInterpPolicy>::generateAndEvaluateInParallel(
+                                const std::deque<double>& initial_primary_grid,
+                                STLCompliantContainerA& primary_grid,
+                                STLCompliantContainerB& secondary_grids,
+                                STLCompliantContainerC& evaluated_function,
+                                const Functor& function ) const
+{
+  // Make sure at least 2 initial grid points have been given
+  testPrecondition( initial_primary_grid.size() >= 2 );
+
+  typedef typename STLCompliantContainerC::value_type EvaluatedFunction;
+
+  // The primary grid points (in the order that they were generated)
+  std::vector<double> primary_values( initial_primary_grid.begin(),
+                                      initial_primary_grid.end() );
+
+  std::vector<std::vector<double> > primary_secondary_grids;
+  std::vector<EvaluatedFunction> primary_evaluated_function;
+
+  // The primary grid points that need a secondary grid
+  std::vector<size_t> new_primary_points;
+
+  for( size_t i = 0; i < primary_values.size(); ++i )
+    new_primary_points.push_back( i );
+
+  // The primary intervals that have not converged (stored as primary grid
+  // point indices and ordered by the lower primary grid point)
+  std::vector<std::pair<size_t,size_t> > intervals, refined_intervals;
+
+  for( size_t i = 1; i < primary_values.size(); ++i )
+    intervals.push_back( std::make_pair( i-1, i ) );
+
+  // The lower primary grid point of every converged interval
+  std::vector<std::pair<double,size_t> > converged_primary_points;
+
+  std::vector<std::string> error_messages;
+  std::vector<char> converged;
+
+  while( true )
+  {
+    // Generate the secondary grids at the new primary grid points
+    primary_secondary_grids.resize( primary_values.size() );
+    primary_evaluated_function.resize( primary_values.size() );
+
+    error_messages.assign( new_primary_points.size(), std::string() );
+
+    #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+    for( size_t i = 0; i < new_primary_points.size(); ++i )
+    {
+      const size_t point = new_primary_points[i];
+
+      try{
+        this->generateAndEvaluateSecondaryInPlace(
+                                         primary_secondary_grids[point],
+                                         primary_evaluated_function[point],
+                                         primary_values[point],
+                                         function );
+      }
+      catch( const std::exception& exception )
+      {
+        error_messages[i] = exception.what();
+      }
+    }
+
+    for( size_t i = 0; i < error_messages.size(); ++i )
+    {
+      TEST_FOR_EXCEPTION( !error_messages[i].empty(),
+                          std::runtime_error,
+                          "The secondary grid could not be generated at "
+                          "primary grid point "
+                          << primary_values[new_primary_points[i]] << ": "
+                          << error_messages[i] );
+    }
+
+    if( intervals.empty() )
+      break;
+
+    // Check the convergence of the primary intervals
+    error_messages.assign( intervals.size(), std::string() );
+    converged.assign( intervals.size(), false );
+
+    #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      const size_t point_0 = intervals[i].first;
+      const size_t point_1 = intervals[i].second;
+
+      try{
+        converged[i] =
+          this->hasGridConverged( primary_values[point_0],
+                                  primary_values[point_1],
+                                  primary_secondary_grids[point_0],
+                                  primary_secondary_grids[point_1],
+                                  primary_evaluated_function[point_0],
+                                  primary_evaluated_function[point_1],
+                                  function );
+      }
+      catch( const std::exception& exception )
+      {
+        error_messages[i] = exception.what();
+      }
+    }
+
+    new_primary_points.clear();
+    refined_intervals.clear();
+
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      TEST_FOR_EXCEPTION( !error_messages[i].empty(),
+                          std::runtime_error,
+                          error_messages[i] );
+
+      const size_t point_0 = intervals[i].first;
+      const size_t point_1 = intervals[i].second;
+
+      // Keep the grid points
+      if( converged[i] )
+      {
+        converged_primary_points.push_back(
+                       std::make_pair( primary_values[point_0], point_0 ) );
+      }
+      // Refine the grid
+      else
+      {
+        const size_t point_mid = primary_values.size();
+
+        primary_values.push_back(
+                    this->calculatePrimaryMidpoint( primary_values[point_0],
+                                                    primary_values[point_1] ) );
+
+        new_primary_points.push_back( point_mid );
+
+        refined_intervals.push_back( std::make_pair( point_0, point_mid ) );
+        refined_intervals.push_back( std::make_pair( point_mid, point_1 ) );
+      }
+    }
+
+    intervals.swap( refined_intervals );
+  }
+
+  // The converged intervals partition the initial primary grid so sorting
+  // their lower primary grid points recovers the order of the sequential
+  // algorithm
+  std::sort( converged_primary_points.begin(),
+             converged_primary_points.end() );
+
+  converged_primary_points.push_back(
+       std::make_pair( primary_values[initial_primary_grid.size()-1],
+                       initial_primary_grid.size()-1 ) );
+
+  for( size_t i = 0; i < converged_primary_points.size(); ++i )
+  {
+    const size_t point = converged_primary_points[i].second;
+
+    primary_grid.push_back( primary_values[point] );
+
+    secondary_grids.push_back( typename STLCompliantContainerB::value_type() );
+    secondary_grids.back().assign( primary_secondary_grids[point].begin(),
+                                   primary_secondary_grids[point].end() );
+
+    evaluated_function.push_back( primary_evaluated_function[point] );
+
+    if( i+1 < converged_primary_points.size() )
+      this->logAddedPrimaryGridPoint( primary_values[point], i );
+  }
+
+  // Make sure there is a secondary grid for every primary grid point
+  testPostcondition( primary_grid.size() == secondary_grids.size() );
+  testPostcondition( secondary_grids.size() == evaluated_function.size() );
+  // Make sure the optimized primary grid has at least 2 grid points
+  testPostcondition( primary_grid.size() >= 2 );
+}
+
 // Check for 2D grid convergence
 template<typename TwoDInterpPolicy>
 template<typename STLCompliantContainerA,
@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <string>
 #include <iostream>
+#include <stdexcept>
 
 // Boost Includes
 #include <boost/bind.hpp>
@@ -18,6 +19,7 @@
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_List.hpp"
 #include "Utility_InterpolationPolicy.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -68,6 +70,57 @@ private:
   double d_b;
 };
 
+struct steps
+{
+  steps( const double a,
+         const double b )
+    : d_a( a ),
+      d_b( b )
+  { /* ... */ }
+
+  double operator()( const double x )
+  {
+    if( x < d_a )
+      return 0.0;
+    else if( x < d_b )
+      return 1.0;
+    else
+      return 2.0;
+  }
+
+private:
+
+  double d_a;
+  double d_b;
+};
+
+struct xWithDomain
+{
+  xWithDomain( const double max_x )
+    : d_max_x( max_x )
+  { /* ... */ }
+
+  double operator()( const double x )
+  {
+    if( x > d_max_x )
+      throw std::domain_error( "x is outside of the domain" );
+
+    return x*x;
+  }
+
+private:
+
+  double d_max_x;
+};
+
+// Return the first line of an exception message
+std::string getFirstLine( const std::exception& exception )
+{
+  std::string message( exception.what() );
+
+  return message.substr( 0, message.find( '\n' ) );
+}
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -87,6 +140,23 @@ FRENSIE_UNIT_TEST( GridGenerator, dirty_convergence_handling )
   FRENSIE_CHECK( !generator.isExceptionThrownOnDirtyConvergence() );
 }
 
+//---------------------------------------------------------------------------//
+// Check if parallel refinement can be set
+FRENSIE_UNIT_TEST( GridGenerator, parallel_refinement_handling )
+{
+  Utility::GridGenerator<Utility::LinLin> generator;
+
+  FRENSIE_CHECK( !generator.isParallelRefinementEnabled() );
+
+  generator.enableParallelRefinement();
+
+  FRENSIE_CHECK( generator.isParallelRefinementEnabled() );
+
+  generator.disableParallelRefinement();
+
+  FRENSIE_CHECK( !generator.isParallelRefinementEnabled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the convergence tolerance can be set
 FRENSIE_UNIT_TEST( GridGenerator, setConvergenceTolerance )
@@ -790,6 +860,185 @@ FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace )
   FRENSIE_CHECK_EQUAL( grid.back(), initial_grid[7] );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement generates the sequential grid
+FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace_parallel )
+{
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+  Utility::GridGenerator<Utility::LinLin> linlin_generator( 0.001, 1e-12 );
+  Utility::GridGenerator<Utility::LogLin> loglin_generator( 0.001, 1e-12 );
+
+  Utility::GridGenerator<Utility::LinLin>
+    parallel_linlin_generator( 0.001, 1e-12 );
+  parallel_linlin_generator.enableParallelRefinement();
+
+  Utility::GridGenerator<Utility::LogLin>
+    parallel_loglin_generator( 0.001, 1e-12 );
+  parallel_loglin_generator.enableParallelRefinement();
+
+  // Create the initial grid
+  std::vector<double> initial_grid( 4 );
+  initial_grid[0] = -1.0;
+  initial_grid[1] = 0.0;
+  initial_grid[2] = 10.0;
+  initial_grid[3] = 20.0;
+
+  // Create a lin-lin grid for (x-2)^3
+  x3 x_cubed( 2 );
+  boost::function<double (double x)> function =
+    boost::bind<double>(x_cubed, _1);
+
+  std::vector<double> grid = initial_grid, evaluated_function;
+  std::vector<double> parallel_grid = initial_grid, parallel_evaluated_function;
+
+  linlin_generator.refineAndEvaluateInPlace( grid,
+                                             evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  parallel_linlin_generator.refineAndEvaluateInPlace(
+                                             parallel_grid,
+                                             parallel_evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid.size(), 710 );
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+
+  // Create a log-lin grid for x^2
+  initial_grid[0] = 1e-4;
+  initial_grid[1] = 1e-3;
+  grid = initial_grid;
+  parallel_grid = initial_grid;
+
+  function = &x2;
+
+  loglin_generator.refineAndEvaluateInPlace( grid,
+                                             evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  parallel_loglin_generator.refineAndEvaluateInPlace(
+                                             parallel_grid,
+                                             parallel_evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid.size(), 216 );
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+
+  // Generate a lin-lin grid for x*cos(x) with discontinuities
+  xcosxAB x_cos_x( -1, 1 );
+  function = boost::bind<double>(x_cos_x, _1);
+
+  initial_grid.resize( 7 );
+  initial_grid[0] = -2.0;
+  initial_grid[1] = -1.0 - 1e-15;
+  initial_grid[2] = -1.0;
+  initial_grid[3] = 0.0;
+  initial_grid[4] = 1.0;
+  initial_grid[5] = 1.0 + 1e-15;
+  initial_grid[6] = 2.0;
+
+  linlin_generator.generateAndEvaluate( grid,
+                                        evaluated_function,
+                                        initial_grid,
+                                        function );
+
+  parallel_linlin_generator.generateAndEvaluate( parallel_grid,
+                                                 parallel_evaluated_function,
+                                                 initial_grid,
+                                                 function );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement reports errors like the sequential
+// refinement
+FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace_parallel_errors )
+{
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+  Utility::GridGenerator<Utility::LinLin> generator;
+  generator.throwExceptionOnDirtyConvergence();
+
+  Utility::GridGenerator<Utility::LinLin> parallel_generator;
+  parallel_generator.throwExceptionOnDirtyConvergence();
+  parallel_generator.enableParallelRefinement();
+
+  // The discontinuity in the upper interval will hit the distance tolerance
+  // at a lower refinement level than the discontinuity in the lower interval
+  steps step_function( 0.3, 0.95 );
+  boost::function<double (double x)> function =
+    boost::bind<double>(step_function, _1);
+
+  std::vector<double> initial_grid( 3 );
+  initial_grid[0] = 0.0;
+  initial_grid[1] = 0.9;
+  initial_grid[2] = 1.0;
+
+  std::vector<double> grid, evaluated_function;
+
+  std::string message, parallel_message;
+
+  try{
+    generator.generateAndEvaluate( grid,
+                                   evaluated_function,
+                                   initial_grid,
+                                   function );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    message = getFirstLine( exception );
+  }
+
+  try{
+    parallel_generator.generateAndEvaluate( grid,
+                                            evaluated_function,
+                                            initial_grid,
+                                            function );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    parallel_message = getFirstLine( exception );
+  }
+
+  FRENSIE_CHECK( message.find( "distance tolerance" ) < message.size() );
+  FRENSIE_CHECK_EQUAL( parallel_message, message );
+
+  // The exception thrown by the function must not be converted
+  xWithDomain x_with_domain( 0.5 );
+  function = boost::bind<double>(x_with_domain, _1);
+
+  FRENSIE_CHECK_THROW( generator.generateAndEvaluate( grid,
+                                                      evaluated_function,
+                                                      initial_grid,
+                                                      function ),
+                       std::domain_error );
+
+  FRENSIE_CHECK_THROW(
+               parallel_generator.generateAndEvaluate( grid,
+                                                       evaluated_function,
+                                                       initial_grid,
+                                                       function ),
+               std::domain_error );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstGridGenerator.cpp
 //---------------------------------------------------------------------------//
@@ -16,6 +16,7 @@
 #include "Utility_TwoDInterpolationPolicy.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_List.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -118,6 +119,23 @@ FRENSIE_UNIT_TEST( TwoDGridGenerator, dirty_convergence_handling )
   FRENSIE_CHECK( !generator.isExceptionThrownOnDirtyConvergence() );
 }
 
+//---------------------------------------------------------------------------//
+// Check if parallel refinement can be set
+FRENSIE_UNIT_TEST( TwoDGridGenerator, parallel_refinement_handling )
+{
+  TestTwoDGridGenerator<Utility::LinLinLin> generator;
+
+  FRENSIE_CHECK( !generator.isParallelRefinementEnabled() );
+
+  generator.enableParallelRefinement();
+
+  FRENSIE_CHECK( generator.isParallelRefinementEnabled() );
+
+  generator.disableParallelRefinement();
+
+  FRENSIE_CHECK( !generator.isParallelRefinementEnabled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the convergence tolerance can be set
 FRENSIE_UNIT_TEST( TwoDGridGenerator, setConvergenceTolerance )
@@ -641,6 +659,60 @@ FRENSIE_UNIT_TEST( TwoDGridGenerator, generateAndEvaluate )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement generates the sequential grids
+FRENSIE_UNIT_TEST( TwoDGridGenerator, generateAndEvaluate_parallel )
+{
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+  TestTwoDGridGenerator<Utility::LinLinLin> linlinlin_generator;
+  linlinlin_generator.setConvergenceTolerance( 0.01 );
+
+  TestTwoDGridGenerator<Utility::LinLinLin> parallel_linlinlin_generator;
+  parallel_linlinlin_generator.setConvergenceTolerance( 0.01 );
+  parallel_linlinlin_generator.enableParallelRefinement();
+
+  std::vector<double> initial_primary_grid( 3 );
+  initial_primary_grid[0] = 0.0;
+  initial_primary_grid[1] = 10.0;
+  initial_primary_grid[2] = 20.0;
+
+  Normal normal( 5.0 );
+
+  std::vector<double> primary_grid, parallel_primary_grid;
+  std::vector<std::vector<double> > secondary_grids, parallel_secondary_grids;
+  std::vector<std::vector<double> >
+    evaluated_function, parallel_evaluated_function;
+
+  linlinlin_generator.generateAndEvaluate( primary_grid,
+                                           secondary_grids,
+                                           evaluated_function,
+                                           initial_primary_grid,
+                                           normal );
+
+  parallel_linlinlin_generator.generateAndEvaluate(
+                                               parallel_primary_grid,
+                                               parallel_secondary_grids,
+                                               parallel_evaluated_function,
+                                               initial_primary_grid,
+                                               normal );
+
+  FRENSIE_CHECK( primary_grid.size() > 3 );
+  FRENSIE_CHECK_EQUAL( parallel_primary_grid, primary_grid );
+  FRENSIE_REQUIRE_EQUAL( parallel_secondary_grids.size(),
+                         secondary_grids.size() );
+
+  for( size_t i = 0; i < secondary_grids.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( parallel_secondary_grids[i], secondary_grids[i] );
+    FRENSIE_CHECK_EQUAL( parallel_evaluated_function[i],
+                         evaluated_function[i] );
+  }
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstTwoDGridGenerator.cpp
 //---------------------------------------------------------------------------//
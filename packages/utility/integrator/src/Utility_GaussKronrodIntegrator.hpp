@@ -11,6 +11,7 @@
 
 // std Includes
 #include <queue>
+#include <algorithm>
 
 // Boost Includes
 #include <boost/numeric/odeint.hpp>
@@ -50,6 +51,62 @@ struct ExtrapolatedBinTraits
   }
 };
 
+/*! The Gauss-Kronrod bin buffers
+ * \details The bins are stored as a structure of arrays so that the bin with
+ * the largest error can be found with a single pass over contiguous memory.
+ * The abscissae and integrand values buffers hold the points of the two
+ * point rule evaluations that are done when a bin is bisected.
+ */
+template<typename T>
+struct BinBuffers
+{
+  std::vector<T> lower_limits;
+  std::vector<T> upper_limits;
+  std::vector<T> results;
+  std::vector<T> errors;
+  std::vector<T> abscissae;
+  std::vector<T> integrand_values;
+
+  //! Return the number of bins
+  size_t size() const
+  {
+    return errors.size();
+  }
+
+  //! Add a bin
+  void addBin( const BinTraits<T>& bin )
+  {
+    lower_limits.push_back( bin.lower_limit );
+    upper_limits.push_back( bin.upper_limit );
+    results.push_back( bin.result );
+    errors.push_back( bin.error );
+  }
+
+  //! Set a bin
+  void setBin( const size_t index, const BinTraits<T>& bin )
+  {
+    lower_limits[index] = bin.lower_limit;
+    upper_limits[index] = bin.upper_limit;
+    results[index] = bin.result;
+    errors[index] = bin.error;
+  }
+
+  //! Get a bin
+  void getBin( const size_t index, BinTraits<T>& bin ) const
+  {
+    bin.lower_limit = lower_limits[index];
+    bin.upper_limit = upper_limits[index];
+    bin.result = results[index];
+    bin.error = errors[index];
+  }
+
+  //! Return the index of the bin with the largest error
+  size_t getIndexOfBinWithLargestError() const
+  {
+    return std::max_element( errors.begin(), errors.end() ) - errors.begin();
+  }
+};
+
 //! The Gauss-Kronrod integrator
 template<typename T>
 class GaussKronrodIntegrator
@@ -123,6 +180,14 @@ typedef std::vector<ExtrapolatedBinTraits<T>> BinArray;
 			    T upper_limit,
 			    T& result,
 			    T& absolute_error ) const;
+  //! Integrate the function adaptively using batch integrand evaluations
+  template<int Points, typename BatchFunctor>
+  void integrateAdaptivelyBatch( BatchFunctor& integrand,
+                                 T lower_limit,
+                                 T upper_limit,
+                                 T& result,
+                                 T& absolute_error ) const;
+
 /*
   //! Integrate the function over a semi-infinite interval (+infinity)
   template<typename Functor>
@@ -193,6 +258,16 @@ typedef std::vector<ExtrapolatedBinTraits<T>> BinArray;
                 T& result_abs,
                 T& result_asc ) const;
 
+  //! Integrate the function with point rule using a batch integrand evaluation
+  template<int Points, typename BatchFunctor>
+  void integrateWithPointRuleBatch( BatchFunctor& integrand,
+                                    T lower_limit,
+                                    T upper_limit,
+                                    T& result,
+                                    T& absolute_error,
+                                    T& result_abs,
+                                    T& result_asc ) const;
+
 protected:
 
   // Calculate the quadrature upper and lower integrand values at an abscissa
@@ -237,6 +312,34 @@ protected:
     T& bin_1_asc,
     T& bin_2_asc ) const;
 
+  // Bisect and integrate the given bin interval using a batch evaluation
+  template<int Points, typename BatchFunctor>
+  void bisectAndIntegrateBinIntervalBatch(
+    BatchFunctor& integrand,
+    const BinTraits<T>& bin,
+    BinTraits<T>& bin_1,
+    BinTraits<T>& bin_2,
+    T& bin_1_asc,
+    T& bin_2_asc,
+    std::vector<T>& abscissae,
+    std::vector<T>& integrand_values ) const;
+
+  // Calculate the point rule abscissae for the integration limits
+  template<int Points>
+  void calculatePointRuleAbscissae( T lower_limit,
+                                    T upper_limit,
+                                    T* abscissae ) const;
+
+  // Calculate the point rule estimates from the integrand values
+  template<int Points>
+  void calculatePointRuleEstimates( T lower_limit,
+                                    T upper_limit,
+                                    const T* integrand_values,
+                                    T& result,
+                                    T& absolute_error,
+                                    T& result_abs,
+                                    T& result_asc ) const;
+
   // Rescale absolute error from integration
   void rescaleAbsoluteError(
     T& absolute_error,
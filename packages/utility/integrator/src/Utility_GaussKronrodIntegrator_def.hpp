@@ -997,6 +997,198 @@ void GaussKronrodIntegrator<T>::integrateAdaptively(
   result = area;
 }
 
+// Integrate the function adaptively using batch integrand evaluations
+/*! \details BatchFunctor must have
+ * operator()( const Utility::ArrayView<const T>&, const Utility::ArrayView<T>& )
+ * defined, which must evaluate the integrand at every abscissa in the first
+ * array and store the values in the second array. This function applies the
+ * same adaptive strategy as the integrateAdaptively method but the
+ * integrand is only called once for each initial point rule evaluation and
+ * once for each bisection (all 2*Points abscissae of the two new bins are
+ * evaluated in a single call). This allows the integrand to amortize its
+ * lookup costs (e.g. grid searches) over all of the abscissae and to
+ * vectorize the evaluation. The bins are stored in contiguous buffers (see
+ * Utility::BinBuffers) instead of a priority queue. When the integrand
+ * values are identical to the values returned by a scalar functor, the
+ * result will be the same as the result returned by integrateAdaptively.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateAdaptivelyBatch(
+                                                 BatchFunctor& integrand,
+                                                 T lower_limit,
+                                                 T upper_limit,
+                                                 T& result,
+                                                 T& absolute_error ) const
+{
+  BinTraits<T> bin;
+  BinBuffers<T> bin_buffers;
+
+  bin_buffers.lower_limits.reserve( d_subinterval_limit+1 );
+  bin_buffers.upper_limits.reserve( d_subinterval_limit+1 );
+  bin_buffers.results.reserve( d_subinterval_limit+1 );
+  bin_buffers.errors.reserve( d_subinterval_limit+1 );
+
+  result = 0.0;
+  bin.lower_limit = lower_limit;
+  bin.upper_limit = upper_limit;
+
+  /* perform the first integration */
+
+  T result_abs = 0.0;
+  T result_asc = 0.0;
+
+  integrateWithPointRuleBatch<Points>(
+    integrand,
+    bin.lower_limit,
+    bin.upper_limit,
+    bin.result,
+    bin.error,
+    result_abs,
+    result_asc );
+
+  bin_buffers.addBin( bin );
+
+  /* Test on accuracy */
+
+  T tolerance =
+    getMax(d_absolute_error_tol, d_relative_error_tol * fabs (bin.result));
+
+  T round_off = 50*std::numeric_limits<T>::epsilon()*result_abs;
+
+  // Check roundoff on first attempt - dirty integration
+  if ( bin.error <= round_off && bin.error > tolerance )
+  {
+    std::ostringstream oss;
+    oss.precision( 18 );
+    oss << " Cannot reach tolerance because of roundoff error on first attempt";
+
+    if ( d_throw_exceptions )
+    {
+      THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+    }
+    else
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+    }
+  }
+
+  if ( ( bin.error <= tolerance && bin.error != result_asc ) ||
+            bin.error == 0)
+    {
+      result = bin.result;
+      absolute_error = bin.error;
+
+      return;
+    }
+
+  TEST_FOR_EXCEPTION( d_subinterval_limit == 1,
+                      Utility::IntegratorException,
+                      "A maximum of one iteration was insufficient" );
+
+  // The abscissae of both bisected bins are evaluated together
+  bin_buffers.abscissae.resize( 2*Points );
+  bin_buffers.integrand_values.resize( 2*Points );
+
+  T area = bin.result;
+  absolute_error = bin.error;
+  int round_off_1 = 0;
+  int round_off_2 = 0;
+
+  int last;
+  for ( last = 1; last < d_subinterval_limit; ++last )
+  {
+    T result_asc_1 = 0.0, result_asc_2 = 0.0;
+    BinTraits<T> bin_1, bin_2;
+
+    // Get the bin with highest error
+    size_t bin_index = bin_buffers.getIndexOfBinWithLargestError();
+
+    bin_buffers.getBin( bin_index, bin );
+
+    bisectAndIntegrateBinIntervalBatch<Points>(
+      integrand,
+      bin,
+      bin_1,
+      bin_2,
+      result_asc_1,
+      result_asc_2,
+      bin_buffers.abscissae,
+      bin_buffers.integrand_values );
+
+    // Bin 1 replaces the bisected bin
+    bin_buffers.setBin( bin_index, bin_1 );
+    bin_buffers.addBin( bin_2 );
+
+    // Improve previous approximations to integral and error and test for accuracy
+    absolute_error += bin_1.error + bin_2.error - bin.error;
+    area += bin_1.result + bin_2.result - bin.result;
+
+    if ( d_estimate_roundoff )
+    {
+      // Check that the roundoff error is not too high
+      checkRoundoffError( bin,
+                          bin_1,
+                          bin_2,
+                          result_asc_1,
+                          result_asc_2,
+                          round_off_1,
+                          round_off_2,
+                          last+1 );
+    }
+
+    tolerance =
+      getMax( d_absolute_error_tol, d_relative_error_tol * fabs (area));
+
+    if ( absolute_error <= tolerance )
+      break;
+
+    // Check if the subinterval limit was hit - dirty integration
+    if ( last+1 == d_subinterval_limit )
+    {
+      std::ostringstream oss;
+      oss.precision( 18 );
+      oss << " The maximum number of subdivisions ( "
+          << d_subinterval_limit
+          << " ) were reached";
+
+      if ( d_throw_exceptions )
+      {
+        THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+      }
+      else
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+      }
+      break;
+    }
+
+    // Check if the subdivisions have gotten too small - dirty integration
+    if ( subintervalTooSmall<Points>( bin_1.lower_limit,
+                                      bin_2.lower_limit,
+                                      bin_2.upper_limit ) )
+    {
+      std::ostringstream oss;
+      oss.precision( 18 );
+      oss << " Subdivisions have become too small - "
+          << "subinterval size(lower boundary, upper boundary) =\n"
+          << "subinterval size(" << bin_1.lower_limit << ", "
+          << bin_2.upper_limit <<") = " << bin_2.upper_limit - bin_1.lower_limit;
+
+      if ( d_throw_exceptions )
+      {
+        THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+      }
+      else
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+      }
+      break;
+    }
+  }
+  result = area;
+}
+
 // Integrate a function with integrable singularities adaptively
 /*! \details Functor must have operator()( double ) defined. This function
  * applies the Gauss-Kronrod 21-point integration rule adaptively until an
@@ -2147,6 +2339,196 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
   }
 }
 
+// Integrate the function with point rule using a batch integrand evaluation
+/*! \details BatchFunctor must have
+ * operator()( const Utility::ArrayView<const T>&, const Utility::ArrayView<T>& )
+ * defined (see integrateAdaptivelyBatch). All of the Kronrod abscissae are
+ * evaluated with a single call to the integrand. The abscissae are ordered
+ * as follows: the Points/2 abscissae below the midpoint, the Points/2
+ * abscissae above the midpoint and the midpoint.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateWithPointRuleBatch(
+                                                  BatchFunctor& integrand,
+                                                  T lower_limit,
+                                                  T upper_limit,
+                                                  T& result,
+                                                  T& absolute_error,
+                                                  T& result_abs,
+                                                  T& result_asc ) const
+{
+  // Make sure the point rule is valid_rule
+  testStaticPrecondition( (GaussKronrodQuadratureSetTraits<Points,T>::valid_rule) );
+  // Make sure the integration limits are valid
+  testPrecondition( lower_limit <= upper_limit );
+
+  if( lower_limit < upper_limit )
+  {
+    std::vector<T> abscissae( Points ), integrand_values( Points );
+
+    this->calculatePointRuleAbscissae<Points>( lower_limit,
+                                               upper_limit,
+                                               abscissae.data() );
+
+    integrand( Utility::arrayViewOfConst( abscissae ),
+               Utility::arrayView( integrand_values ) );
+
+    this->calculatePointRuleEstimates<Points>( lower_limit,
+                                               upper_limit,
+                                               integrand_values.data(),
+                                               result,
+                                               absolute_error,
+                                               result_abs,
+                                               result_asc );
+  }
+  else if( lower_limit == upper_limit )
+  {
+    result = 0.0;
+    absolute_error = 0.0;
+  }
+  else // invalid limits
+  {
+    THROW_EXCEPTION( Utility::IntegratorException,
+		     "Invalid integration limits: " << lower_limit << " !< "
+		     << upper_limit << "." );
+  }
+}
+
+// Calculate the point rule abscissae for the integration limits
+/*! \details The abscissae array must store at least Points values. The
+ * abscissae below the midpoint are stored first, followed by the abscissae
+ * above the midpoint and the midpoint.
+ */
+template<typename T>
+template<int Points>
+void GaussKronrodIntegrator<T>::calculatePointRuleAbscissae(
+                                                       T lower_limit,
+                                                       T upper_limit,
+                                                       T* abscissae ) const
+{
+  // midpoint between upper and lower integration limits
+  T midpoint = ( upper_limit + lower_limit )/2.0;
+
+  // half the length between the upper and lower integration limits
+  T half_length = (upper_limit - lower_limit )/2.0;
+
+  // Get number of abscissa pairs
+  int number_of_pairs =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size() - 1;
+
+  for ( int j = 0; j < number_of_pairs; ++j )
+  {
+    T weighted_abscissa = half_length*
+      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_abscissae[j];
+
+    abscissae[j] = midpoint - weighted_abscissa;
+    abscissae[number_of_pairs+j] = midpoint + weighted_abscissa;
+  }
+
+  abscissae[2*number_of_pairs] = midpoint;
+}
+
+// Calculate the point rule estimates from the integrand values
+/*! \details The integrand values must be ordered like the abscissae returned
+ * by calculatePointRuleAbscissae. The estimates are calculated in the same
+ * order as the integrateWithPointRule method.
+ */
+template<typename T>
+template<int Points>
+void GaussKronrodIntegrator<T>::calculatePointRuleEstimates(
+                                                T lower_limit,
+                                                T upper_limit,
+                                                const T* integrand_values,
+                                                T& result,
+                                                T& absolute_error,
+                                                T& result_abs,
+                                                T& result_asc ) const
+{
+  // half the length between the upper and lower integration limits
+  T half_length = (upper_limit - lower_limit )/2.0;
+  T abs_half_length = fabs( half_length );
+
+  // Get number of Kronrod weights
+  int number_of_weights =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
+
+  const T* integrand_values_lower = integrand_values;
+  const T* integrand_values_upper = integrand_values + number_of_weights - 1;
+
+  // Estimate Kronrod and absolute value integral for all but last weight
+  T kronrod_result = 0.0;
+  result_abs = kronrod_result;
+
+  for ( int j = 0; j < number_of_weights-1; ++j )
+  {
+    T integrand_values_sum =
+      integrand_values_lower[j] + integrand_values_upper[j];
+
+    kronrod_result +=
+      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*integrand_values_sum;
+
+    result_abs += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*(
+      fabs( integrand_values_lower[j] ) + fabs( integrand_values_upper[j] ) );
+  }
+
+  // Integrand at the midpoint
+  T integrand_midpoint = integrand_values[2*(number_of_weights-1)];
+
+  // Estimate Kronrod integral for the last weight
+  T kronrod_result_last_weight = integrand_midpoint*
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1];
+
+  // Update Kronrod estimate and absolute value with last weight
+  kronrod_result += kronrod_result_last_weight;
+  result_abs += fabs( kronrod_result_last_weight );
+
+  // Calculate final integral result and absolute value
+  result = kronrod_result*half_length;
+  result_abs *= abs_half_length;
+
+  // Calculate the mean kronrod result
+  T mean_kronrod_result = kronrod_result/2.0;
+
+  // Estimate the result asc for all but the last weight
+  result_asc = 0.0;
+  for ( int j = 0; j < number_of_weights - 1; ++j )
+  {
+    result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*
+      ( fabs( integrand_values_lower[j] - mean_kronrod_result ) +
+        fabs( integrand_values_upper[j] - mean_kronrod_result ) );
+  }
+
+  // Estimate the result asc for the last weight
+  result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1]*
+    fabs( integrand_midpoint - mean_kronrod_result );
+
+  // Calculate final result acx
+  result_asc *= abs_half_length;
+
+  // Estimate Gauss integral
+  T gauss_result = 0.0;
+
+  for ( int j = 0; j < (number_of_weights-1)/2; ++j )
+  {
+    int jj = j*2 + 1;
+    gauss_result +=
+      ( integrand_values_lower[jj] + integrand_values_upper[jj] )*
+      GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[j];
+  }
+
+  // Update Gauss estimate with last weight if needed
+  if ( number_of_weights % 2 == 0 )
+  {
+    gauss_result += integrand_midpoint*
+      GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[number_of_weights/2 - 1];
+  }
+
+  // Estimate error in integral
+  absolute_error = fabs( ( kronrod_result - gauss_result ) * half_length );
+  rescaleAbsoluteError( absolute_error, result_abs, result_asc);
+}
+
 // Test if subinterval is too small
 template<typename T>
 template<int Points>
@@ -2295,6 +2677,70 @@ void GaussKronrodIntegrator<T>::bisectAndIntegrateBinInterval(
       bin_2_asc );
 };
 
+// Bisect and integrate the given bin interval using a batch evaluation
+/*! \details The abscissae of both bins are evaluated with a single call to
+ * the integrand. The abscissae and integrand values buffers must store at
+ * least 2*Points values.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::bisectAndIntegrateBinIntervalBatch(
+    BatchFunctor& integrand,
+    const BinTraits<T>& bin,
+    BinTraits<T>& bin_1,
+    BinTraits<T>& bin_2,
+    T& bin_1_asc,
+    T& bin_2_asc,
+    std::vector<T>& abscissae,
+    std::vector<T>& integrand_values ) const
+{
+  // Make sure the buffers are valid
+  testPrecondition( abscissae.size() >= 2*Points );
+  testPrecondition( integrand_values.size() >= 2*Points );
+
+  // Bisect the bin with the largest error estimate into bin 1 and bin 2
+
+  // Set bin_1
+  bin_1.lower_limit = bin.lower_limit;
+  bin_1.upper_limit = (1/2.0)  * ( bin.lower_limit + bin.upper_limit );
+
+  // Set bin 2
+  bin_2.lower_limit = bin_1.upper_limit;
+  bin_2.upper_limit = bin.upper_limit;
+
+  this->calculatePointRuleAbscissae<Points>( bin_1.lower_limit,
+                                             bin_1.upper_limit,
+                                             abscissae.data() );
+
+  this->calculatePointRuleAbscissae<Points>( bin_2.lower_limit,
+                                             bin_2.upper_limit,
+                                             abscissae.data()+Points );
+
+  // Evaluate the integrand over both bins
+  integrand( Utility::ArrayView<const T>( abscissae.data(), 2*Points ),
+             Utility::ArrayView<T>( integrand_values.data(), 2*Points ) );
+
+  T bin_1_abs, bin_2_abs;
+
+  // Integrate over bin 1
+  this->calculatePointRuleEstimates<Points>( bin_1.lower_limit,
+                                             bin_1.upper_limit,
+                                             integrand_values.data(),
+                                             bin_1.result,
+                                             bin_1.error,
+                                             bin_1_abs,
+                                             bin_1_asc );
+
+  // Integrate over bin 2
+  this->calculatePointRuleEstimates<Points>( bin_2.lower_limit,
+                                             bin_2.upper_limit,
+                                             integrand_values.data()+Points,
+                                             bin_2.result,
+                                             bin_2.error,
+                                             bin_2_abs,
+                                             bin_2_asc );
+}
+
 // return max of two variables of type T
 template<typename T>
 T GaussKronrodIntegrator<T>::getMax( T variable_1, T variable_2 ) const
@@ -276,6 +276,42 @@ double inv_sqrt_abs_x( const double x )
   return 1/sqrt(fabs(x));
 }
 
+double exp_neg_x_sin_x( const double x )
+{
+  return exp( -x )*sin( 20*x );
+}
+
+// Evaluate a scalar function on every abscissa of a batch
+template<typename Functor>
+struct BatchFunctor
+{
+  BatchFunctor( Functor functor )
+    : functor( functor ),
+      number_of_calls( 0 ),
+      number_of_evaluations( 0 )
+  { /* ... */ }
+
+  void operator()( const Utility::ArrayView<const double>& abscissae,
+                   const Utility::ArrayView<double>& integrand_values )
+  {
+    for( size_t i = 0; i < abscissae.size(); ++i )
+      integrand_values[i] = functor( abscissae[i] );
+
+    ++number_of_calls;
+    number_of_evaluations += abscissae.size();
+  }
+
+  Functor functor;
+  size_t number_of_calls;
+  size_t number_of_evaluations;
+};
+
+template<typename Functor>
+BatchFunctor<Functor> makeBatchFunctor( Functor functor )
+{
+  return BatchFunctor<Functor>( functor );
+}
+
 //---------------------------------------------------------------------------//
 // Testing Structs.
 //---------------------------------------------------------------------------//
@@ -292,6 +328,9 @@ public:
   // Allow public access to the GaussKronrodIntegrator protected member functions
   using Utility::GaussKronrodIntegrator<double>::calculateQuadratureIntegrandValuesAtAbscissa;
   using Utility::GaussKronrodIntegrator<double>::bisectAndIntegrateBinInterval;
+  using Utility::GaussKronrodIntegrator<double>::bisectAndIntegrateBinIntervalBatch;
+  using Utility::GaussKronrodIntegrator<double>::calculatePointRuleAbscissae;
+  using Utility::GaussKronrodIntegrator<double>::calculatePointRuleEstimates;
   using Utility::GaussKronrodIntegrator<double>::rescaleAbsoluteError;
   using Utility::GaussKronrodIntegrator<double>::subintervalTooSmall;
   using Utility::GaussKronrodIntegrator<double>::checkRoundoffError;
@@ -1786,6 +1825,275 @@ FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the point rule abscissae can be calculated
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, calculatePointRuleAbscissae )
+{
+  TestGaussKronrodIntegrator test_integrator( 1e-12 );
+
+  std::vector<double> abscissae( 15 );
+
+  test_integrator.calculatePointRuleAbscissae<15>( 1.0, 3.0, abscissae.data() );
+
+  const std::vector<double>& kronrod_abscissae =
+    Utility::GaussKronrodQuadratureSetTraits<15,double>::kronrod_abscissae;
+
+  for( size_t j = 0; j < 7; ++j )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( abscissae[j],
+                                     2.0 - kronrod_abscissae[j],
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( abscissae[7+j],
+                                     2.0 + kronrod_abscissae[j],
+                                     1e-15 );
+  }
+
+  FRENSIE_CHECK_EQUAL( abscissae[14], 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated over [0,1] with a batch evaluation
+FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
+                            integrateWithPointRuleBatch,
+                            TestFunctors )
+{
+  FETCH_TEMPLATE_PARAM( 0, Functor );
+
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error, result_abs, result_asc;
+  double batch_result, batch_absolute_error, batch_result_abs, batch_result_asc;
+
+  Functor functor_instance;
+
+  auto batch_functor = makeBatchFunctor( functor_instance );
+
+  gk_integrator.integrateWithPointRule<15>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleBatch<15>( batch_functor,
+                                                 0.0,
+                                                 1.0,
+                                                 batch_result,
+                                                 batch_absolute_error,
+                                                 batch_result_abs,
+                                                 batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_calls, 1 );
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_evaluations, 15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_abs, result_abs, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_asc, result_asc, 1e-15 );
+
+  gk_integrator.integrateWithPointRule<21>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleBatch<21>( batch_functor,
+                                                 0.0,
+                                                 1.0,
+                                                 batch_result,
+                                                 batch_absolute_error,
+                                                 batch_result_abs,
+                                                 batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_calls, 2 );
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_evaluations, 36 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_abs, result_abs, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_asc, result_asc, 1e-15 );
+
+  gk_integrator.integrateWithPointRule<61>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleBatch<61>( batch_functor,
+                                                 0.0,
+                                                 1.0,
+                                                 batch_result,
+                                                 batch_absolute_error,
+                                                 batch_result_abs,
+                                                 batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_calls, 3 );
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_evaluations, 97 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_abs, result_abs, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result_asc, result_asc, 1e-15 );
+
+  // Equal integration limits
+  gk_integrator.integrateWithPointRuleBatch<15>( batch_functor,
+                                                 0.5,
+                                                 0.5,
+                                                 batch_result,
+                                                 batch_absolute_error,
+                                                 batch_result_abs,
+                                                 batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_calls, 3 );
+  FRENSIE_CHECK_EQUAL( batch_result, 0.0 );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a bin can be bisected and integrated with a batch evaluation
+FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
+                            bisectAndIntegrateBinIntervalBatch,
+                            TestFunctors )
+{
+  FETCH_TEMPLATE_PARAM( 0, Functor );
+
+  TestGaussKronrodIntegrator test_integrator( 1e-12 );
+
+  Utility::BinTraits<double> bin, bin_1, bin_2, batch_bin_1, batch_bin_2;
+  bin.lower_limit = 0.0;
+  bin.upper_limit = 1.0;
+
+  double bin_1_asc, bin_2_asc, batch_bin_1_asc, batch_bin_2_asc;
+
+  Functor functor_instance;
+
+  auto batch_functor = makeBatchFunctor( functor_instance );
+
+  std::vector<double> abscissae( 2*21 ), integrand_values( 2*21 );
+
+  test_integrator.bisectAndIntegrateBinInterval<21>( functor_instance,
+                                                     bin,
+                                                     bin_1,
+                                                     bin_2,
+                                                     bin_1_asc,
+                                                     bin_2_asc );
+
+  test_integrator.bisectAndIntegrateBinIntervalBatch<21>( batch_functor,
+                                                          bin,
+                                                          batch_bin_1,
+                                                          batch_bin_2,
+                                                          batch_bin_1_asc,
+                                                          batch_bin_2_asc,
+                                                          abscissae,
+                                                          integrand_values );
+
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_calls, 1 );
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_evaluations, 42 );
+  FRENSIE_CHECK_EQUAL( batch_bin_1.lower_limit, 0.0 );
+  FRENSIE_CHECK_EQUAL( batch_bin_1.upper_limit, 0.5 );
+  FRENSIE_CHECK_EQUAL( batch_bin_2.lower_limit, 0.5 );
+  FRENSIE_CHECK_EQUAL( batch_bin_2.upper_limit, 1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_1.result, bin_1.result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_1.error, bin_1.error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_2.result, bin_2.result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_2.error, bin_2.error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_1_asc, bin_1_asc, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_bin_2_asc, bin_2_asc, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated adaptively with batch evaluations
+FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
+                            integrateAdaptivelyBatch,
+                            TestFunctors )
+{
+  FETCH_TEMPLATE_PARAM( 0, Functor );
+
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error, batch_result, batch_absolute_error;
+
+  Functor functor_instance;
+
+  auto batch_functor = makeBatchFunctor( functor_instance );
+
+  gk_integrator.integrateAdaptively<15>( functor_instance,
+                                         0.0,
+                                         1.0,
+                                         result,
+                                         absolute_error );
+
+  gk_integrator.integrateAdaptivelyBatch<15>( batch_functor,
+                                              0.0,
+                                              1.0,
+                                              batch_result,
+                                              batch_absolute_error );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Functor::getIntegratedValue(),
+                                   batch_result,
+                                   1e-12 );
+
+  gk_integrator.integrateAdaptively<61>( functor_instance,
+                                         0.0,
+                                         1.0,
+                                         result,
+                                         absolute_error );
+
+  gk_integrator.integrateAdaptivelyBatch<61>( batch_functor,
+                                              0.0,
+                                              1.0,
+                                              batch_result,
+                                              batch_absolute_error );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Functor::getIntegratedValue(),
+                                   batch_result,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an oscillating function can be integrated adaptively with
+// batch evaluations
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, integrateAdaptivelyBatch_oscillating )
+{
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error, batch_result, batch_absolute_error;
+
+  auto batch_functor = makeBatchFunctor( exp_neg_x_sin_x );
+
+  gk_integrator.integrateAdaptively<21>( exp_neg_x_sin_x,
+                                         0.0,
+                                         10.0,
+                                         result,
+                                         absolute_error );
+
+  gk_integrator.integrateAdaptivelyBatch<21>( batch_functor,
+                                              0.0,
+                                              10.0,
+                                              batch_result,
+                                              batch_absolute_error );
+
+  // One call for the initial bin and one call for each bisection
+  FRENSIE_CHECK( batch_functor.number_of_calls > 1 );
+  FRENSIE_CHECK_EQUAL( batch_functor.number_of_evaluations,
+                       21 + (batch_functor.number_of_calls-1)*42 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, result, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_absolute_error, absolute_error, 1e-12 );
+
+  // int_0^10 e^-x sin(20x) dx = 20(1-e^-10(cos(200)+sin(200)/20))/401
+  double expected_result =
+    20.0*(1.0 - exp(-10.0)*(cos(200.0) + sin(200.0)/20.0))/401.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, expected_result, 1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstGaussKronrodIntegrator.cpp
 //---------------------------------------------------------------------------//
@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstGaussKronrodIntegratorBenchmark.cpp
+//! \author Luke Kersting
+//! \brief  Gauss-Kronrod quadrature integrator scalar vs. batch benchmark.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <functional>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_GaussKronrodIntegrator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_Timer.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ArrayView.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+int number_of_integrations;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// A damped oscillating integrand
+double damped_oscillation( const double x )
+{
+  return exp( -x )*sin( 20*x )/(1.0 + x*x);
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Compare the scalar and batch adaptive integration paths
+/*! \details The integrands are type erased like the integrands that are
+ * created by the data generators (e.g. with std::bind).
+ */
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, integrateAdaptively_scalar_vs_batch )
+{
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  std::function<double(double)> scalar_integrand = damped_oscillation;
+
+  std::function<void(const Utility::ArrayView<const double>&,
+                     const Utility::ArrayView<double>&)> batch_integrand =
+    []( const Utility::ArrayView<const double>& abscissae,
+        const Utility::ArrayView<double>& integrand_values ){
+      for( size_t i = 0; i < abscissae.size(); ++i )
+        integrand_values[i] = damped_oscillation( abscissae[i] );
+    };
+
+  std::vector<double> scalar_results( number_of_integrations );
+  std::vector<double> scalar_errors( number_of_integrations );
+  std::vector<double> batch_results( number_of_integrations );
+  std::vector<double> batch_errors( number_of_integrations );
+
+  std::shared_ptr<Utility::Timer> timer =
+    Utility::OpenMPProperties::createTimer();
+
+  // Integrate over [0,x] like the data generators do for each energy
+  timer->start();
+
+  for( int i = 0; i < number_of_integrations; ++i )
+  {
+    gk_integrator.integrateAdaptively<21>( scalar_integrand,
+                                           0.0,
+                                           10.0*(i+1)/number_of_integrations,
+                                           scalar_results[i],
+                                           scalar_errors[i] );
+  }
+
+  timer->stop();
+
+  double scalar_time = timer->elapsed().count();
+
+  timer->start();
+
+  for( int i = 0; i < number_of_integrations; ++i )
+  {
+    gk_integrator.integrateAdaptivelyBatch<21>( batch_integrand,
+                                                0.0,
+                                                10.0*(i+1)/number_of_integrations,
+                                                batch_results[i],
+                                                batch_errors[i] );
+  }
+
+  timer->stop();
+
+  double batch_time = timer->elapsed().count();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_results, scalar_results, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_errors, scalar_errors, 1e-15 );
+
+  std::cout << std::endl
+            << "Integrations: " << number_of_integrations << "\n"
+            << "Scalar integration time: " << scalar_time << " s\n"
+            << "Batch integration time: " << batch_time << " s\n"
+            << "Speedup: " << scalar_time/batch_time << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "integrations",
+                                        number_of_integrations, 1000,
+                                        "Number of integrations per path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstGaussKronrodIntegratorBenchmark.cpp
+//---------------------------------------------------------------------------//
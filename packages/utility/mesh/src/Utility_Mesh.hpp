@@ -85,6 +85,12 @@ public:
   //! Determine the mesh element that contains a given point
   virtual ElementHandle whichElementIsPointIn( const double point[3] ) const = 0;
 
+  //! Get the index of a mesh element (position in the mesh element list)
+  virtual size_t getElementIndex( ElementHandle element ) const = 0;
+
+  //! Determine the index of the mesh element that contains a given point
+  virtual size_t whichElementIndexIsPointIn( const double point[3] ) const = 0;
+
   //! Determine the mesh elements that a line segment intersects
   virtual void computeTrackLengths(
               const double start_point[3],
@@ -159,8 +159,26 @@ bool StructuredHexMesh::isPointInMesh( const double point[3] ) const
   return false;
 }
 
-// Returns the index of the hex that contains a given point.
+// Returns the hex that contains a given point.
 auto StructuredHexMesh::whichElementIsPointIn( const double point[3] ) const -> ElementHandle
+{
+  return d_hex_elements[this->whichElementIndexIsPointIn( point )];
+}
+
+// Get the index of a hex element
+/*! \details The hex element handles are the hex indices. If the element is
+ * not in the mesh the number of elements will be returned.
+ */
+size_t StructuredHexMesh::getElementIndex( ElementHandle element ) const
+{
+  if( element < d_hex_elements.size() )
+    return element;
+  else
+    return d_hex_elements.size();
+}
+
+// Returns the index of the hex that contains a given point.
+size_t StructuredHexMesh::whichElementIndexIsPointIn( const double point[3] ) const
 {
   // Make sure that the point is in the mesh
   testPrecondition( this->isPointInMesh(point) );
@@ -118,6 +118,12 @@ public:
   //! Returns the index of the hex that contains a given point.
   ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
 
+  //! Get the index of a hex element
+  size_t getElementIndex( ElementHandle element ) const final override;
+
+  //! Returns the index of the hex that contains a given point.
+  size_t whichElementIndexIsPointIn( const double point[3] ) const final override;
+
   //! Returns an array of pairs of hex IDs and partial track lengths along a given line segment.
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
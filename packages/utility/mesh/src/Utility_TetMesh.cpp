@@ -99,6 +99,12 @@ public:
   //! Returns the tet that contains a given point
   ElementHandle whichElementIsPointIn( const double point[3] ) const;
 
+  //! Get the index of a tet element
+  size_t getElementIndex( ElementHandle element ) const;
+
+  //! Returns the index of the tet that contains a given point
+  size_t whichElementIndexIsPointIn( const double point[3] ) const;
+
   //! Determine the mesh elements that a line segment intersects
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
@@ -154,12 +160,15 @@ private:
   // The kd-tree for finding point in tet
   std::unique_ptr<moab::AdaptiveKDTree> d_kd_tree;
 
-  // The map of tet ids and barycentric coordinate transform matrices
-  std::unordered_map<ElementHandle,std::pair<std::array<double,9>,std::array<double,3> > >
+  // The tet barycentric coordinate transform matrices (indexed by tet index)
+  std::vector<std::pair<std::array<double,9>,std::array<double,3> > >
   d_tet_barycentric_data;
 
   // The tet element handles
   std::vector<ElementHandle> d_tets;
+
+  // The tet element handle range (used to convert handles to tet indices)
+  moab::Range d_tet_range;
 #endif // end HAVE_FRENSIE_MOAB
 };
 
@@ -168,7 +177,7 @@ const double TetMeshImpl::s_tol = 1e-6;
 
 } // end Utility namespace
 
-BOOST_CLASS_VERSION( Utility::TetMeshImpl, 0 );
+BOOST_CLASS_VERSION( Utility::TetMeshImpl, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( TetMeshImpl, Utility );
 
 namespace Utility{
@@ -216,7 +225,8 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
     d_kd_tree_root(),
     d_kd_tree( new moab::AdaptiveKDTree( d_moab_interface.get() ) ),
     d_tet_barycentric_data(),
-    d_tets()
+    d_tets(),
+    d_tet_range()
 #endif // end HAVE_FRENSIE_MOAB
 {
 #ifdef HAVE_FRENSIE_MOAB
@@ -226,6 +236,11 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
 
   this->createTetMeshset( all_tet_elements, verbose_construction );
 
+  // Cache the tet range before the kd-tree adds the surface triangles to it
+  d_tet_range = all_tet_elements;
+
+  d_tet_barycentric_data.resize( all_tet_elements.size() );
+
   // Construct the extra tet data
   for( moab::Range::const_iterator tet_handle_it = all_tet_elements.begin();
        tet_handle_it != all_tet_elements.end();
@@ -264,7 +279,7 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
 
       // Calculate barycentric matrix
       std::pair<std::array<double,9>,std::array<double,3> >&
-        tet_barycentric_data = d_tet_barycentric_data[tet_handle];
+        tet_barycentric_data = d_tet_barycentric_data[d_tets.size()-1];
       Utility::calculateBarycentricTransformMatrix(
                                            vertices[0].data(),
                                            vertices[1].data(),
@@ -570,7 +585,8 @@ bool TetMeshImpl::isPointInMesh( const double point[3] ) const
          ++tet_handle_it )
     {
       const std::pair<std::array<double,9>,std::array<double,3> >&
-        tet_barycentric_data = d_tet_barycentric_data.find( *tet_handle_it )->second;
+        tet_barycentric_data =
+        d_tet_barycentric_data[d_tet_range.index( *tet_handle_it )];
 
       if( Utility::isPointInTet( point,
                                  tet_barycentric_data.second.data(),
@@ -599,7 +615,59 @@ auto TetMesh::whichElementIsPointIn( const double point[3] ) const -> ElementHan
 }
 
 // Returns the tet that contains a given point
+/*! \details If the tet cannot be found (usually due to a tolerance issue) the
+ * returned handle will be zero.
+ */
 auto TetMeshImpl::whichElementIsPointIn( const double point[3] ) const -> ElementHandle
+{
+#ifdef HAVE_FRENSIE_MOAB
+  const size_t tet_index = this->whichElementIndexIsPointIn( point );
+
+  if( tet_index < d_tets.size() )
+    return d_tets[tet_index];
+  else
+    return 0;
+#else // HAVE_FRENSIE_MOAB
+  return 0;
+#endif // end HAVE_FRENSIE_MOAB
+}
+
+// Get the index of a tet element
+size_t TetMesh::getElementIndex( ElementHandle element ) const
+{
+  return d_impl->getElementIndex( element );
+}
+
+// Get the index of a tet element
+/*! \details The tet handles are stored in a moab::Range so the index lookup
+ * only has to search the (usually single) contiguous handle subranges. If
+ * the element is not in the mesh the number of elements will be returned.
+ */
+size_t TetMeshImpl::getElementIndex( ElementHandle element ) const
+{
+#ifdef HAVE_FRENSIE_MOAB
+  const int tet_index = d_tet_range.index( element );
+
+  if( tet_index >= 0 )
+    return tet_index;
+  else
+    return d_tets.size();
+#else
+  return 0;
+#endif // end HAVE_FRENSIE_MOAB
+}
+
+// Returns the index of the tet that contains a given point
+size_t TetMesh::whichElementIndexIsPointIn( const double point[3] ) const
+{
+  return d_impl->whichElementIndexIsPointIn( point );
+}
+
+// Returns the index of the tet that contains a given point
+/*! \details If the tet cannot be found (usually due to a tolerance issue) the
+ * number of elements will be returned.
+ */
+size_t TetMeshImpl::whichElementIndexIsPointIn( const double point[3] ) const
 {
   // Make sure that the point is in the mesh
   testPrecondition( this->isPointInMesh( point ) );
@@ -633,28 +701,30 @@ auto TetMeshImpl::whichElementIsPointIn( const double point[3] ) const -> Elemen
 
   // A tet must be found since a leaf was found - failure to find a tet
   // indicates a tolerance issue usually
-  ElementHandle element_handle = 0;
+  size_t tet_index = d_tets.size();
 
   for( moab::Range::const_iterator tet_handle_it = tets_in_leaf.begin();
        tet_handle_it != tets_in_leaf.end();
        ++tet_handle_it )
   {
+    const size_t leaf_tet_index = d_tet_range.index( *tet_handle_it );
+
     const std::pair<std::array<double,9>,std::array<double,3> >&
-      tet_barycentric_data = d_tet_barycentric_data.find( *tet_handle_it )->second;
+      tet_barycentric_data = d_tet_barycentric_data[leaf_tet_index];
 
     if( Utility::isPointInTet( point,
                                tet_barycentric_data.second.data(),
                                tet_barycentric_data.first.data(),
                                s_tol ) )
     {
-      element_handle = *tet_handle_it;
+      tet_index = leaf_tet_index;
 
       break;
     }
   }
 
   // Make sure that the tet has been found
-  if( element_handle == 0 && d_display_warnings )
+  if( tet_index == d_tets.size() && d_display_warnings )
   {
     FRENSIE_LOG_TAGGED_WARNING( "TetMesh",
                                 "The tetrahedron containing point {"
@@ -666,7 +736,7 @@ auto TetMeshImpl::whichElementIsPointIn( const double point[3] ) const -> Elemen
   // Make sure that the leaf is valid
   testPostcondition( tets_in_leaf.size() > 0 );
 
-  return element_handle;
+  return tet_index;
 #else // HAVE_FRENSIE_MOAB
   return 0;
 #endif // end HAVE_FRENSIE_MOAB
@@ -890,7 +960,16 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
 #ifdef HAVE_FRENSIE_MOAB
   ar & BOOST_SERIALIZATION_NVP( d_mesh_input_file );
   ar & BOOST_SERIALIZATION_NVP( d_display_warnings );
-  ar & BOOST_SERIALIZATION_NVP( d_tet_barycentric_data );
+
+  // Version 0 archives store the barycentric data in a tet handle map
+  std::unordered_map<ElementHandle,std::pair<std::array<double,9>,std::array<double,3> > >
+    tet_barycentric_data_map;
+
+  if( version == 0 )
+    ar & boost::serialization::make_nvp( "d_tet_barycentric_data", tet_barycentric_data_map );
+  else
+    ar & BOOST_SERIALIZATION_NVP( d_tet_barycentric_data );
+
   ar & BOOST_SERIALIZATION_NVP( d_tets );
 
   // Initialize the moab interface
@@ -901,21 +980,35 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
 
   this->createTetMeshset( all_tet_elements, false );
 
+  d_tet_range = all_tet_elements;
+
   // Initialize the kd-tree
   d_kd_tree.reset( new moab::AdaptiveKDTree( d_moab_interface.get() ) );
 
   // Reconstruct the kd-tree
   this->createKDTree( all_tet_elements, false );
 
-  // Verify that the entity handles haven't changed
-  for( auto&& cached_element_handle : d_tets )
+  // Verify that the entity handles (and their order) haven't changed
+  TEST_FOR_EXCEPTION( d_tet_range.size() != d_tets.size(),
+                      std::runtime_error,
+                      "The tet mesh cannot be loaded from the archive "
+                      "because the number of tets has changed!" );
+
+  for( size_t i = 0; i < d_tets.size(); ++i )
   {
-    TEST_FOR_EXCEPTION( all_tet_elements.find( cached_element_handle ) ==
-                        all_tet_elements.end(),
+    TEST_FOR_EXCEPTION( d_tet_range.index( d_tets[i] ) != (int)i,
                         std::runtime_error,
                         "The tet mesh cannot be loaded from the archive "
                         "because the moab::EntityHandles have changed!" );
   }
+
+  if( version == 0 )
+  {
+    d_tet_barycentric_data.resize( d_tets.size() );
+
+    for( size_t i = 0; i < d_tets.size(); ++i )
+      d_tet_barycentric_data[i] = tet_barycentric_data_map[d_tets[i]];
+  }
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -87,6 +87,12 @@ public:
   //! Returns the tet that contains a given point
   ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
 
+  //! Get the index of a tet element
+  size_t getElementIndex( ElementHandle element ) const final override;
+
+  //! Returns the index of the tet that contains a given point
+  size_t whichElementIndexIsPointIn( const double point[3] ) const final override;
+
   //! Determine the mesh elements that a line segment intersects
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
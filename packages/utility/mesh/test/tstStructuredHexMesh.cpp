@@ -251,6 +251,30 @@ FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn )
   FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn(point11), 7);
 }
 
+//---------------------------------------------------------------------------//
+// test whether or not the hex index methods work
+FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIndexIsPointIn )
+{
+  std::vector<double> x_planes( {0.0, 0.5, 1.0} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double point1[3] {0.25, 0.25, 0.25};
+  double point2[3] {0.75, 0.75, 0.25};
+  double point3[3] {1.0, 1.0, 1.0};
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIndexIsPointIn(point1), 0);
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIndexIsPointIn(point2), 3);
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIndexIsPointIn(point3), 7);
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->getElementIndex(0), 0);
+  FRENSIE_CHECK_EQUAL( hex_mesh->getElementIndex(5), 5);
+  FRENSIE_CHECK_EQUAL( hex_mesh->getElementIndex(8), 8);
+}
+
 //---------------------------------------------------------------------------//
 // test simple cases of rays not interacting with mesh and computeTrackLengths
 // returning empty arrays
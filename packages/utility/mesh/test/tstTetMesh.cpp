@@ -234,6 +234,49 @@ FRENSIE_UNIT_TEST( TetMesh, whichElementIsPointIn )
                        5764607523034234886 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the index of a tet can be returned
+FRENSIE_UNIT_TEST( TetMesh, getElementIndex )
+{
+  std::unique_ptr<Utility::Mesh> mesh( new Utility::TetMesh( tet_mesh_file_name ) );
+
+  Utility::Mesh::ElementHandleIterator element_handle_it =
+    mesh->getStartElementHandleIterator();
+
+  for( size_t i = 0; i < mesh->getNumberOfElements(); ++i, ++element_handle_it )
+  {
+    FRENSIE_CHECK_EQUAL( mesh->getElementIndex( *element_handle_it ), i );
+  }
+
+  FRENSIE_CHECK_EQUAL( mesh->getElementIndex( 0 ), 6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the index of the tet that a point falls in can be determined
+FRENSIE_UNIT_TEST( TetMesh, whichElementIndexIsPointIn )
+{
+  std::unique_ptr<Utility::Mesh> mesh( new Utility::TetMesh( tet_mesh_file_name ) );
+
+  double inside_point_1[3] = { 0.5, 0.25, 0.75 };
+  double inside_point_2[3] = { 0.75, 0.25, 0.5 };
+  double inside_point_3[3] = { 0.25, 0.5, 0.75 };
+  double inside_point_4[3] = { 0.25, 0.75, 0.5 };
+  double inside_point_5[3] = { 0.75, 0.75, 0.25 };
+  double inside_point_6[3] = { 0.5, 0.75, 0.25 };
+
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_1 ), 0 );
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_2 ), 1 );
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_3 ), 2 );
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_4 ), 3 );
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_5 ), 4 );
+  FRENSIE_CHECK_EQUAL( mesh->whichElementIndexIsPointIn( inside_point_6 ), 5 );
+
+  // The index must be consistent with the element handle
+  FRENSIE_CHECK_EQUAL( *(mesh->getStartElementHandleIterator() +
+                         mesh->whichElementIndexIsPointIn( inside_point_4 )),
+                       mesh->whichElementIsPointIn( inside_point_4 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the tracks through tets can be calculated
 FRENSIE_UNIT_TEST( TetMesh, computeTrackLengths )
@@ -552,6 +595,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( TetMesh, archive, TestArchives )
                          5764607523034234885 );
     FRENSIE_CHECK_EQUAL( concrete_tet_mesh->whichElementIsPointIn( inside_point_6 ),
                          5764607523034234886 );
+    FRENSIE_CHECK_EQUAL( concrete_tet_mesh->whichElementIndexIsPointIn( inside_point_1 ), 0 );
+    FRENSIE_CHECK_EQUAL( concrete_tet_mesh->whichElementIndexIsPointIn( inside_point_6 ), 5 );
   }
 
   {
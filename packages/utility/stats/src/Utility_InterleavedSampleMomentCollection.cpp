@@ -0,0 +1,17 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_InterleavedSampleMomentCollection.cpp
+//! \author Alex Robinson
+//! \brief  The interleaved sample moment collection class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_InterleavedSampleMomentCollection.hpp"
+
+EXPLICIT_TEMPLATE_CLASS_INST( Utility::InterleavedSampleMomentCollection<double,2,1> );
+EXPLICIT_TEMPLATE_CLASS_INST( Utility::InterleavedSampleMomentCollection<double,4,3,2,1> );
+
+//---------------------------------------------------------------------------//
+// end Utility_InterleavedSampleMomentCollection.cpp
+//---------------------------------------------------------------------------//
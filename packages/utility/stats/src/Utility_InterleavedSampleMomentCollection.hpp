@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_InterleavedSampleMomentCollection.hpp
+//! \author Alex Robinson
+//! \brief  The interleaved sample moment collection class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_HPP
+#define UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Boost Includes
+#include <boost/align/aligned_allocator.hpp>
+
+// FRENSIE Includes
+#include "Utility_SampleMomentCollection.hpp"
+
+namespace Utility{
+
+/*! The interleaved sample moment collection
+ *
+ * \details The Utility::SampleMomentCollection stores the scores of each
+ * moment in a separate array, which is ideal for reading the moments of a
+ * collection (e.g. with Utility::getCurrentScores) but requires an update of
+ * every moment array when a raw score is added. This collection stores all
+ * of the moments of a bin contiguously in a 32 byte aligned block so that
+ * adding a raw score only touches a single cache line and the moment
+ * updates can be vectorized. This collection is intended to be used as a
+ * scoring buffer for a Utility::SampleMomentCollection with the same moments
+ * (see transferCurrentScores) or as the scoring storage of the moments (see
+ * takeCurrentScores and releaseCurrentScores, which move the scores between
+ * the two layouts without keeping a second copy). Only floating point raw
+ * scores are supported.
+ */
+template<typename T, size_t... Ns>
+class InterleavedSampleMomentCollection
+{
+  // Only floating point scores can be interleaved (all moments must have
+  // the same value type)
+  static_assert( std::is_floating_point<T>::value,
+                 "Only floating point scores can be interleaved!" );
+
+  // There must be at least one moment
+  static_assert( sizeof...(Ns) > 0,
+                 "At least one moment must be stored!" );
+
+  // The alignment of the moments of a bin (bytes)
+  static constexpr size_t s_alignment = 32;
+
+public:
+
+  //! The value type
+  typedef T ValueType;
+
+  //! The number of values stored for each bin (including padding)
+  static constexpr size_t stride =
+    ((sizeof...(Ns)*sizeof(T) + s_alignment - 1)/s_alignment)*
+    (s_alignment/sizeof(T));
+
+  //! The corresponding sample moment collection type
+  typedef SampleMomentCollection<T,Ns...> CollectionType;
+
+  //! Default constructor
+  InterleavedSampleMomentCollection();
+
+  //! Constructor
+  explicit InterleavedSampleMomentCollection( const size_t i );
+
+  //! Destructor
+  ~InterleavedSampleMomentCollection()
+  { /* ... */ }
+
+  //! Clear the collection
+  void clear();
+
+  //! Reset the collection (sets all scores to zero)
+  void reset();
+
+  //! Resize the collection (the scores will be reset)
+  void resize( const size_t i );
+
+  //! Get the size of the collection
+  size_t size() const;
+
+  //! Add a raw score
+  void addRawScore( const size_t i, const T& raw_score );
+
+  //! Add raw scores to the requested bins
+  void addRawScores( const size_t* bin_indices,
+                     const T* raw_scores,
+                     const size_t number_of_scores );
+
+  //! Get the current score of a moment
+  template<size_t N>
+  const ValueType& getCurrentScore( const size_t i ) const;
+
+  //! Add the current scores to a collection and reset this collection
+  void transferCurrentScores( CollectionType& collection );
+
+  //! Copy the current scores to a collection
+  void copyCurrentScores( CollectionType& collection ) const;
+
+  //! Move the current scores of a collection into this collection
+  void takeCurrentScores( CollectionType& collection );
+
+  //! Move the current scores of this collection into a collection
+  void releaseCurrentScores( CollectionType& collection );
+
+private:
+
+  // The underlying container type
+  typedef std::vector<T,boost::alignment::aligned_allocator<T,s_alignment> >
+  ContainerType;
+
+  // Get the index of a moment in a bin block
+  template<size_t N>
+  static constexpr size_t getMomentIndex();
+
+  // Add the current scores of a moment to a collection
+  template<size_t N, size_t K>
+  void addCurrentScoresToCollection( CollectionType& collection ) const;
+
+  // Add the current scores of every moment to a collection
+  template<size_t... Ks>
+  void addCurrentScoresToCollection( CollectionType& collection,
+                                     std::index_sequence<Ks...> ) const;
+
+  // Set the current scores of a moment from a collection
+  template<size_t N, size_t K>
+  void setCurrentScoresFromCollection( const CollectionType& collection );
+
+  // Set the current scores of every moment from a collection
+  template<size_t... Ks>
+  void setCurrentScoresFromCollection( const CollectionType& collection,
+                                       std::index_sequence<Ks...> );
+
+  // The current scores (bin major)
+  ContainerType d_current_scores;
+};
+
+//! Get the desired score from the interleaved collection
+template<size_t N, typename T, size_t... Ms>
+const typename SampleMoment<N,T>::ValueType&
+getCurrentScore( const InterleavedSampleMomentCollection<T,Ms...>& collection,
+                 const size_t i );
+
+//! Get the desired moment from the interleaved collection
+template<size_t N, typename T, size_t... Ms>
+SampleMoment<N,T> getMoment(
+               const InterleavedSampleMomentCollection<T,Ms...>& collection,
+               const size_t i );
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes.
+//---------------------------------------------------------------------------//
+
+#include "Utility_InterleavedSampleMomentCollection_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_InterleavedSampleMomentCollection.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_InterleavedSampleMomentCollection_def.hpp
+//! \author Alex Robinson
+//! \brief  The interleaved sample moment collection class template definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_DEF_HPP
+#define UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_DEF_HPP
+
+// FRENSIE Includes
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// The alignment of the moments of a bin (bytes)
+template<typename T, size_t... Ns>
+constexpr size_t InterleavedSampleMomentCollection<T,Ns...>::s_alignment;
+
+// The number of values stored for each bin (including padding)
+template<typename T, size_t... Ns>
+constexpr size_t InterleavedSampleMomentCollection<T,Ns...>::stride;
+
+// Default constructor
+template<typename T, size_t... Ns>
+InterleavedSampleMomentCollection<T,Ns...>::InterleavedSampleMomentCollection()
+  : d_current_scores()
+{ /* ... */ }
+
+// Constructor
+template<typename T, size_t... Ns>
+InterleavedSampleMomentCollection<T,Ns...>::InterleavedSampleMomentCollection(
+                                                               const size_t i )
+  : d_current_scores( i*stride, QuantityTraits<T>::zero() )
+{ /* ... */ }
+
+// Clear the collection
+/*! \details The memory used by the collection will be released.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::clear()
+{
+  ContainerType().swap( d_current_scores );
+}
+
+// Reset the collection (sets all scores to zero)
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::reset()
+{
+  std::fill( d_current_scores.begin(),
+             d_current_scores.end(),
+             QuantityTraits<T>::zero() );
+}
+
+// Resize the collection (the scores will be reset)
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::resize( const size_t i )
+{
+  d_current_scores.assign( i*stride, QuantityTraits<T>::zero() );
+}
+
+// Get the size of the collection
+template<typename T, size_t... Ns>
+size_t InterleavedSampleMomentCollection<T,Ns...>::size() const
+{
+  return d_current_scores.size()/stride;
+}
+
+// Add a raw score
+/*! \details The processed scores of every moment are calculated first and
+ * then added to the bin block with a single (vectorizable) loop over the
+ * block.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::addRawScore(
+                                                         const size_t i,
+                                                         const T& raw_score )
+{
+  // Make sure the the index is valid
+  testPrecondition( i < this->size() );
+
+  alignas(s_alignment) T processed_scores[stride] =
+    {SampleMoment<Ns,T>::processRawScore( raw_score )...};
+
+  T* bin_scores = &d_current_scores[i*stride];
+
+  #pragma omp simd aligned(bin_scores: s_alignment)
+  for( size_t j = 0; j < stride; ++j )
+    bin_scores[j] += processed_scores[j];
+}
+
+// Add raw scores to the requested bins
+/*! \details The bin indices do not need to be unique - the raw scores will
+ * be added in the order that they are given.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::addRawScores(
+                                                const size_t* bin_indices,
+                                                const T* raw_scores,
+                                                const size_t number_of_scores )
+{
+  for( size_t k = 0; k < number_of_scores; ++k )
+    this->addRawScore( bin_indices[k], raw_scores[k] );
+}
+
+// Get the current score of a moment
+template<typename T, size_t... Ns>
+template<size_t N>
+inline auto InterleavedSampleMomentCollection<T,Ns...>::getCurrentScore(
+                              const size_t i ) const -> const ValueType&
+{
+  // Make sure the the index is valid
+  testPrecondition( i < this->size() );
+
+  return d_current_scores[i*stride +
+                          InterleavedSampleMomentCollection::getMomentIndex<N>()];
+}
+
+// Add the current scores to a collection and reset this collection
+/*! \details The collection must have the same size as this collection.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::transferCurrentScores(
+                                                   CollectionType& collection )
+{
+  // Make sure the collection is valid
+  testPrecondition( collection.size() == this->size() );
+
+  this->addCurrentScoresToCollection(
+                          collection,
+                          std::make_index_sequence<sizeof...(Ns)>() );
+
+  this->reset();
+}
+
+// Copy the current scores to a collection
+/*! \details The collection will be resized to the size of this collection
+ * and any scores that it stores will be overwritten.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::copyCurrentScores(
+                                             CollectionType& collection ) const
+{
+  collection.resize( this->size() );
+  collection.reset();
+
+  this->addCurrentScoresToCollection(
+                          collection,
+                          std::make_index_sequence<sizeof...(Ns)>() );
+}
+
+// Move the current scores of a collection into this collection
+/*! \details This collection will be resized to the size of the collection.
+ * The collection will be cleared (its memory will be released) so that the
+ * scores are only stored once after the move.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::takeCurrentScores(
+                                                   CollectionType& collection )
+{
+  ContainerType( collection.size()*stride, QuantityTraits<T>::zero() ).swap(
+                                                            d_current_scores );
+
+  this->setCurrentScoresFromCollection(
+                          collection,
+                          std::make_index_sequence<sizeof...(Ns)>() );
+
+  collection.clear();
+}
+
+// Move the current scores of this collection into a collection
+/*! \details The collection will be resized to the size of this collection
+ * and any scores that it stores will be overwritten. This collection will be
+ * cleared (its memory will be released) so that the scores are only stored
+ * once after the move.
+ */
+template<typename T, size_t... Ns>
+void InterleavedSampleMomentCollection<T,Ns...>::releaseCurrentScores(
+                                                   CollectionType& collection )
+{
+  this->copyCurrentScores( collection );
+
+  this->clear();
+}
+
+// Get the index of a moment in a bin block
+template<typename T, size_t... Ns>
+template<size_t N>
+constexpr size_t InterleavedSampleMomentCollection<T,Ns...>::getMomentIndex()
+{
+  const size_t moments[] = {Ns...};
+
+  size_t index = 0;
+
+  while( moments[index] != N )
+    ++index;
+
+  return index;
+}
+
+// Add the current scores of a moment to a collection
+template<typename T, size_t... Ns>
+template<size_t N, size_t K>
+void InterleavedSampleMomentCollection<T,Ns...>::addCurrentScoresToCollection(
+                                            CollectionType& collection ) const
+{
+  T* collection_scores = Utility::getCurrentScores<N>( collection );
+
+  const size_t size = this->size();
+
+  for( size_t i = 0; i < size; ++i )
+    collection_scores[i] += d_current_scores[i*stride + K];
+}
+
+// Add the current scores of every moment to a collection
+template<typename T, size_t... Ns>
+template<size_t... Ks>
+void InterleavedSampleMomentCollection<T,Ns...>::addCurrentScoresToCollection(
+                                            CollectionType& collection,
+                                            std::index_sequence<Ks...> ) const
+{
+  // The moments and the block indices are expanded together
+  const int expander[] =
+    {(this->template addCurrentScoresToCollection<Ns,Ks>( collection ), 0)...};
+
+  (void)expander;
+}
+
+// Set the current scores of a moment from a collection
+template<typename T, size_t... Ns>
+template<size_t N, size_t K>
+void InterleavedSampleMomentCollection<T,Ns...>::setCurrentScoresFromCollection(
+                                            const CollectionType& collection )
+{
+  const T* collection_scores = Utility::getCurrentScores<N>( collection );
+
+  const size_t size = this->size();
+
+  for( size_t i = 0; i < size; ++i )
+    d_current_scores[i*stride + K] = collection_scores[i];
+}
+
+// Set the current scores of every moment from a collection
+template<typename T, size_t... Ns>
+template<size_t... Ks>
+void InterleavedSampleMomentCollection<T,Ns...>::setCurrentScoresFromCollection(
+                                            const CollectionType& collection,
+                                            std::index_sequence<Ks...> )
+{
+  // The moments and the block indices are expanded together
+  const int expander[] =
+    {(this->template setCurrentScoresFromCollection<Ns,Ks>( collection ), 0)...};
+
+  (void)expander;
+}
+
+// Get the desired score from the interleaved collection
+template<size_t N, typename T, size_t... Ms>
+inline const typename SampleMoment<N,T>::ValueType&
+getCurrentScore( const InterleavedSampleMomentCollection<T,Ms...>& collection,
+                 const size_t i )
+{
+  return collection.template getCurrentScore<N>( i );
+}
+
+// Get the desired moment from the interleaved collection
+template<size_t N, typename T, size_t... Ms>
+inline SampleMoment<N,T> getMoment(
+                 const InterleavedSampleMomentCollection<T,Ms...>& collection,
+                 const size_t i )
+{
+  return SampleMoment<N,T>( collection.template getCurrentScore<N>( i ) );
+}
+
+} // end Utility namespace
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( Utility::InterleavedSampleMomentCollection<double,2,1> );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( Utility::InterleavedSampleMomentCollection<double,4,3,2,1> );
+
+#endif // end UTILITY_INTERLEAVED_SAMPLE_MOMENT_COLLECTION_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_InterleavedSampleMomentCollection_def.hpp
+//---------------------------------------------------------------------------//
@@ -260,8 +260,9 @@ template<typename T, size_t N, size_t... Ns>
 void SampleMomentCollection<T,N,Ns...>::clear()
 {
   SampleMomentCollection<T,Ns...>::clear();
-  
-  d_current_scores.clear();
+
+  // Release the memory of the scores
+  ContainerType().swap( d_current_scores );
 }
 
 // Reset the collection (sets all scores to zero)
@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstInterleavedSampleMomentCollection.cpp
+//! \author Alex Robinson
+//! \brief  The interleaved sample moment collection unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Utility_InterleavedSampleMomentCollection.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the moments of a bin fill a 32 byte block
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection, stride )
+{
+  FRENSIE_CHECK_EQUAL( (Utility::InterleavedSampleMomentCollection<double,4,3,2,1>::stride), 4 );
+  FRENSIE_CHECK_EQUAL( (Utility::InterleavedSampleMomentCollection<double,2,1>::stride), 4 );
+  FRENSIE_CHECK_EQUAL( (Utility::InterleavedSampleMomentCollection<float,4,3,2,1>::stride), 8 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the size of a collection can be returned
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection, size )
+{
+  Utility::InterleavedSampleMomentCollection<double,4,3,2,1>
+    empty_moment_collection;
+
+  FRENSIE_CHECK_EQUAL( empty_moment_collection.size(), 0 );
+
+  Utility::InterleavedSampleMomentCollection<double,4,3,2,1>
+    moment_collection( 10 );
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 10 );
+
+  moment_collection.resize( 3 );
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 3 );
+
+  moment_collection.clear();
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection, addRawScore )
+{
+  Utility::InterleavedSampleMomentCollection<double,4,3,2,1>
+    moment_collection( 3 );
+
+  moment_collection.addRawScore( 0, 10.0 );
+  moment_collection.addRawScore( 0, 10.0 );
+  moment_collection.addRawScore( 2, 2.0 );
+
+  // The bin blocks must be aligned
+  FRENSIE_CHECK_EQUAL( reinterpret_cast<std::uintptr_t>( &Utility::getCurrentScore<4>( moment_collection, 1 ) ) % 32, 0 );
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 0 ), 20.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 0 ), 200.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, 0 ), 2000.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 0 ), 20000.0 );
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 1 ), 0.0 );
+
+  FRENSIE_CHECK_EQUAL( Utility::getMoment<1>( moment_collection, 2 ).getCurrentScore(), 2.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getMoment<2>( moment_collection, 2 ).getCurrentScore(), 4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getMoment<3>( moment_collection, 2 ).getCurrentScore(), 8.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getMoment<4>( moment_collection, 2 ).getCurrentScore(), 16.0 );
+
+  moment_collection.reset();
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 3 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 2 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added to many bins at once
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection, addRawScores )
+{
+  Utility::InterleavedSampleMomentCollection<double,2,1>
+    moment_collection( 4 );
+
+  const size_t bin_indices[] = {3, 0, 3};
+  const double raw_scores[] = {1.0, 2.0, 3.0};
+
+  moment_collection.addRawScores( bin_indices, raw_scores, 3 );
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 0 ), 4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 3 ), 4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 3 ), 10.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the current scores can be transferred to a collection
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection, transferCurrentScores )
+{
+  Utility::InterleavedSampleMomentCollection<double,4,3,2,1>
+    moment_collection( 3 );
+
+  Utility::SampleMomentCollection<double,4,3,2,1> expected_collection( 3 );
+  Utility::SampleMomentCollection<double,4,3,2,1> collection( 3 );
+
+  expected_collection.addRawScore( 1.0 );
+  collection.addRawScore( 1.0 );
+
+  for( size_t i = 0; i < 10; ++i )
+  {
+    moment_collection.addRawScore( i % 3, i + 0.5 );
+    expected_collection.addRawScore( i % 3, i + 0.5 );
+  }
+
+  moment_collection.transferCurrentScores( collection );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<1>( collection, i ),
+                                     Utility::getCurrentScore<1>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<2>( collection, i ),
+                                     Utility::getCurrentScore<2>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<3>( collection, i ),
+                                     Utility::getCurrentScore<3>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<4>( collection, i ),
+                                     Utility::getCurrentScore<4>( expected_collection, i ),
+                                     1e-15 );
+
+    // The interleaved collection must be reset
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, i ), 0.0 );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, i ), 0.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the current scores can be moved between the moment layouts
+FRENSIE_UNIT_TEST( InterleavedSampleMomentCollection,
+                   take_releaseCurrentScores )
+{
+  Utility::SampleMomentCollection<double,4,3,2,1> expected_collection( 3 );
+  Utility::SampleMomentCollection<double,4,3,2,1> collection( 3 );
+
+  for( size_t i = 0; i < 10; ++i )
+  {
+    collection.addRawScore( i % 3, i + 0.5 );
+    expected_collection.addRawScore( i % 3, i + 0.5 );
+  }
+
+  Utility::InterleavedSampleMomentCollection<double,4,3,2,1>
+    moment_collection;
+
+  moment_collection.takeCurrentScores( collection );
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 3 );
+  FRENSIE_CHECK_EQUAL( collection.size(), 0 );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, i ),
+                         Utility::getCurrentScore<1>( expected_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, i ),
+                         Utility::getCurrentScore<2>( expected_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, i ),
+                         Utility::getCurrentScore<3>( expected_collection, i ) );
+    FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, i ),
+                         Utility::getCurrentScore<4>( expected_collection, i ) );
+  }
+
+  moment_collection.addRawScore( 1, 2.0 );
+  expected_collection.addRawScore( 1, 2.0 );
+
+  moment_collection.releaseCurrentScores( collection );
+
+  FRENSIE_CHECK_EQUAL( moment_collection.size(), 0 );
+  FRENSIE_REQUIRE_EQUAL( collection.size(), 3 );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<1>( collection, i ),
+                                     Utility::getCurrentScore<1>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<2>( collection, i ),
+                                     Utility::getCurrentScore<2>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<3>( collection, i ),
+                                     Utility::getCurrentScore<3>( expected_collection, i ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( Utility::getCurrentScore<4>( collection, i ),
+                                     Utility::getCurrentScore<4>( expected_collection, i ),
+                                     1e-15 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// end tstInterleavedSampleMomentCollection.cpp
+//---------------------------------------------------------------------------//